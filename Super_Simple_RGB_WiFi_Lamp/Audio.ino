@@ -0,0 +1,43 @@
+// Audio Methods
+// Audio for the visualiser streamed by a host over UDP, see AudioStream.h. The blocks are queued by the network
+// stack and taken by the visualiser once they waited for its jitter delay. While none arrive the visualiser samples
+// the ADC instead.
+
+// Listen for audio packets, which needs a network connection
+void audioInit() {
+  audioInitTime = millis();
+  audioUdp.close();
+  audioListening = WiFi.isConnected() && audioUdp.listen(AUDIO_STREAM_PORT);
+  if (audioListening) audioUdp.onPacket(onAudioPacket);
+
+  // Debug
+  Serial.println("[audioInit] - " + String(audioListening ? "Listening for audio on port " + String(AUDIO_STREAM_PORT) : "Waiting for the network"));
+}
+
+// Runs in the network stack, packets that arrive after a newer one are dropped
+void onAudioPacket(AsyncUDPPacket &_packet) {
+  AudioFrame frame;
+  uint8_t sequence;
+  if (!audioParsePacket(_packet.data(), _packet.length(), frame, sequence)) return;
+  audioStats.packets++;
+  if (sequence != 0 && audioSequence != 0 && lightingSequenceLate(sequence, audioSequence, 8)) {
+    audioStats.late++;
+    return;
+  }
+  audioSequence = sequence;
+  audioLastPacketTime = millis();
+  audioQueue.push(frame, audioLastPacketTime);
+}
+
+void handleAudio() {
+  if (!audioListening && WiFi.isConnected() && millis() - audioInitTime > 10000) audioInit();
+}
+
+// True while a host keeps sending audio
+bool audioReceiving() {
+  return audioStats.packets > 0 && millis() - audioLastPacketTime <= AUDIO_TIMEOUT;
+}
+
+String audioInfo() {
+  return String(audioReceiving() ? "receiving" : "ADC") + ", " + String(audioStats.packets) + " packets, " + String(audioStats.late) + " late, " + String(audioQueue.dropped) + " dropped";
+}
@@ -0,0 +1,111 @@
+/* AudioStream
+ *
+ * Audio for the visualiser sent by a host over UDP, so the lamp does not
+ * have to stop everything to sample its ADC. A packet carries either a
+ * block of PCM samples, which the lamp runs its FFT over, or a spectrum the
+ * host already worked out. Values are little endian:
+ *
+ *   uint8    magic       'L'
+ *   uint8    magic       'A'
+ *   uint8    version     AUDIO_STREAM_VERSION
+ *   uint8    type        see AudioStreamType
+ *   uint8    sequence    counts the packets, 0 if the sender does not
+ *   uint8    count       number of values that follow
+ *   uint16   sampleRate  of the PCM samples in Hz, 0 for a spectrum
+ *   ...      values      PCM: int16 mono samples, AUDIO_BLOCK_SIZE of them
+ *                        SPECTRUM: uint16 magnitudes from the lowest band up,
+ *                        at most AUDIO_BLOCK_SIZE / 2, on the scale of the FFT
+ *                        of the ADC (0 - about 3000)
+ *
+ * The packets wait in an AudioFrameQueue for the jitter delay, so blocks
+ * that arrive unevenly over WiFi are still shown evenly.
+ *
+ * Nothing in here depends on the Arduino core.
+*/
+
+#ifndef AudioStream_h
+#define AudioStream_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define AUDIO_STREAM_PORT       6769
+#define AUDIO_STREAM_VERSION    1
+#define AUDIO_HEADER_SIZE       8
+#define AUDIO_BLOCK_SIZE        64        // Samples per PCM block, the size of the FFT
+#define AUDIO_QUEUE_FRAMES      4         // Blocks the jitter buffer holds
+#define AUDIO_TIMEOUT           1000      // ms without packets before the visualiser falls back to the ADC
+
+enum AudioStreamType : uint8_t {
+  AUDIO_STREAM_PCM      = 1,
+  AUDIO_STREAM_SPECTRUM = 2
+};
+
+struct AudioFrame {
+  uint8_t   type;
+  uint8_t   count;
+  uint16_t  sampleRate;
+  int16_t   values[AUDIO_BLOCK_SIZE];     // Spectrum magnitudes are stored as they are, they fit 15 bits
+};
+
+// Returns false if the packet is not a valid audio packet
+inline bool audioParsePacket(const uint8_t* data, size_t length, AudioFrame& frame, uint8_t& sequence) {
+  if (length < AUDIO_HEADER_SIZE || data[0] != 'L' || data[1] != 'A' || data[2] != AUDIO_STREAM_VERSION) return false;
+  frame.type = data[3];
+  sequence = data[4];
+  frame.count = data[5];
+  frame.sampleRate = data[6] | data[7] << 8;
+  if (frame.type == AUDIO_STREAM_PCM && frame.count != AUDIO_BLOCK_SIZE) return false;
+  if (frame.type == AUDIO_STREAM_SPECTRUM && (frame.count == 0 || frame.count > AUDIO_BLOCK_SIZE / 2)) return false;
+  if (frame.type != AUDIO_STREAM_PCM && frame.type != AUDIO_STREAM_SPECTRUM) return false;
+  if (length < AUDIO_HEADER_SIZE + 2 * (size_t)frame.count) return false;
+
+  for (uint8_t i = 0; i < frame.count; i++) {
+    const uint8_t* value = data + AUDIO_HEADER_SIZE + 2 * i;
+    frame.values[i] = (int16_t)(value[0] | value[1] << 8);
+  }
+  return true;
+}
+
+/// Holds the blocks for the jitter delay. Filled by the network stack and emptied by the mode, which never run at
+/// the same time on the ESP8266.
+class AudioFrameQueue {
+public:
+  uint32_t  dropped = 0;                  // Blocks that were never shown
+
+  // Queue a block that arrived at the given time, a full queue drops its oldest
+  void push(const AudioFrame& frame, uint32_t now) {
+    if (count == AUDIO_QUEUE_FRAMES) {
+      first = (first + 1) % AUDIO_QUEUE_FRAMES;
+      count--;
+      dropped++;
+    }
+    uint8_t slot = (first + count) % AUDIO_QUEUE_FRAMES;
+    frames[slot] = frame;
+    times[slot] = now;
+    count++;
+  }
+
+  // Take the newest block that waited for the delay, older ones are skipped. Returns false if none is due.
+  bool pop(uint32_t now, uint32_t delay, AudioFrame& frame) {
+    uint8_t due = 0;
+    while (due < count && now - times[(first + due) % AUDIO_QUEUE_FRAMES] >= delay) due++;
+    if (due == 0) return false;
+    frame = frames[(first + due - 1) % AUDIO_QUEUE_FRAMES];
+    dropped += due - 1;
+    first = (first + due) % AUDIO_QUEUE_FRAMES;
+    count -= due;
+    return true;
+  }
+
+  void clear() { count = 0; }
+
+private:
+  AudioFrame  frames[AUDIO_QUEUE_FRAMES];
+  uint32_t    times[AUDIO_QUEUE_FRAMES];
+  uint8_t     first = 0;
+  uint8_t     count = 0;
+};
+
+#endif
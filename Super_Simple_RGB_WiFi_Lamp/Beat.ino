@@ -0,0 +1,88 @@
+// Beat Methods
+// The beat clock follows the tempo of the music, see BeatClock.h. It is set by tempo messages on the network, by
+// tapping the tempo on the website and by the onsets the visualiser hears. Modes with a beats parameter run their
+// cycles in beats and start them on a downbeat while a tempo is known, and fall back to their speed otherwise.
+
+// Time the beat clock is read at. The inputs are timed when they arrive, reading the clock ahead by the latency
+// makes up for the delay of the inputs and the LEDs. Lamps of a sync group lag behind by their offset.
+uint32_t beatMillis() {
+  return millis() + beatLatency - syncOffset;
+}
+
+// Position in a cycle as a fraction of 65536. The cycle lasts the given number of beats while a tempo is known, and
+// periodMs of the animation clock otherwise.
+uint16_t animationPhase(unsigned long periodMs, uint16_t beats) {
+  if (beats > 0 && beatClock.running()) return beatClock.phase(beatMillis(), beats);
+  if (periodMs == 0) return 0;
+  return (uint64_t)(animationMillis() % periodMs) * 65536 / periodMs;
+}
+
+// Number of steps taken, stepsPerBeat per beat while a tempo is known and one every stepMs otherwise
+uint32_t animationSteps(unsigned long stepMs, uint16_t stepsPerBeat) {
+  if (stepsPerBeat > 0 && beatClock.running()) return beatClock.steps(beatMillis(), stepsPerBeat);
+  return animationMillis() / (stepMs > 0 ? stepMs : 1);
+}
+
+void beatApplyConfig(JsonVariant& beatSettings) {
+  beatLatency = constrain(beatSettings["Latency"] | beatLatency, -BEAT_LATENCY_MAX, BEAT_LATENCY_MAX);
+  beatClock.beatsPerBar = constrain(beatSettings["Beats Per Bar"] | (int)beatClock.beatsPerBar, 1, 16);
+
+  // Commands, applied now and not stored
+  if (beatSettings["Tap"] | false) beatClock.tap(millis());
+  if (beatSettings["Downbeat"] | false) beatClock.downbeat(millis());
+  float tempo = beatSettings["Tempo"] | -1.0;
+  if (tempo >= 0) beatClock.setTempo(tempo * 1000, millis());
+  beatSettings.remove("Tap");
+  beatSettings.remove("Downbeat");
+  beatSettings.remove("Tempo");
+
+  // Write back the values in use
+  beatSettings["Latency"] = beatLatency;
+  beatSettings["Beats Per Bar"] = beatClock.beatsPerBar;
+}
+
+// Listen for tempo messages, which needs a network connection
+void beatInit() {
+  beatInitTime = millis();
+  beatUdp.close();
+  beatListening = WiFi.isConnected() && beatUdp.listen(BEAT_PORT);
+  if (beatListening) beatUdp.onPacket(onBeatPacket);
+
+  // Debug
+  Serial.println("[beatInit] - " + String(beatListening ? "Listening for tempo messages on port " + String(BEAT_PORT) : "Waiting for the network"));
+}
+
+// Runs in the network stack, the message is timed here and applied by handleBeat()
+void onBeatPacket(AsyncUDPPacket &_packet) {
+  BeatMessage message;
+  if (beatMessageReceived || !beatParseMessage(_packet.data(), _packet.length(), message)) return;
+  beatMessage = message;
+  beatMessageTime = millis();
+  beatMessageReceived = true;
+}
+
+void handleBeat() {
+  if (!beatListening && WiFi.isConnected() && millis() - beatInitTime > 10000) beatInit();
+
+  if (beatMessageReceived) {
+    beatClock.message(beatMessage, beatMessageTime);
+    beatMessageReceived = false;
+    beatStats.messages++;
+  }
+  beatClock.update(millis());
+}
+
+// Energy of the low frequencies of one frame of audio, onsets in it pull the beat clock
+void beatAudioFrame(float energy, float threshold) {
+  if (!beatOnsets.update(energy, threshold, millis())) return;
+  beatClock.onset(millis());
+  beatStats.onsets++;
+}
+
+String beatInfo() {
+  String latency = ", latency " + String(beatLatency) + "ms";
+  if (!beatClock.running()) return "no tempo" + latency;
+  int64_t beat = beatClock.steps(beatMillis(), 1);
+  int64_t bar = beatFloorDiv(beat, beatClock.beatsPerBar);
+  return String(beatClock.tempo() / 1000.0, 1) + " BPM from " + beatSourceName(beatClock.source()) + ", bar " + String((long)bar) + " beat " + String((long)(beat - bar * beatClock.beatsPerBar) + 1) + " of " + String(beatClock.beatsPerBar) + latency + ", " + String(beatStats.messages) + " messages, " + String(beatStats.onsets) + " onsets";
+}
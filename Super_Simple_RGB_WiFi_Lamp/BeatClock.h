@@ -0,0 +1,296 @@
+/* BeatClock
+ *
+ * Tempo and phase of the music, so modes can run in beats and bars instead
+ * of milliseconds. The clock counts beats from a downbeat in fixed point,
+ * BEAT_ONE is one beat. It is set by tempo messages from the network, by
+ * tapping the tempo and by onsets found in the audio, in that order of
+ * priority: a source is only taken over by a lower one once it has been
+ * quiet for BEAT_SOURCE_TIMEOUT. Without input the clock keeps running at
+ * the last tempo.
+ *
+ * Tempo messages are UDP packets to BEAT_PORT, sent on every beat or at
+ * least once per bar, values are little endian:
+ *
+ *   uint8    magic       'L'
+ *   uint8    magic       'B'
+ *   uint8    version     BEAT_PROTOCOL_VERSION
+ *   uint8    beat        beat of the bar the message is sent on, 0 is the downbeat
+ *   uint8    beatsPerBar
+ *   uint8    reserved
+ *   uint32   tempo       in 1/1000 BPM, 0 stops the clock
+ *
+ * A message can be held up on the way but never arrives early. The clock
+ * is moved forward to a message at once, but only slowly back, so a late
+ * message does not pull the beat. Fixed delays of the network and the LEDs
+ * are taken care of by the latency setting of the lamp.
+ *
+ * Nothing in here depends on the Arduino core.
+*/
+
+#ifndef BeatClock_h
+#define BeatClock_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define BEAT_PORT               6768
+#define BEAT_PROTOCOL_VERSION   1
+#define BEAT_MESSAGE_SIZE       10
+#define BEAT_ONE                65536     // One beat in the fixed point positions
+#define BEAT_TEMPO_MIN          20000     // Slowest tempo in 1/1000 BPM
+#define BEAT_TEMPO_MAX          300000    // Fastest tempo in 1/1000 BPM
+#define BEAT_LATENCY_MAX        1000      // Largest latency compensation in ms
+#define BEAT_SOURCE_TIMEOUT     10000     // ms before a quiet source can be taken over by a lower one
+#define BEAT_TAP_TIMEOUT        2000      // ms between taps that starts a new tempo
+#define BEAT_TAP_MIN            100       // ms between taps below which a tap is a bounce of the last one
+#define BEAT_TAPS_MAX           8         // Taps the tempo is averaged over
+#define BEAT_ONSETS_MAX         16        // Audio onsets the tempo is estimated from
+#define BEAT_PERIOD_MIN         375       // Audio tempos are folded into 80 - 160 BPM, shortest beat in ms
+#define BEAT_HISTOGRAM_BIN      5         // ms per bin of the audio tempo histogram
+#define BEAT_HISTOGRAM_BINS     (BEAT_PERIOD_MIN / BEAT_HISTOGRAM_BIN)
+
+enum BeatSource : uint8_t {
+  BEAT_SOURCE_NONE = 0,
+  BEAT_SOURCE_AUDIO,
+  BEAT_SOURCE_TAP,
+  BEAT_SOURCE_NETWORK
+};
+
+inline const char* beatSourceName(BeatSource source) {
+  switch (source) {
+    case BEAT_SOURCE_AUDIO    : return "audio";
+    case BEAT_SOURCE_TAP      : return "tap";
+    case BEAT_SOURCE_NETWORK  : return "network";
+    default                   : return "none";
+  }
+}
+
+struct BeatMessage {
+  uint8_t   beat;
+  uint8_t   beatsPerBar;
+  uint32_t  tempo;
+};
+
+// Returns false if the packet is not a tempo message
+inline bool beatParseMessage(const uint8_t* data, size_t length, BeatMessage& message) {
+  if (length < BEAT_MESSAGE_SIZE || data[0] != 'L' || data[1] != 'B' || data[2] != BEAT_PROTOCOL_VERSION) return false;
+  message.beat        = data[3];
+  message.beatsPerBar = data[4];
+  message.tempo       = (uint32_t)data[6] | (uint32_t)data[7] << 8 | (uint32_t)data[8] << 16 | (uint32_t)data[9] << 24;
+  return true;
+}
+
+// Round down, also for negative positions
+inline int64_t beatFloorDiv(int64_t value, int64_t divisor) {
+  int64_t quotient = value / divisor;
+  return (value % divisor != 0 && value < 0) ? quotient - 1 : quotient;
+}
+
+/// Finds the onsets in the energy of the low frequencies, a frame that is well above the recent average and still
+/// rising is an onset
+class BeatOnsetDetector {
+public:
+  bool update(float energy, float threshold, uint32_t now) {
+    bool onset = energy > threshold && energy > average * 1.5f && energy > previous && now - lastOnset > 200;
+    average += (energy - average) / 16;
+    previous = energy;
+    if (onset) lastOnset = now;
+    return onset;
+  }
+
+private:
+  float     average   = 0;
+  float     previous  = 0;
+  uint32_t  lastOnset = 0;
+};
+
+class BeatClock {
+public:
+  uint8_t   beatsPerBar = 4;
+
+  bool running() const { return period != 0; }
+  uint32_t tempo() const { return milliBpm; }
+  BeatSource source() const { return currentSource; }
+
+  /// Position in 1/BEAT_ONE beats, beat 0 is a downbeat
+  int64_t position(uint32_t now) const {
+    if (!period) return 0;
+    return anchorPosition + (int64_t)(int32_t)(now - anchorTime) * 1000 * BEAT_ONE / period;
+  }
+
+  /// Fraction of a cycle of the given number of beats, 0 - 65535. Cycles of whole bars start on a downbeat.
+  uint16_t phase(uint32_t now, uint16_t beatsPerCycle) const {
+    int64_t cycle = (int64_t)beatsPerCycle * BEAT_ONE;
+    int64_t offset = position(now) - beatFloorDiv(position(now), cycle) * cycle;
+    return offset * 65536 / cycle;
+  }
+
+  /// Number of steps since beat 0, with the given number of steps per beat
+  int64_t steps(uint32_t now, uint16_t perBeat) const {
+    return beatFloorDiv(position(now) * perBeat, BEAT_ONE);
+  }
+
+  /// Keep the anchor close to now, the position is only calculated for 24 days from it
+  void update(uint32_t now) {
+    if (period && now - anchorTime > 3600000UL) reanchor(now);
+  }
+
+  /// Run at the given tempo in 1/1000 BPM from now on without moving the beat, 0 stops the clock
+  void setTempo(uint32_t tempo, uint32_t now) {
+    if (!tempo) {
+      period = 0;
+      milliBpm = 0;
+      return;
+    }
+    if (tempo < BEAT_TEMPO_MIN) tempo = BEAT_TEMPO_MIN;
+    if (tempo > BEAT_TEMPO_MAX) tempo = BEAT_TEMPO_MAX;
+    reanchor(now);
+    milliBpm = tempo;
+    period = 60000000000ULL / tempo;
+  }
+
+  /// A tempo message arrived from the network
+  void message(const BeatMessage& message, uint32_t now) {
+    if (!accept(BEAT_SOURCE_NETWORK, now)) return;
+    if (message.beatsPerBar) beatsPerBar = message.beatsPerBar;
+    bool started = running();
+    if (message.tempo != milliBpm) setTempo(message.tempo, now);
+    if (!running()) return;
+
+    // The message was sent on the nearest beat with its place in the bar
+    reanchor(now);
+    int64_t bar = (int64_t)beatsPerBar * BEAT_ONE;
+    int64_t target = beatFloorDiv(anchorPosition, bar) * bar + (int64_t)(message.beat % beatsPerBar) * BEAT_ONE;
+    if (target - anchorPosition > bar / 2) target -= bar;
+    if (anchorPosition - target > bar / 2) target += bar;
+
+    // Being behind is certain, being ahead may just be a late message
+    int64_t error = target - anchorPosition;
+    anchorPosition += (!started || error > 0) ? error : error / 16;
+  }
+
+  /// The tempo was tapped, the first tap of a series is the downbeat. Taps closer than BEAT_TAP_MIN are ignored, so
+  /// the taps of a series are never at the same time.
+  void tap(uint32_t now) {
+    if (tapCount && now - taps[tapCount - 1] < BEAT_TAP_MIN) return;
+    if (tapCount && now - taps[tapCount - 1] > BEAT_TAP_TIMEOUT) {
+      tapCount = 0;
+      tapTotal = 0;
+    }
+    if (tapCount == BEAT_TAPS_MAX) {
+      for (uint8_t i = 1; i < BEAT_TAPS_MAX; i++) taps[i - 1] = taps[i];
+      tapCount--;
+    }
+    taps[tapCount++] = now;
+    tapTotal++;
+    if (tapCount < 2 || !accept(BEAT_SOURCE_TAP, now)) return;
+
+    setTempo(60000000UL * (tapCount - 1) / (now - taps[0]), now);
+    anchorTime = now;
+    anchorPosition = (int64_t)(tapTotal - 1) * BEAT_ONE;
+  }
+
+  /// The current beat is a downbeat, moves the clock by at most half a bar
+  void downbeat(uint32_t now) {
+    if (!running()) return;
+    reanchor(now);
+    int64_t bar = (int64_t)beatsPerBar * BEAT_ONE;
+    anchorPosition = beatFloorDiv(anchorPosition + bar / 2, bar) * bar;
+  }
+
+  /// An onset was found in the audio. The tempo is the most common time between onsets, onsets close to a beat pull
+  /// the beat and the tempo towards them.
+  void onset(uint32_t now) {
+    onsets[onsetNext] = now;
+    onsetNext = (onsetNext + 1) % BEAT_ONSETS_MAX;
+    if (onsetCount < BEAT_ONSETS_MAX) onsetCount++;
+
+    uint32_t beatPeriod = audioPeriod();
+    if (!beatPeriod || !accept(BEAT_SOURCE_AUDIO, now)) return;
+
+    uint32_t tempo = 960000000UL / beatPeriod;
+    if (!running() || tempo * 50 < milliBpm * 49 || tempo * 50 > milliBpm * 51) setTempo(tempo, now);
+    reanchor(now);
+    int64_t error = beatFloorDiv(anchorPosition + BEAT_ONE / 2, BEAT_ONE) * BEAT_ONE - anchorPosition;
+    if (error < BEAT_ONE / 8 && error > -BEAT_ONE / 8) {
+      anchorPosition += error / 8;
+      setTempo(milliBpm + (int64_t)milliBpm * error / BEAT_ONE / 32, now);
+    }
+  }
+
+private:
+  uint32_t    period          = 0;        // us per beat, 0 while stopped
+  uint32_t    milliBpm        = 0;
+  uint32_t    anchorTime      = 0;
+  int64_t     anchorPosition  = 0;        // Position at anchorTime
+  BeatSource  currentSource   = BEAT_SOURCE_NONE;
+  uint32_t    sourceTime      = 0;
+  uint32_t    taps[BEAT_TAPS_MAX];
+  uint8_t     tapCount        = 0;
+  uint32_t    tapTotal        = 0;        // Taps since the first of the series
+  uint32_t    onsets[BEAT_ONSETS_MAX];
+  uint8_t     onsetCount      = 0;
+  uint8_t     onsetNext       = 0;
+
+  void reanchor(uint32_t now) {
+    anchorPosition = position(now);
+    anchorTime = now;
+  }
+
+  bool accept(BeatSource source, uint32_t now) {
+    if (source < currentSource && now - sourceTime < BEAT_SOURCE_TIMEOUT) return false;
+    currentSource = source;
+    sourceTime = now;
+    return true;
+  }
+
+  // Beat period in 1/16 ms from the times between the onsets, folded into one octave. 0 while there is no clear peak.
+  uint32_t audioPeriod() const {
+    uint8_t votes[BEAT_HISTOGRAM_BINS] = { 0 };
+    for (uint8_t i = 0; i < onsetCount; i++) {
+      for (uint8_t j = 0; j < onsetCount; j++) {
+        uint32_t interval = fold(onsets[i] - onsets[j]);
+        if (interval) votes[(interval / 16 - BEAT_PERIOD_MIN) / BEAT_HISTOGRAM_BIN]++;
+      }
+    }
+
+    uint8_t best = 0;
+    uint16_t bestVotes = 0;
+    for (uint8_t bin = 0; bin < BEAT_HISTOGRAM_BINS; bin++) {
+      uint16_t binVotes = votes[bin] + (bin ? votes[bin - 1] : 0) + (bin + 1 < BEAT_HISTOGRAM_BINS ? votes[bin + 1] : 0);
+      if (binVotes > bestVotes) {
+        best = bin;
+        bestVotes = binVotes;
+      }
+    }
+    if (bestVotes < 6) return 0;
+
+    // Average the intervals around the peak
+    uint32_t sum = 0;
+    uint16_t count = 0;
+    for (uint8_t i = 0; i < onsetCount; i++) {
+      for (uint8_t j = 0; j < onsetCount; j++) {
+        uint32_t interval = fold(onsets[i] - onsets[j]);
+        int bin = interval ? (int)((interval / 16 - BEAT_PERIOD_MIN) / BEAT_HISTOGRAM_BIN) : -10;
+        if (bin >= best - 1 && bin <= best + 1) {
+          sum += interval;
+          count++;
+        }
+      }
+    }
+    return sum / count;
+  }
+
+  // Interval between two onsets in ms folded into BEAT_PERIOD_MIN - 2 * BEAT_PERIOD_MIN, returned in 1/16 ms so the
+  // halving does not round. 0 if it is too short or too long.
+  static uint32_t fold(uint32_t interval) {
+    if (interval < 250 || interval > 3000) return 0;
+    uint32_t beats = 1;
+    interval *= 16;
+    while (interval >= 2 * BEAT_PERIOD_MIN * 16 * beats) beats *= 2;
+    if (interval < BEAT_PERIOD_MIN * 16) interval *= 2;
+    return (interval + beats / 2) / beats;
+  }
+};
+
+#endif
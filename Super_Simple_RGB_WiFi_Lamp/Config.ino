@@ -1,4 +1,5 @@
-// Check if the flash size set in the IDE is the same as the onboard chip
+// Check if the flash size set in the IDE is the same as the onboard chip and mount the file system. This is the only
+// place the file system is mounted, everything else relies on fileSystemMounted.
 bool checkFlashConfig() {
   //  Set bool pesimistically 
   bool flashSizeCorrect = false;
@@ -9,20 +10,20 @@ bool checkFlashConfig() {
 
   // Compare the two
   if (realSize >= ideSize) {
-    // Get info about the SPIFFS
-    if (SPIFFS.begin()) {
+    // Get info about the file system
+    if (mountFileSystem()) {
       FSInfo fs_info;
-      SPIFFS.info(fs_info);
+      fileSystem.info(fs_info);
       if (fs_info.totalBytes != 0) {
         // Change the boolean to true if the config is ok
         flashSizeCorrect = true;
       }
       else {
-        Serial.println("[checkFlashConfig] - SPIFFS size was set to 0, please select a SPIFFS size from the \"tools->flash size:\" menu");
+        Serial.println("[checkFlashConfig] - File system size was set to 0, please select a file system size from the \"tools->flash size:\" menu");
       }
     }
     else {
-      Serial.println("[checkFlashConfig] - SPIFFS size was set to 0, please select a SPIFFS size from the \"tools->flash size:\" menu");
+      Serial.println("[checkFlashConfig] - File system size was set to 0, please select a file system size from the \"tools->flash size:\" menu");
     }
   }
   else {
@@ -34,38 +35,66 @@ bool checkFlashConfig() {
   return flashSizeCorrect;
 }
 
+bool mountFileSystem() {
+#ifdef USE_LITTLEFS
+  // Do not let LittleFS format the flash before the SPIFFS contents had a chance to move over
+  LittleFSConfig fileSystemConfig;
+  fileSystemConfig.setAutoFormat(false);
+  LittleFS.setConfig(fileSystemConfig);
+  if (LittleFS.begin()) return true;
+  return migrateSpiffsToLittleFS();
+#else
+  return SPIFFS.begin();
+#endif
+}
+
+#ifdef USE_LITTLEFS
+// Keep the settings of an older version of this sketch when moving from SPIFFS to LittleFS. Both use the same part
+// of the flash, so the files are held in RAM while the flash is formatted. They are only a few kB.
+bool migrateSpiffsToLittleFS() {
+  std::map<String, std::vector<uint8_t>> files;
+  if (SPIFFS.begin()) {
+    Dir dir = SPIFFS.openDir("/");
+    while (dir.next()) {
+      File file = dir.openFile("r");
+      if (file && file.size() <= 8192) {
+        std::vector<uint8_t>& contents = files[dir.fileName()];
+        contents.resize(file.size());
+        file.read(contents.data(), contents.size());
+      }
+      file.close();
+    }
+    SPIFFS.end();
+  }
+
+  // Debug
+  Serial.println("[migrateSpiffsToLittleFS] - Formatting the flash for LittleFS, keeping " + String(files.size()) + " files");
+
+  if (!LittleFS.format() || !LittleFS.begin()) return false;
+  for (auto it = files.begin(); it != files.end(); it++) {
+    File file = LittleFS.open(it->first, "w");
+    if (file) {
+      file.write(it->second.data(), it->second.size());
+      file.close();
+    }
+    else Serial.println("[migrateSpiffsToLittleFS] - Failed to copy " + it->first);
+  }
+
+  return true;
+}
+#endif
+
 // Get the config file from the flash chip
 void getConfig() {
-  // Check if flash is configured correctly
-  if (checkFlashConfig()) {
-    // Mount the file system
-    if (SPIFFS.begin()) {
-      // Check if the file exists
-      if (SPIFFS.exists("/DeviceConfig.json")) {
-        // Open file in read only mode and check if it opened correctly
-        File deviceConfigFile = SPIFFS.open("/DeviceConfig.json", "r");
-        if (deviceConfigFile) {
-          // Get size of file and allocate memory
-          size_t size = deviceConfigFile.size();
-          char filebuffer[size];
-          deviceConfigFile.readBytes(filebuffer, size);
-
-          // Create JSON buffer and parse file
-          DynamicJsonDocument jsonDocument(1024); 
-          DeserializationError jsonError = deserializeJson(jsonDocument, filebuffer);
-
-          // Check if file parsed correctly and decode
-          if (!jsonError) {
-            parseConfig(jsonDocument);
-          }
-          else {
-            Serial.print("[getConfig] - deserializeJson() failed: ");
-            Serial.println(jsonError.c_str());
-          }
-        }
-        else {
-          Serial.println("[getConfig] - Failed to open device config file");
-        }
+  // Check if flash is configured correctly, this was already checked in setup()
+  if (fileSystemMounted) {
+    // Read the file into the config held in RAM
+    if (loadDeviceConfig()) {
+      if (deviceConfig.size() > 0) {
+        // Apply a copy, parseConfig() merges it back
+        DynamicJsonDocument jsonDocument(DEVICE_CONFIG_SIZE);
+        jsonDocument.set(deviceConfig);
+        parseConfig(jsonDocument);
       }
       else {
         // Create a new config file if none exists and pre populate
@@ -79,129 +108,256 @@ void getConfig() {
         saveConfigItem(jsonDocument);
       }
     }
-    else Serial.println("[getConfig] - Failed to mount FS");
   }
   else Serial.println("[getConfig] - Could not get parameters due to incorrect IDE flash settings");
 }
 
-bool sendConfigViaWS() {
-    // Check if flash is configured correctly
-  if (checkFlashConfig()) {
-    // Mount the file system
-    if (SPIFFS.begin()) {
-      // Check if the file exists
-      if (SPIFFS.exists("/DeviceConfig.json")) {
-        // Open file in read only mode and check if it opened correctly
-        File deviceConfigFile = SPIFFS.open("/DeviceConfig.json", "r");
-        if (deviceConfigFile) {
-          // Get size of file and allocate memory
-          size_t size = deviceConfigFile.size();
-          char filebuffer[size];
-          deviceConfigFile.readBytes(filebuffer, size);
-
-          // Parse the file
-          DynamicJsonDocument jsonDocument(1024); 
-          DeserializationError jsonError = deserializeJson(jsonDocument, filebuffer);
-
-          // Check if file parsed correctly and decode
-          if (!jsonError) {
-            parseConfig(jsonDocument);
-            addLampInfo(jsonDocument);
-
-            // Send the updated config back to the clients via websocket
-            websocketSend(jsonDocument);
-
-            return true;
-          }
-          else {
-            Serial.print("[getConfigAsDocument] - deserializeJson() failed: ");
-            Serial.println(jsonError.c_str());
-          }
-        }
-        else Serial.println("[getConfigAsDocument] - Failed to open device config file");
+// Read /DeviceConfig.json into the config held in RAM, only done once. A missing file leaves it empty.
+bool loadDeviceConfig() {
+  if (deviceConfigLoaded) return true;
+  if (!fileSystemMounted) return false;
+
+  recoverFile(fileSystem, "/DeviceConfig.json", "/DeviceConfig.tmp");
+
+  deviceConfig.clear();
+  if (fileSystem.exists("/DeviceConfig.json")) {
+    // Open file in read only mode and parse it straight from the file
+    File deviceConfigFile = fileSystem.open("/DeviceConfig.json", "r");
+    if (deviceConfigFile) {
+      DeserializationError jsonError = deserializeJson(deviceConfig, deviceConfigFile);
+      deviceConfigFile.close();
+      if (jsonError) {
+        Serial.print("[loadDeviceConfig] - deserializeJson() failed: ");
+        Serial.println(jsonError.c_str());
+        deviceConfig.clear();
       }
-      else Serial.println("[getConfigAsDocument] - Device config file does not exist");
     }
-    else Serial.println("[getConfigAsDocument] - Failed to mount FS");
+    else {
+      Serial.println("[loadDeviceConfig] - Failed to open device config file");
+      return false;
+    }
   }
-  else Serial.println("[getConfigAsDocument] - Could not get parameters due to incorrect IDE flash settings");
 
-  return false;
+  deviceConfigLoaded = true;
+  return true;
+}
+
+// Send the state of the lamp to a newly connected client. The state is serialized once and kept until it changes,
+// see invalidateClientState(), so connecting clients cost no flash access or JSON work. Called from the loop, the
+// message is written member by member into the frame buffer and the static scratch document is borrowed for the
+// parts that have to be built, so no documents are allocated.
+bool sendConfigViaWS(uint8_t num) {
+  if (!clientStateValid) {
+    if (!loadDeviceConfig()) return false;
+
+    // The config held in RAM is in line with the lamp apart from the mode and state, which the realtime frames
+    // change without storing them. The credentials are never sent.
+    char* payload = websocketPayload();
+    size_t length = 1;
+    payload[0] = '{';
+    bool fits = true;
+    for (auto kvp : deviceConfig.as<JsonObjectConst>()) {
+      const char* key = kvp.key().c_str();
+      auto modeIter = modes.find(key);
+      if (!strcmp(key, "Wifi") || !strcmp(key, "Mode") || !strcmp(key, "State")) continue;
+      if (modeIter != modes.end() && modeIter->second->countParameters()) continue;
+      fits = fits && websocketAppendMember(length, key, kvp.value());
+    }
+
+    // The stored mode settings only hold what was ever changed, send all values
+    for (auto it = modes.begin(); it != modes.end() && fits; it++) {
+      if (!it->second->countParameters()) continue;
+      configScratch.set(deviceConfig[it->first]);
+      JsonObject settings = configScratch.as<JsonObject>();
+      if (settings.isNull()) settings = configScratch.to<JsonObject>();
+      it->second->addConfig(settings);
+      fits = websocketAppendMember(length, it->first.c_str(), configScratch.as<JsonVariantConst>());
+    }
+
+    // The sequence number tells the client which state patch comes next
+    configScratch.clear();
+    configScratch["Mode"] = Mode.c_str();
+    configScratch["State"] = State;
+    configScratch["Seq"] = stateSeq;
+    configScratch["Full"] = true;
+    presetAddNames(configScratch);
+    for (auto kvp : configScratch.as<JsonObjectConst>()) {
+      fits = fits && websocketAppendMember(length, kvp.key().c_str(), kvp.value());
+    }
+    configScratch.clear();
+    if (!fits) return false;
+    payload[length++] = '}';
+
+    clientState.assign(payload, payload + length);
+    clientStateValid = true;
+  }
+  if (websocketCanSend(num)) websocketClient(num)->text((const char*)clientState.data(), clientState.size());
+
+  // The lamp info changes all the time, it is not part of the cached state
+  addLampInfo(configScratch);
+  websocketSendTo(num, configScratch);
+  configScratch.clear();
+
+  return true;
+}
+
+// Drop the cached state, called whenever the config or the preset list changes
+void invalidateClientState() {
+  clientStateValid = false;
+  std::vector<uint8_t>().swap(clientState);
 }
 
-// Save a specific config item parsed to JSON
+// Send the parameter tables of the modes, the website builds the controls of the modes from them. One message is
+// sent per mode, streamed into the frame buffer one small document per parameter.
+void sendParametersViaWS(uint8_t num) {
+  char* payload = websocketPayload();
+  for (auto it = modes.begin(); it != modes.end(); it++) {
+    uint8_t parameterCount = it->second->countParameters();
+    if (!parameterCount) continue;
+
+    size_t length = snprintf(payload, WEBSOCKET_FRAME_SIZE, "{\"Parameters\":{\"%s\":[", it->first.c_str());
+    for (uint8_t i = 0; i < parameterCount; i++) {
+      StaticJsonDocument<JSON_OBJECT_SIZE(9)> entry;
+      it->second->addParameterInfo(entry.to<JsonObject>(), i);
+
+      // Keep room for the separator and the closing brackets
+      if (length + measureJson(entry) + 4 >= WEBSOCKET_FRAME_SIZE) {
+        websocketFrameOverflows++;
+        Serial.println("[sendParametersViaWS] - Parameters of " + it->first + " do not fit the frame, dropped");
+        length = 0;
+        break;
+      }
+      if (i) payload[length++] = ',';
+      length += serializeJson(entry, payload + length, WEBSOCKET_FRAME_SIZE - length);
+    }
+    if (!length) continue;
+    length += strlcpy(payload + length, "]}}", WEBSOCKET_FRAME_SIZE - length);
+    websocketSendFrameTo(num, length);
+  }
+}
+
+// Save a specific config item parsed to JSON. Only the config held in RAM is changed here, it is written to
+// the flash by handleConfigWrite() once the changes have stopped for a moment.
 void saveConfigItem(JsonDocument& jsonSetting) {
   // Debug
   // Serial.print("[saveConfigItem] - Incoming Document is: ");
   // serializeJson(jsonSetting, Serial);
   // Serial.println();
 
-  // Check if the flash is configured correctly
-  if (checkFlashConfig()) {
-    // Mount the file system
-    if (SPIFFS.begin()) {
-      // Start a json buffer
-      String stringBuffer;
-      DynamicJsonDocument currentjsonDocument(1024); 
-      File deviceConfigFile;
-
-      // Read the contents of the current file
-      if (SPIFFS.exists("/DeviceConfig.json")) {
-        deviceConfigFile = SPIFFS.open("/DeviceConfig.json", "r");
-        if (deviceConfigFile) {
-          // Get size of file and allocate memory
-          size_t size = deviceConfigFile.size();
-          char filebuffer[size];
-          deviceConfigFile.readBytes(filebuffer, size);
-
-          // Create JSON buffer and parse file
-          DeserializationError jsonError = deserializeJson(currentjsonDocument, filebuffer);
-          if (!jsonError) {
-            serializeJson(currentjsonDocument, stringBuffer);
-            // Serial.print("Stored Document is currently: ");
-            // serializeJson(currentjsonDocument, Serial);
-            // Serial.println();
-          }
-          else {
-            Serial.print(F("[saveConfigItem] - Deserialize Json failed: "));
-            Serial.println(jsonError.c_str());
-          }
-
-          // Close the file for reading
-          deviceConfigFile.close();
-        }
-      }
-      else Serial.println("[saveConfigItem] - No Device Config file found");
-
-      // Modify and write the updated contents back to file
-      deviceConfigFile = SPIFFS.open("/DeviceConfig.json", "w");
-      if (deviceConfigFile) {
-        // Deserilise json from string
-        if (stringBuffer != "") DeserializationError jsonError = deserializeJson(currentjsonDocument, stringBuffer);
-
-        // Put all keys from the new object into the old settings object - will overide existing values
-        for (auto kvp : jsonSetting.as<JsonObject>()) { 
-          currentjsonDocument[kvp.key()] = kvp.value();
-        }
-
-        // Debug
-        // Serial.print("[saveConfigItem] - Stored Document is now: ");
-        // serializeJson(currentjsonDocument, Serial);
-        // Serial.println();
-
-        // Print updated object to file and close
-        serializeJson(currentjsonDocument, deviceConfigFile);
-        deviceConfigFile.close();
-      }
+  if (!loadDeviceConfig()) return;
+
+  // Merge the new settings into a copy of the current settings - will overide existing values. Copying also drops
+  // the memory of replaced values, which the document would otherwise never free. The copy is made in the static
+  // scratch document, so no memory is allocated.
+  configScratch.set(deviceConfig);
+  JsonObject updatedConfig = configScratch.as<JsonObject>();
+  if (updatedConfig.isNull()) updatedConfig = configScratch.to<JsonObject>();
+  mergeConfig(updatedConfig, jsonSetting.as<JsonObjectConst>());
+  jsonArenaMeasure(configScratch, jsonArenaStats.configPeak, false, "saveConfigItem");
+
+  // Only mark the config as changed if it really did
+  if (configScratch.as<JsonVariantConst>() != deviceConfig.as<JsonVariantConst>()) {
+    // Collect the changes for the clients, see handleStatePatch()
+    JsonObject patch = statePatch.as<JsonObject>();
+    if (patch.isNull()) patch = statePatch.to<JsonObject>();
+    addConfigChanges(patch, configScratch.as<JsonObjectConst>(), deviceConfig.as<JsonObjectConst>());
+    patch.remove("Wifi");
+    if (jsonArenaMeasure(statePatch, jsonArenaStats.patchPeak, false, "saveConfigItem")) statePatchOverflow = true;
+
+    deviceConfig = configScratch;
+    deviceConfigDirty = true;
+    deviceConfigChangeTime = millis();
+    invalidateClientState();
+  }
+  configScratch.clear();
+}
 
-      // Debug
-      // Serial.println("[saveConfigItem] - Device config saved");
+// Copy all keys of source into target, nested objects are merged so messages only need to hold the changed values
+void mergeConfig(JsonObject target, JsonObjectConst source) {
+  for (auto kvp : source) {
+    JsonObjectConst sourceObject = kvp.value().as<JsonObjectConst>();
+    JsonObject targetObject = target[kvp.key()].as<JsonObject>();
+    if (!sourceObject.isNull() && !targetObject.isNull()) mergeConfig(targetObject, sourceObject);
+    else copyConfigValue(target.getOrAddMember((char*)kvp.key().c_str()), kvp.value());
+  }
+}
+
+// Add the values of after that differ from before to patch, nested objects only with their changed keys
+void addConfigChanges(JsonObject patch, JsonObjectConst after, JsonObjectConst before) {
+  for (auto kvp : after) {
+    JsonVariantConst previous = before[kvp.key()];
+    if (previous == kvp.value()) continue;
+
+    JsonObjectConst afterObject = kvp.value().as<JsonObjectConst>();
+    JsonObjectConst beforeObject = previous.as<JsonObjectConst>();
+    JsonObject patchObject = patch[kvp.key()].as<JsonObject>();
+    if (!afterObject.isNull() && !beforeObject.isNull()) {
+      if (patchObject.isNull()) patchObject = patch.createNestedObject((char*)kvp.key().c_str());
+      addConfigChanges(patchObject, afterObject, beforeObject);
     }
-    else
-      Serial.println("[saveConfigItem] - Failed to mount FS");
+    else copyConfigValue(patch.getOrAddMember((char*)kvp.key().c_str()), kvp.value());
+  }
+}
+
+// Deep copy of source into target. Keys and strings are always copied: messages are parsed in place and their
+// strings point into a buffer that is gone once the message was handled.
+void copyConfigValue(JsonVariant target, JsonVariantConst source) {
+  if (source.is<JsonObject>()) {
+    JsonObject object = target.to<JsonObject>();
+    for (auto kvp : source.as<JsonObjectConst>()) {
+      copyConfigValue(object.getOrAddMember((char*)kvp.key().c_str()), kvp.value());
+    }
+  }
+  else if (source.is<JsonArray>()) {
+    JsonArray array = target.to<JsonArray>();
+    for (JsonVariantConst element : source.as<JsonArrayConst>()) copyConfigValue(array.addElement(), element);
+  }
+  else if (source.is<const char*>()) target.set((char*)source.as<const char*>());
+  else target.set(source);
+}
+
+// Keep the peak memory use of a static document and report when it ran full, returns true if it did
+bool jsonArenaMeasure(JsonDocument& jsonDocument, uint16_t& peak, bool overflowed, const char* user) {
+  if (jsonDocument.memoryUsage() > peak) peak = jsonDocument.memoryUsage();
+
+  // Less than one free slot means values were most likely dropped
+  if (overflowed || jsonDocument.memoryUsage() + JSON_OBJECT_SIZE(1) > jsonDocument.capacity()) {
+    jsonArenaStats.overflows++;
+    Serial.println("[" + String(user) + "] - JSON document is full at " + String(jsonDocument.capacity()) + " bytes, some values might be lost");
+    return true;
+  }
+  return false;
+}
+
+// Write the config and the schedule to the flash once they have not changed for deviceConfigWriteDelay
+void handleConfigWrite() {
+  if (!(deviceConfigDirty || scheduleDirty) || millis() - deviceConfigChangeTime < deviceConfigWriteDelay) return;
+  if (deviceConfigDirty) {
+    deviceConfigDirty = false;
+    writeDeviceConfig();
+    saveConfigSnapshot();
+  }
+  if (scheduleDirty) {
+    scheduleDirty = false;
+    writeSchedule();
   }
-  else
-    Serial.println("[saveConfigItem] - Could not set config due to incorrect IDE flash settings");
+}
+
+// Replace /DeviceConfig.json with the config held in RAM, see FileReplace.h
+bool writeDeviceConfig() {
+  bool written = replaceFile(fileSystem, "/DeviceConfig.json", "/DeviceConfig.tmp", measureJson(deviceConfig), [](File& file) {
+    return serializeJson(deviceConfig, file);
+  });
+  if (!written) {
+    Serial.println("[writeDeviceConfig] - Failed to replace device config file");
+    return false;
+  }
+  deviceConfigWrites++;
+
+  // Debug
+  // Serial.println("[writeDeviceConfig] - Device config saved");
+
+  return true;
 }
 
 // Generic message parser
@@ -213,6 +369,7 @@ void parseConfig(JsonDocument& jsonMessage) {
     "Mode": "Colour",
     "State": true,
     "Fade Period" : 1,
+    "Brightness" : 255,
     "Colour": {
       "Red": 0,
       "Green": 0,
@@ -287,17 +444,36 @@ void parseConfig(JsonDocument& jsonMessage) {
   // Get the root object
   JsonObject jsonSettingsObject = jsonMessage.as<JsonObject>();
 
+  // Preset commands go first, so the rest of the message sees the look of a recalled preset
+  JsonVariant presetSettings = jsonSettingsObject["Preset"];
+  if (presetSettings) {
+    presetCommand(presetSettings);
+    jsonSettingsObject.remove("Preset");
+  }
+
   // Check for Name, Mode, and State
   jsonSettingsObject["Name"] = Name = (Name != "") ? jsonSettingsObject["Name"] | Name : DEFAULT_NAME;
-  jsonSettingsObject["Mode"] = Mode = jsonSettingsObject["Mode"] | Mode;
-  jsonSettingsObject["State"] = State = jsonSettingsObject["State"] | State;
+  // While realtime frames are shown, the mode and state they switched to are not stored, see realtimeNotify()
+  bool realtime = realtimePreviousMode != "";
+  if (realtime && !jsonSettingsObject.containsKey("Mode")) jsonSettingsObject["Mode"] = realtimePreviousMode;
+  else {
+    // Remember what to go back to when Realtime is chosen by hand, see realtimeLeave()
+    String mode = jsonSettingsObject["Mode"] | Mode;
+    if (mode == "Realtime" && Mode != "Realtime") realtimeReturnMode = Mode;
+    jsonSettingsObject["Mode"] = Mode = mode;
+  }
+  if (realtime && !jsonSettingsObject.containsKey("State")) jsonSettingsObject["State"] = realtimePreviousState;
+  else jsonSettingsObject["State"] = State = realtimePreviousState = jsonSettingsObject["State"] | State;
   jsonSettingsObject["Fade Time"] = FadeTime = jsonSettingsObject["Fade Time"] | FadeTime;
+  jsonSettingsObject["Brightness"] = Brightness = constrain(jsonSettingsObject["Brightness"] | Brightness, 0, 255);
   
   // Might need to reconnect wifi with Name change
 
   // Check for Wifi Settings
   JsonVariant wifiSettings = jsonSettingsObject["Wifi"];
   if (wifiSettings) {
+      String previousSSID = SSID;
+      String previousPassword = Password;
       String pssidBuffer = wifiSettings["PSSID"] | programmedSSID;
       if (pssidBuffer == programmedSSID && wifiSettings.containsKey("SSID")) {
         String ssidBuffer = wifiSettings["SSID"] | SSID;
@@ -313,6 +489,9 @@ void parseConfig(JsonDocument& jsonMessage) {
         wifiSettings["PSSID"] = programmedSSID;
       }
 
+      // The connection starts over with the new credentials, see handleWifiConnection()
+      if (SSID != previousSSID || Password != previousPassword) wifiCredentialsGeneration++;
+
       if (wifiSettings.containsKey("Rescan")) {
         // Scan and wifi here
         scanForNetworks();
@@ -322,11 +501,27 @@ void parseConfig(JsonDocument& jsonMessage) {
       }
   }
 
-  // Apply settings to the modes
-  for(auto it = modes.begin(); it != modes.end(); it++) {
-    JsonVariant settings = jsonSettingsObject[it->first];
-    if (settings) {
-        it->second->applyConfig(settings);
+  // Check for the sync group settings, they are written back as they are used
+  JsonVariant syncSettings = jsonSettingsObject["Sync"];
+  if (syncSettings) syncApplyConfig(syncSettings);
+
+  // Check for the beat clock settings and commands, the commands are not stored
+  JsonVariant beatSettings = jsonSettingsObject["Beat"];
+  if (beatSettings) beatApplyConfig(beatSettings);
+
+  // Store new schedule rules separately, they are not part of the device config
+  JsonVariant scheduleSettings = jsonSettingsObject["Schedule"];
+  if (scheduleSettings) {
+    scheduleSave(scheduleSettings);
+    jsonSettingsObject.remove("Schedule");
+  }
+
+  // Apply settings to the modes named in the message
+  for (JsonPair kvp : jsonSettingsObject) {
+    auto modeIter = modes.find(kvp.key().c_str());
+    if (modeIter != modes.end()) {
+      JsonVariant settings = kvp.value();
+      modeIter->second->applyConfig(settings);
     }
   }
 
@@ -339,6 +534,20 @@ void parseConfig(JsonDocument& jsonMessage) {
   saveConfigItem(jsonMessage);
 }
 
+// Store state changes made on the lamp itself, e.g. by the switch or the scheduler. The clients are told by the
+// next state patch.
+void sendLampState() {
+  // parseConfig() adds Name and Fade Time and copies the mode, or the stored one, again. The strings are copied each
+  // time they are set.
+  DynamicJsonDocument jsonDocument(JSON_OBJECT_SIZE(5) + Name.length() + 1 + 2 * (Mode.length() + realtimePreviousMode.length() + 1));
+
+  // The realtime mode is left out while frames are shown, parseConfig() then keeps the stored mode
+  if (realtimePreviousMode == "" || Mode != "Realtime") jsonDocument["Mode"] = Mode;
+  jsonDocument["State"] = State;
+  jsonDocument["Brightness"] = Brightness;
+  parseConfig(jsonDocument);
+}
+
 // Adds useful diagnose information to the provided JSON document which
 // is later made available to the websocket clients.
 void addLampInfo(JsonDocument& jsonDocument) {
@@ -348,4 +557,207 @@ void addLampInfo(JsonDocument& jsonDocument) {
   jsonDocument["Info"]["ESPVersion"] = ESP.getFullVersion();
   jsonDocument["Info"]["FastLEDVersion"] = String(FASTLED_VERSION);
   jsonDocument["Info"]["Time"] = get12hrAsString();
+  jsonDocument["Info"]["IdleResidency"] = String(lampIdleResidency(), 1) + "%";
+  jsonDocument["Info"]["FirstFrame"] = String(bootFirstFrameTime) + "ms";
+  jsonDocument["Info"]["FrameTime"] = frameTimeInfo();
+  jsonDocument["Info"]["NtpSync"] = ntpTimeSet ? "offset " + String(ntpOffset) + "ms, delay " + String(ntpDelay) + "ms" : String("not synced");
+  jsonDocument["Info"]["Schedule"] = String(scheduleRuleCount) + " rules" + (scheduleNextDue() ? ", next at " + scheduleTimeAsString(scheduleNextDue()) : String(""));
+  jsonDocument["Info"]["ConfigWrites"] = String(deviceConfigWrites) + String(deviceConfigDirty || scheduleDirty ? " (pending)" : "");
+  jsonDocument["Info"]["Realtime"] = String(realtimeStats.frames) + " frames, " + String(realtimeStats.packetRate) + " packets/s, " + String(realtimeStats.late) + " late, " + String(realtimeStats.dropped) + " dropped, " + String(realtimeStats.messages) + " messages, " + String(realtimeStats.errors) + " errors";
+  jsonDocument["Info"]["Sync"] = syncInfo();
+  jsonDocument["Info"]["Beat"] = beatInfo();
+  jsonDocument["Info"]["Audio"] = audioInfo();
+  jsonDocument["Info"]["Preview"] = String(previewStats.frames) + " frames, " + String(previewStats.bytes / 1024) + " KB";
+  jsonDocument["Info"]["Messages"] = String(inboundStats.received) + " received, " + String(inboundStats.coalesced) + " coalesced, " + String(inboundStats.dropped) + " dropped";
+  jsonDocument["Info"]["JsonArena"] = "message " + String(jsonArenaStats.messagePeak) + "/" + String(JSON_MESSAGE_SIZE) + "B, queue " + String(jsonArenaStats.queuePeak) + "/" + String(INBOUND_QUEUE_SIZE) + "B, config " + String(jsonArenaStats.configPeak) + "/" + String(DEVICE_CONFIG_SIZE) + "B, patch " + String(jsonArenaStats.patchPeak) + "/" + String(STATE_PATCH_SIZE) + "B, " + String(jsonArenaStats.overflows) + " full, " + String(websocketFrameOverflows) + " dropped, " + String(websocketQueueFull) + " queue full";
+  jsonDocument["Info"]["WifiConnect"] = String(wifiConnection.lastConnectTime) + "ms" + String(wifiConnection.lastConnectWasFast ? " (cached)" : " (scan)");
+}
+
+// Restore the config from the binary snapshot and start the mode without fading in, so the first frame can be
+// shown before the JSON config is read. Returns false if there is no valid snapshot.
+bool restoreConfigSnapshot() {
+  configSnapshotLoaded = loadConfigSnapshot();
+  if (!configSnapshotLoaded) return false;
+
+  // Check the mode still exists
+  auto modeIter = modes.find(Mode);
+  if (modeIter == modes.end()) return false;
+
+  // Start the mode without fading
+  modeIter->second->initialize();
+  currentMode = previousMode = Mode;
+  previousState = State;
+  modeChangeFadeAmount = State ? 255 : 0;
+
+  // Debug
+  Serial.println("[restoreConfigSnapshot] - Restored mode \"" + Mode + "\" with the light " + String(State ? "on" : "off"));
+
+  return true;
+}
+
+// Read and apply the binary config snapshot. Returns false if it is missing, corrupt or from a newer version.
+bool loadConfigSnapshot() {
+  uint16_t length = 0;
+  uint32_t crc = 0;
+  uint8_t* payload = readSnapshotFile("/Config.bin", CONFIG_SNAPSHOT_MAGIC, length, crc);
+  if (!payload) return false;
+
+  // Base variables of the light
+  ConfigSnapshotReader reader(payload, length);
+  LampSnapshot lamp = { State, (uint8_t)Brightness, (uint16_t)FadeTime };
+  reader.readBlockInto(&lamp, sizeof(lamp));
+  State       = lamp.state;
+  Brightness  = lamp.brightness;
+  FadeTime    = lamp.fadeTime;
+
+  char text[CONFIG_SNAPSHOT_MAX_BLOCK + 1];
+  reader.readString(text, sizeof(text));
+  Name = text;
+  reader.readString(text, sizeof(text));
+  Mode = text;
+
+  // Wifi settings, the same as in parseConfig() the credentials in the sketch win if they were changed since
+  reader.readString(text, sizeof(text));
+  String ssidBuffer = text;
+  reader.readString(text, sizeof(text));
+  String passBuffer = text;
+  reader.readString(text, sizeof(text));
+  SSID      = (programmedSSID == text) ? ssidBuffer : programmedSSID;
+  Password  = (programmedSSID == text) ? passBuffer : programmedPassword;
+
+  readModeSnapshots(reader);
+
+  // Appended later, older snapshots end before it
+  if (!reader.atEnd()) {
+    SyncSnapshot sync = { syncRole, syncGroup, (int16_t)syncOffset };
+    reader.readBlockInto(&sync, sizeof(sync));
+    syncRole    = sync.role <= LAMP_SYNC_FOLLOWER ? (LampSyncRole)sync.role : LAMP_SYNC_OFF;
+    syncGroup   = sync.group ? sync.group : 1;
+    syncOffset  = constrain(sync.offset, -LAMP_SYNC_OFFSET_MAX, LAMP_SYNC_OFFSET_MAX);
+  }
+  if (!reader.atEnd()) {
+    BeatSnapshot beat = { (int16_t)beatLatency, beatClock.beatsPerBar };
+    reader.readBlockInto(&beat, sizeof(beat));
+    beatLatency           = constrain(beat.latency, -BEAT_LATENCY_MAX, BEAT_LATENCY_MAX);
+    beatClock.beatsPerBar = constrain(beat.beatsPerBar, 1, 16);
+  }
+
+  bool loaded = !reader.failed;
+  if (loaded) configSnapshotCrc = crc;
+  else Serial.println("[loadConfigSnapshot] - Config snapshot was truncated");
+  delete[] payload;
+
+  return loaded;
+}
+
+// Read a file in the snapshot format and check its header and CRC. Returns the payload, which has to be deleted by
+// the caller, or nullptr if the file is missing, corrupt or from a newer version.
+uint8_t* readSnapshotFile(const String& path, uint32_t magic, uint16_t& length, uint32_t& crc) {
+  recoverFile(fileSystem, path.c_str(), tempFilePath(path).c_str());
+
+  // Check the header
+  if (!fileSystem.exists(path)) return nullptr;
+  File snapshotFile = fileSystem.open(path, "r");
+  if (!snapshotFile) return nullptr;
+  ConfigSnapshotHeader header;
+  if (snapshotFile.read((uint8_t*)&header, sizeof(header)) != sizeof(header) || !snapshotHeaderValid(header, magic, snapshotFile.size())) {
+    Serial.println("[readSnapshotFile] - " + path + " is invalid, too large or from a newer version, ignoring it");
+    snapshotFile.close();
+    return nullptr;
+  }
+
+  // Read the payload and check the CRC, the length was checked against the size of the file
+  uint8_t* payload = new (std::nothrow) uint8_t[header.length];
+  if (!payload) {
+    snapshotFile.close();
+    return nullptr;
+  }
+  bool complete = snapshotFile.read(payload, header.length) == header.length && snapshotFile.read((uint8_t*)&crc, sizeof(crc)) == sizeof(crc);
+  snapshotFile.close();
+  if (!complete || crc != snapshotCrc32(0, payload, header.length)) {
+    Serial.println("[readSnapshotFile] - " + path + " failed the CRC check, ignoring it");
+    delete[] payload;
+    return nullptr;
+  }
+
+  length = header.length;
+  return payload;
+}
+
+// Temporary file used while replacing a file, the extension is swapped for .tmp
+String tempFilePath(const String& path) {
+  return path.substring(0, path.lastIndexOf('.')) + ".tmp";
+}
+
+// Mode settings, stored by name so modes can be added or removed
+void readModeSnapshots(ConfigSnapshotReader& reader) {
+  char text[CONFIG_SNAPSHOT_MAX_BLOCK + 1];
+  uint8_t modeCount = 0;
+  reader.readBlockInto(&modeCount, sizeof(modeCount));
+  for (uint8_t i = 0; i < modeCount && !reader.atEnd(); i++) {
+    reader.readString(text, sizeof(text));
+    uint8_t size;
+    const uint8_t* block = reader.readBlock(size);
+    auto modeIter = modes.find(text);
+    if (block && modeIter != modes.end()) modeIter->second->loadSnapshot(block, size);
+  }
+}
+
+void writeModeSnapshots(ConfigSnapshotWriter& writer) {
+  uint8_t modeCount = modes.size();
+  writer.writeBlock(&modeCount, sizeof(modeCount));
+  uint8_t modeData[MODE_SNAPSHOT_MAX_SIZE];
+  for (auto it = modes.begin(); it != modes.end(); it++) {
+    writer.writeString(it->first.c_str());
+    writer.writeBlock(modeData, it->second->saveSnapshot(modeData));
+  }
+}
+
+// Serialize the current config into the snapshot writer, the layout is described in ConfigSnapshot.h
+void writeConfigSnapshot(ConfigSnapshotWriter& writer) {
+  // The switch to the realtime mode made by the frames is never stored, see realtimeNotify()
+  bool realtime = realtimePreviousMode != "";
+  LampSnapshot lamp = { realtime ? realtimePreviousState : State, (uint8_t)Brightness, (uint16_t)FadeTime };
+  writer.writeBlock(&lamp, sizeof(lamp));
+  writer.writeString(Name.c_str());
+  writer.writeString(realtime ? realtimePreviousMode.c_str() : Mode.c_str());
+  writer.writeString(SSID.c_str());
+  writer.writeString(Password.c_str());
+  writer.writeString(programmedSSID.c_str());
+  writeModeSnapshots(writer);
+  SyncSnapshot sync = { syncRole, syncGroup, (int16_t)syncOffset };
+  writer.writeBlock(&sync, sizeof(sync));
+  BeatSnapshot beat = { (int16_t)beatLatency, beatClock.beatsPerBar };
+  writer.writeBlock(&beat, sizeof(beat));
+}
+
+size_t writeConfigSnapshotFile(void* context, const uint8_t* data, size_t length) {
+  return ((File*)context)->write(data, length);
+}
+
+// Write the binary config snapshot, the flash is only touched when the config changed since the last read or write
+bool saveConfigSnapshot() {
+  // Work out the length and CRC without writing anything
+  ConfigSnapshotWriter dryRun;
+  writeConfigSnapshot(dryRun);
+  if (dryRun.crc == configSnapshotCrc) return true;
+
+  // Replace the file, see FileReplace.h
+  ConfigSnapshotHeader header = { CONFIG_SNAPSHOT_MAGIC, CONFIG_SNAPSHOT_VERSION, dryRun.length };
+  uint32_t crc = 0;
+  bool written = replaceFile(fileSystem, "/Config.bin", "/Config.tmp", sizeof(header) + header.length + sizeof(crc), [&](File& file) -> size_t {
+    size_t size = file.write((const uint8_t*)&header, sizeof(header));
+    ConfigSnapshotWriter writer(writeConfigSnapshotFile, &file);
+    writeConfigSnapshot(writer);
+    if (writer.failed) return 0;
+    crc = writer.crc;
+    return size + writer.length + file.write((const uint8_t*)&crc, sizeof(crc));
+  });
+  if (!written) {
+    Serial.println("[saveConfigSnapshot] - Failed to write config snapshot");
+    return false;
+  }
+  configSnapshotCrc = crc;
+
+  return true;
 }
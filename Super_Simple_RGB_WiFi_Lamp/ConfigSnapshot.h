@@ -0,0 +1,155 @@
+/* ConfigSnapshot
+ *
+ * Compact binary copy of the lamp config, used at boot and for hot reloads
+ * instead of parsing the JSON config. The JSON file stays the import and
+ * export format.
+ *
+ * File layout:
+ *   ConfigSnapshotHeader   magic, format version and payload length
+ *   payload                length prefixed blocks and strings
+ *   uint32_t               CRC32 of the payload
+ *
+ * Every block is prefixed with its length. Readers copy as much of a block
+ * as they know about and keep their defaults for the rest, so fields can be
+ * appended to a block without breaking older snapshots.
+ *
+ * Presets use the same file format with their own magic, see Presets.ino.
+ *
+ * Nothing in here depends on the Arduino core.
+*/
+
+#ifndef ConfigSnapshot_h
+#define ConfigSnapshot_h
+
+#include <stdint.h>
+#include <string.h>
+
+#define CONFIG_SNAPSHOT_MAGIC     0x4746434C  // "LCFG"
+#define CONFIG_SNAPSHOT_VERSION   1
+#define CONFIG_SNAPSHOT_MAX_BLOCK 255
+#define CONFIG_SNAPSHOT_MAX       4096        // Largest payload read, the config of all modes is about 1 KB
+#define PRESET_SNAPSHOT_MAGIC     0x5452504C  // "LPRT"
+
+struct ConfigSnapshotHeader {
+  uint32_t  magic;
+  uint16_t  version;
+  uint16_t  length;
+} __attribute__((packed));
+
+// Fixed size settings of the lamp itself, strings are stored separately
+struct LampSnapshot {
+  uint8_t   state;
+  uint8_t   brightness;
+  uint16_t  fadeTime;
+} __attribute__((packed));
+
+// Sync group of the lamp, stored after the mode settings
+struct SyncSnapshot {
+  uint8_t   role;
+  uint8_t   group;
+  int16_t   offset;
+} __attribute__((packed));
+
+// Beat clock settings, stored after the sync group
+struct BeatSnapshot {
+  int16_t   latency;
+  uint8_t   beatsPerBar;
+} __attribute__((packed));
+
+// Bitwise CRC32 (IEEE 802.3), slow but small and the snapshot is only a few hundred bytes
+inline uint32_t snapshotCrc32(uint32_t crc, const uint8_t* data, size_t length) {
+  crc = ~crc;
+  while (length--) {
+    crc ^= *data++;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+// Check the header of a file before its payload is read. The length has to fit the file exactly and stay below
+// CONFIG_SNAPSHOT_MAX, so a corrupt header never asks for more memory than the lamp has.
+inline bool snapshotHeaderValid(const ConfigSnapshotHeader& header, uint32_t magic, size_t fileSize) {
+  return header.magic == magic && header.version <= CONFIG_SNAPSHOT_VERSION && header.length <= CONFIG_SNAPSHOT_MAX
+    && fileSize == sizeof(header) + header.length + sizeof(uint32_t);
+}
+
+/// Serializes the payload of a snapshot. Without a sink only the length and
+/// CRC are calculated, which is used to check if the snapshot changed before
+/// touching the flash.
+class ConfigSnapshotWriter {
+public:
+  typedef size_t (*Sink)(void* context, const uint8_t* data, size_t length);
+
+  uint32_t  crc     = 0;
+  uint16_t  length  = 0;
+  bool      failed  = false;
+
+  ConfigSnapshotWriter(Sink sink = nullptr, void* context = nullptr) : sink(sink), context(context) {}
+
+  void write(const void* data, size_t size) {
+    crc = snapshotCrc32(crc, (const uint8_t*)data, size);
+    length += size;
+    if (sink && sink(context, (const uint8_t*)data, size) != size) failed = true;
+  }
+
+  void writeBlock(const void* data, size_t size) {
+    if (size > CONFIG_SNAPSHOT_MAX_BLOCK) size = CONFIG_SNAPSHOT_MAX_BLOCK;
+    uint8_t blockSize = size;
+    write(&blockSize, 1);
+    write(data, size);
+  }
+
+  void writeString(const char* text) {
+    writeBlock(text, strlen(text));
+  }
+
+private:
+  Sink  sink;
+  void* context;
+};
+
+/// Reads the payload of a snapshot from memory
+class ConfigSnapshotReader {
+public:
+  bool failed = false;
+
+  ConfigSnapshotReader(const uint8_t* data, size_t length) : data(data), remaining(length) {}
+
+  bool atEnd() const { return remaining == 0 || failed; }
+
+  // Returns a pointer to the next block and its length
+  const uint8_t* readBlock(uint8_t& size) {
+    size = 0;
+    if (remaining < 1) { failed = true; return nullptr; }
+    size = *data;
+    if (remaining < 1 + (size_t)size) { failed = true; size = 0; return nullptr; }
+    const uint8_t* block = data + 1;
+    data += 1 + size;
+    remaining -= 1 + size;
+    return block;
+  }
+
+  // Copies the next block over the given struct, fields missing from older snapshots keep their value
+  void readBlockInto(void* target, size_t targetSize) {
+    uint8_t size;
+    const uint8_t* block = readBlock(size);
+    if (block) memcpy(target, block, size < targetSize ? size : targetSize);
+  }
+
+  // Copies the next block as a zero terminated string
+  void readString(char* text, size_t textSize) {
+    uint8_t size;
+    const uint8_t* block = readBlock(size);
+    size_t copySize = (size < textSize - 1) ? size : textSize - 1;
+    if (block) memcpy(text, block, copySize);
+    text[block ? copySize : 0] = '\0';
+  }
+
+private:
+  const uint8_t*  data;
+  size_t          remaining;
+};
+
+#endif
@@ -0,0 +1,54 @@
+/* FileReplace
+ *
+ * Replaces a file on the flash without ever leaving a half written file
+ * behind. The new contents go to a temporary file first, then the old file
+ * is removed and the temporary file renamed over it:
+ *   reset while writing             the old file is kept
+ *   reset before the rename         recoverFile() renames the temporary file
+ *
+ * A file written for the first time is created empty before the temporary
+ * file is written, so a missing file always means the temporary file is
+ * complete. Readers have to treat an empty file like a missing one.
+ *
+ * Works with anything that has the open(), exists(), remove() and rename()
+ * of the file systems of the Arduino core.
+ *
+ * Nothing in here depends on the Arduino core.
+*/
+
+#ifndef FileReplace_h
+#define FileReplace_h
+
+#include <stddef.h>
+
+// Finish a replacement that was interrupted between removing the old file and renaming the new one
+template <typename FileSystem>
+void recoverFile(FileSystem& fileSystem, const char* path, const char* tempPath) {
+  if (!fileSystem.exists(path) && fileSystem.exists(tempPath)) fileSystem.rename(tempPath, path);
+}
+
+// Replace path with what writeContents(file) writes, it returns the number of bytes written. The old file is kept
+// unless exactly expectedSize bytes were written.
+template <typename FileSystem, typename Writer>
+bool replaceFile(FileSystem& fileSystem, const char* path, const char* tempPath, size_t expectedSize, Writer writeContents) {
+  if (!fileSystem.exists(path)) {
+    auto placeholder = fileSystem.open(path, "w");
+    if (!placeholder) return false;
+    placeholder.close();
+  }
+
+  auto file = fileSystem.open(tempPath, "w");
+  if (!file) return false;
+  size_t size = writeContents(file);
+  file.close();
+  if (size == 0 || size != expectedSize) {
+    fileSystem.remove(tempPath);
+    return false;
+  }
+
+  // Not every file system can rename over an existing file
+  fileSystem.remove(path);
+  return fileSystem.rename(tempPath, path);
+}
+
+#endif
@@ -1,4 +1,10 @@
 void ledStringInit() {
+#ifdef LED_POWER_PIN
+  // Power up the LED rail
+  pinMode(LED_POWER_PIN, OUTPUT);
+  digitalWrite(LED_POWER_PIN, HIGH);
+#endif
+
   // add the leds to fast led and clear them
   //FastLED.addLeds<CHIPSET, DATA_PIN, COLOR_ORDER>(ledString, NUM_LEDS);
   //FastLED with RGBW
@@ -17,33 +23,54 @@ void handleMode() {
   // This limitation is important to prevent LED flickering
   // See: https://github.com/thebigpotatoe/Super-Simple-RGB-WiFi-Lamp/issues/30
   EVERY_N_MILLISECONDS(1000/FRAME_RATE) {
-    // Adapt the leds to the current mode. Please note the differences between Mode and currentMode.
-    //
-    // Mode:        Is set by the config or the web interface to tell the lamp that a specific mode should
-    //              be shown. The lamp will then change to that mode slowly (see adjustBrightnessAndSwitchMode())
-    // currentMode: In case this is set to a mode name, the lamp came to the point where a mode should be
-    //              asked to render it's pattern.
-    //              During startup this is set to "". In this situation the mode should not be rendered, but
-    //              adjustBrightnessAndSwitchMode() should be called to introduce Mode.
-    if (currentMode != "") {
-      auto modeIter = modes.find(currentMode);
-      if (modeIter == modes.end()) {
-        // Should only be reached when a user has configured a mode that does not exist (anymore)
-        Serial.println("[handleMode] - Mode \"" + currentMode + "\" not found, resetting to default");
-        Mode = "Colour"; // Automatically jump back to colour
-        return;
-      }
+    renderFrame();
+  }
+}
+
+void renderFrame() {
+  // Nothing is rendered while the light is off, wake up when it has to come on again
+  if (lampIdle) {
+    if (State || (autoOnWithModeChange && Mode != currentMode)) leaveLampIdle();
+    else return;
+  }
 
-      // If mode is found run its render function
-      modeIter->second->render();
+  // Adapt the leds to the current mode. Please note the differences between Mode and currentMode.
+  //
+  // Mode:        Is set by the config or the web interface to tell the lamp that a specific mode should
+  //              be shown. The lamp will then change to that mode slowly (see adjustBrightnessAndSwitchMode())
+  // currentMode: In case this is set to a mode name, the lamp came to the point where a mode should be
+  //              asked to render it's pattern.
+  //              During startup this is set to "". In this situation the mode should not be rendered, but
+  //              adjustBrightnessAndSwitchMode() should be called to introduce Mode.
+  if (currentMode != "") {
+    auto modeIter = modes.find(currentMode);
+    if (modeIter == modes.end()) {
+      // Should only be reached when a user has configured a mode that does not exist (anymore)
+      Serial.println("[handleMode] - Mode \"" + currentMode + "\" not found, resetting to default");
+      Mode = "Colour"; // Automatically jump back to colour
+      return;
     }
 
-    // Globally adjust the brightness
-    adjustBrightnessAndSwitchMode();
+    // If mode is found run its render function
+    modeIter->second->render();
+  }
+
+  // Globally adjust the brightness
+  adjustBrightnessAndSwitchMode();
+
+  // Handle Fast LED
+  FastLED.show();
+  previewFrameReady = true;
+  frameTimeMeasure();
 
-    // Handle Fast LED
-    FastLED.show();
+  // Remember how long it took to get the first frame out after a reset
+  if (!bootFirstFrameTime) {
+    bootFirstFrameTime = millis();
+    Serial.println("[renderFrame] - First frame shown after " + String(bootFirstFrameTime) + "ms");
   }
+
+  // Stop rendering once the light has completely faded out
+  if (lampCanIdle()) enterLampIdle();
 }
 
 void adjustBrightnessAndSwitchMode() {
@@ -126,5 +153,81 @@ void adjustBrightnessAndSwitchMode() {
   }
 
   // Globally Scale the brightness of all LED's
-  nscale8(ledString, NUM_LEDS, (int)modeChangeFadeAmount);
+  nscale8(ledString, NUM_LEDS, (int)modeChangeFadeAmount * Brightness / 255);
+}
+
+bool lampCanIdle() {
+  return !State && !previousState && modeChangeFadeAmount <= 0 && Mode == currentMode && currentMode == previousMode;
+}
+
+void enterLampIdle() {
+  // Show one black frame before stopping
+  FastLED.clear();
+  FastLED.show();
+
+#ifdef LED_POWER_PIN
+  // Cut the power to the LEDs
+  digitalWrite(LED_POWER_PIN, LOW);
+#endif
+
+  // Let the wifi sleep between beacons, only possible while not running the soft AP. Websocket messages are still
+  // received on the next beacon and a press of the switch wakes the CPU straight away if it uses an interrupt.
+  if (WiFi.getMode() == WIFI_STA) {
+    switchWakeupArm();
+    WiFi.setSleepMode(WIFI_LIGHT_SLEEP);
+  }
+
+  lampIdle = true;
+  lampIdleSince = millis();
+  frameTimeStats.lastTime = 0;
+
+  // Debug
+  Serial.println("[enterLampIdle] - Light is off, going idle");
+}
+
+void leaveLampIdle() {
+#ifdef LED_POWER_PIN
+  // Power the LEDs back up
+  digitalWrite(LED_POWER_PIN, HIGH);
+#endif
+
+  // Back to the default modem sleep
+  switchWakeupDisarm();
+  WiFi.setSleepMode(WIFI_MODEM_SLEEP);
+
+  lampIdle = false;
+  lampIdleTotalTime += millis() - lampIdleSince;
+
+  // Debug
+  Serial.println("[leaveLampIdle] - Light is coming on, leaving idle");
+}
+
+// Percentage of the time since boot that the light has been idle
+float lampIdleResidency() {
+  unsigned long idleTime = lampIdleTotalTime + (lampIdle ? millis() - lampIdleSince : 0);
+  return millis() ? 100.0 * idleTime / millis() : 0;
+}
+
+// Time the gap since the last frame, which shows how much the network and the flash hold up the animations
+void frameTimeMeasure() {
+  unsigned long now = micros();
+  if (frameTimeStats.lastTime) {
+    uint32_t gap = now - frameTimeStats.lastTime;
+    frameTimeStats.frames++;
+    frameTimeStats.totalGap += gap;
+    if (gap > frameTimeStats.maxGap) frameTimeStats.maxGap = gap;
+    if (gap > 1500000UL / FRAME_RATE) frameTimeStats.late++;
+
+    // Keep the mean from overflowing, it follows the recent frames
+    if (frameTimeStats.totalGap > 0x7FFFFFFF) {
+      frameTimeStats.totalGap /= 2;
+      frameTimeStats.frames /= 2;
+    }
+  }
+  frameTimeStats.lastTime = now ? now : 1;
+}
+
+String frameTimeInfo() {
+  if (!frameTimeStats.frames) return "no frames";
+  return "mean " + String(frameTimeStats.totalGap / frameTimeStats.frames / 1000.0, 1) + "ms, longest " + String(frameTimeStats.maxGap / 1000.0, 1) + "ms, " + String(frameTimeStats.late) + " late";
 }
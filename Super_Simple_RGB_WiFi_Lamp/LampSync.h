@@ -0,0 +1,139 @@
+/* LampSync
+ *
+ * Lamps in one room render their animations from a shared clock. One lamp
+ * of a sync group leads and sends a beacon to the multicast group four
+ * times a second, the others follow: they take the mode and its parameters
+ * from the beacon and set their animation clock from timed requests to the
+ * leader. Packets start with a short header, values are little endian:
+ *
+ *   uint8    magic     'L'
+ *   uint8    magic     'S'
+ *   uint8    version   LAMP_SYNC_VERSION
+ *   uint8    type      see LampSyncType
+ *   uint8    group     sync group of the sender
+ *   ...      payload
+ *
+ * Payloads:
+ *
+ *   BEACON   uint32 clock, uint32 epoch, uint8 length, mode name,
+ *            uint8 length, parameters of the mode packed like the snapshot
+ *   REQUEST  uint32 t1, clock of the follower when it was sent
+ *   REPLY    uint32 t1, uint32 t2 and uint32 t3, clock of the leader when
+ *            the request was received and when the reply was sent
+ *
+ * The epoch counts the changes of the mode and its parameters on the
+ * leader, followers only apply a beacon when it changed. WiFi holds
+ * multicast packets back until the next DTIM beacon of the access point,
+ * so the clock in the beacon is only good enough to start with. Offset and
+ * delay are calculated from the four timestamps of a request and its reply
+ * like NTP does, on the millisecond clock that wraps after 49 days. Samples
+ * with a much longer delay than the best of the last few are dropped, the
+ * offset of a delayed packet is only known to half its delay.
+ *
+ * Nothing in here depends on the Arduino core.
+*/
+
+#ifndef LampSync_h
+#define LampSync_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "NtpTime.h"
+#include "RealtimeProtocol.h"
+
+#define LAMP_SYNC_PORT            6767
+#define LAMP_SYNC_VERSION         1
+#define LAMP_SYNC_HEADER_SIZE     5
+#define LAMP_SYNC_NAME_MAX        32
+#define LAMP_SYNC_PACKET_MAX      (LAMP_SYNC_HEADER_SIZE + 10 + LAMP_SYNC_NAME_MAX + 64)
+#define LAMP_SYNC_BEACON_PERIOD   250     // ms between beacons of the leader
+#define LAMP_SYNC_LEADER_TIMEOUT  5000    // ms without a beacon before a follower looks for a new leader
+#define LAMP_SYNC_OFFSET_MAX      30000   // Largest offset of a lamp in the group in ms
+#define LAMP_SYNC_FILTER_SIZE     8       // Samples the delay filter looks back at
+#define LAMP_SYNC_DELAY_MARGIN    4       // Samples at most this much slower than the best are used, in ms
+
+enum LampSyncType : uint8_t {
+  LAMP_SYNC_BEACON  = 1,
+  LAMP_SYNC_REQUEST = 2,
+  LAMP_SYNC_REPLY   = 3
+};
+
+enum LampSyncRole : uint8_t {
+  LAMP_SYNC_OFF = 0,
+  LAMP_SYNC_LEADER,
+  LAMP_SYNC_FOLLOWER
+};
+
+inline const char* lampSyncRoleName(LampSyncRole role) {
+  switch (role) {
+    case LAMP_SYNC_LEADER   : return "Leader";
+    case LAMP_SYNC_FOLLOWER : return "Follower";
+    default                 : return "Off";
+  }
+}
+
+inline LampSyncRole lampSyncRoleFromName(const char* name) {
+  if (strcmp(name, "Leader") == 0) return LAMP_SYNC_LEADER;
+  if (strcmp(name, "Follower") == 0) return LAMP_SYNC_FOLLOWER;
+  return LAMP_SYNC_OFF;
+}
+
+inline size_t lampSyncWrite32(uint8_t* data, uint32_t value) {
+  for (uint8_t i = 0; i < 4; i++) data[i] = value >> (8 * i);
+  return 4;
+}
+
+// Write the header, returns its size
+inline size_t lampSyncWriteHeader(uint8_t* data, LampSyncType type, uint8_t group) {
+  data[0] = 'L';
+  data[1] = 'S';
+  data[2] = LAMP_SYNC_VERSION;
+  data[3] = type;
+  data[4] = group;
+  return LAMP_SYNC_HEADER_SIZE;
+}
+
+// Check the header of a packet of the given group, returns its type or 0 if the packet is not meant for the group
+inline uint8_t lampSyncReadHeader(RealtimeReader& reader, uint8_t group) {
+  const uint8_t* header = reader.readBytes(LAMP_SYNC_HEADER_SIZE);
+  if (!header || header[0] != 'L' || header[1] != 'S' || header[2] != LAMP_SYNC_VERSION || header[4] != group) return 0;
+  return header[3];
+}
+
+// Offset of the leader clock against the follower clock and the round trip delay from the four timestamps
+inline NtpSample lampSyncCalculate(uint32_t t1, uint32_t t2, uint32_t t3, uint32_t t4) {
+  NtpSample sample;
+  sample.offset = ((int64_t)(int32_t)(t2 - t1) + (int32_t)(t3 - t4)) / 2;
+  sample.delay  = (int64_t)(int32_t)(t4 - t1) - (int32_t)(t3 - t2);
+  return sample;
+}
+
+/// Drops the samples that were held up on the way. A sample is used if its delay is close to the best delay of the
+/// last LAMP_SYNC_FILTER_SIZE samples, so a slow network lets through its best samples only.
+class LampSyncFilter {
+public:
+  bool accept(int32_t delay) {
+    delays[next] = delay;
+    next = (next + 1) % LAMP_SYNC_FILTER_SIZE;
+    if (count < LAMP_SYNC_FILTER_SIZE) count++;
+
+    int32_t best = delay;
+    for (uint8_t i = 0; i < count; i++) if (delays[i] < best) best = delays[i];
+    return delay <= best + LAMP_SYNC_DELAY_MARGIN;
+  }
+
+  uint8_t samples() const { return count; }
+
+  void reset() {
+    count = 0;
+    next = 0;
+  }
+
+private:
+  int32_t   delays[LAMP_SYNC_FILTER_SIZE];
+  uint8_t   count = 0;
+  uint8_t   next  = 0;
+};
+
+#endif
@@ -0,0 +1,189 @@
+/* LightingProtocols
+ *
+ * Parsers for the UDP protocols lighting desks and pixel software use to
+ * stream pixels: E1.31 (sACN), Art-Net and DDP. A packet is reduced to a
+ * LightingPacket that holds its channels and tells whether it completes a
+ * frame, a LightingMapping places the channels of a universe on the LEDs.
+ *
+ * E1.31 and Art-Net carry up to 512 channels per universe. The pixels of
+ * the lamp start at the start channel of the first universe and continue
+ * at channel 1 of the following universes, a pixel is never split across
+ * two universes. DDP carries one stream of channels with a byte offset.
+ *
+ * Nothing in here depends on the Arduino core.
+*/
+
+#ifndef LightingProtocols_h
+#define LightingProtocols_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define E131_PORT   5568
+#define ARTNET_PORT 6454
+#define DDP_PORT    4048
+
+#define LIGHTING_UNIVERSE_SIZE 512
+
+enum LightingProtocol : uint8_t {
+  LIGHTING_E131 = 0,
+  LIGHTING_ARTNET,
+  LIGHTING_DDP,
+  LIGHTING_PROTOCOLS
+};
+
+enum LightingPacketType : uint8_t {
+  LIGHTING_IGNORE = 0,  // not a packet with pixels, or not a valid one
+  LIGHTING_DATA,        // channels of a universe or at an offset
+  LIGHTING_SYNC         // the frame received so far is complete
+};
+
+struct LightingPacket {
+  LightingPacketType  type              = LIGHTING_IGNORE;
+  uint16_t            universe          = 0;        // E1.31 and Art-Net, also the sync universe of a sync packet
+  uint32_t            offset            = 0;        // DDP, offset of the first channel
+  uint8_t             sequence          = 0;        // 0 if the sender does not number its packets
+  uint8_t             sequenceBits      = 8;        // DDP only counts from 1 to 15
+  uint16_t            syncUniverse      = 0;        // E1.31, the frame is shown by a sync packet of this universe
+  uint8_t             channelsPerPixel  = 0;        // DDP, from the data type, 0 if it was not given
+  bool                push              = false;    // DDP, the frame is complete
+  const uint8_t*      data              = nullptr;
+  uint16_t            length            = 0;
+};
+
+inline uint16_t lightingRead16(const uint8_t* data) {
+  return data[0] << 8 | data[1];
+}
+
+inline uint32_t lightingRead32(const uint8_t* data) {
+  return (uint32_t)data[0] << 24 | (uint32_t)data[1] << 16 | (uint32_t)data[2] << 8 | data[3];
+}
+
+// E1.31 data packets (ANSI E1.31-2018 section 4.1) and universe sync packets (section 4.2)
+inline LightingPacket lightingParseE131(const uint8_t* data, size_t length) {
+  static const uint8_t identifier[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+  LightingPacket packet;
+  if (length < 49 || lightingRead16(data) != 0x0010 || memcmp(data + 4, identifier, sizeof(identifier)) != 0) return packet;
+
+  uint32_t rootVector = lightingRead32(data + 18);
+  uint32_t framingVector = lightingRead32(data + 40);
+  if (rootVector == 0x00000008 && framingVector == 0x00000001) {
+    packet.type = LIGHTING_SYNC;
+    packet.sequence = data[44];
+    packet.universe = lightingRead16(data + 45);
+    return packet;
+  }
+  if (rootVector != 0x00000004 || framingVector != 0x00000002 || length < 126) return packet;
+
+  // Skip preview data and terminated streams, only the DMX start code carries levels
+  uint8_t options = data[112];
+  if (options & 0xC0 || data[117] != 0x02 || data[125] != 0) return packet;
+  uint16_t count = lightingRead16(data + 123);
+  if (count < 1 || 125 + (size_t)count > length) return packet;
+
+  packet.type = LIGHTING_DATA;
+  packet.syncUniverse = lightingRead16(data + 109);
+  packet.sequence = data[111];
+  packet.universe = lightingRead16(data + 113);
+  packet.data = data + 126;
+  packet.length = count - 1;
+  return packet;
+}
+
+// Art-Net 4 ArtDmx and ArtSync packets
+inline LightingPacket lightingParseArtNet(const uint8_t* data, size_t length) {
+  LightingPacket packet;
+  if (length < 14 || memcmp(data, "Art-Net", 8) != 0) return packet;
+
+  uint16_t opcode = data[8] | data[9] << 8;
+  if (opcode == 0x5200) {
+    packet.type = LIGHTING_SYNC;
+    return packet;
+  }
+  if (opcode != 0x5000 || length < 18) return packet;
+
+  uint16_t count = lightingRead16(data + 16);
+  if (count > LIGHTING_UNIVERSE_SIZE || 18 + (size_t)count > length) return packet;
+
+  packet.type = LIGHTING_DATA;
+  packet.sequence = data[12];
+  packet.universe = (data[15] & 0x7F) << 8 | data[14];
+  packet.data = data + 18;
+  packet.length = count;
+  return packet;
+}
+
+// DDP data packets for the default output, see http://www.3waylabs.com/ddp/
+inline LightingPacket lightingParseDdp(const uint8_t* data, size_t length) {
+  LightingPacket packet;
+  if (length < 10 || (data[0] & 0xC0) != 0x40 || data[0] & 0x06) return packet;
+  if (data[3] != 1 && data[3] != 255) return packet;
+
+  size_t headerLength = (data[0] & 0x10) ? 14 : 10;
+  uint16_t count = lightingRead16(data + 8);
+  if (headerLength + count > length) return packet;
+
+  // Data type: bits 3 - 5 are the pixel type, bits 0 - 2 the size of a channel
+  uint8_t pixelType = data[2] >> 3 & 0x07;
+  bool eightBit = (data[2] & 0x07) == 3;
+  if (eightBit && pixelType == 1) packet.channelsPerPixel = 3;
+  if (eightBit && pixelType == 3) packet.channelsPerPixel = 4;
+
+  packet.type = LIGHTING_DATA;
+  packet.sequence = data[1] & 0x0F;
+  packet.sequenceBits = 4;
+  packet.push = data[0] & 0x01;
+  packet.offset = lightingRead32(data + 4);
+  packet.data = data + headerLength;
+  packet.length = count;
+  return packet;
+}
+
+// True if the sequence number is a repeat or older than the last one. E1.31 defines a window of 20 numbers, the
+// shorter DDP numbers only have half their range.
+inline bool lightingSequenceLate(uint8_t sequence, uint8_t last, uint8_t bits) {
+  uint8_t mask = (1 << bits) - 1;
+  uint8_t behind = (last - sequence) & mask;
+  return behind < (bits >= 8 ? 20 : 1 << (bits - 1));
+}
+
+struct LightingMapping {
+  uint16_t  universe;           // Universe of the first pixel
+  uint16_t  startChannel;       // Channel of the first pixel in its universe, from 1
+  uint8_t   channelsPerPixel;   // 3 for RGB, 4 for RGBW
+  uint16_t  pixelCount;
+};
+
+inline uint16_t lightingPixelsInUniverse(const LightingMapping& mapping, uint16_t index) {
+  uint16_t channels = index == 0 ? LIGHTING_UNIVERSE_SIZE - (mapping.startChannel - 1) : LIGHTING_UNIVERSE_SIZE;
+  return channels / mapping.channelsPerPixel;
+}
+
+// Number of universes that hold all pixels
+inline uint16_t lightingUniverseCount(const LightingMapping& mapping) {
+  uint16_t pixels = 0;
+  uint16_t count = 0;
+  while (pixels < mapping.pixelCount) pixels += lightingPixelsInUniverse(mapping, count++);
+  return count;
+}
+
+// Place the channels of a universe on the pixels. Returns the number of whole pixels in the packet, the first of
+// them is pixel firstPixel and starts at data[dataOffset]. Returns 0 for universes that are not mapped.
+inline uint16_t lightingMapUniverse(const LightingMapping& mapping, uint16_t universe, uint16_t length, uint16_t& firstPixel, uint16_t& dataOffset) {
+  if (universe < mapping.universe) return 0;
+  uint16_t index = universe - mapping.universe;
+  if (index >= lightingUniverseCount(mapping)) return 0;
+
+  firstPixel = 0;
+  for (uint16_t i = 0; i < index; i++) firstPixel += lightingPixelsInUniverse(mapping, i);
+  dataOffset = index == 0 ? mapping.startChannel - 1 : 0;
+  if (length <= dataOffset) return 0;
+
+  uint16_t count = (length - dataOffset) / mapping.channelsPerPixel;
+  if (count > lightingPixelsInUniverse(mapping, index)) count = lightingPixelsInUniverse(mapping, index);
+  if (count > mapping.pixelCount - firstPixel) count = mapping.pixelCount - firstPixel;
+  return count;
+}
+
+#endif
@@ -1,33 +1,37 @@
 class ModeBellCurve : public ModeBase
 {
 private:
-    // Config
-    int bellCurveRed   = 128;
-    int bellCurveGreen = 128;
-    int bellCurveBlue  = 128;
+    // Config, described by the parameter table in the constructor
+    struct Config {
+        int red;
+        int green;
+        int blue;
+    } config;
+
 public:
-    ModeBellCurve() {}
+    ModeBellCurve() {
+        static constexpr ModeParameter parameters[] = {
+            MODE_PARAMETER(red,   nullptr, "Red",   0, 255, 128, "Red",   "", 1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(green, nullptr, "Green", 0, 255, 128, "Green", "", 1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(blue,  nullptr, "Blue",  0, 255, 128, "Blue",  "", 1, MODE_PARAM_SHOW_COLOUR)
+        };
+        setParameters(parameters, &config);
+    }
     virtual void initialize() {}
 
     virtual void render() {
         // Set the top brightness
         for (int i = 0; i < topNumLeds; i++) {
           int ledNrightness = cubicwave8( ( 255 / (float)topNumLeds  ) * i );
-          ledString[topLeds[i]] = CRGB(bellCurveRed, bellCurveGreen, bellCurveBlue);
+          ledString[topLeds[i]] = CRGB(config.red, config.green, config.blue);
           ledString[topLeds[i]] %= ledNrightness;
         }
 
         // Set the Bottom brightness
         for (int i = 0; i < bottomNumLeds; i++) {
           int ledNrightness = cubicwave8( ( 255 / (float)bottomNumLeds  ) * i );
-          ledString[bottomLeds[i]] = CRGB(bellCurveRed, bellCurveGreen, bellCurveBlue);
+          ledString[bottomLeds[i]] = CRGB(config.red, config.green, config.blue);
           ledString[bottomLeds[i]] %= ledNrightness;
         }
     }
-
-    virtual void applyConfig(JsonVariant& settings) {
-        settings["Red"] = bellCurveRed = settings["Red"] | bellCurveRed;
-        settings["Green"]= bellCurveGreen = settings["Green"] | bellCurveGreen;
-        settings["Blue"] = bellCurveBlue = settings["Blue"] | bellCurveBlue;
-    }
 };
@@ -1,9 +1,19 @@
 class ModeCircle : public ModeBase
 {
 private:
+    // Config, described by the parameter table in the constructor
+    struct Config {
+        int beats;
+    } config;
+
     int circleActiveLedNumber;
 public:
-    ModeCircle() {}
+    ModeCircle() {
+        static constexpr ModeParameter parameters[] = {
+            MODE_PARAMETER(beats, nullptr, "Beats", 0, 64, 0, "Beats per Round", "beats", 1, MODE_PARAM_SHOW_VALUE)
+        };
+        setParameters(parameters, &config);
+    }
 
     virtual void initialize() {
         circleActiveLedNumber = 0;
@@ -27,15 +37,14 @@ public:
           leds[ledIter++] = rightLeds[i];
         }
 
-        // Update the active LED index
-        EVERY_N_MILLISECONDS(40) {
-          circleActiveLedNumber += 1;
-          if (circleActiveLedNumber == NUM_LEDS)
-              circleActiveLedNumber = 0;
+        // Update the active LED index, one LED every 40ms of the animation clock or once round in the set beats
+        int activeLedNumber = (uint32_t)animationPhase(40 * NUM_LEDS, config.beats) * NUM_LEDS / 65536;
+        if (activeLedNumber != circleActiveLedNumber) {
+          circleActiveLedNumber = activeLedNumber;
 
           // Darken all LEDs to slightly dim the previous active LEDs
           fadeToBlackBy(ledString, NUM_LEDS, 80);
-        };
+        }
 
         // And now highlight the active index
         for (i = 0; i < NUM_LEDS; i++) {
@@ -44,8 +53,4 @@ public:
           }
         }
     }
-
-    virtual void applyConfig(JsonVariant& settings) {
-
-    }
 };
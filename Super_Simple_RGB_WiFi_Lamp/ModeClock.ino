@@ -1,19 +1,31 @@
 class ModeClock : public ModeBase
 {
 private:
-    // Config
-    int clockHourRed                 = 128;
-    int clockHourGreen               = 128;
-    int clockHourBlue                = 128;
-    int clockMinRed                  = 128;
-    int clockMinGreen                = 128;
-    int clockMinBlue                 = 128;
+    // Config, described by the parameter table in the constructor
+    struct Config {
+        int hourRed;
+        int hourGreen;
+        int hourBlue;
+        int minRed;
+        int minGreen;
+        int minBlue;
+    } config;
 
     // State
     int clockOnPauseBrightness;
     unsigned long lastClockExecution;
 public:
-    ModeClock() {}
+    ModeClock() {
+        static constexpr ModeParameter parameters[] = {
+            MODE_PARAMETER(hourRed,   "hourColour", "Red",   0, 255, 128, "Hour Red",     "", 1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(hourGreen, "hourColour", "Green", 0, 255, 128, "Hour Green",   "", 1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(hourBlue,  "hourColour", "Blue",  0, 255, 128, "Hour Blue",    "", 1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(minRed,    "minColour",  "Red",   0, 255, 128, "Minute Red",   "", 1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(minGreen,  "minColour",  "Green", 0, 255, 128, "Minute Green", "", 1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(minBlue,   "minColour",  "Blue",  0, 255, 128, "Minute Blue",  "", 1, MODE_PARAM_SHOW_COLOUR)
+        };
+        setParameters(parameters, &config);
+    }
 
     virtual void initialize() {
         clockOnPauseBrightness = 255;
@@ -54,9 +66,9 @@ public:
             FastLED.clear();
 
             // Set the colour of the LED
-            ledString[hourCurrentLED] = CRGB( clockHourRed, clockHourGreen, clockHourBlue);
+            ledString[hourCurrentLED] = CRGB( config.hourRed, config.hourGreen, config.hourBlue);
             ledString[hourNextLED] = ledString[hourCurrentLED];
-            ledString[minuteCurrentLED] = CRGB( clockMinRed, clockMinGreen, clockMinBlue);
+            ledString[minuteCurrentLED] = CRGB( config.minRed, config.minGreen, config.minBlue);
             ledString[minuteNextLED] = ledString[minuteCurrentLED];
 
             // Dim the led correctly
@@ -68,10 +80,10 @@ public:
         else {
             // Set each of the lights colours
             for (int i = 0; i < topNumLeds; i++){
-                ledString[topLeds[i]] = CRGB(clockHourRed, clockHourGreen, clockHourBlue);
+                ledString[topLeds[i]] = CRGB(config.hourRed, config.hourGreen, config.hourBlue);
             }
             for (int i = 0; i < topNumLeds; i++){
-            ledString[bottomLeds[i]] = CRGB(clockMinRed, clockMinGreen, clockMinBlue);
+            ledString[bottomLeds[i]] = CRGB(config.minRed, config.minGreen, config.minBlue);
             }
         
             // Set the brightness up and down
@@ -81,24 +93,14 @@ public:
         }
     }
 
+    // The time can be set through the config as well, it is not a parameter of the mode
     virtual void applyConfig(JsonVariant& settings) {
         if (settings.containsKey("Epoch")){
             settings["Epoch"]  = currentEpochTime = settings["Epoch"] | currentEpochTime;
+            lampClock.step((int64_t)(unsigned long)(currentEpochTime - utcOffset) * 1000, millis());
             setTime(currentEpochTime);
         }
 
-        JsonVariant hourColourSettings = settings["hourColour"];
-        if (hourColourSettings) {
-            hourColourSettings["Red"] = clockHourRed = hourColourSettings["Red"] | clockHourRed;
-            hourColourSettings["Green"] = clockHourGreen = hourColourSettings["Green"] | clockHourGreen;
-            hourColourSettings["Blue"] = clockHourBlue = hourColourSettings["Blue"] | clockHourBlue;
-        }
-
-        JsonVariant minColourSettings = settings["minColour"];
-        if (minColourSettings) {
-            minColourSettings["Red"] = clockMinRed = minColourSettings["Red"] | clockMinRed;
-            minColourSettings["Green"] = clockMinGreen = minColourSettings["Green"] | clockMinGreen;
-            minColourSettings["Blue"]  = clockMinBlue = minColourSettings["Blue"] | clockMinBlue;
-        }
+        ModeBase::applyConfig(settings);
     }
 };
@@ -1,48 +1,38 @@
 class ModeColorWipe : public ModeBase
 {
 private:
-    // State
-    int colorWipePosition;
-    bool TurningOn;
-
-    // Config
-    int colorWipeRed   = 255;
-    int colorWipeGreen = 0;
-    int colorWipeBlue  = 255;
-    int colorWipeSpeed = 20;
+    // Config, described by the parameter table in the constructor
+    struct Config {
+        int red;
+        int green;
+        int blue;
+        int speed;
+        int beats;
+    } config;
 
 public:
-    ModeColorWipe() {}
-
-    virtual void initialize() {
-        colorWipePosition = -1;
-        TurningOn         = true;
+    ModeColorWipe() {
+        static constexpr ModeParameter parameters[] = {
+            MODE_PARAMETER(red,   nullptr, "Red",   0, 255, 255, "Red",             "",             1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(green, nullptr, "Green", 0, 255, 0,   "Green",           "",             1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(blue,  nullptr, "Blue",  0, 255, 255, "Blue",            "",             1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(speed, nullptr, "Speed", 1, 255, 20,  "Wipe Speed",      "milliseconds", 1, MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(beats, nullptr, "Beats", 0, 64,  0,   "Beats per Wipe",  "beats",        1, MODE_PARAM_SHOW_VALUE)
+        };
+        setParameters(parameters, &config);
     }
 
-    virtual void render() {
-        EVERY_N_MILLISECONDS(colorWipeSpeed) {
-            colorWipePosition++;
-            if (TurningOn) {
-              fill_solid(ledString, colorWipePosition, CRGB(colorWipeRed, colorWipeGreen, colorWipeBlue));
-              if (colorWipePosition == NUM_LEDS) {
-                TurningOn = false;
-                colorWipePosition = -1;
-              }
-            }
-            else {
-              fill_solid(ledString, colorWipePosition, CRGB( 0, 0, 0));
-              if (colorWipePosition == NUM_LEDS) {
-                TurningOn = true;
-                colorWipePosition = -1;
-              }
-            }
-        }
-    }
+    virtual void initialize() {}
 
-    virtual void applyConfig(JsonVariant& settings) {
-        settings["Red"] = colorWipeRed = settings["Red"] | colorWipeRed;
-        settings["Green"]= colorWipeGreen = settings["Green"] | colorWipeGreen;
-        settings["Blue"] = colorWipeBlue = settings["Blue"] | colorWipeBlue;
-        settings["Speed"] = colorWipeSpeed = settings["Speed"] | colorWipeSpeed;
+    virtual void render() {
+        // Wipe one LED on every speed ms of the animation clock, then wipe them off again. With beats set each wipe
+        // takes that many beats.
+        unsigned long cycleSteps = 2 * (NUM_LEDS + 1);
+        unsigned long step = (uint32_t)animationPhase(config.speed * cycleSteps, 2 * config.beats) * cycleSteps / 65536;
+        bool turningOn = step <= NUM_LEDS;
+        int colorWipePosition = turningOn ? step : step - (NUM_LEDS + 1);
+        CRGB colour = CRGB(config.red, config.green, config.blue);
+        fill_solid(ledString, colorWipePosition, turningOn ? colour : CRGB(0, 0, 0));
+        fill_solid(ledString + colorWipePosition, NUM_LEDS - colorWipePosition, turningOn ? CRGB(0, 0, 0) : colour);
     }
 };
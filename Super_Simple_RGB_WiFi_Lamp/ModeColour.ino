@@ -1,37 +1,41 @@
 class ModeColour : public ModeBase
 {
 private:
-    // Config
-    int colourRed   = 128;
-    int colourGreen = 128;
-    int colourBlue  = 128;
-    int colourWhite = 0;
-    int colorBrightness = 100;
+    // Config, described by the parameter table in the constructor
+    struct Config {
+        int red;
+        int green;
+        int blue;
+        int white;
+        int brightness;
+    } config;
+
 public:
-    ModeColour() {}
+    ModeColour() {
+        static constexpr ModeParameter parameters[] = {
+            MODE_PARAMETER(red,         nullptr, "Red",         0, 255, 128, "Red",               "", 1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(green,       nullptr, "Green",       0, 255, 128, "Green",             "", 1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(blue,        nullptr, "Blue",        0, 255, 128, "Blue",              "", 1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(white,       nullptr, "White",       0, 255, 0,   "White",             "", 1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(brightness,  nullptr, "Brightness",  0, 255, 100, "Colour Brightness", "", 1, MODE_PARAM_SHOW_PERCENT)
+        };
+        setParameters(parameters, &config);
+    }
     virtual void initialize() {}
 
     virtual void render() {
-      int brightness = colorBrightness;
+      int brightness = config.brightness;
       brightness = constrain(brightness, 0, 255);
       
-      if (colourWhite > 0){
+      if (config.white > 0){
         //have a white request so fill white 
         fill_solid(ledString, NUM_LEDS, CRGBW(0, 0, 0, 255));               
         
       }else{
         //otherwise fill with selected colours
-        fill_solid(ledString, NUM_LEDS, CRGB(colourRed, colourGreen, colourBlue));
+        fill_solid(ledString, NUM_LEDS, CRGB(config.red, config.green, config.blue));
       }
 
       FastLED.setBrightness(brightness);
     }
-
-    virtual void applyConfig(JsonVariant& settings) {
-        settings["Red"] = colourRed = settings["Red"] | colourRed;
-        settings["Green"] = colourGreen = settings["Green"] | colourGreen;
-        settings["Blue"] = colourBlue = settings["Blue"] | colourBlue;
-        settings["White"] = colourWhite = settings["White"] | colourWhite;
-        settings["Brightness"] = colorBrightness = settings["Brightness"] | colorBrightness;
-    }
 };
@@ -1,23 +1,37 @@
 class ModeConfetti : public ModeBase
 {
 private:
+    // Config, described by the parameter table in the constructor
+    struct Config {
+        int speed;
+        int perBeat;
+    } config;
+
     // State
     bool confettiActive;
     int confettiPixel;
-
-    // Config
-    int confettiSpeed = 100;
+    uint32_t confettiStep;
 
 public:
-    ModeConfetti() {}
+    ModeConfetti() {
+        static constexpr ModeParameter parameters[] = {
+            MODE_PARAMETER(speed,   nullptr, "Speed",         10, 255, 100, "Confetti Speed", "milliseconds", 5, MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(perBeat, nullptr, "Dots Per Beat", 0,  8,   0,   "Dots per Beat",  "",             1, MODE_PARAM_SHOW_VALUE)
+        };
+        setParameters(parameters, &config);
+    }
 
     virtual void initialize() {
         confettiActive = true;
         confettiPixel = random(NUM_LEDS);
+        confettiStep = animationSteps(config.speed, config.perBeat);
     }
 
     virtual void render() {
-        EVERY_N_MILLISECONDS(confettiSpeed) {
+        // A dot every speed ms, or on the beat with dots per beat set
+        uint32_t step = animationSteps(config.speed, config.perBeat);
+        if (step != confettiStep) {
+          confettiStep = step;
           if (confettiActive) {
             confettiPixel = random(NUM_LEDS);
             fadeToBlackBy(ledString, NUM_LEDS, 10);
@@ -26,12 +40,4 @@ public:
           }
         }
     }
-
-    virtual void applyConfig(JsonVariant& settings) {
-        // Are not used
-        //settings["Red"] = confettiRed = settings["Red"] | confettiRed;
-        //settings["Green"]= confettiGreen = settings["Green"] | confettiGreen;
-        //settings["Blue"] = confettiBlue = settings["Blue"] | confettiBlue;
-        settings["Speed"] = confettiSpeed = settings["Speed"] | confettiSpeed;
-    }
 };
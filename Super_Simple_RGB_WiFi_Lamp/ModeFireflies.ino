@@ -3,22 +3,34 @@
 class ModeFireflies : public ModeBase
 {
 private:
-    unsigned long nextFlash[NUM_LEDS];
+    // Config, described by the parameter table in the constructor
+    struct Config {
+        unsigned int minimumFlashDelay;     // in milliseconds
+        unsigned int maximumFlashDelay;     // in milliseconds
+        int          flashLength;           // in milliseconds
+        uint8_t      brightness;
+        uint8_t      hue;
+    } config;
 
-    unsigned int minimumFlashDelay = 1000; // in milliseconds
-    unsigned int maximumFlashDelay = 5000; // in milliseconds
-    int flashLength = 2500;                // in milliseconds
-    int halfFlashLength = flashLength / 2;
-    uint8_t brightness = 255;
-    uint8_t hue = 160;
+    unsigned long nextFlash[NUM_LEDS];
+    int halfFlashLength;
 
 public:
     ModeFireflies()
     {
-        unsigned long initialBaseTime = millis() - flashLength;
+        static constexpr ModeParameter parameters[] = {
+            MODE_PARAMETER(minimumFlashDelay, nullptr, "MinimumFlashDelay", 100, 30000, 1000, "Minimum Flash Delay", "milliseconds", 100, MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(maximumFlashDelay, nullptr, "MaximumFlashDelay", 100, 30000, 5000, "Maximum Flash Delay", "milliseconds", 100, MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(flashLength,       nullptr, "FlashLength",       50,  15000, 2500, "Flash Length",        "milliseconds", 50,  MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(brightness,        nullptr, "Brightness",        0,   255,   255,  "Brightness",          "",             1,   MODE_PARAM_SHOW_PERCENT),
+            MODE_PARAMETER(hue,               nullptr, "Hue",               0,   255,   160,  "Hue",                 "",             1,   MODE_PARAM_SHOW_HUE)
+        };
+        setParameters(parameters, &config);
+        configChanged();
+        unsigned long initialBaseTime = millis() - config.flashLength;
         for (int i = 0; i < NUM_LEDS; i++)
         {
-            nextFlash[i] = initialBaseTime + random16(maximumFlashDelay + flashLength);
+            nextFlash[i] = initialBaseTime + random16(config.maximumFlashDelay + config.flashLength);
         }
     }
 
@@ -39,9 +51,9 @@ public:
                     //continue;
                     value = 0;
                 }
-                else if (flashTime > flashLength)
+                else if (flashTime > config.flashLength)
                 {
-                    nextFlash[i] = now + random16(minimumFlashDelay, maximumFlashDelay);
+                    nextFlash[i] = now + random16(config.minimumFlashDelay, config.maximumFlashDelay);
                     value = 0;
                 }
                 else if (true)
@@ -50,39 +62,32 @@ public:
                 }
                 else if (flashTime > halfFlashLength)
                 {
-                    value = ease8InOutApprox(255 * (flashLength - flashTime) / halfFlashLength);
+                    value = ease8InOutApprox(255 * (config.flashLength - flashTime) / halfFlashLength);
                 }
                 else
                 {
                     // Brightness peaks in the very middle
-                    //int value = cos(2 * PI * flashTime / flashLength) * -127 + 127;
+                    //int value = cos(2 * PI * flashTime / config.flashLength) * -127 + 127;
 
                     // Bright peaks at 33% of the duration then falls off slowly
-                    //int value = cos(2 * PI * pow(flashLength - flashTime, 2) / pow(flashLength, 2)) * -127 + 127;
+                    //int value = cos(2 * PI * pow(config.flashLength - flashTime, 2) / pow(config.flashLength, 2)) * -127 + 127;
 
                     // Ease Curve which peaks at the end
                     value = ease8InOutApprox(255 * flashTime / halfFlashLength);
                 }
-                ledString[i] = CHSV(hue, 255, value);
+                ledString[i] = CHSV(config.hue, 255, value);
             }
-            FastLED.setBrightness(brightness);
+            FastLED.setBrightness(config.brightness);
         }
     }
 
-    virtual void applyConfig(JsonVariant &settings)
+protected:
+    virtual void configChanged()
     {
-        minimumFlashDelay = settings["MinimumFlashDelay"] | minimumFlashDelay;
-        maximumFlashDelay = settings["MaximumFlashDelay"] | maximumFlashDelay;
-        if (maximumFlashDelay < minimumFlashDelay)
+        if (config.maximumFlashDelay < config.minimumFlashDelay)
         {
-            std::swap(minimumFlashDelay, maximumFlashDelay);
+            std::swap(config.minimumFlashDelay, config.maximumFlashDelay);
         }
-        settings["MinimumFlashDelay"] = minimumFlashDelay;
-        settings["MaximumFlashDelay"] = maximumFlashDelay;
-
-        settings["Hue"] = hue = settings["Hue"] | hue;
-        settings["Brightness"] = brightness = settings["Brightness"] | brightness;
-        settings["FlashLength"] = flashLength = settings["FlashLength"] | flashLength;
-        halfFlashLength = flashLength / 2;
+        halfFlashLength = config.flashLength / 2;
     }
-};
\ No newline at end of file
+};
@@ -1,41 +1,47 @@
 class ModeNightRider : public ModeBase
 {
 private:
-    int nightRiderTopLedNumber;
-    int nightRiderBottomLedNumber;
-    int nightRiderTopIncrement;
-    int nightRiderBottomIncrement;
+    // Config, described by the parameter table in the constructor
+    struct Config {
+        int beats;
+    } config;
+
+    unsigned long nightRiderStep;
+
+    // Position of the LED after the given number of steps, going back and forth along a side
+    int bounce(unsigned long step, int count) {
+        if (count < 2) return 0;
+        int position = step % (2 * (count - 1));
+        return position < count ? position : 2 * (count - 1) - position;
+    }
+
 public:
-    ModeNightRider() {}
+    ModeNightRider() {
+        static constexpr ModeParameter parameters[] = {
+            MODE_PARAMETER(beats, nullptr, "Beats", 0, 32, 0, "Beats per Sweep", "beats", 1, MODE_PARAM_SHOW_VALUE)
+        };
+        setParameters(parameters, &config);
+    }
 
     virtual void initialize() {
-        nightRiderTopLedNumber    = 0;
-        nightRiderBottomLedNumber = 0;
-        nightRiderTopIncrement    = 1;
-        nightRiderBottomIncrement = 1;
+        nightRiderStep = (unsigned long)-1;
     }
 
     virtual void render() {
+        // Take the step from the animation clock, so lamps in a sync group move together. A sweep there and back
+        // takes the set beats, and starts on a downbeat.
         int delayTime = 500 / topNumLeds;
-        EVERY_N_MILLISECONDS(delayTime) {
-          // Set the current LED to Red
-          ledString[topLeds[nightRiderTopLedNumber]] = CRGB(255, 0, 0);
-          ledString[bottomLeds[nightRiderBottomLedNumber]] = CRGB::Red;
-          // Serial.println(nightRiderTopLedNumber);
-          // Serial.println(ledString[topLeds[0]]);
+        unsigned long sweepSteps = 2 * (topNumLeds > 1 ? topNumLeds - 1 : 1);
+        unsigned long step = (uint32_t)animationPhase(delayTime * sweepSteps, config.beats) * sweepSteps / 65536;
+        if (step != nightRiderStep) {
+          nightRiderStep = step;
 
-          //  Increment the LED number
-          nightRiderTopLedNumber = nightRiderTopLedNumber + nightRiderTopIncrement;
-          nightRiderBottomLedNumber = nightRiderBottomLedNumber + nightRiderBottomIncrement;
-          if (nightRiderTopLedNumber >= topNumLeds - 1 || nightRiderTopLedNumber <= 0) nightRiderTopIncrement = -nightRiderTopIncrement;
-          if (nightRiderBottomLedNumber >= bottomNumLeds - 1 || nightRiderBottomLedNumber <= 0) nightRiderBottomIncrement = -nightRiderBottomIncrement;
+          // Set the current LED to Red
+          ledString[topLeds[bounce(step, topNumLeds)]] = CRGB(255, 0, 0);
+          ledString[bottomLeds[bounce(step, bottomNumLeds)]] = CRGB::Red;
 
           // Start fading all lit leds
           fadeToBlackBy( ledString, NUM_LEDS, 10);
-        };
-    }
-
-    virtual void applyConfig(JsonVariant& settings) {
-
+        }
     }
 };
@@ -0,0 +1,147 @@
+/* ModeParameters
+ *
+ * Declarative config of the modes. A mode keeps its config in a plain
+ * struct and describes every member in a table: JSON key, type, range,
+ * default, offset in the struct and how the website shows it. The generic
+ * code in ModeBase applies, clamps and serializes the config from the table
+ * and the website builds its controls from it, so a new setting is one more
+ * line in the table.
+ *
+ * The order of the table is also the layout of the mode block in the binary
+ * config snapshot, every parameter is packed with the size of its type. New
+ * parameters must only be appended.
+ *
+ * Nothing in here depends on the Arduino core.
+*/
+
+#ifndef ModeParameters_h
+#define ModeParameters_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+enum ModeParameterType : uint8_t {
+  MODE_PARAM_INT32 = 0,
+  MODE_PARAM_UINT32,
+  MODE_PARAM_UINT16,
+  MODE_PARAM_UINT8
+};
+
+// How the website shows a parameter
+enum ModeParameterShow : uint8_t {
+  MODE_PARAM_SHOW_VALUE = 0,  // slider with the raw value and unit
+  MODE_PARAM_SHOW_PERCENT,    // slider, 0 - 255 shown as percent
+  MODE_PARAM_SHOW_HUE,        // slider, 0 - 255 shown as degrees
+  MODE_PARAM_SHOW_FREQUENCY,  // slider over a sample period in us, shown as the displayed frequency range
+  MODE_PARAM_SHOW_COLOUR      // channel of a colour picker, no slider
+};
+
+struct ModeParameter {
+  const char*         name;           // JSON key
+  const char*         group;          // JSON object the key is nested in, nullptr if there is none
+  ModeParameterType   type;
+  uint16_t            offset;         // offset of the member in the config struct
+  int32_t             minimum;
+  int32_t             maximum;
+  int32_t             defaultValue;
+  const char*         label;
+  const char*         unit;
+  uint16_t            step;
+  ModeParameterShow   show;
+};
+
+template <typename T> struct ModeParameterTypeOf;
+template <> struct ModeParameterTypeOf<int>             { static const ModeParameterType type = MODE_PARAM_INT32; };
+template <> struct ModeParameterTypeOf<unsigned int>    { static const ModeParameterType type = MODE_PARAM_UINT32; };
+template <> struct ModeParameterTypeOf<uint16_t>        { static const ModeParameterType type = MODE_PARAM_UINT16; };
+template <> struct ModeParameterTypeOf<uint8_t>         { static const ModeParameterType type = MODE_PARAM_UINT8; };
+
+// Table entry for a member of the Config struct of the mode the table belongs to
+#define MODE_PARAMETER(member, group, name, minimum, maximum, defaultValue, label, unit, step, show) \
+  { name, group, ModeParameterTypeOf<decltype(Config::member)>::type, offsetof(Config, member), minimum, maximum, defaultValue, label, unit, step, show }
+
+inline uint8_t modeParameterSize(ModeParameterType type) {
+  switch (type) {
+    case MODE_PARAM_UINT16 : return 2;
+    case MODE_PARAM_UINT8  : return 1;
+    default                : return 4;
+  }
+}
+
+// Read a value of the given type, data does not need to be aligned
+inline int32_t modeParameterRead(ModeParameterType type, const uint8_t* data) {
+  switch (type) {
+    case MODE_PARAM_UINT32 : { uint32_t value; memcpy(&value, data, sizeof(value)); return value; }
+    case MODE_PARAM_UINT16 : { uint16_t value; memcpy(&value, data, sizeof(value)); return value; }
+    case MODE_PARAM_UINT8  : return *data;
+    default                : { int32_t value; memcpy(&value, data, sizeof(value)); return value; }
+  }
+}
+
+inline void modeParameterWrite(ModeParameterType type, uint8_t* data, int32_t value) {
+  switch (type) {
+    case MODE_PARAM_UINT32 : { uint32_t typed = value; memcpy(data, &typed, sizeof(typed)); } break;
+    case MODE_PARAM_UINT16 : { uint16_t typed = value; memcpy(data, &typed, sizeof(typed)); } break;
+    case MODE_PARAM_UINT8  : *data = value; break;
+    default                : memcpy(data, &value, sizeof(value)); break;
+  }
+}
+
+inline int32_t modeParameterGet(const ModeParameter& parameter, const void* config) {
+  return modeParameterRead(parameter.type, (const uint8_t*)config + parameter.offset);
+}
+
+inline int32_t modeParameterClamp(const ModeParameter& parameter, int32_t value) {
+  return (value < parameter.minimum) ? parameter.minimum : (value > parameter.maximum) ? parameter.maximum : value;
+}
+
+// Clamp the value to the range of the parameter and store it, returns true if the config changed
+inline bool modeParameterSet(const ModeParameter& parameter, void* config, int32_t value) {
+  value = modeParameterClamp(parameter, value);
+  if (modeParameterGet(parameter, config) == value) return false;
+  modeParameterWrite(parameter.type, (uint8_t*)config + parameter.offset, value);
+  return true;
+}
+
+inline void modeParametersReset(const ModeParameter* table, uint8_t count, void* config) {
+  for (uint8_t i = 0; i < count; i++) {
+    modeParameterWrite(table[i].type, (uint8_t*)config + table[i].offset, table[i].defaultValue);
+  }
+}
+
+// Pack the config in table order, returns the number of bytes written
+inline uint8_t modeParametersPack(const ModeParameter* table, uint8_t count, const void* config, uint8_t* data) {
+  uint8_t length = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    memcpy(data + length, (const uint8_t*)config + table[i].offset, modeParameterSize(table[i].type));
+    length += modeParameterSize(table[i].type);
+  }
+  return length;
+}
+
+// Unpack a config written by modeParametersPack(). Parameters missing from shorter (older) data keep their value,
+// all values are clamped to their range. Returns true if the config changed.
+inline bool modeParametersUnpack(const ModeParameter* table, uint8_t count, void* config, const uint8_t* data, uint8_t length) {
+  bool changed = false;
+  uint8_t position = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    uint8_t size = modeParameterSize(table[i].type);
+    if (position + size > length) break;
+    changed |= modeParameterSet(table[i], config, modeParameterRead(table[i].type, data + position));
+    position += size;
+  }
+  return changed;
+}
+
+inline const char* modeParameterShowName(ModeParameterShow show) {
+  switch (show) {
+    case MODE_PARAM_SHOW_PERCENT   : return "Percent";
+    case MODE_PARAM_SHOW_HUE       : return "Hue";
+    case MODE_PARAM_SHOW_FREQUENCY : return "Frequency";
+    case MODE_PARAM_SHOW_COLOUR    : return "Colour";
+    default                        : return "Value";
+  }
+}
+
+#endif
@@ -1,40 +1,41 @@
 class ModeRainbow : public ModeBase
 {
 private:
-    // Config
-    int rainbowStartHue = 0;
-    int rainbowSpeed    = 10;
-    int rainbowBri      = 100;
-
-    // State
-    float rainbowAddedHue;
+    // Config, described by the parameter table in the constructor
+    struct Config {
+        int startHue;
+        int speed;
+        int brightness;
+        int beats;
+    } config;
 
 public:
-    ModeRainbow() {}
-
-    virtual void initialize() {
-        rainbowAddedHue = 0;
+    ModeRainbow() {
+        static constexpr ModeParameter parameters[] = {
+            MODE_PARAMETER(startHue,    nullptr, "Hue",         0, 255, 0,   "Start Hue",           "",        1, MODE_PARAM_SHOW_HUE),
+            MODE_PARAMETER(speed,       nullptr, "Speed",       0, 10,  10,  "Rainbow Speed",       "seconds", 1, MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(brightness,  nullptr, "Brightness",  0, 255, 100, "Rainbow Brightness",  "",        1, MODE_PARAM_SHOW_PERCENT),
+            MODE_PARAMETER(beats,       nullptr, "Beats",       0, 64,  0,   "Beats per Rainbow",   "beats",   1, MODE_PARAM_SHOW_VALUE)
+        };
+        setParameters(parameters, &config);
     }
 
+    virtual void initialize() {}
+
     virtual void render() {
-        int startHue = rainbowStartHue;
-        int speed = rainbowSpeed;
-        int brightness = rainbowBri;
+        int startHue = config.startHue;
+        int speed = config.speed;
+        int brightness = config.brightness;
 
         // Constrain the variables before using
         startHue = constrain(startHue, 0, 255);
         speed = speed > 0 ? speed : 0;
         brightness = constrain(brightness, 0, 255);  
 
-        // Update the hue by 1 every 360th of the allocated time
-        if (speed > 0) {
-          float rainbowDeltaHue = (255 / ((float)speed * 1000)) * 50;
-          EVERY_N_MILLISECONDS(50) {
-            rainbowAddedHue += rainbowDeltaHue;
-            rainbowAddedHue = (rainbowAddedHue > 255) ? rainbowAddedHue - 255 : rainbowAddedHue;
-          };
-
-          startHue += (int)rainbowAddedHue;
+        // Go round the colour wheel once in the allocated time, taken from the animation clock so lamps in a sync
+        // group show the same hue. With beats set it goes round once in that many beats of the music.
+        if (speed > 0 || (config.beats > 0 && beatClock.running())) {
+          startHue += animationPhase((unsigned long)speed * 1000, config.beats) * 255 / 65536;
         }
 
         // Calculate the rainbow so it lines up
@@ -48,10 +49,4 @@ public:
 
         FastLED.setBrightness(brightness);
     }
-
-    virtual void applyConfig(JsonVariant& settings) {
-        settings["Hue"] = rainbowStartHue = settings["Hue"] | rainbowStartHue;
-        settings["Speed"] = rainbowSpeed = settings["Speed"] | rainbowSpeed;
-        settings["Brightness"] = rainbowBri = settings["Brightness"] | rainbowBri;
-    }
 };
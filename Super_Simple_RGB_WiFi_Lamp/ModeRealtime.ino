@@ -0,0 +1,102 @@
+class ModeRealtime : public ModeBase
+{
+private:
+    // Config, described by the parameter table in the constructor
+    struct Config {
+        int timeout;
+        int universe;
+        int startChannel;
+        int channels;
+        int jitterDelay;
+    } config;
+
+    // The brightness is scaled into ledString every frame, so the pushed pixels are kept here
+    CRGBW framePixels[NUM_LEDS];
+    CRGBW pendingPixels[NUM_LEDS];
+    unsigned long lastFrameTime = 0;
+    bool frameReceived = false;
+
+    // Complete frames waiting for the jitter delay, oldest first
+    CRGBW queuedPixels[REALTIME_JITTER_FRAMES][NUM_LEDS];
+    unsigned long queuedTime[REALTIME_JITTER_FRAMES];
+    uint8_t queueFirst = 0;
+    uint8_t queueCount = 0;
+
+public:
+    ModeRealtime() {
+        static constexpr ModeParameter parameters[] = {
+            MODE_PARAMETER(timeout,       nullptr, "Timeout",       1, 60,    3,  "Timeout",              "s",  1, MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(universe,      nullptr, "Universe",      0, 63999, 1,  "Universe",             "",   1, MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(startChannel,  nullptr, "Start Channel", 1, 512,   1,  "Start Channel",        "",   1, MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(channels,      nullptr, "Channels",      3, 4,     3,  "Channels per Pixel",   "",   1, MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(jitterDelay,   nullptr, "Jitter Delay",  0, 250,   20, "Jitter Delay",         "ms", 5, MODE_PARAM_SHOW_VALUE)
+        };
+        setParameters(parameters, &config);
+    }
+    virtual void initialize() {}
+
+    virtual void render() {
+      // Show the newest frame that has waited for the jitter delay, older ones are skipped
+      uint8_t due = 0;
+      while (due < queueCount && millis() - queuedTime[(queueFirst + due) % REALTIME_JITTER_FRAMES] >= (unsigned long)config.jitterDelay) due++;
+      if (due > 0) {
+        memcpy((void*)framePixels, queuedPixels[(queueFirst + due - 1) % REALTIME_JITTER_FRAMES], sizeof(framePixels));
+        realtimeStats.dropped += due - 1;
+        queueFirst = (queueFirst + due) % REALTIME_JITTER_FRAMES;
+        queueCount -= due;
+      }
+
+      memcpy((void*)ledString, framePixels, sizeof(framePixels));
+      FastLED.setBrightness(255);
+    }
+
+    // Copy the pixels of a message into the frame being received, returns false if they do not fit the string
+    bool setPixels(uint16_t start, const uint8_t* data, size_t count, bool withWhite) {
+      if (start + count > NUM_LEDS) return false;
+      for (size_t i = 0; i < count; i++) {
+        if (withWhite) pendingPixels[start + i] = CRGBW(data[0], data[1], data[2], data[3]);
+        else pendingPixels[start + i] = CRGBW(data[0], data[1], data[2], 0);
+        data += withWhite ? 4 : 3;
+      }
+      return true;
+    }
+
+    // The frame is complete, it is shown once it has waited for the jitter delay. The pending pixels are kept, so
+    // the next frame only needs to send what changed.
+    void showFrame() {
+      lastFrameTime = millis();
+      frameReceived = true;
+      if (config.jitterDelay == 0) {
+        memcpy((void*)framePixels, pendingPixels, sizeof(pendingPixels));
+        queueCount = 0;
+        return;
+      }
+
+      // A full queue means the frames come faster than the delay lets them out, drop the oldest
+      if (queueCount == REALTIME_JITTER_FRAMES) {
+        queueFirst = (queueFirst + 1) % REALTIME_JITTER_FRAMES;
+        queueCount--;
+        realtimeStats.dropped++;
+      }
+      uint8_t slot = (queueFirst + queueCount) % REALTIME_JITTER_FRAMES;
+      memcpy((void*)queuedPixels[slot], pendingPixels, sizeof(pendingPixels));
+      queuedTime[slot] = lastFrameTime;
+      queueCount++;
+    }
+
+    // True while frames keep coming in
+    bool receiving() {
+      return frameReceived && millis() - lastFrameTime <= (unsigned long)config.timeout * 1000;
+    }
+
+    // Where the pixels are in the universes of E1.31 and Art-Net
+    LightingMapping mapping() const {
+      return { (uint16_t)config.universe, (uint16_t)config.startChannel, (uint8_t)config.channels, NUM_LEDS };
+    }
+
+protected:
+    virtual void configChanged() {
+      // Join the multicast group of the new universe
+      realtimeUdpRestart = true;
+    }
+};
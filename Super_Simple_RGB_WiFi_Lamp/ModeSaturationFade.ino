@@ -1,11 +1,22 @@
 class ModeSaturationFade : public ModeBase
 {
 private:
-    uint8_t fadeHue = 171;
-    int fadeSpeed = 10;
+    // Config, described by the parameter table in the constructor
+    struct Config {
+        uint8_t hue;
+        int     speed;
+        int     beats;
+    } config;
 
 public:
-    ModeSaturationFade() {}
+    ModeSaturationFade() {
+        static constexpr ModeParameter parameters[] = {
+            MODE_PARAMETER(hue,   nullptr, "Hue",   0, 255, 171, "Hue",             "",        1, MODE_PARAM_SHOW_HUE),
+            MODE_PARAMETER(speed, nullptr, "Speed", 0, 10,  10,  "Fade Speed",      "seconds", 1, MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(beats, nullptr, "Beats", 0, 64,  0,   "Beats per Fade",  "beats",   1, MODE_PARAM_SHOW_VALUE)
+        };
+        setParameters(parameters, &config);
+    }
 
     virtual void initialize() {}
 
@@ -13,19 +24,13 @@ public:
     {
         EVERY_N_MILLISECONDS(10)
         {
-            fadeSpeed = (fadeSpeed == 0) ? 1 : fadeSpeed;
-            int fadeOffset = millis() / (fadeSpeed * 1000 / NUM_LEDS) % NUM_LEDS;
+            int fadeSpeed = (config.speed == 0) ? 1 : config.speed;
+            int fadeOffset = (uint32_t)animationPhase(fadeSpeed * 1000 / NUM_LEDS * NUM_LEDS, config.beats) * NUM_LEDS / 65536;
             for (int led = 0; led < NUM_LEDS; led++)
             {
                 uint8_t saturation = sin8(((led + fadeOffset) % 255) * 255 / NUM_LEDS);
-                ledString[led].setHSV(fadeHue, saturation, 100);
+                ledString[led].setHSV(config.hue, saturation, 100);
             }
         }
     }
-
-    virtual void applyConfig(JsonVariant &settings)
-    {
-        settings["Hue"] = fadeHue = settings["Hue"] | fadeHue;
-        settings["Speed"] = fadeSpeed = settings["Speed"] | fadeSpeed;
-    }
 };
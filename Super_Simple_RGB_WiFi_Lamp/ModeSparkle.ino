@@ -2,18 +2,28 @@ class ModeSparkle : public ModeBase
 {
 
 private:
-    // Config
-    int sparkleSpeed  = 30;
-    int sparkleRed    = 128;
-    int sparkleGreen  = 128;
-    int sparkleBlue   = 128;
+    // Config, described by the parameter table in the constructor
+    struct Config {
+        int speed;
+        int red;
+        int green;
+        int blue;
+    } config;
 
     // State
     bool sparkleActive;
     int sparklePixel;
 
 public:
-    ModeSparkle() {}
+    ModeSparkle() {
+        static constexpr ModeParameter parameters[] = {
+            MODE_PARAMETER(speed, nullptr, "Speed", 10, 255, 30,  "Sparkle Speed", "milliseconds", 5, MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(red,   nullptr, "Red",   0,  255, 128, "Red",           "",             1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(green, nullptr, "Green", 0,  255, 128, "Green",         "",             1, MODE_PARAM_SHOW_COLOUR),
+            MODE_PARAMETER(blue,  nullptr, "Blue",  0,  255, 128, "Blue",          "",             1, MODE_PARAM_SHOW_COLOUR)
+        };
+        setParameters(parameters, &config);
+    }
 
     virtual void initialize() {
         sparkleActive = true;
@@ -21,10 +31,10 @@ public:
     }
 
     virtual void render() {
-        EVERY_N_MILLISECONDS(sparkleSpeed) {
+        EVERY_N_MILLISECONDS(config.speed) {
             if (sparkleActive) {
               sparklePixel = random(NUM_LEDS);
-              ledString[sparklePixel] = CRGB(sparkleRed, sparkleGreen, sparkleBlue);
+              ledString[sparklePixel] = CRGB(config.red, config.green, config.blue);
             }
             else {
               ledString[sparklePixel] = CRGB(0, 0, 0);
@@ -32,11 +42,4 @@ public:
             sparkleActive = !sparkleActive;
         }
     }
-
-    virtual void applyConfig(JsonVariant& settings) {
-        settings["Red"] = sparkleRed = settings["Red"] | sparkleRed;
-        settings["Green"]= sparkleGreen = settings["Green"] | sparkleGreen;
-        settings["Blue"] = sparkleBlue = settings["Blue"] | sparkleBlue;
-        settings["Speed"] = sparkleSpeed = settings["Speed"] | sparkleSpeed;
-    }
 };
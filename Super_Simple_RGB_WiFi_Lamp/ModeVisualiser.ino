@@ -1,8 +1,21 @@
 #define VISUALISER_NUM_SAMPLES 64
+#define VISUALISER_BASS_BINS   4
 
 class ModeVisualiser : public ModeBase
 {
 private:
+    // Config, described by the parameter table in the constructor
+    struct Config {
+        uint16_t period;
+        uint16_t minThreshold;
+        uint16_t maxThreshold;
+        uint8_t  fadeUp;
+        uint8_t  fadeDown;
+        uint8_t  hueOffset;
+        uint8_t  adcFallback;
+        uint8_t  jitterDelay;
+    } config;
+
     // State
     ADC_MODE(ADC_TOUT);
     arduinoFFT FFT = arduinoFFT();
@@ -11,15 +24,20 @@ private:
     unsigned long visualiserLastSampleTime;
     uint8_t visualiserNumBinsToSkip;
 
-    // Config
-    uint16_t visualiserPeriod        = 250;
-    uint16_t visualiserMinThreshold  = 100;
-    uint16_t visualiserMaxThreshold  = 750;
-    uint8_t visualiserFadeUp         = 32;
-    uint8_t visualiserFadeDown       = 32;
-    uint8_t visualiserHueOffset      = 170;
 public:
-    ModeVisualiser() {}
+    ModeVisualiser() {
+        static constexpr ModeParameter parameters[] = {
+            MODE_PARAMETER(period,        nullptr, "Period",       100, 2000, 250, "Frequency Range",   "", 50, MODE_PARAM_SHOW_FREQUENCY),
+            MODE_PARAMETER(minThreshold,  nullptr, "MinThreshold", 0,   300,  100, "Minimum Threshold", "", 10, MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(maxThreshold,  nullptr, "MaxThreshold", 400, 3000, 750, "Maximum Threshold", "", 50, MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(fadeUp,        nullptr, "FadeUp",       0,   255,  32,  "Fade Up Delay",     "", 1,  MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(fadeDown,      nullptr, "FadeDown",     0,   255,  32,  "Fade Down Delay",   "", 1,  MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(hueOffset,     nullptr, "HueOffset",    0,   255,  170, "Hue Offset",        "", 1,  MODE_PARAM_SHOW_HUE),
+            MODE_PARAMETER(adcFallback,   nullptr, "ADC Fallback", 0,   1,    1,   "ADC Fallback",      "", 1,  MODE_PARAM_SHOW_VALUE),
+            MODE_PARAMETER(jitterDelay,   nullptr, "Jitter Delay", 0,   250,  40,  "Jitter Delay",      "ms", 5, MODE_PARAM_SHOW_VALUE)
+        };
+        setParameters(parameters, &config);
+    }
 
     virtual void initialize() {
         visualiserLastSampleTime = 0;
@@ -27,111 +45,138 @@ public:
     }
 
     virtual void render() {
-        // Only use visualiser when not trying to access the NTP server
-        if (((WiFi.isConnected() && ntpTimeSet) || softApStarted) && !webSocketConnecting) {
-          // ************* ADC Reading *************
-          // Turn off interupts
-          system_soft_wdt_stop();
-          ets_intr_lock( ); //close interrupt
-          noInterrupts();
-
-          // Set up the buffer
-          int       sampleNumber = 0;
-          uint16_t  sampleBuffer[1];
-
-          // Read the first value - seems to be invalid on first read?
+        // Audio streamed by a host comes first, a block is shown once it waited for the jitter delay
+        if (audioReceiving()) {
+          AudioFrame frame;
+          if (!audioQueue.pop(millis(), config.jitterDelay, frame)) return;
+          if (frame.type == AUDIO_STREAM_PCM) {
+            // Move the samples to the range of the ADC, so the thresholds work the same for both
+            for (int i = 0; i < VISUALISER_NUM_SAMPLES; i++) {
+              visualiserRealSamples[i]      = frame.values[i] / 64.0 + 512;
+              visualiserImaginarySamples[i] = 0.0;
+            }
+            computeSpectrum();
+          }
+          else {
+            for (int i = 0; i <= VISUALISER_NUM_SAMPLES / 2; i++) {
+              visualiserRealSamples[i] = i < frame.count ? frame.values[i] : 0;
+            }
+          }
+          showSpectrum();
+        }
+        // Only use the ADC when not trying to access the NTP server
+        else if (config.adcFallback && ((WiFi.isConnected() && ntpState == NTP_STATE_IDLE) || softApStarted) && !webSocketConnecting) {
+          sampleAdc();
+          computeSpectrum();
+          showSpectrum();
+        }
+        else {
+          // Let the light fade out while there is nothing to show
+          fadeToBlackBy(ledString, NUM_LEDS, config.fadeDown);
+        }
+    }
+
+    // Sample the ADC with the interrupts off, which holds up everything else for the length of the block
+    void sampleAdc() {
+        // ************* ADC Reading *************
+        // Turn off interupts
+        system_soft_wdt_stop();
+        ets_intr_lock( ); //close interrupt
+        noInterrupts();
+
+        // Set up the buffer
+        int       sampleNumber = 0;
+        uint16_t  sampleBuffer[1];
+
+        // Read the first value - seems to be invalid on first read?
+        system_adc_read_fast(sampleBuffer, 1, 8);
+
+        // Sample the ADC until buffer is full
+        unsigned long adcBufferTime = micros();
+        while (sampleNumber < VISUALISER_NUM_SAMPLES) {
+          // Get the ADC reading
+          adcBufferTime = micros();
           system_adc_read_fast(sampleBuffer, 1, 8);
 
-          // Constrain the period
-          visualiserPeriod = constrain(visualiserPeriod, 0, 2000);
-
-          // Sample the ADC until buffer is full
-          unsigned long adcBufferTime = micros();
-          while (sampleNumber < VISUALISER_NUM_SAMPLES) {
-            // Get the ADC reading
-            adcBufferTime = micros();
-            system_adc_read_fast(sampleBuffer, 1, 8);
-
-            // If the correct period of time has passed store the reading
-            if (sampleNumber < VISUALISER_NUM_SAMPLES && adcBufferTime - visualiserLastSampleTime > visualiserPeriod) {
-              visualiserRealSamples[sampleNumber]       = sampleBuffer[0];
-              visualiserImaginarySamples[sampleNumber]  = 0.0;
-              visualiserLastSampleTime                  = adcBufferTime;
-              sampleNumber++;
-            }
+          // If the correct period of time has passed store the reading
+          if (sampleNumber < VISUALISER_NUM_SAMPLES && adcBufferTime - visualiserLastSampleTime > config.period) {
+            visualiserRealSamples[sampleNumber]       = sampleBuffer[0];
+            visualiserImaginarySamples[sampleNumber]  = 0.0;
+            visualiserLastSampleTime                  = adcBufferTime;
+            sampleNumber++;
           }
+        }
+
+        // Turn interupts back on
+        interrupts();
+        ets_intr_unlock(); //open interrupt
+        system_soft_wdt_restart();
+
+        // Debug for ADC - Should be centered around 512
+        // for (int i = 0; i < VISUALISER_NUM_SAMPLES; i++) {
+        //   Serial.println(visualiserRealSamples[i]);
+        // }
+    }
+
+    // Run the FFT over the samples, the magnitudes of the bins replace them
+    void computeSpectrum() {
+        FFT.Windowing(visualiserRealSamples, VISUALISER_NUM_SAMPLES, FFT_WIN_TYP_HAMMING, FFT_FORWARD);
+        FFT.Compute(visualiserRealSamples, visualiserImaginarySamples, VISUALISER_NUM_SAMPLES, FFT_FORWARD);
+        FFT.ComplexToMagnitude(visualiserRealSamples, visualiserImaginarySamples, VISUALISER_NUM_SAMPLES);
+    }
 
-          // Turn interupts back on
-          interrupts();
-          ets_intr_unlock(); //open interrupt
-          system_soft_wdt_restart();
-
-          // Debug for ADC - Should be centered around 512
-          // for (int i = 0; i < VISUALISER_NUM_SAMPLES; i++) {
-          //   Serial.println(visualiserRealSamples[i]);
-          // }
-
-          // ************* Calculate FFT *************
-          FFT.Windowing(visualiserRealSamples, VISUALISER_NUM_SAMPLES, FFT_WIN_TYP_HAMMING, FFT_FORWARD);
-          FFT.Compute(visualiserRealSamples, visualiserImaginarySamples, VISUALISER_NUM_SAMPLES, FFT_FORWARD);
-          FFT.ComplexToMagnitude(visualiserRealSamples, visualiserImaginarySamples, VISUALISER_NUM_SAMPLES);
-
-          // ************* Set the LED's *************
-          // Set the colour of each light based on the values calculated
-          for (int ledNum = 0; ledNum < topNumLeds; ledNum++) {
-            // Map to the bin number, skip all bins required. Start at the second bin to avoid DC
-            uint8_t binNumber = (ledNum < visualiserNumBinsToSkip) ? visualiserNumBinsToSkip : constrain(ledNum, 0, VISUALISER_NUM_SAMPLES/2);
-            // Serial.print(binNumber);
-            // Serial.print("\t");
-          
-            // Subract the minium value chosen for reduction of artifacts
-            double adjustedBinValue = (visualiserRealSamples[binNumber] > visualiserMinThreshold) ? visualiserRealSamples[binNumber]-visualiserMinThreshold : 0.0;
-            // Serial.print(adjustedBinValue);
-            // Serial.print("\t");
-
-            // Set if visualiserRealSamples[binNumber] is above 0
-            if (adjustedBinValue > 0) {
-              // Map the float values to 8 bit integers
-              uint8_t brightnessValue =  map(adjustedBinValue, 0, visualiserMaxThreshold, 0, 255);
-              // Serial.println(brightnessValue);
-
-              // Get the current hue of the rainbow for the specific LED
-              uint8_t ledHue = int(255.0/(topNumLeds - 1) * ledNum + visualiserHueOffset) % 255;
-              CRGB newColour = CRGB(CHSV(ledHue, 255, 255)).nscale8(brightnessValue*(visualiserFadeUp/255.00));
-          
-              // Add the new colour to the current LED
-              ledString[topLeds[ledNum]] = ledString[bottomLeds[ledNum]] += newColour;
-          
-              // If the LED num is the first or last, use it to set the sides
-              if (ledNum == 0) {
-                for (int sideLedNum = 0; sideLedNum < rightNumLeds; sideLedNum++){
-                  ledString[rightLeds[sideLedNum]] += newColour;
-                }
+    // Light the LEDs from the magnitudes of the bins
+    void showSpectrum() {
+        // ************* Find the beat *************
+        // The kicks and the bass show up in the lowest bins, their onsets pull the beat clock
+        double bassEnergy = 0;
+        for (uint8_t binNumber = visualiserNumBinsToSkip; binNumber < visualiserNumBinsToSkip + VISUALISER_BASS_BINS; binNumber++) {
+          bassEnergy += visualiserRealSamples[binNumber];
+        }
+        beatAudioFrame(bassEnergy, config.minThreshold * VISUALISER_BASS_BINS);
+
+        // ************* Set the LED's *************
+        // Set the colour of each light based on the values calculated
+        for (int ledNum = 0; ledNum < topNumLeds; ledNum++) {
+          // Map to the bin number, skip all bins required. Start at the second bin to avoid DC
+          uint8_t binNumber = (ledNum < visualiserNumBinsToSkip) ? visualiserNumBinsToSkip : constrain(ledNum, 0, VISUALISER_NUM_SAMPLES/2);
+          // Serial.print(binNumber);
+          // Serial.print("\t");
+        
+          // Subract the minium value chosen for reduction of artifacts
+          double adjustedBinValue = (visualiserRealSamples[binNumber] > config.minThreshold) ? visualiserRealSamples[binNumber]-config.minThreshold : 0.0;
+          // Serial.print(adjustedBinValue);
+          // Serial.print("\t");
+
+          // Set if visualiserRealSamples[binNumber] is above 0
+          if (adjustedBinValue > 0) {
+            // Map the float values to 8 bit integers
+            uint8_t brightnessValue =  map(adjustedBinValue, 0, config.maxThreshold, 0, 255);
+            // Serial.println(brightnessValue);
+
+            // Get the current hue of the rainbow for the specific LED
+            uint8_t ledHue = int(255.0/(topNumLeds - 1) * ledNum + config.hueOffset) % 255;
+            CRGB newColour = CRGB(CHSV(ledHue, 255, 255)).nscale8(brightnessValue*(config.fadeUp/255.00));
+        
+            // Add the new colour to the current LED
+            ledString[topLeds[ledNum]] = ledString[bottomLeds[ledNum]] += newColour;
+        
+            // If the LED num is the first or last, use it to set the sides
+            if (ledNum == 0) {
+              for (int sideLedNum = 0; sideLedNum < rightNumLeds; sideLedNum++){
+                ledString[rightLeds[sideLedNum]] += newColour;
               }
-              else if (ledNum == topNumLeds-1) {
-                for (int sideLedNum = 0; sideLedNum < leftNumLeds; sideLedNum++){
-                  ledString[leftLeds[sideLedNum]] += newColour;
-                }
+            }
+            else if (ledNum == topNumLeds-1) {
+              for (int sideLedNum = 0; sideLedNum < leftNumLeds; sideLedNum++){
+                ledString[leftLeds[sideLedNum]] += newColour;
               }
             }
           }
-
-          // Fade all leds gradually for a smooth effect
-          fadeToBlackBy(ledString, NUM_LEDS, visualiserFadeDown);
-          // fadeLightBy(ledString, NUM_LEDS, visualiserFadeDown);
         }
-        else {
-          // Serial.println("Websockets Connecting");
-          delay(1000);
-        }
-    }
 
-    virtual void applyConfig(JsonVariant& settings) {
-        settings["Period"] = visualiserPeriod = settings["Period"] | visualiserPeriod;
-        settings["MinThreshold"] = visualiserMinThreshold = settings["MinThreshold"] | visualiserMinThreshold;
-        settings["MaxThreshold"] = visualiserMaxThreshold = settings["MaxThreshold"] | visualiserMaxThreshold;
-        settings["FadeUp"] = visualiserFadeUp = settings["FadeUp"] | visualiserFadeUp;
-        settings["FadeDown"] = visualiserFadeDown = settings["FadeDown"] | visualiserFadeDown;
-        settings["HueOffset"] = visualiserHueOffset = settings["HueOffset"] | visualiserHueOffset;
+        // Fade all leds gradually for a smooth effect
+        fadeToBlackBy(ledString, NUM_LEDS, config.fadeDown);
+        // fadeLightBy(ledString, NUM_LEDS, config.fadeDown);
     }
 };
@@ -1,95 +1,156 @@
-void handleNTP() {
-  // Change the bool after a waiting period
-  if ( millis() - lastNTPCollectionTime > collectionPeriod ) ntpTimeSet = false;
-
-  // Check if the time needs to be updated 
-  if (!ntpTimeSet) {
+// NTP Methods
+void ntpInit() {
+  // Let TimeLib take the time from the lamp clock
+  setSyncProvider(ntpSyncProvider);
+  setSyncInterval(1);
+}
 
-    // Collect the current time if the wifi is connected
-    if (WiFi.isConnected()) {
+void handleNTP() {
+  // Keep the clock running and slewing
+  lampClock.update(millis());
 
-      // Get the IP Address of the nearest server
-      if (getNTPServerIP(ntpHostName.c_str(), ntpIpAddress)) {
-          sendNTPRequest();
+  switch (ntpState) {
+    case NTP_STATE_IDLE : {
+      // Collect the current time after the waiting period if the wifi is connected
+      if (WiFi.isConnected() && millis() - lastNTPCollectionTime >= collectionPeriod) {
+        // The server is only looked up once and then again after repeated failures
+        if ((uint32_t)ntpIpAddress == 0) resolveNTPServer();
+        else sendNTPRequest();
+      }
+    }
+    break;
+    case NTP_STATE_RESOLVING : {
+      if (ntpDnsDone) {
+        if ((uint32_t)ntpIpAddress != 0) sendNTPRequest();
+        else ntpRequestFailed("Failed to lookup DNS results for NTP server \"" + ntpHostName + "\"");
       }
+      else if (millis() - ntpStateTime > ntpTimeout) ntpRequestFailed("DNS lookup for NTP server \"" + ntpHostName + "\" timed out");
+    }
+    break;
+    case NTP_STATE_WAITING : {
+      if (ntpResponseReceived) parseNTPResponse();
+      else if (millis() - ntpStateTime > ntpTimeout) ntpRequestFailed("No response from NTP server " + ntpIpAddress.toString());
     }
+    break;
   }
 }
-bool getNTPServerIP(const char *_ntpServerName, IPAddress &_ntpServerIp) {
-  // Probe the DNS for the IP Address of the NTP Server
-  if (!WiFi.hostByName(_ntpServerName, _ntpServerIp)) {
-    Serial.println("[getNTPServerIP] - Failed to lookup DNS results for NTP server \"" + String(_ntpServerName) + "\"");
-    return false;
-  }
-  else {
-    // Serial.println("[getNTPServerIP] - DNS results for \"" + String(_ntpServerName) + "\" was " + _ntpServerIp.toString());
-    return true;
-  }
+
+// Start an asynchronous lookup of the NTP server, the result arrives in onNTPServerFound()
+void resolveNTPServer() {
+  ip_addr_t address;
+  ntpDnsDone = false;
+  ntpState = NTP_STATE_RESOLVING;
+  ntpStateTime = millis();
+
+  err_t error = dns_gethostbyname(ntpHostName.c_str(), &address, onNTPServerFound, nullptr);
+  if (error == ERR_OK) onNTPServerFound(ntpHostName.c_str(), &address, nullptr);
+  else if (error != ERR_INPROGRESS) ntpDnsDone = true;
+}
+
+void onNTPServerFound(const char *_name, const ip_addr_t *_ipAddress, void *_arg) {
+  if (_ipAddress) ntpIpAddress = IPAddress(ip4_addr_get_u32(ip_2_ip4(_ipAddress)));
+  ntpDnsDone = true;
 }
+
 bool sendNTPRequest() {
   // Attempt to connect to NTP Server
   if (udpClient.connect(ntpIpAddress, 123)) {
-    // Debug
-    // Serial.println("[sendNTPRequest] - Connected to NTP server");
-
     // Initialize values needed to form NTP request
-    byte packetBuffer[48];
-    memset(packetBuffer, 0, 48);
-    packetBuffer[0] = 0b11100011; // LI, Version, Mode
-    packetBuffer[1] = 0;          // Stratum, or type of clock
-    packetBuffer[2] = 6;          // Polling Interval
-    packetBuffer[3] = 0xEC;       // Peer Clock Precision
-    packetBuffer[12] = 49;
-    packetBuffer[13] = 0x4E;
-    packetBuffer[14] = 49;
-    packetBuffer[15] = 52;
+    memset(ntpRequest, 0, NTP_PACKET_SIZE);
+    ntpRequest[0] = 0b11100011; // LI, Version, Mode
+    ntpRequest[1] = 0;          // Stratum, or type of clock
+    ntpRequest[2] = 6;          // Polling Interval
+    ntpRequest[3] = 0xEC;       // Peer Clock Precision
+    ntpRequest[12] = 49;
+    ntpRequest[13] = 0x4E;
+    ntpRequest[14] = 49;
+    ntpRequest[15] = 52;
 
     // Send packet to NTP server and setup response handler
-    if (udpClient.write(packetBuffer, 48)) {
-      // Debug
-      // Serial.println("[sendNTPRequest] - Message sent to NTP server");
+    udpClient.onPacket(onNTPPacket);
+    ntpResponseReceived = false;
 
-      // Create a handler for the received packet
-      udpClient.onPacket([&](AsyncUDPPacket packet) {
-        parseNTPResponse(packet.data());
-      });
-
-      // Set the delay to 1000 milliseconds in case the request fails
-      collectionPeriod = 1000;
-      lastNTPCollectionTime = millis();
-      ntpTimeSet = true;
-
-      // Return true on send message
+    // The transmit timestamp (t1) is echoed back by the server as the originate timestamp
+    ntpWriteTimestamp(&ntpRequest[40], lampClock.time(millis()));
+    if (udpClient.write(ntpRequest, NTP_PACKET_SIZE)) {
+      ntpState = NTP_STATE_WAITING;
+      ntpStateTime = millis();
       return true;
     }
-    else Serial.println("[sendNTPRequest] - Message was not sent to NTP Server");
+    else ntpRequestFailed("Message was not sent to NTP Server");
   }
-  else Serial.println("[sendNTPRequest] - Could not connect to NTP Server");
+  else ntpRequestFailed("Could not connect to NTP Server");
 
   // Always return
   return false;
 }
-void parseNTPResponse(uint8_t *_ntpData) {
-  // Convert data to a unix time
-  unsigned long highWord = word(_ntpData[40], _ntpData[41]);
-  unsigned long lowWord = word(_ntpData[42], _ntpData[43]);
-  currentEpochTime = highWord << 16 | lowWord;
-  currentEpochTime += utcOffset - 2208988800UL;
 
-  // Set time in library
-  setTime(currentEpochTime);
+// Runs in the network stack, only keep the packet and its arrival time (t4) here
+void onNTPPacket(AsyncUDPPacket &_packet) {
+  if (ntpState != NTP_STATE_WAITING || ntpResponseReceived || _packet.length() < NTP_PACKET_SIZE) return;
+  ntpResponseTime = lampClock.time(millis());
+  memcpy(ntpResponse, _packet.data(), NTP_PACKET_SIZE);
+  ntpResponseReceived = true;
+}
+
+void parseNTPResponse() {
+  // Close the connection
+  udpClient.close();
+
+  // Only accept a server reply to the last request
+  uint8_t mode = ntpResponse[0] & 0x07;
+  uint8_t stratum = ntpResponse[1];
+  if (mode != 4 || stratum == 0 || memcmp(&ntpResponse[24], &ntpRequest[40], 8) != 0) {
+    ntpRequestFailed("Invalid response from NTP server");
+    return;
+  }
+
+  // Work out offset and delay from all four timestamps
+  NtpSample sample = ntpCalculate(ntpReadTimestamp(&ntpRequest[40]), ntpReadTimestamp(&ntpResponse[32]), ntpReadTimestamp(&ntpResponse[40]), ntpResponseTime);
+  if (sample.delay < 0 || sample.delay > ntpTimeout) {
+    ntpRequestFailed("NTP round trip delay of " + String((long)sample.delay) + "ms is out of range");
+    return;
+  }
+
+  // Slew the clock, the first sample steps it
+  lampClock.adjust(sample.offset, millis());
+  ntpOffset = constrain(sample.offset, -2147483647LL, 2147483647LL);
+  ntpDelay = sample.delay;
+  currentEpochTime = lampClock.time(millis()) / 1000 + utcOffset;
 
   // Set the timer back to the desired wait period
   lastNTPCollectionTime = millis();
-  collectionPeriod = 3600 * 1000;
+  collectionPeriod = ntpSyncPeriod;
+  ntpFailures = 0;
   ntpTimeSet = true;
+  ntpState = NTP_STATE_IDLE;
 
-  // Close the connection
+  // Debug
+  Serial.println("[parseNTPResponse] - Current time set to: " + get12hrAsString() + " offset " + String(ntpOffset) + "ms, delay " + String(ntpDelay) + "ms");
+}
+
+void ntpRequestFailed(const String &_reason) {
+  Serial.println("[ntpRequestFailed] - " + _reason);
   udpClient.close();
 
-  // Debug
-  Serial.println("[getTime] - Current time set to: " + get12hrAsString());
+  // Look the server up again after a few failures, the pool might have dropped it
+  if (++ntpFailures >= 3) {
+    ntpFailures = 0;
+    ntpIpAddress = IPAddress(0, 0, 0, 0);
+  }
+
+  // Try again later
+  lastNTPCollectionTime = millis();
+  collectionPeriod = ntpRetryPeriod;
+  ntpState = NTP_STATE_IDLE;
+}
+
+// Local time in seconds for TimeLib, 0 while the clock has not been set
+time_t ntpSyncProvider() {
+  if (!lampClock.isSet()) return 0;
+  return lampClock.time(millis()) / 1000 + utcOffset;
 }
+
 String get12hrAsString() {
   String hrStr = hourFormat12() < 10 ? "0" + String(hourFormat12()) : String(hourFormat12());
   String minStr = minute() < 10 ? "0" + String(minute()) : String(minute());
@@ -0,0 +1,111 @@
+/* NtpTime
+ *
+ * NTP timestamp helpers and the millisecond clock of the lamp. Nothing in
+ * here depends on the Arduino core, the caller hands in millis().
+ *
+ * Offset and round trip delay are calculated from all four timestamps of an
+ * exchange (RFC 5905):
+ *   t1  client transmit    t2  server receive
+ *   t3  server transmit    t4  client receive
+ *   offset = ((t2 - t1) + (t3 - t4)) / 2
+ *   delay  = (t4 - t1) - (t3 - t2)
+ *
+ * Small offsets are slewed, i.e. the clock runs slightly faster or slower
+ * until the offset is gone, so the time never jumps and never runs
+ * backwards. Large offsets (or the first sync) step the clock.
+*/
+
+#ifndef NtpTime_h
+#define NtpTime_h
+
+#include <stdint.h>
+
+#define NTP_PACKET_SIZE     48
+#define NTP_UNIX_OFFSET     2208988800UL  // seconds from 1900 to 1970
+
+// Read a 64 bit NTP timestamp at the given position of a packet as unix time in ms
+inline int64_t ntpReadTimestamp(const uint8_t* packet) {
+  uint32_t seconds  = (uint32_t)packet[0] << 24 | (uint32_t)packet[1] << 16 | (uint32_t)packet[2] << 8 | packet[3];
+  uint32_t fraction = (uint32_t)packet[4] << 24 | (uint32_t)packet[5] << 16 | (uint32_t)packet[6] << 8 | packet[7];
+  return ((int64_t)seconds - NTP_UNIX_OFFSET) * 1000 + (((uint64_t)fraction * 1000 + 0x80000000UL) >> 32);
+}
+
+// Write unix time in ms as a 64 bit NTP timestamp
+inline void ntpWriteTimestamp(uint8_t* packet, int64_t unixMs) {
+  uint32_t seconds  = (uint32_t)(unixMs / 1000 + NTP_UNIX_OFFSET);
+  uint32_t fraction = (uint32_t)((((uint64_t)(unixMs % 1000)) << 32) / 1000);
+  for (uint8_t i = 0; i < 4; i++) {
+    packet[i]     = seconds >> (24 - 8 * i);
+    packet[4 + i] = fraction >> (24 - 8 * i);
+  }
+}
+
+struct NtpSample {
+  int64_t offset;   // correction for the local clock in ms
+  int64_t delay;    // round trip delay without the server processing time in ms
+};
+
+inline NtpSample ntpCalculate(int64_t t1, int64_t t2, int64_t t3, int64_t t4) {
+  NtpSample sample;
+  sample.offset = ((t2 - t1) + (t3 - t4)) / 2;
+  sample.delay  = (t4 - t1) - (t3 - t2);
+  return sample;
+}
+
+/// Unix time in ms, driven by millis() and corrected by slewing
+class SlewClock {
+public:
+  int32_t   stepThreshold = 1000;   // offsets above this step the clock, in ms
+  uint8_t   slewDivider   = 16;     // at most 1 ms of correction per slewDivider ms
+
+  bool isSet() const { return set; }
+
+  /// Jump to the given time
+  void step(int64_t unixMs, uint32_t now) {
+    baseTime    = unixMs;
+    baseMillis  = now;
+    slewRemaining = 0;
+    slewCredit = 0;
+    set = true;
+  }
+
+  /// Correct the clock by the given offset, slewing it if it is small enough
+  void adjust(int64_t offset, uint32_t now) {
+    if (!set || offset > stepThreshold || offset < -stepThreshold) step(time(now) + offset, now);
+    else {
+      update(now);
+      slewRemaining = offset;
+    }
+  }
+
+  /// Fold the elapsed time and the slew into the base, call regularly
+  void update(uint32_t now) {
+    uint32_t elapsed = now - baseMillis;
+
+    // Frequent updates add up to whole ms of correction
+    slewCredit = slewRemaining ? slewCredit + elapsed : 0;
+    int32_t  limit   = slewCredit / slewDivider;
+    int32_t  applied = (slewRemaining > limit) ? limit : (slewRemaining < -limit) ? -limit : (int32_t)slewRemaining;
+    slewCredit -= limit * slewDivider;
+
+    baseTime   += (int64_t)elapsed + applied;
+    baseMillis  = now;
+    slewRemaining -= applied;
+  }
+
+  /// Current unix time in ms
+  int64_t time(uint32_t now) const {
+    return baseTime + (uint32_t)(now - baseMillis);
+  }
+
+  int64_t pendingSlew() const { return slewRemaining; }
+
+private:
+  bool      set           = false;
+  int64_t   baseTime      = 0;
+  uint32_t  baseMillis    = 0;
+  int64_t   slewRemaining = 0;
+  uint32_t  slewCredit    = 0;
+};
+
+#endif
@@ -0,0 +1,321 @@
+// Preset Methods
+// A preset holds the whole look of the light in the binary snapshot format (see ConfigSnapshot.h), one file per slot:
+//   string        name of the preset
+//   LampSnapshot  state, brightness and fade time
+//   string        mode
+//   mode records  the same as in the config snapshot, see writeModeSnapshots()
+// Recalling a preset only copies these blocks into the modes, no JSON is involved until the clients are told about it.
+void presetInit() {
+  // Index the stored presets, with PRESET_PRELOAD the presets are kept in RAM as well
+  for (uint8_t slot = 0; slot < PRESET_MAX; slot++) {
+    uint16_t length = 0;
+    uint32_t crc = 0;
+    uint8_t* payload = readSnapshotFile(presetPath(slot), PRESET_SNAPSHOT_MAGIC, length, crc);
+    if (!payload) continue;
+
+    ConfigSnapshotReader reader(payload, length);
+    char name[CONFIG_SNAPSHOT_MAX_BLOCK + 1];
+    reader.readString(name, sizeof(name));
+    if (!reader.failed && name[0] != '\0') {
+      presetNames[slot] = name;
+#ifdef PRESET_PRELOAD
+      presetData[slot].assign(payload, payload + length);
+#endif
+    }
+    delete[] payload;
+  }
+}
+
+String presetPath(uint8_t slot) {
+  return "/Preset" + String(slot) + ".bin";
+}
+
+// Slot of the named preset, -1 if there is none
+int8_t presetFind(const String& name) {
+  for (uint8_t slot = 0; slot < PRESET_MAX; slot++) {
+    if (presetNames[slot] != "" && presetNames[slot] == name) return slot;
+  }
+  return -1;
+}
+
+size_t writePresetBuffer(void* context, const uint8_t* data, size_t length) {
+  std::vector<uint8_t>* buffer = (std::vector<uint8_t>*)context;
+  buffer->insert(buffer->end(), data, data + length);
+  return length;
+}
+
+// Serialize the current look of the light as a preset
+void presetCapture(const String& name, std::vector<uint8_t>& payload) {
+  payload.clear();
+  ConfigSnapshotWriter writer(writePresetBuffer, &payload);
+  writer.writeString(name.c_str());
+  LampSnapshot lamp = { State, (uint8_t)Brightness, (uint16_t)FadeTime };
+  writer.writeBlock(&lamp, sizeof(lamp));
+  writer.writeString(Mode.c_str());
+  writeModeSnapshots(writer);
+}
+
+// Serialize settings in the layout of presetExport() as a preset. Whatever settings leave out is taken from the
+// current look of the light, which is only read.
+void presetFromSettings(const String& name, JsonObject settings, std::vector<uint8_t>& payload) {
+  payload.clear();
+  ConfigSnapshotWriter writer(writePresetBuffer, &payload);
+  writer.writeString(name.c_str());
+  LampSnapshot lamp = { (uint8_t)(settings["State"] | State), (uint8_t)constrain(settings["Brightness"] | Brightness, 0, 255), (uint16_t)(settings["Fade Time"] | FadeTime) };
+  writer.writeBlock(&lamp, sizeof(lamp));
+  String mode = settings["Mode"] | Mode;
+  writer.writeString(modes.find(mode) != modes.end() ? mode.c_str() : Mode.c_str());
+
+  // The mode records the same as writeModeSnapshots()
+  uint8_t modeCount = modes.size();
+  writer.writeBlock(&modeCount, sizeof(modeCount));
+  uint8_t modeData[MODE_SNAPSHOT_MAX_SIZE];
+  for (auto it = modes.begin(); it != modes.end(); it++) {
+    writer.writeString(it->first.c_str());
+    writer.writeBlock(modeData, it->second->saveSnapshotWith(modeData, settings[it->first]));
+  }
+}
+
+// Copy the preset in the slot from RAM or the flash
+bool presetRead(uint8_t slot, std::vector<uint8_t>& payload) {
+  if (!presetData[slot].empty()) {
+    payload = presetData[slot];
+    return true;
+  }
+  uint16_t length = 0;
+  uint32_t crc = 0;
+  uint8_t* data = readSnapshotFile(presetPath(slot), PRESET_SNAPSHOT_MAGIC, length, crc);
+  if (!data) return false;
+  payload.assign(data, data + length);
+  delete[] data;
+  return true;
+}
+
+// Apply a preset written by presetCapture(). The mode is only changed if it still exists.
+bool presetApply(const uint8_t* payload, size_t length) {
+  ConfigSnapshotReader reader(payload, length);
+  char text[CONFIG_SNAPSHOT_MAX_BLOCK + 1];
+  reader.readString(text, sizeof(text));
+  LampSnapshot lamp = { State, (uint8_t)Brightness, (uint16_t)FadeTime };
+  reader.readBlockInto(&lamp, sizeof(lamp));
+  reader.readString(text, sizeof(text));
+  if (reader.failed) return false;
+
+  State       = lamp.state;
+  Brightness  = lamp.brightness;
+  FadeTime    = lamp.fadeTime;
+  if (modes.find(text) != modes.end()) Mode = text;
+  readModeSnapshots(reader);
+
+  return !reader.failed;
+}
+
+// Store the current look under the given name, replacing a preset with the same name
+bool presetSave(const String& name) {
+  if (name == "") return false;
+  std::vector<uint8_t> payload;
+  presetCapture(name, payload);
+  return presetStore(name, payload);
+}
+
+// Store a preset serialized with the given name, replacing a preset with the same name
+bool presetStore(const String& name, std::vector<uint8_t>& payload) {
+  int8_t slot = presetFind(name);
+  for (uint8_t i = 0; i < PRESET_MAX && slot < 0; i++) {
+    if (presetNames[i] == "") slot = i;
+  }
+  if (slot < 0) {
+    Serial.println("[presetStore] - All " + String(PRESET_MAX) + " preset slots are used, delete one first");
+    return false;
+  }
+
+  // Replace the file, see FileReplace.h. A preset with the same name is kept if this fails.
+  ConfigSnapshotHeader header = { PRESET_SNAPSHOT_MAGIC, CONFIG_SNAPSHOT_VERSION, (uint16_t)payload.size() };
+  uint32_t crc = snapshotCrc32(0, payload.data(), payload.size());
+  String path = presetPath(slot);
+  bool written = replaceFile(fileSystem, path.c_str(), tempFilePath(path).c_str(), sizeof(header) + payload.size() + sizeof(crc), [&](File& file) {
+    return file.write((const uint8_t*)&header, sizeof(header)) + file.write(payload.data(), payload.size()) + file.write((const uint8_t*)&crc, sizeof(crc));
+  });
+  if (!written) {
+    Serial.println("[presetStore] - Failed to write preset file");
+    return false;
+  }
+
+  presetNames[slot] = name;
+#ifdef PRESET_PRELOAD
+  presetData[slot].swap(payload);
+#endif
+  invalidateClientState();
+
+  // Debug
+  Serial.println("[presetStore] - Saved preset \"" + name + "\" in slot " + String(slot));
+
+  return true;
+}
+
+// Switch to the named preset. The clients and the device config are updated by handlePresets() after the next frame.
+bool presetRecall(const String& name) {
+  int8_t slot = presetFind(name);
+  if (slot < 0) return false;
+
+  // Keep the current look, so only the changes have to be sent to the clients
+  if (!presetStatePending) presetCapture("", presetPrevious);
+
+  bool applied = false;
+  if (!presetData[slot].empty()) applied = presetApply(presetData[slot].data(), presetData[slot].size());
+  else {
+    uint16_t length = 0;
+    uint32_t crc = 0;
+    uint8_t* payload = readSnapshotFile(presetPath(slot), PRESET_SNAPSHOT_MAGIC, length, crc);
+    if (payload) {
+      applied = presetApply(payload, length);
+      delete[] payload;
+    }
+  }
+
+  if (applied) presetStatePending = true;
+  else Serial.println("[presetRecall] - Failed to recall preset \"" + name + "\"");
+
+  return applied;
+}
+
+bool presetDelete(const String& name) {
+  int8_t slot = presetFind(name);
+  if (slot < 0) return false;
+  fileSystem.remove(presetPath(slot));
+  presetNames[slot] = "";
+  presetData[slot].clear();
+  invalidateClientState();
+  return true;
+}
+
+// Add the settings that differ from the previous look, captured by presetCapture(), as JSON
+void presetAddChanges(JsonObject settings, const std::vector<uint8_t>& previous) {
+  settings["Mode"] = Mode;
+  settings["State"] = State;
+  settings["Fade Time"] = FadeTime;
+  settings["Brightness"] = Brightness;
+
+  // Skip the name, base variables and mode of the previous look, then compare the mode records
+  ConfigSnapshotReader reader(previous.data(), previous.size());
+  uint8_t size;
+  for (uint8_t i = 0; i < 3; i++) reader.readBlock(size);
+  uint8_t modeCount = 0;
+  reader.readBlockInto(&modeCount, sizeof(modeCount));
+  char text[CONFIG_SNAPSHOT_MAX_BLOCK + 1];
+  for (uint8_t i = 0; i < modeCount && !reader.atEnd(); i++) {
+    reader.readString(text, sizeof(text));
+    const uint8_t* block = reader.readBlock(size);
+    auto modeIter = modes.find(text);
+    if (!block || modeIter == modes.end()) continue;
+
+    JsonObject modeSettings = settings.createNestedObject(modeIter->first);
+    modeIter->second->addConfig(modeSettings, block, size);
+    if (modeSettings.size() == 0) settings.remove(modeIter->first);
+  }
+}
+
+// Add the named preset as JSON in the same layout as the device config. It is decoded from the stored preset, the
+// current look of the light is left alone.
+bool presetExport(const String& name, JsonObject settings) {
+  int8_t slot = presetFind(name);
+  std::vector<uint8_t> payload;
+  if (slot < 0 || !presetRead(slot, payload)) return false;
+
+  ConfigSnapshotReader reader(payload.data(), payload.size());
+  char text[CONFIG_SNAPSHOT_MAX_BLOCK + 1];
+  reader.readString(text, sizeof(text));
+  LampSnapshot lamp = { State, (uint8_t)Brightness, (uint16_t)FadeTime };
+  reader.readBlockInto(&lamp, sizeof(lamp));
+  reader.readString(text, sizeof(text));
+  if (reader.failed) return false;
+
+  settings["Mode"] = text;
+  settings["State"] = (bool)lamp.state;
+  settings["Fade Time"] = lamp.fadeTime;
+  settings["Brightness"] = lamp.brightness;
+
+  // The mode records, see writeModeSnapshots()
+  uint8_t modeCount = 0;
+  reader.readBlockInto(&modeCount, sizeof(modeCount));
+  for (uint8_t i = 0; i < modeCount && !reader.atEnd(); i++) {
+    reader.readString(text, sizeof(text));
+    uint8_t size;
+    const uint8_t* block = reader.readBlock(size);
+    auto modeIter = modes.find(text);
+    if (block && modeIter != modes.end() && modeIter->second->countParameters()) {
+      modeIter->second->addSnapshotConfig(settings.createNestedObject(modeIter->first), block, size);
+    }
+  }
+
+  return !reader.failed;
+}
+
+// Store settings exported by presetExport() as a preset, the current look of the light is left alone
+bool presetImport(const String& name, JsonObject settings) {
+  if (name == "" || settings.isNull()) return false;
+
+  std::vector<uint8_t> payload;
+  presetFromSettings(name, settings, payload);
+  return presetStore(name, payload);
+}
+
+// Preset commands sent by the clients
+/*
+  {
+    "Preset" : { "Recall" : "Evening" }
+    "Preset" : { "Save" : "Evening" }
+    "Preset" : { "Delete" : "Evening" }
+    "Preset" : { "Import" : { "Name" : "Evening", "Settings" : { "Mode" : "Colour", "Colour" : { "Red" : 255 } } } }
+  }
+*/
+void presetCommand(JsonVariant& presetSettings) {
+  bool listChanged = false;
+  if (presetSettings.containsKey("Recall")) presetRecall(presetSettings["Recall"] | "");
+  if (presetSettings.containsKey("Save")) listChanged |= presetSave(presetSettings["Save"] | "");
+  if (presetSettings.containsKey("Delete")) listChanged |= presetDelete(presetSettings["Delete"] | "");
+  if (presetSettings.containsKey("Import")) {
+    JsonVariant importSettings = presetSettings["Import"];
+    listChanged |= presetImport(importSettings["Name"] | "", importSettings["Settings"].as<JsonObject>());
+  }
+
+  if (listChanged) {
+    DynamicJsonDocument jsonDocument(JSON_ARRAY_SIZE(PRESET_MAX) + JSON_OBJECT_SIZE(1));
+    presetAddNames(jsonDocument);
+    websocketSend(jsonDocument);
+  }
+}
+
+// The names are added as pointers to presetNames and not copied, so the document only needs room for the array. It
+// has to be serialized before the presets change.
+void presetAddNames(JsonDocument& jsonDocument) {
+  JsonArray names = jsonDocument.createNestedArray("Presets");
+  for (uint8_t slot = 0; slot < PRESET_MAX; slot++) {
+    if (presetNames[slot] != "") names.add(presetNames[slot].c_str());
+  }
+}
+
+// Answer the exports asked for with { "Preset" : { "Export" : "Evening" } }, each only to the client that asked
+void presetSendExports() {
+  for (uint8_t num = 0; num < WEBSOCKET_CLIENTS_MAX; num++) {
+    if (presetExports[num] == "") continue;
+    DynamicJsonDocument jsonDocument(DEVICE_CONFIG_SIZE);
+    JsonObject exportSettings = jsonDocument.createNestedObject("PresetExport");
+    exportSettings["Name"] = presetExports[num];
+    if (presetExport(presetExports[num], exportSettings.createNestedObject("Settings"))) websocketSendTo(num, jsonDocument);
+    presetExports[num] = "";
+  }
+}
+
+// Store a recalled preset in the device config and answer exports, called after the frame was rendered. The
+// clients are told about a recall by the next state patch.
+void handlePresets() {
+  presetSendExports();
+  if (!presetStatePending) return;
+  presetStatePending = false;
+
+  DynamicJsonDocument jsonDocument(DEVICE_CONFIG_SIZE);
+  presetAddChanges(jsonDocument.to<JsonObject>(), presetPrevious);
+  presetPrevious.clear();
+  parseConfig(jsonDocument);
+}
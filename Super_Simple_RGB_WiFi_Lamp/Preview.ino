@@ -0,0 +1,79 @@
+// Preview Methods
+// Clients can ask for a preview of the frames with { "Preview" : 10 }, the number being the frames per second and 0
+// stopping it. The frames are sent as binary PREVIEW messages, see RealtimeProtocol.h, with only the pixels that
+// changed since the last one sent to the client. At most one client is sent a preview after each rendered frame, so
+// the preview never delays the next frame.
+void previewSubscribe(uint8_t num, int rate) {
+  if (num >= WEBSOCKET_CLIENTS_MAX) return;
+  PreviewClient& client = previewClients[num];
+  client.rate = constrain(rate, 0, PREVIEW_MAX_RATE);
+  if (!client.rate) {
+    std::vector<uint16_t>().swap(client.last);
+    return;
+  }
+
+  // A new subscriber is told how the pixels are laid out and starts with a key frame
+  if (client.last.empty()) {
+    client.last.assign(NUM_LEDS, 0);
+    client.key = true;
+    sendPreviewLayout(num);
+  }
+
+  // Debug
+  Serial.println("[previewSubscribe] - Client number " + String(num) + " gets a preview at " + String(client.rate) + " fps");
+}
+
+// Send the LED numbers of the sides, the website draws the preview around a rectangle with them
+void sendPreviewLayout(uint8_t num) {
+  DynamicJsonDocument jsonDocument(JSON_OBJECT_SIZE(1) + JSON_OBJECT_SIZE(6) + JSON_ARRAY_SIZE(topNumLeds) + JSON_ARRAY_SIZE(bottomNumLeds) + JSON_ARRAY_SIZE(leftNumLeds) + JSON_ARRAY_SIZE(rightNumLeds));
+  JsonObject layout = jsonDocument.createNestedObject("Preview");
+  layout["Leds"] = NUM_LEDS;
+  layout["Rate"] = previewClients[num].rate;
+  JsonArray top = layout.createNestedArray("Top");
+  for (int i = 0; i < topNumLeds; i++) top.add(topLeds[i]);
+  JsonArray bottom = layout.createNestedArray("Bottom");
+  for (int i = 0; i < bottomNumLeds; i++) bottom.add(bottomLeds[i]);
+  JsonArray left = layout.createNestedArray("Left");
+  for (int i = 0; i < leftNumLeds; i++) left.add(leftLeds[i]);
+  JsonArray right = layout.createNestedArray("Right");
+  for (int i = 0; i < rightNumLeds; i++) right.add(rightLeds[i]);
+  websocketSendTo(num, jsonDocument);
+}
+
+// Send the preview to the next client that is due, called after a frame was rendered
+void handlePreview() {
+  if (!previewFrameReady) return;
+  previewFrameReady = false;
+
+  for (uint8_t i = 0; i < WEBSOCKET_CLIENTS_MAX; i++) {
+    uint8_t num = (previewNextClient + i) % WEBSOCKET_CLIENTS_MAX;
+    PreviewClient& client = previewClients[num];
+    if (!client.rate || millis() - client.lastTime < 1000UL / client.rate) continue;
+
+    client.lastTime = millis();
+    previewNextClient = num + 1;
+    sendPreview(num, client);
+    return;
+  }
+}
+
+void sendPreview(uint8_t num, PreviewClient& client) {
+  // A client that is behind skips the frame, the next one is sent against the last frame it got
+  if (!websocketCanSend(num)) return;
+
+  // The frame as it is shown, with the white channel added to the colours
+  uint16_t pixels[NUM_LEDS];
+  for (int i = 0; i < NUM_LEDS; i++) {
+    const CRGBW& led = ledString[i];
+    pixels[i] = realtimeRgb565(qadd8(led.r, led.w), qadd8(led.g, led.w), qadd8(led.b, led.w));
+  }
+
+  uint8_t* message = (uint8_t*)websocketPayload();
+  size_t length = realtimeEncodePreview(pixels, client.last.data(), NUM_LEDS, client.key, message);
+  client.key = false;
+  if (!length) return;
+
+  websocketClient(num)->binary(message, length);
+  previewStats.frames++;
+  previewStats.bytes += length;
+}
@@ -0,0 +1,270 @@
+// Realtime Methods
+// Pixels pushed by binary websocket messages (see RealtimeProtocol.h) or by E1.31, Art-Net and DDP (see
+// LightingProtocols.h) go straight into the realtime mode. It takes over the light with the first complete frame
+// and hands it back once no frame came for its timeout. Settings sent over the websocket are turned into the same
+// JSON as a text message and queued with them, so they are stored and sent to the clients like any other change.
+void realtimeMessage(uint8_t num, uint8_t* payload, size_t length) {
+  realtimeStats.messages++;
+
+  RealtimeReader reader(payload, length);
+  uint8_t version = reader.readU8();
+  uint8_t opcode = reader.readU8();
+  RealtimeError error = (RealtimeError)0;
+  if (reader.failed) error = REALTIME_ERROR_LENGTH;
+  else if (version != REALTIME_PROTOCOL_VERSION) error = REALTIME_ERROR_VERSION;
+  else {
+    switch (opcode) {
+      case REALTIME_PIXELS_RGBW :
+      case REALTIME_PIXELS_RGB : {
+        error = realtimePixels(reader, opcode);
+      }
+      break;
+      case REALTIME_SET_PARAMETER : {
+        error = realtimeSetParameter(reader);
+      }
+      break;
+      case REALTIME_SET_LAMP : {
+        error = realtimeSetLamp(reader);
+      }
+      break;
+      case REALTIME_PING : {
+        // Send the payload back as it is, the client measures the round trip with it
+        realtimeReply(num, REALTIME_PONG, payload + REALTIME_HEADER_SIZE, reader.remaining());
+      }
+      break;
+      default : {
+        error = REALTIME_ERROR_OPCODE;
+      }
+      break;
+    }
+  }
+
+  if (error) {
+    realtimeStats.errors++;
+    uint8_t reply[2] = { error, opcode };
+    realtimeReply(num, REALTIME_ERROR, reply, sizeof(reply));
+  }
+}
+
+RealtimeError realtimePixels(RealtimeReader& reader, uint8_t opcode) {
+  uint8_t flags = reader.readU8();
+  uint16_t start = reader.readU16();
+  size_t count = realtimePixelCount(opcode, reader.remaining());
+  const uint8_t* pixels = reader.readBytes(reader.remaining());
+  if (reader.failed || !realtimeMode->setPixels(start, pixels, count, opcode == REALTIME_PIXELS_RGBW)) return REALTIME_ERROR_LENGTH;
+
+  if (flags & REALTIME_FLAG_SHOW) {
+    realtimeMode->showFrame();
+    realtimeStats.frames++;
+  }
+  return (RealtimeError)0;
+}
+
+RealtimeError realtimeSetParameter(RealtimeReader& reader) {
+  uint8_t nameLength = reader.readU8();
+  const uint8_t* name = reader.readBytes(nameLength);
+  uint8_t index = reader.readU8();
+  int32_t value = reader.readI32();
+  if (reader.failed) return REALTIME_ERROR_LENGTH;
+
+  char modeName[CONFIG_SNAPSHOT_MAX_BLOCK + 1];
+  memcpy(modeName, name, nameLength);
+  modeName[nameLength] = '\0';
+  auto modeIter = modes.find(modeName);
+  const ModeParameter* parameter = modeIter != modes.end() ? modeIter->second->parameter(index) : nullptr;
+  if (!parameter) return REALTIME_ERROR_PARAMETER;
+
+  // The keys point to the mode map and the parameter table, both outlive the queue
+  StaticJsonDocument<JSON_OBJECT_SIZE(1) * 3> jsonDocument;
+  JsonObject settings = jsonDocument.createNestedObject(modeIter->first.c_str());
+  if (parameter->group) settings = settings.createNestedObject(parameter->group);
+  settings[parameter->name] = value;
+  queueInboundMessage(jsonDocument.as<JsonObjectConst>(), jsonDocument.memoryUsage());
+  return (RealtimeError)0;
+}
+
+RealtimeError realtimeSetLamp(RealtimeReader& reader) {
+  uint8_t mask = reader.readU8();
+  uint8_t state = reader.readU8();
+  uint8_t brightness = reader.readU8();
+  if (reader.failed) return REALTIME_ERROR_LENGTH;
+
+  StaticJsonDocument<JSON_OBJECT_SIZE(2)> jsonDocument;
+  JsonObject settings = jsonDocument.to<JsonObject>();
+  if (mask & REALTIME_LAMP_STATE) settings["State"] = state != 0;
+  if (mask & REALTIME_LAMP_BRIGHTNESS) settings["Brightness"] = brightness;
+  if (settings.size() > 0) queueInboundMessage(settings, jsonDocument.memoryUsage());
+  return (RealtimeError)0;
+}
+
+// Send a binary message to one client, the payload is copied into the frame buffer behind the header
+void realtimeReply(uint8_t num, uint8_t opcode, const uint8_t* data, size_t length) {
+  if (length > WEBSOCKET_FRAME_SIZE - REALTIME_HEADER_SIZE) length = WEBSOCKET_FRAME_SIZE - REALTIME_HEADER_SIZE;
+  uint8_t* message = (uint8_t*)websocketPayload();
+  size_t headerLength = realtimeWriteHeader(message, opcode);
+  memmove(message + headerLength, data, length);
+  if (websocketCanSend(num)) websocketClient(num)->binary(message, headerLength + length);
+}
+
+// Listen for E1.31, Art-Net and DDP. E1.31 is also sent to the multicast group of the first universe, which can only
+// be joined while connected to a network.
+void realtimeUdpInit() {
+  realtimeUdpRestart = false;
+  realtimeUdpInitTime = millis();
+  for (uint8_t protocol = 0; protocol < LIGHTING_PROTOCOLS; protocol++) realtimeUdp[protocol].close();
+
+  uint16_t universe = realtimeMode->mapping().universe;
+  realtimeUdpJoined = WiFi.isConnected() && realtimeUdp[LIGHTING_E131].listenMulticast(IPAddress(239, 255, universe >> 8, universe & 0xFF), E131_PORT);
+  if (!realtimeUdpJoined) realtimeUdp[LIGHTING_E131].listen(E131_PORT);
+  realtimeUdp[LIGHTING_ARTNET].listen(ARTNET_PORT);
+  realtimeUdp[LIGHTING_DDP].listen(DDP_PORT);
+  realtimeUdp[LIGHTING_E131].onPacket(onE131Packet);
+  realtimeUdp[LIGHTING_ARTNET].onPacket(onArtNetPacket);
+  realtimeUdp[LIGHTING_DDP].onPacket(onDdpPacket);
+
+  // Debug
+  Serial.println("[realtimeUdpInit] - Listening for E1.31" + String(realtimeUdpJoined ? " (multicast)" : "") + ", Art-Net and DDP from universe " + String(universe));
+}
+
+// The UDP callbacks only fill the pending frame, the mode is switched by handleRealtime()
+void onE131Packet(AsyncUDPPacket &_packet) {
+  realtimeUdpPacket(LIGHTING_E131, lightingParseE131(_packet.data(), _packet.length()));
+}
+
+void onArtNetPacket(AsyncUDPPacket &_packet) {
+  realtimeUdpPacket(LIGHTING_ARTNET, lightingParseArtNet(_packet.data(), _packet.length()));
+}
+
+void onDdpPacket(AsyncUDPPacket &_packet) {
+  realtimeUdpPacket(LIGHTING_DDP, lightingParseDdp(_packet.data(), _packet.length()));
+}
+
+void realtimeUdpPacket(LightingProtocol protocol, const LightingPacket& packet) {
+  if (packet.type == LIGHTING_IGNORE) return;
+  realtimeStats.packets++;
+
+  // A sync packet shows the frame received so far. E1.31 only syncs on the universe named by the data packets,
+  // Art-Net senders that sync once are expected to keep doing so.
+  if (packet.type == LIGHTING_SYNC) {
+    if (protocol == LIGHTING_ARTNET) realtimeArtSyncTime = millis() | 1;
+    else if (packet.universe != realtimeE131SyncUniverse) return;
+    if (realtimeUdpFramePending) {
+      realtimeUdpFramePending = false;
+      realtimeMode->showFrame();
+      realtimeStats.frames++;
+    }
+    return;
+  }
+
+  // Drop packets that arrive after a newer one, every universe is numbered on its own
+  LightingMapping mapping = realtimeMode->mapping();
+  uint16_t slot = protocol == LIGHTING_DDP ? 0 : packet.universe - mapping.universe;
+  if (protocol != LIGHTING_DDP && (packet.universe < mapping.universe || slot >= REALTIME_UNIVERSES_MAX)) return;
+  if (packet.sequence) {
+    uint8_t& last = realtimeSequence[protocol][slot];
+    if (last && lightingSequenceLate(packet.sequence, last, packet.sequenceBits)) {
+      realtimeStats.late++;
+      return;
+    }
+    last = packet.sequence;
+  }
+
+  bool complete = false;
+  if (protocol == LIGHTING_DDP) {
+    uint8_t channels = packet.channelsPerPixel ? packet.channelsPerPixel : mapping.channelsPerPixel;
+    uint32_t firstPixel = packet.offset / channels;
+    uint32_t count = packet.length / channels;
+    if (firstPixel >= NUM_LEDS) count = 0;
+    else if (firstPixel + count > NUM_LEDS) count = NUM_LEDS - firstPixel;
+    realtimeMode->setPixels(firstPixel, packet.data, count, channels == 4);
+    complete = packet.push;
+  }
+  else {
+    uint16_t firstPixel = 0;
+    uint16_t dataOffset = 0;
+    uint16_t count = lightingMapUniverse(mapping, packet.universe, packet.length, firstPixel, dataOffset);
+    if (!count) return;
+    realtimeMode->setPixels(firstPixel, packet.data + dataOffset, count, mapping.channelsPerPixel == 4);
+
+    // Without sync packets the frame is complete with the last universe. Art-Net goes back to that once the sync
+    // packets have stopped for 4 seconds.
+    bool lastUniverse = packet.universe == mapping.universe + lightingUniverseCount(mapping) - 1;
+    if (protocol == LIGHTING_E131) {
+      realtimeE131SyncUniverse = packet.syncUniverse;
+      complete = lastUniverse && !packet.syncUniverse;
+    }
+    else complete = lastUniverse && (!realtimeArtSyncTime || millis() - realtimeArtSyncTime > 4000);
+  }
+
+  if (complete) {
+    realtimeUdpFramePending = false;
+    realtimeMode->showFrame();
+    realtimeStats.frames++;
+  }
+  else realtimeUdpFramePending = true;
+}
+
+// Tell the clients about a switch made by the frames. It is not stored, so the lamp comes back in the mode it had
+// before the frames after a reset and the flash is not written every time a sender starts or stops.
+void realtimeNotify() {
+  JsonObject patch = statePatch.as<JsonObject>();
+  if (patch.isNull()) patch = statePatch.to<JsonObject>();
+  patch["Mode"] = Mode;
+  patch["State"] = State;
+  if (jsonArenaMeasure(statePatch, jsonArenaStats.patchPeak, false, "realtimeNotify")) statePatchOverflow = true;
+  invalidateClientState();
+}
+
+// A frame arrived, switch to the realtime mode and remember what to go back to
+void realtimeEnter() {
+  realtimePreviousMode = Mode;
+  realtimePreviousState = State;
+  Mode = "Realtime";
+  State = true;
+  realtimeNotify();
+
+  // Debug
+  Serial.println("[realtimeEnter] - Showing realtime frames, was \"" + realtimePreviousMode + "\"");
+}
+
+// Go back to the previous mode once the frames have stopped
+void realtimeLeave() {
+  // Also reached when the mode was chosen without sending frames or was stored before a reset. The state is then left
+  // alone and the mode from before Realtime was chosen is stored, Colour if that is not known or no mode anymore.
+  if (realtimePreviousMode != "" && realtimePreviousMode != "Realtime") {
+    Mode = realtimePreviousMode;
+    State = realtimePreviousState;
+    realtimePreviousMode = "";
+    realtimeNotify();
+  }
+  else {
+    bool known = realtimeReturnMode != "Realtime" && modes.find(realtimeReturnMode) != modes.end();
+    Mode = known ? realtimeReturnMode : "Colour";
+    realtimePreviousMode = "";
+    sendLampState();
+  }
+
+  // The next sender starts its own numbers
+  memset(realtimeSequence, 0, sizeof(realtimeSequence));
+  realtimeArtSyncTime = 0;
+
+  // Debug
+  Serial.println("[realtimeLeave] - No realtime frames, back to \"" + Mode + "\"");
+}
+
+void handleRealtime() {
+  // Restart the receivers after the universe changed, and join the multicast group once connected
+  if (realtimeUdpRestart || (!realtimeUdpJoined && WiFi.isConnected() && millis() - realtimeUdpInitTime > 10000)) realtimeUdpInit();
+
+  // Count the packets of the last second
+  if (millis() - realtimeStats.rateTime >= 1000) {
+    realtimeStats.packetRate = realtimeStats.packets - realtimeStats.ratePackets;
+    realtimeStats.ratePackets = realtimeStats.packets;
+    realtimeStats.rateTime = millis();
+  }
+
+  // The frames take over the light for as long as they keep coming in
+  bool receiving = realtimeMode->receiving();
+  if (receiving && Mode != "Realtime") realtimeEnter();
+  else if (!receiving && Mode == "Realtime") realtimeLeave();
+}
@@ -0,0 +1,180 @@
+/* RealtimeProtocol
+ *
+ * Binary messages on the websocket server, used to push pixels straight
+ * into the frame buffer and to change settings without any JSON. Every
+ * message starts with the protocol version and an opcode, multi byte
+ * values are little endian:
+ *
+ *   uint8   version   REALTIME_PROTOCOL_VERSION
+ *   uint8   opcode    see RealtimeOpcode
+ *   ...     payload
+ *
+ * Payloads:
+ *
+ *   PIXELS_RGBW    uint8 flags, uint16 start, then r, g, b, w per pixel
+ *   PIXELS_RGB     uint8 flags, uint16 start, then r, g, b per pixel
+ *   SET_PARAMETER  uint8 length, mode name, uint8 parameter index, int32 value
+ *   SET_LAMP       uint8 mask, uint8 state, uint8 brightness
+ *   PING           anything, sent back as it is with PONG
+ *   PREVIEW        uint8 flags, uint16 pixel count, then runs of
+ *                  uint8 skip, uint8 count, count RGB565 pixels
+ *   ERROR          uint8 error, uint8 opcode of the message that failed
+ *
+ * Pixel messages may cover any part of the string, the pixels are collected
+ * until a message with REALTIME_FLAG_SHOW completes the frame. A frame
+ * larger than one websocket message is sent in several parts that way.
+ * The parameter index is the position in the parameter table of the mode,
+ * as sent in the "Parameters" message.
+ *
+ * PREVIEW is only sent by the lamp, to clients that asked for a preview of
+ * the frames. The white channel is added to the colours, which are reduced
+ * to RGB565. Each run skips the pixels that did not change since the
+ * previous preview sent to the client and then replaces count pixels. A
+ * key frame (REALTIME_FLAG_KEY) replaces all pixels and starts the deltas.
+ *
+ * Nothing in here depends on the Arduino core.
+*/
+
+#ifndef RealtimeProtocol_h
+#define RealtimeProtocol_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define REALTIME_PROTOCOL_VERSION 1
+#define REALTIME_HEADER_SIZE      2
+#define REALTIME_PIXELS_HEADER    (REALTIME_HEADER_SIZE + 3)
+
+enum RealtimeOpcode : uint8_t {
+  REALTIME_PIXELS_RGBW    = 0x01,
+  REALTIME_PIXELS_RGB     = 0x02,
+  REALTIME_SET_PARAMETER  = 0x10,
+  REALTIME_SET_LAMP       = 0x11,
+  REALTIME_PING           = 0x20,
+  REALTIME_PONG           = 0x21,
+  REALTIME_PREVIEW        = 0x30,
+  REALTIME_ERROR          = 0x7F
+};
+
+// Flags of the pixel messages
+#define REALTIME_FLAG_SHOW        0x01  // the frame is complete and is shown
+
+// Flags of the preview messages
+#define REALTIME_FLAG_KEY         0x01  // all pixels are sent, not only the changed ones
+
+// Mask of SET_LAMP, which of the values are set
+#define REALTIME_LAMP_STATE       0x01
+#define REALTIME_LAMP_BRIGHTNESS  0x02
+
+enum RealtimeError : uint8_t {
+  REALTIME_ERROR_VERSION    = 1,  // unknown protocol version
+  REALTIME_ERROR_OPCODE     = 2,  // unknown opcode
+  REALTIME_ERROR_LENGTH     = 3,  // message too short or pixels out of range
+  REALTIME_ERROR_PARAMETER  = 4   // unknown mode or parameter index
+};
+
+// Reads the values of a message in order. Reading past the end sets failed and returns zeros.
+class RealtimeReader {
+public:
+  bool failed = false;
+
+  RealtimeReader(const uint8_t* data, size_t length) : data(data), length(length) {}
+
+  uint8_t readU8() {
+    const uint8_t* value = readBytes(1);
+    return value ? *value : 0;
+  }
+
+  uint16_t readU16() {
+    const uint8_t* value = readBytes(2);
+    return value ? value[0] | value[1] << 8 : 0;
+  }
+
+  int32_t readI32() {
+    const uint8_t* value = readBytes(4);
+    return value ? (int32_t)((uint32_t)value[0] | (uint32_t)value[1] << 8 | (uint32_t)value[2] << 16 | (uint32_t)value[3] << 24) : 0;
+  }
+
+  // Pointer to the next bytes of the message, nullptr if there are not enough left
+  const uint8_t* readBytes(size_t count) {
+    if (failed || count > length - position) {
+      failed = true;
+      return nullptr;
+    }
+    const uint8_t* value = data + position;
+    position += count;
+    return value;
+  }
+
+  size_t remaining() const { return failed ? 0 : length - position; }
+
+private:
+  const uint8_t*  data;
+  size_t          length;
+  size_t          position = 0;
+};
+
+// Number of whole pixels in a pixel message after its header, 0 for other opcodes
+inline size_t realtimePixelCount(uint8_t opcode, size_t payloadLength) {
+  if (opcode == REALTIME_PIXELS_RGBW) return payloadLength / 4;
+  if (opcode == REALTIME_PIXELS_RGB) return payloadLength / 3;
+  return 0;
+}
+
+inline uint16_t realtimeRgb565(uint8_t red, uint8_t green, uint8_t blue) {
+  return (red & 0xF8) << 8 | (green & 0xFC) << 3 | blue >> 3;
+}
+
+// Largest preview message of count pixels, every other pixel changed
+inline size_t realtimePreviewSize(uint16_t count) {
+  return REALTIME_HEADER_SIZE + 3 + count * 2 + (count / 2 + 1) * 2;
+}
+
+// Write a preview message of the pixels into data, which must hold realtimePreviewSize() bytes. Only the pixels that
+// differ from last are sent unless key is set, last is updated to the pixels. Returns the length of the message or 0
+// if nothing changed.
+inline size_t realtimeEncodePreview(const uint16_t* pixels, uint16_t* last, uint16_t count, bool key, uint8_t* data) {
+  size_t length = 0;
+  data[length++] = REALTIME_PROTOCOL_VERSION;
+  data[length++] = REALTIME_PREVIEW;
+  data[length++] = key ? REALTIME_FLAG_KEY : 0;
+  data[length++] = count & 0xFF;
+  data[length++] = count >> 8;
+  bool changed = false;
+
+  uint16_t position = 0;
+  while (position < count) {
+    // Skip the unchanged pixels, at most 255 at a time
+    uint16_t skip = 0;
+    while (!key && position + skip < count && skip < 255 && pixels[position + skip] == last[position + skip]) skip++;
+    if (position + skip == count) break;
+    position += skip;
+
+    // Copy the changed pixels that follow, a run may be empty if more than 255 pixels are skipped
+    uint16_t run = 0;
+    uint8_t* runHeader = data + length;
+    length += 2;
+    while (position < count && run < 255 && (key || pixels[position] != last[position])) {
+      last[position] = pixels[position];
+      data[length++] = pixels[position] & 0xFF;
+      data[length++] = pixels[position] >> 8;
+      position++;
+      run++;
+    }
+    runHeader[0] = skip;
+    runHeader[1] = run;
+    changed |= run > 0;
+  }
+
+  return changed ? length : 0;
+}
+
+// Write the version and opcode, returns the size of the header
+inline size_t realtimeWriteHeader(uint8_t* data, uint8_t opcode) {
+  data[0] = REALTIME_PROTOCOL_VERSION;
+  data[1] = opcode;
+  return REALTIME_HEADER_SIZE;
+}
+
+#endif
@@ -0,0 +1,150 @@
+/* Scheduler
+ *
+ * Timing side of the automation rules: when a rule fires next and a hashed
+ * timer wheel that hands out the rules once they are due. What a rule does
+ * when it fires is left to the sketch. Nothing in here depends on the
+ * Arduino core, all times are local seconds since 1970 so days of virtual
+ * time can be run through it on any machine.
+ *
+ * The wheel has SCHEDULE_WHEEL_SLOTS slots of one second. A rule is linked
+ * into the slot of its due time and every tick only looks at the rules in
+ * one slot, so the work per tick does not grow with the number of rules.
+ * Rules due more than one lap ahead stay in their slot until their time
+ * has come.
+*/
+
+#ifndef Scheduler_h
+#define Scheduler_h
+
+#include <stdint.h>
+#include <math.h>
+
+#define SCHEDULE_MAX_RULES    16
+#define SCHEDULE_WHEEL_SLOTS  64
+#define SCHEDULE_EVERY_DAY    0x7F
+
+enum ScheduleTrigger : uint8_t {
+  SCHEDULE_AT_TIME = 0,   // minutes is the minute of the day
+  SCHEDULE_AT_SUNRISE,    // minutes is an offset to sunrise
+  SCHEDULE_AT_SUNSET      // minutes is an offset to sunset
+};
+
+struct ScheduleRule {
+  uint8_t   days        = SCHEDULE_EVERY_DAY;   // bit 0 is Sunday
+  uint8_t   trigger     = SCHEDULE_AT_TIME;
+  int16_t   minutes     = 0;
+  int16_t   brightness  = -1;                   // target brightness, -1 to leave it alone
+  uint16_t  rampMinutes = 0;                    // time to ramp to the target brightness
+};
+
+// Day of the year (1 - 366) of the given day since 1970
+inline uint16_t scheduleDayOfYear(uint32_t day) {
+  // Civil from days, see http://howardhinnant.github.io/date_algorithms.html
+  int32_t z = day + 719468;
+  int32_t era = z / 146097;
+  uint32_t doe = z - era * 146097;
+  uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);  // days since the 1st of March
+  uint32_t year = yoe + era * 400 + (doy >= 306 ? 1 : 0);
+  bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  return (doy >= 306) ? doy - 305 : doy + 60 + (leap ? 1 : 0);
+}
+
+// Local minute of the day of sunrise or sunset (NOAA approximation), -1 if the sun does not rise or set that day
+inline int16_t scheduleSunMinutes(uint16_t dayOfYear, float latitude, float longitude, int32_t utcOffsetMinutes, bool sunrise) {
+  const float toRad = M_PI / 180.0;
+  float gamma = 2 * M_PI / 365 * (dayOfYear - 1);
+  float eqTime = 229.18 * (0.000075 + 0.001868 * cos(gamma) - 0.032077 * sin(gamma) - 0.014615 * cos(2 * gamma) - 0.040849 * sin(2 * gamma));
+  float decl = 0.006918 - 0.399912 * cos(gamma) + 0.070257 * sin(gamma) - 0.006758 * cos(2 * gamma) + 0.000907 * sin(2 * gamma) - 0.002697 * cos(3 * gamma) + 0.00148 * sin(3 * gamma);
+  float cosHourAngle = cos(90.833 * toRad) / (cos(latitude * toRad) * cos(decl)) - tan(latitude * toRad) * tan(decl);
+  if (cosHourAngle < -1 || cosHourAngle > 1) return -1;
+  float hourAngle = acos(cosHourAngle) / toRad;
+  int32_t minutes = lround(720 - 4 * (longitude + (sunrise ? hourAngle : -hourAngle)) - eqTime) + utcOffsetMinutes;
+  return ((minutes % 1440) + 1440) % 1440;
+}
+
+// Local time of the next occurrence of the rule after now, 0 if it does not occur within a week
+inline uint32_t scheduleNextOccurrence(const ScheduleRule& rule, uint32_t now, float latitude, float longitude, int32_t utcOffsetMinutes) {
+  uint32_t today = now / 86400;
+  for (uint32_t day = today; day <= today + 7; day++) {
+    // The 1st of January 1970 was a Thursday
+    if (!(rule.days & (1 << ((day + 4) % 7)))) continue;
+
+    int32_t minute = rule.minutes;
+    if (rule.trigger != SCHEDULE_AT_TIME) {
+      int16_t sun = scheduleSunMinutes(scheduleDayOfYear(day), latitude, longitude, utcOffsetMinutes, rule.trigger == SCHEDULE_AT_SUNRISE);
+      if (sun < 0) continue;
+      minute += sun;
+    }
+
+    int64_t time = (int64_t)day * 86400 + minute * 60;
+    if (time > now) return time;
+  }
+  return 0;
+}
+
+class ScheduleWheel {
+public:
+  /// Empty the wheel and start ticking from now
+  void begin(uint32_t now) {
+    current = now;
+    for (uint8_t i = 0; i < SCHEDULE_WHEEL_SLOTS; i++) slots[i] = -1;
+    for (uint8_t i = 0; i < SCHEDULE_MAX_RULES; i++) entries[i].active = false;
+  }
+
+  /// Add or move a rule, due times in the past fire on the next tick
+  void schedule(uint8_t id, uint32_t due) {
+    cancel(id);
+    if (due <= current) due = current + 1;
+    uint8_t slot = due % SCHEDULE_WHEEL_SLOTS;
+    entries[id].due = due;
+    entries[id].active = true;
+    entries[id].next = slots[slot];
+    slots[slot] = id;
+  }
+
+  void cancel(uint8_t id) {
+    if (!entries[id].active) return;
+    int8_t* link = &slots[entries[id].due % SCHEDULE_WHEEL_SLOTS];
+    while (*link != -1 && *link != id) link = &entries[*link].next;
+    if (*link == id) *link = entries[id].next;
+    entries[id].active = false;
+  }
+
+  /// Tick up to now and call fired(id) for every rule that became due. At most one lap is
+  /// walked, so a large jump costs the same as SCHEDULE_WHEEL_SLOTS ticks.
+  template <typename Callback> void advance(uint32_t now, Callback fired) {
+    if ((int32_t)(now - current) <= 0) return;
+    uint32_t ticks = now - current;
+    if (ticks > SCHEDULE_WHEEL_SLOTS) ticks = SCHEDULE_WHEEL_SLOTS;
+    for (uint32_t tick = 1; tick <= ticks; tick++) {
+      int8_t* link = &slots[(current + tick) % SCHEDULE_WHEEL_SLOTS];
+      while (*link != -1) {
+        uint8_t id = *link;
+        if (entries[id].due <= now) {
+          *link = entries[id].next;
+          entries[id].active = false;
+          fired(id);
+        }
+        else link = &entries[id].next;
+      }
+    }
+    current = now;
+  }
+
+  bool isScheduled(uint8_t id) const { return entries[id].active; }
+  uint32_t dueTime(uint8_t id) const { return entries[id].due; }
+
+private:
+  struct Entry {
+    uint32_t  due     = 0;
+    int8_t    next    = -1;
+    bool      active  = false;
+  };
+
+  Entry     entries[SCHEDULE_MAX_RULES];
+  int8_t    slots[SCHEDULE_WHEEL_SLOTS];
+  uint32_t  current = 0;
+};
+
+#endif
@@ -0,0 +1,205 @@
+// Scheduler Methods
+void scheduleInit() {
+  // Load the rules saved on the flash
+  recoverFile(fileSystem, "/Schedule.json", "/Schedule.tmp");
+  if (fileSystem.exists("/Schedule.json")) {
+    File scheduleFile = fileSystem.open("/Schedule.json", "r");
+    // An empty file was left by a replacement that did not finish, see FileReplace.h
+    if (scheduleFile && scheduleFile.size() == 0) scheduleFile.close();
+    else if (scheduleFile) {
+      DynamicJsonDocument jsonDocument(2048);
+      DeserializationError jsonError = deserializeJson(jsonDocument, scheduleFile);
+      scheduleFile.close();
+
+      if (!jsonError) {
+        JsonVariant scheduleSettings = jsonDocument.as<JsonVariant>();
+        scheduleLoad(scheduleSettings);
+      }
+      else {
+        Serial.print("[scheduleInit] - deserializeJson() failed: ");
+        Serial.println(jsonError.c_str());
+      }
+    }
+    else Serial.println("[scheduleInit] - Failed to open schedule file");
+  }
+}
+
+// Replace the rules with the handed over ones
+/*
+  {
+    "Latitude" : 51.5,
+    "Longitude" : -0.12,
+    "Rules" : [
+      { "Days" : [1, 2, 3, 4, 5], "Time" : "06:30", "Brightness" : 255, "Ramp" : 20, "Settings" : { "State" : true, "Mode" : "Colour", "Colour" : { "White" : 255 } } },
+      { "Time" : "23:00", "Settings" : { "State" : false } },
+      { "Sun" : "Sunset", "Offset" : -15, "Settings" : { "Mode" : "Rainbow" } }
+    ]
+  }
+*/
+void scheduleLoad(JsonVariant& scheduleSettings) {
+  scheduleLatitude = scheduleSettings["Latitude"] | scheduleLatitude;
+  scheduleLongitude = scheduleSettings["Longitude"] | scheduleLongitude;
+
+  scheduleRuleCount = 0;
+  for (JsonVariant ruleSettings : scheduleSettings["Rules"].as<JsonArray>()) {
+    if (scheduleRuleCount >= SCHEDULE_MAX_RULES) {
+      Serial.println("[scheduleLoad] - Only " + String(SCHEDULE_MAX_RULES) + " rules are supported, ignoring the rest");
+      break;
+    }
+    ScheduleRule rule;
+
+    // Days of the week, 0 is Sunday. All days if not given
+    JsonArray days = ruleSettings["Days"];
+    if (days.size() > 0) {
+      rule.days = 0;
+      for (int day : days) rule.days |= 1 << (day % 7);
+    }
+
+    // Either a time of the day or an offset to sunrise or sunset
+    String sun = ruleSettings["Sun"] | "";
+    if (sun == "Sunrise" || sun == "Sunset") {
+      rule.trigger = (sun == "Sunrise") ? SCHEDULE_AT_SUNRISE : SCHEDULE_AT_SUNSET;
+      rule.minutes = ruleSettings["Offset"] | 0;
+    }
+    else {
+      String time = ruleSettings["Time"] | "00:00";
+      rule.minutes = constrain(time.substring(0, time.indexOf(':')).toInt() * 60 + time.substring(time.indexOf(':') + 1).toInt(), 0, 1439);
+    }
+
+    // Actions
+    rule.brightness = ruleSettings.containsKey("Brightness") ? constrain(ruleSettings["Brightness"].as<int>(), 0, 255) : -1;
+    rule.rampMinutes = ruleSettings["Ramp"] | 0;
+    scheduleRuleSettings[scheduleRuleCount] = "";
+    if (ruleSettings.containsKey("Settings")) serializeJson(ruleSettings["Settings"], scheduleRuleSettings[scheduleRuleCount]);
+    scheduleRules[scheduleRuleCount++] = rule;
+  }
+
+  // Put the rules on the wheel again
+  scheduleLastTime = 0;
+
+  // Debug
+  Serial.println("[scheduleLoad] - Loaded " + String(scheduleRuleCount) + " schedule rules");
+}
+
+// Apply the rules and store them, they are written to the flash with the device config by handleConfigWrite()
+void scheduleSave(JsonVariant& scheduleSettings) {
+  scheduleLoad(scheduleSettings);
+
+  scheduleJson = "";
+  serializeJson(scheduleSettings, scheduleJson);
+  scheduleDirty = true;
+  deviceConfigChangeTime = millis();
+}
+
+// Replace /Schedule.json with the rules last handed over, see FileReplace.h
+bool writeSchedule() {
+  bool written = replaceFile(fileSystem, "/Schedule.json", "/Schedule.tmp", scheduleJson.length(), [](File& file) {
+    return file.print(scheduleJson);
+  });
+  if (!written) {
+    Serial.println("[writeSchedule] - Failed to replace schedule file");
+    return false;
+  }
+  scheduleJson = "";
+  return true;
+}
+
+void handleSchedule() {
+  // Nothing can be scheduled without the time
+  if (!ntpTimeSet || !scheduleRuleCount) return;
+
+  // Local time in seconds
+  uint32_t now = lampClock.time(millis()) / 1000 + utcOffset;
+  if (now == scheduleLastTime) {
+    handleScheduleRamp();
+    return;
+  }
+
+  // Put all rules on the wheel again after a reload or when the clock jumped
+  if (!scheduleLastTime || now - scheduleLastTime > 60) {
+    scheduleWheel.begin(now);
+    for (uint8_t i = 0; i < scheduleRuleCount; i++) {
+      uint32_t due = scheduleNextOccurrence(scheduleRules[i], now, scheduleLatitude, scheduleLongitude, (long)utcOffset / 60);
+      if (due) scheduleWheel.schedule(i, due);
+    }
+  }
+  scheduleLastTime = now;
+
+  // Fire the rules that are due and put them back for their next occurrence
+  scheduleWheel.advance(now, [now](uint8_t id) {
+    scheduleFire(id);
+    uint32_t due = scheduleNextOccurrence(scheduleRules[id], now, scheduleLatitude, scheduleLongitude, (long)utcOffset / 60);
+    if (due) scheduleWheel.schedule(id, due);
+  });
+
+  handleScheduleRamp();
+}
+
+void scheduleFire(uint8_t id) {
+  ScheduleRule& rule = scheduleRules[id];
+  bool wasOn = State;
+
+  // Apply the settings like any other message
+  if (scheduleRuleSettings[id] != "") {
+    DynamicJsonDocument jsonDocument(1024);
+    DeserializationError jsonError = deserializeJson(jsonDocument, scheduleRuleSettings[id]);
+    if (!jsonError) parseConfig(jsonDocument);
+    else Serial.println("[scheduleFire] - Settings of rule " + String(id) + " are invalid");
+  }
+
+  // Start the brightness ramp, coming on it starts from dark
+  if (rule.brightness >= 0) {
+    if (rule.rampMinutes) {
+      scheduleRampFrom = (!wasOn && State) ? 0 : Brightness;
+      scheduleRampTo = rule.brightness;
+      scheduleRampTime = (unsigned long)rule.rampMinutes * 60000;
+      scheduleRampStart = millis();
+      Brightness = scheduleRampLast = scheduleRampFrom;
+    }
+    else {
+      Brightness = rule.brightness;
+      sendLampState();
+    }
+  }
+
+  // Debug
+  Serial.println("[scheduleFire] - Rule " + String(id) + " fired at " + get12hrAsString());
+}
+
+void handleScheduleRamp() {
+  if (scheduleRampStart) {
+    unsigned long elapsed = millis() - scheduleRampStart;
+    int expected = scheduleRampFrom + (long)(scheduleRampTo - scheduleRampFrom) * (elapsed < scheduleRampTime ? elapsed : scheduleRampTime) / scheduleRampTime;
+
+    // Stop if the brightness was changed by anything else
+    if (Brightness != scheduleRampLast) {
+      scheduleRampStart = 0;
+      return;
+    }
+    Brightness = scheduleRampLast = expected;
+
+    // Store the final brightness
+    if (elapsed >= scheduleRampTime) {
+      scheduleRampStart = 0;
+      sendLampState();
+    }
+  }
+}
+
+// Local time of the next rule, 0 if none is scheduled
+uint32_t scheduleNextDue() {
+  uint32_t next = 0;
+  for (uint8_t i = 0; i < scheduleRuleCount; i++) {
+    if (scheduleWheel.isScheduled(i) && (!next || scheduleWheel.dueTime(i) < next)) next = scheduleWheel.dueTime(i);
+  }
+  return next;
+}
+
+// Day and time of a local time as a string, e.g. "Mon 06:30"
+String scheduleTimeAsString(uint32_t localTime) {
+  const char* dayNames[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+  uint32_t minuteOfDay = localTime % 86400 / 60;
+  String hrStr = minuteOfDay / 60 < 10 ? "0" + String(minuteOfDay / 60) : String(minuteOfDay / 60);
+  String minStr = minuteOfDay % 60 < 10 ? "0" + String(minuteOfDay % 60) : String(minuteOfDay % 60);
+  return String(dayNames[(localTime / 86400 + 4) % 7]) + " " + hrStr + ":" + minStr;
+}
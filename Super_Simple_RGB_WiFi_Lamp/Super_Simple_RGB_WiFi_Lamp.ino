@@ -1,24 +1,40 @@
 // Included Libraries
 #define FASTLED_ESP8266_RAW_PIN_ORDER
 #include "user_interface.h"
+extern "C" {
+#include "gpio.h"
+}
 #include <FastLED.h>
 #include "FS.h"
 #include <ESP8266WiFi.h>
 #include "IPAddress.h"
 #include <DNSServer.h>
 #include <ESP8266mDNS.h>
-#include <ESP8266WebServer.h>
-#include <ESP8266HTTPUpdateServer.h>
 #include <ESPAsyncTCP.h>
-#include <WebSocketsServer.h>
+#include <ESPAsyncWebServer.h>
 #include <ArduinoJson.h>
 #include <TimeLib.h>
 #include <ESPAsyncUDP.h>
 #include "arduinoFFT.h"
 #include "lwip/inet.h"
 #include "lwip/dns.h"
+#include "lwip/dhcp.h"
 #include <map>
+#include <new>
+#include <vector>
 #include "FastLED_RGBW.h"
+#include "SwitchGestures.h"
+#include "ConfigSnapshot.h"
+#include "FileReplace.h"
+#include "WifiConnection.h"
+#include "NtpTime.h"
+#include "Scheduler.h"
+#include "ModeParameters.h"
+#include "RealtimeProtocol.h"
+#include "LightingProtocols.h"
+#include "LampSync.h"
+#include "BeatClock.h"
+#include "AudioStream.h"
 
 
 // ############################################################# Sketch Variables #############################################################
@@ -27,11 +43,18 @@
 
 #define DEFAULT_NAME "Lillys Lamp"
 
+// File system used to store the settings. LittleFS is faster and wear levels small writes, it needs version 2.7.0 or newer
+// of the ESP8266 core. Settings stored in SPIFFS by older versions of this sketch are moved over on the first start. Comment
+// this out to keep using SPIFFS.
+#define USE_LITTLEFS
+
 // Set Your Data pin - This is the pin on your ESP8266 that is connected to the LED's. Remember to add the letter "D" infront of the number 
 // to map the pin correctly for your platform.
 #define DATA_PIN D5
 
-// Pin used for the manual switch to turn LEDs on and off
+// Pin used for the manual switch to turn LEDs on and off. A short press toggles the light, a double press steps to the next
+// mode, holding the button ramps the brightness and holding it for 5 seconds slowly fades the light off. Pins that support
+// interrupts are read by an ISR, others (like D0) are sampled from the main loop.
 #define SWITCH_PIN D0
 
 // Set the number of LED's - Simply count how many there are on your string and enter the number here.
@@ -48,6 +71,11 @@
 // above cause flickering LEDs because of the WS2821 update frequency.
 #define FRAME_RATE 60
 
+// Optional pin that switches the power rail of the LEDs, for example through a MOSFET. When the light is off and has faded
+// out the pin is pulled LOW to stop the LEDs drawing their quiescent current. Leave commented out if the LEDs are powered
+// directly.
+// #define LED_POWER_PIN D6
+
 // Set up LED's for each side - These arrays hold which leds are on what sides. For the basic rectangular shape in the example this relates to 4
 // sides and 4 arrays. You must subract 1 off the count of the LED when entering it as the array is 0 based. For example the first LED on the 
 // string is entered as 0.
@@ -60,8 +88,26 @@ int leftLeds[]   = {51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41};
 // method to get your ESP8266 connected to your network quickly. If you don't you can always set it up later in the wifi portal.
 String SSID = "";
 String Password = "";
+
+// Optional static IP - A fixed address skips DHCP and makes connecting to your network faster. Leave these commented out to use
+// DHCP, the last lease is then reused for a fast reconnect and renewed through DHCP in the background.
+// #define STATIC_IP       192, 168, 1, 50
+// #define STATIC_GATEWAY  192, 168, 1, 1
+// #define STATIC_SUBNET   255, 255, 255, 0
+// #define STATIC_DNS      192, 168, 1, 1
+
+// Keep the presets in RAM so recalling one does not touch the flash. Each preset takes around 150 bytes. Comment this
+// out to read the preset from the flash on every recall.
+#define PRESET_PRELOAD
 // ########################################################## End of Sketch Variables ##########################################################
 
+#ifdef USE_LITTLEFS
+#include <LittleFS.h>
+fs::FS& fileSystem = LittleFS;
+#else
+fs::FS& fileSystem = SPIFFS;
+#endif
+
 class ModeBase
 {
 public:
@@ -71,86 +117,565 @@ public:
     // Is called once per frame to update the LEDs
     virtual void render();
 
-    // Update config member variables based on the handed over settings
-    virtual void applyConfig(JsonVariant& settings);
+    // Update the config from the handed over settings. Only the parameters present in settings are touched, values
+    // that are not numbers are ignored and the rest is clamped to its range and written back, so the clients see the
+    // values in use.
+    virtual void applyConfig(JsonVariant& settings) {
+        bool changed = false;
+        for (uint8_t i = 0; i < parameterCount; i++) {
+            JsonVariant value = parameterValue(parameterTable[i], settings);
+            if (value.is<float>()) changed |= modeParameterSet(parameterTable[i], parameterConfig, value.as<long>());
+        }
+        if (changed) configChanged();
+
+        for (uint8_t i = 0; i < parameterCount; i++) {
+            JsonVariant value = parameterValue(parameterTable[i], settings);
+            if (!value.isNull()) value.set(modeParameterGet(parameterTable[i], parameterConfig));
+        }
+    }
+
+    // Add the config to settings. With a reference snapshot only the parameters that differ from it are added.
+    void addConfig(JsonVariant settings, const uint8_t* reference = nullptr, uint8_t referenceLength = 0) {
+        uint8_t position = 0;
+        for (uint8_t i = 0; i < parameterCount; i++) {
+            const ModeParameter& parameter = parameterTable[i];
+            int32_t value = modeParameterGet(parameter, parameterConfig);
+            uint8_t size = modeParameterSize(parameter.type);
+            bool unchanged = reference && position + size <= referenceLength && modeParameterRead(parameter.type, reference + position) == value;
+            position += size;
+            if (unchanged) continue;
+
+            if (parameter.group) settings[parameter.group][parameter.name] = value;
+            else settings[parameter.name] = value;
+        }
+    }
+
+    // Add the config held in a snapshot written by saveSnapshot() to settings, the config in use is not touched.
+    // Parameters missing from shorter snapshots of older versions are left out.
+    void addSnapshotConfig(JsonVariant settings, const uint8_t* data, uint8_t length) {
+        uint8_t position = 0;
+        for (uint8_t i = 0; i < parameterCount; i++) {
+            const ModeParameter& parameter = parameterTable[i];
+            uint8_t size = modeParameterSize(parameter.type);
+            if (position + size > length) break;
+            int32_t value = modeParameterClamp(parameter, modeParameterRead(parameter.type, data + position));
+            position += size;
+
+            if (parameter.group) settings[parameter.group][parameter.name] = value;
+            else settings[parameter.name] = value;
+        }
+    }
+
+    // Write a snapshot like saveSnapshot() of the config in use with the parameters in settings applied, without
+    // changing the config in use. The values are clamped the same way applyConfig() does.
+    uint8_t saveSnapshotWith(uint8_t* data, JsonVariant settings) {
+        uint8_t position = 0;
+        for (uint8_t i = 0; i < parameterCount; i++) {
+            const ModeParameter& parameter = parameterTable[i];
+            JsonVariant value = parameterValue(parameter, settings);
+            int32_t packed = value.is<float>() ? modeParameterClamp(parameter, value.as<long>()) : modeParameterGet(parameter, parameterConfig);
+            modeParameterWrite(parameter.type, data + position, packed);
+            position += modeParameterSize(parameter.type);
+        }
+        return position;
+    }
+
+    // Describe a parameter for the website. The strings are not copied, the entry needs JSON_OBJECT_SIZE(9).
+    void addParameterInfo(JsonObject entry, uint8_t index) {
+        const ModeParameter& parameter = parameterTable[index];
+        entry["Name"] = parameter.name;
+        if (parameter.group) entry["Group"] = parameter.group;
+        entry["Label"] = parameter.label;
+        entry["Unit"] = parameter.unit;
+        entry["Min"] = parameter.minimum;
+        entry["Max"] = parameter.maximum;
+        entry["Step"] = parameter.step;
+        entry["Default"] = parameter.defaultValue;
+        entry["Show"] = modeParameterShowName(parameter.show);
+    }
+
+    uint8_t countParameters() const { return parameterCount; }
+
+    // Entry of the parameter table at index, nullptr if there is none
+    const ModeParameter* parameter(uint8_t index) const { return index < parameterCount ? &parameterTable[index] : nullptr; }
+
+    // Write the config into data in the layout of the parameter table and return its size, at most
+    // MODE_SNAPSHOT_MAX_SIZE bytes
+    virtual uint8_t saveSnapshot(uint8_t* data) {
+        return modeParametersPack(parameterTable, parameterCount, parameterConfig, data);
+    }
+
+    // Restore the config from data written by saveSnapshot(), snapshots written by older versions may be shorter
+    virtual void loadSnapshot(const uint8_t* data, uint8_t length) {
+        if (modeParametersUnpack(parameterTable, parameterCount, parameterConfig, data, length)) configChanged();
+    }
+
+protected:
+    // Register the parameter table of the mode and the config struct it describes, the config is set to the defaults
+    template <size_t N> void setParameters(const ModeParameter (&table)[N], void* config) {
+        parameterTable = table;
+        parameterCount = N;
+        parameterConfig = config;
+        modeParametersReset(parameterTable, parameterCount, parameterConfig);
+    }
+
+    // Called after the config was changed, override to check values against each other or update derived values
+    virtual void configChanged() {}
+
+private:
+    const ModeParameter*  parameterTable  = nullptr;
+    uint8_t               parameterCount  = 0;
+    void*                 parameterConfig = nullptr;
+
+    // The value of the parameter in settings, null if it is not there. Nothing is added to settings.
+    JsonVariant parameterValue(const ModeParameter& parameter, JsonVariant& settings) {
+        JsonVariant parent = parameter.group ? settings.getMember(parameter.group) : settings;
+        return parent.getMember(parameter.name);
+    }
+};
+
+#define MODE_SNAPSHOT_MAX_SIZE 64
+
+// Last good wifi connection, kept in RTC memory across resets and in flash across power cycles
+struct WifiCache {
+  uint32_t  magic;
+  uint32_t  ssidCrc;        // CRC of the SSID the cache belongs to
+  uint8_t   bssid[6];
+  uint8_t   channel;
+  uint8_t   reserved;
+  uint32_t  ip;
+  uint32_t  gateway;
+  uint32_t  subnet;
+  uint32_t  dns;
+  uint32_t  crc;            // CRC of all members above
+};
+#define WIFI_CACHE_MAGIC      0x48434657  // "WFCH"
+#define WIFI_CACHE_RTC_OFFSET 32          // The first 128 bytes of the RTC user memory are used by OTA
+
+// Preview state of a websocket client, see Preview.ino
+struct PreviewClient {
+  uint8_t         rate;         // Frames per second, 0 if the client has not asked
+  bool            key;          // Next preview is sent whole
+  unsigned long   lastTime;     // Time the last preview was sent
+  std::vector<uint16_t> last;   // Pixels as the client has them
 };
 
 std::map<String, ModeBase*> modes;
 
+
 // In some cases the automatic creation of the prototypes does not work. Do it manually...
+// Audio.ino
+void audioInit();
+void onAudioPacket(AsyncUDPPacket &_packet);
+void handleAudio();
+bool audioReceiving();
+String audioInfo();
+// Beat.ino
+uint32_t beatMillis();
+uint16_t animationPhase(unsigned long periodMs, uint16_t beats);
+uint32_t animationSteps(unsigned long stepMs, uint16_t stepsPerBeat);
+void beatApplyConfig(JsonVariant& beatSettings);
+void beatInit();
+void onBeatPacket(AsyncUDPPacket &_packet);
+void handleBeat();
+void beatAudioFrame(float energy, float threshold);
+String beatInfo();
 // Config.ino
 bool checkFlashConfig();
+bool mountFileSystem();
+bool migrateSpiffsToLittleFS();
 void getConfig();
-bool sendConfigViaWS();
+bool sendConfigViaWS(uint8_t num);
+void invalidateClientState();
+void sendParametersViaWS(uint8_t num);
+bool loadDeviceConfig();
 void saveConfigItem(JsonDocument& jsonSetting);
+void mergeConfig(JsonObject target, JsonObjectConst source);
+void copyConfigValue(JsonVariant target, JsonVariantConst source);
+void addConfigChanges(JsonObject patch, JsonObjectConst after, JsonObjectConst before);
+bool jsonArenaMeasure(JsonDocument& jsonDocument, uint16_t& peak, bool overflowed, const char* user);
+void handleConfigWrite();
+bool writeDeviceConfig();
 void parseConfig(JsonDocument& jsonMessage);
+void sendLampState();
 void addLampInfo(JsonDocument& jsonMessage);
+bool restoreConfigSnapshot();
+bool loadConfigSnapshot();
+void writeConfigSnapshot(ConfigSnapshotWriter& writer);
+size_t writeConfigSnapshotFile(void* context, const uint8_t* data, size_t length);
+bool saveConfigSnapshot();
+uint8_t* readSnapshotFile(const String& path, uint32_t magic, uint16_t& length, uint32_t& crc);
+String tempFilePath(const String& path);
+void readModeSnapshots(ConfigSnapshotReader& reader);
+void writeModeSnapshots(ConfigSnapshotWriter& writer);
 // LEDs.ino
 void ledStringInit();
 void ledModeInit();
 void handleMode();
+void renderFrame();
 void adjustBrightnessAndSwitchMode();
+bool lampCanIdle();
+void enterLampIdle();
+void leaveLampIdle();
+float lampIdleResidency();
+void frameTimeMeasure();
+String frameTimeInfo();
 // NTP.ino
+void ntpInit();
 void handleNTP();
-bool getNTPServerIP(const char *_ntpServerName, IPAddress &_ntpServerIp);
+void resolveNTPServer();
+void onNTPServerFound(const char *_name, const ip_addr_t *_ipAddress, void *_arg);
 bool sendNTPRequest();
-void parseNTPResponse(uint8_t *_ntpData);
+void onNTPPacket(AsyncUDPPacket &_packet);
+void parseNTPResponse();
+void ntpRequestFailed(const String &_reason);
+time_t ntpSyncProvider();
 String get12hrAsString();
+// Presets.ino
+void presetInit();
+String presetPath(uint8_t slot);
+int8_t presetFind(const String& name);
+size_t writePresetBuffer(void* context, const uint8_t* data, size_t length);
+void presetCapture(const String& name, std::vector<uint8_t>& payload);
+void presetFromSettings(const String& name, JsonObject settings, std::vector<uint8_t>& payload);
+bool presetRead(uint8_t slot, std::vector<uint8_t>& payload);
+bool presetApply(const uint8_t* payload, size_t length);
+bool presetSave(const String& name);
+bool presetStore(const String& name, std::vector<uint8_t>& payload);
+bool presetRecall(const String& name);
+bool presetDelete(const String& name);
+void presetAddChanges(JsonObject settings, const std::vector<uint8_t>& previous);
+bool presetExport(const String& name, JsonObject settings);
+bool presetImport(const String& name, JsonObject settings);
+void presetCommand(JsonVariant& presetSettings);
+void presetAddNames(JsonDocument& jsonDocument);
+void presetSendExports();
+void handlePresets();
+// Preview.ino
+void previewSubscribe(uint8_t num, int rate);
+void sendPreviewLayout(uint8_t num);
+void handlePreview();
+void sendPreview(uint8_t num, PreviewClient& client);
+// Realtime.ino
+void realtimeMessage(uint8_t num, uint8_t* payload, size_t length);
+RealtimeError realtimePixels(RealtimeReader& reader, uint8_t opcode);
+RealtimeError realtimeSetParameter(RealtimeReader& reader);
+RealtimeError realtimeSetLamp(RealtimeReader& reader);
+void realtimeReply(uint8_t num, uint8_t opcode, const uint8_t* data, size_t length);
+void realtimeUdpInit();
+void onE131Packet(AsyncUDPPacket &_packet);
+void onArtNetPacket(AsyncUDPPacket &_packet);
+void onDdpPacket(AsyncUDPPacket &_packet);
+void realtimeUdpPacket(LightingProtocol protocol, const LightingPacket& packet);
+void realtimeNotify();
+void realtimeEnter();
+void realtimeLeave();
+void handleRealtime();
+// Scheduler.ino
+void scheduleInit();
+void scheduleLoad(JsonVariant& scheduleSettings);
+void scheduleSave(JsonVariant& scheduleSettings);
+bool writeSchedule();
+void handleSchedule();
+void scheduleFire(uint8_t id);
+void handleScheduleRamp();
+uint32_t scheduleNextDue();
+String scheduleTimeAsString(uint32_t localTime);
+// Super_Simple_RGB_WiFi_Lamp.ino
+void handleBoot();
+// Sync.ino
+uint32_t animationMillis();
+void syncApplyConfig(JsonVariant& syncSettings);
+void syncInit();
+void onSyncPacket(AsyncUDPPacket &_packet);
+void handleSync();
+void sendSyncBeacon();
+void applySyncBeacon();
+void sendSyncRequest();
+void applySyncReply();
+String syncInfo();
+// Switch.ino
+void switchInit();
+void switchInterrupt();
+void switchWakeupArm();
+void switchWakeupDisarm();
+void handleSwitch();
+void handleSwitchEvent(SwitchEvent event);
+void handleSwitchSleepFade();
 // Web_Server.ino
 void webServerInit();
-void serve404();
-void servePage();
+void serve404(AsyncWebServerRequest *request);
+void servePage(AsyncWebServerRequest *request);
+void serveGzip(AsyncWebServerRequest *request, const char* contentType, const uint8_t* data, size_t length, const char* etag, const char* cacheControl);
+void servePreset(AsyncWebServerRequest *request);
+size_t presetImportPrefix(const String& name, char* buffer, size_t size);
+void servePresetBody(AsyncWebServerRequest *request, uint8_t *data, size_t length, size_t index, size_t total);
 void scanForNetworks();
 void updateWifiConfigTable(int _numNetworks);
 void otaInit();
+void serveUpdate(AsyncWebServerRequest *request);
+void serveUpdateUpload(AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t length, bool final);
+void handleWebServer();
 // Websockets.ino
 void websocketsInit();
-void webSocketEvent(uint8_t num, WStype_t type, uint8_t *payload, size_t length);
+void webSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *payload, size_t length);
+AsyncWebSocketClient* websocketClient(uint8_t num);
+bool websocketCanSend(uint8_t num);
+char* websocketPayload();
+size_t websocketSerialize(JsonDocument& jsonMessage);
+bool websocketAppendMember(size_t& length, const char* key, JsonVariantConst value);
 bool websocketSend(JsonDocument& jsonMessage);
+bool queueInboundMessage(JsonObjectConst message, size_t size);
+void handleInboundMessages();
+void handleStatePatch();
+bool websocketSendTo(uint8_t num, JsonDocument& jsonMessage);
+bool websocketSendFrameTo(uint8_t num, size_t length);
 bool updateClients();
 // Wifi.ino
 void wifiInit();
 void handleWifiConnection();
-void onWifiConnected(const WiFiEventStationModeGotIP &event);
-void onWifiDisconnected(const WiFiEventStationModeDisconnected &event);
+void wifiRenewLease();
+String wifiHostName();
+bool wifiCacheValid(const WifiCache& cache);
+void wifiCacheLoad();
+void wifiCacheSave();
 void mdnsInit();
 
 // File System Variables 
-bool spiffsCorrectSize      = false;
+bool fileSystemMounted      = false;
+
+// Device Config Variables
+#define DEVICE_CONFIG_SIZE 2048
+DynamicJsonDocument deviceConfig(DEVICE_CONFIG_SIZE);                 // Authoritative copy of /DeviceConfig.json
+bool deviceConfigLoaded         = false;                              // True once the file has been read
+bool deviceConfigDirty          = false;                              // True if the copy has changed since it was written
+unsigned long deviceConfigChangeTime = 0;                             // Time of the last change
+unsigned long deviceConfigWriteDelay = 2000;                          // Quiet time before the config is written in ms
+uint32_t deviceConfigWrites     = 0;                                  // Number of times the config was written since boot
+
+// JSON Arena Variables
+// The documents of the message path are allocated once, so dragging a slider causes no heap allocations. Inbound
+// messages are parsed in place, the document only holds the nodes. The largest message measured is a preset import
+// with all modes at about 1100 bytes. The queue also holds the copied strings and the values written back by
+// parseConfig(), the echo of a slider message with the lamp info added is about 600 bytes.
+#define JSON_MESSAGE_SIZE 1536
+#define INBOUND_QUEUE_SIZE 2048
+#define INBOUND_ECHO_RESERVE 768                                      // Room kept in the queue for the echo
+StaticJsonDocument<JSON_MESSAGE_SIZE> messageDocument;               // Inbound messages, see webSocketEvent() and servePreset()
+StaticJsonDocument<INBOUND_QUEUE_SIZE> inboundQueue;                 // Merged messages waiting for handleInboundMessages()
+StaticJsonDocument<DEVICE_CONFIG_SIZE> configScratch;                // Next version of the device config, see saveConfigItem()
+#define STATE_PATCH_SIZE 1024
+StaticJsonDocument<STATE_PATCH_SIZE> statePatch;                     // Changes of the state not sent yet, see handleStatePatch()
+struct JsonArenaStats {
+  uint16_t  messagePeak;                                              // Most memory used by a message in bytes
+  uint16_t  queuePeak;                                                // Most memory used by the inbound queue in bytes
+  uint16_t  configPeak;                                               // Most memory used by the device config in bytes
+  uint16_t  patchPeak;                                                // Most memory used by a state patch in bytes
+  uint32_t  overflows;                                                // Documents that ran out of memory
+} jsonArenaStats = { 0, 0, 0, 0, 0 };
+
+// Config Snapshot Variables
+bool configSnapshotLoaded       = false;                              // True if the config came from the snapshot at boot
+uint32_t configSnapshotCrc      = 0;                                  // CRC of the last snapshot read or written
+
+// Preset Variables
+#define PRESET_MAX 8
+String presetNames[PRESET_MAX];                                       // Name of the preset in each slot, "" if the slot is free
+std::vector<uint8_t> presetData[PRESET_MAX];                          // Presets kept in RAM, see PRESET_PRELOAD
+bool presetStatePending         = false;                              // Set by a recall, the clients are told by handlePresets()
+std::vector<uint8_t> presetPrevious;                                  // Look before the last recall, only the changes are sent
+
+// Boot Variables
+int bootStage                   = 0;                                  // Step of the background start up, see handleBoot()
+bool bootComplete               = false;                              // True once networking is up
+unsigned long bootFirstFrameTime = 0;                                 // Time from reset to the first frame in ms
 
 // Wifi Variables and Objects 
 String programmedSSID       = SSID;
 String programmedPassword   = Password;
-bool wifiStarting           = false;
 bool softApStarted          = false;
 IPAddress accessPointIP     = IPAddress(192, 168, 1, 1);
-WiFiEventHandler stationConnectedHandler;
-WiFiEventHandler stationDisconnectedHandler;
+WifiConnection wifiConnection;                                        // Connection state machine, see Wifi.ino
+uint32_t wifiCredentialsGeneration = 0;                               // Counted up by parseConfig() when the SSID or password change
+WifiCache wifiCache;                                                  // Last good connection, see wifiCacheLoad()
+WiFiEventHandler wifiGotIpHandler;                                    // Sets wifiLeaseUpdated
+volatile bool wifiLeaseUpdated = false;                               // Set when the station got an address, the cache is updated by handleWifiConnection()
 
 // DNS and mDNS Objects
 DNSServer captivePortalDNS;
 MDNSResponder::hMDNSService mdnsService;
 
 // Webserver and OTA Objects
-ESP8266WebServer restServer(80);
-ESP8266HTTPUpdateServer OTAServer;
+// The page, the presets, OTA and the websocket share one asynchronous server. Requests are answered from the network
+// stack as the TCP window allows, so a page load never holds up a frame.
+AsyncWebServer webServer(80);
+#define WEBSITE_PAGE_CACHE "no-cache"                                 // Checked on every load, 304 while unchanged
+#define WEBSITE_ASSET_CACHE "public, max-age=31536000, immutable"     // The page asks for them by the hash of their content
+bool otaRestart = false;                        // Set once an update was written, the lamp restarts from the loop
+unsigned long otaRestartTime = 0;
 
 // Web Sockets Variabels and Objects
-WebSocketsServer webSocket(81);
-bool processingMessage = false;
-bool clientNeedsUpdate = false;
+// Every client gets a number that is used for the bitmasks below, the library queues at most WS_MAX_QUEUED_MESSAGES
+// outbound messages per client and drops the rest.
+#define WEBSOCKET_CLIENTS_MAX 5
+AsyncWebSocket webSocket("/ws");
+uint32_t websocketClientIds[WEBSOCKET_CLIENTS_MAX];   // Id the library gave the client with each number, 0 if free
+struct InboundStats {
+  uint32_t  received;                           // Text messages received
+  uint32_t  coalesced;                          // Messages merged into a queue that already held changes
+  uint32_t  dropped;                            // Messages that could not be parsed or did not fit the queue
+} inboundStats = { 0, 0, 0 };
+uint32_t clientsConnected = 0;                  // Bit per connected client number
+uint32_t clientsNeedUpdate = 0;                 // Bit per client number that still has to be sent the state
+uint32_t stateSeq = 0;                          // Sequence number of the last state patch
+bool statePatchOverflow = false;                // Set if the changes did not fit a patch, all clients get the whole state
+String presetExports[WEBSOCKET_CLIENTS_MAX];    // Preset each client asked to export, sent by handlePresets()
+std::vector<uint8_t> clientState;               // Serialized state sent to new clients, see sendConfigViaWS()
+bool clientStateValid = false;
+#define WEBSOCKET_FRAME_SIZE 3072               // Largest outbound message, the state of the lamp is about 2 KB
+char websocketFrame[WEBSOCKET_FRAME_SIZE];     // Outbound messages, see websocketSend()
+uint32_t websocketFrameOverflows = 0;           // Messages dropped because they did not fit the frame
+uint32_t websocketQueueFull = 0;                // Messages not sent because the queue of the client was full
 bool webSocketConnecting = false;
 
+// Realtime Variables
+#define REALTIME_JITTER_FRAMES 3                                      // Frames the jitter buffer holds
+#define REALTIME_UNIVERSES_MAX (NUM_LEDS * 4 / LIGHTING_UNIVERSE_SIZE + 2)
+class ModeRealtime;
+ModeRealtime* realtimeMode            = nullptr;                      // Shows the pixels pushed by the clients, see Realtime.ino
+String realtimePreviousMode           = "";                           // Mode to go back to once the frames stop, "" if none
+bool realtimePreviousState            = true;
+String realtimeReturnMode             = "";                           // Mode before Realtime was chosen by hand, see realtimeLeave()
+AsyncUDP realtimeUdp[LIGHTING_PROTOCOLS];                             // E1.31, Art-Net and DDP receivers
+bool realtimeUdpRestart               = true;                         // Set when the receivers have to be started again
+bool realtimeUdpJoined                = false;                        // True if E1.31 listens to its multicast group
+unsigned long realtimeUdpInitTime     = 0;
+bool realtimeUdpFramePending          = false;                        // Pixels were received that no frame has shown yet
+uint16_t realtimeE131SyncUniverse     = 0;                            // E1.31 frames are shown by sync packets of this universe
+unsigned long realtimeArtSyncTime     = 0;                            // Last ArtSync, 0 if the sender does not sync
+uint8_t realtimeSequence[LIGHTING_PROTOCOLS][REALTIME_UNIVERSES_MAX]; // Last sequence number per protocol and universe
+struct RealtimeStats {
+  uint32_t  messages;                                                 // Binary websocket messages received
+  uint32_t  packets;                                                  // UDP packets received
+  uint32_t  frames;                                                   // Complete frames received
+  uint32_t  late;                                                     // UDP packets dropped for arriving after a newer one
+  uint32_t  dropped;                                                  // Frames replaced before they were shown
+  uint32_t  errors;                                                   // Websocket messages answered with an error
+  uint32_t  packetRate;                                               // UDP packets in the last second
+  uint32_t  ratePackets;
+  unsigned long rateTime;
+} realtimeStats = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+// Preview Variables
+#define PREVIEW_MAX_RATE 20                                           // Most preview frames per second for a client
+PreviewClient previewClients[WEBSOCKET_CLIENTS_MAX];
+bool previewFrameReady          = false;                              // Set by renderFrame(), cleared by handlePreview()
+uint8_t previewNextClient       = 0;                                  // Client to look at first, so all get their turn
+struct PreviewStats {
+  uint32_t  frames;                                                   // Previews sent
+  uint32_t  bytes;                                                    // Size of the previews sent
+} previewStats = { 0, 0 };
+
 // NTP Variables and Objects
+enum NtpState { NTP_STATE_IDLE, NTP_STATE_RESOLVING, NTP_STATE_WAITING };
 AsyncUDP udpClient;
-bool ntpTimeSet                       = false;
+SlewClock lampClock;                                       // UTC in ms, kept in line with the NTP server by slewing
+NtpState ntpState                     = NTP_STATE_IDLE;
+bool ntpTimeSet                       = false;             // True once the time came from the NTP server
 String ntpHostName                    = "pool.ntp.org";
-IPAddress ntpIpAddress                = IPAddress(0, 0, 0, 0);
+IPAddress ntpIpAddress                = IPAddress(0, 0, 0, 0); // Cached result of the DNS lookup
+volatile bool ntpDnsDone              = false;             // Set by the DNS callback
+volatile bool ntpResponseReceived     = false;             // Set by the UDP callback
+uint8_t ntpRequest[NTP_PACKET_SIZE];                       // Last request, used to match the response
+uint8_t ntpResponse[NTP_PACKET_SIZE];
+int64_t ntpResponseTime               = 0;                 // Local time the response arrived (t4)
+unsigned long ntpStateTime            = 0;                 // Start of the current lookup or request
+unsigned long ntpTimeout              = 2000;              // Time to wait for the DNS or NTP server in ms
+unsigned long ntpRetryPeriod          = 10000;             // Wait after a failed request in ms
+unsigned long ntpSyncPeriod           = 3600000;           // Wait after a successful request in ms
+uint8_t ntpFailures                   = 0;                 // Failed requests in a row, the server is looked up again after 3
+int32_t ntpOffset                     = 0;                 // Offset of the last sample in ms
+int32_t ntpDelay                      = 0;                 // Round trip delay of the last sample in ms
 unsigned long utcOffset               = UTC_OFFSET * 3600; // in seconds
-unsigned long collectionPeriod        = 3600;
+unsigned long collectionPeriod        = 0;                 // in milliseconds, 0 to sync as soon as the wifi is up
 unsigned long currentEpochTime        = 0;
 unsigned long lastNTPCollectionTime   = 0;
 
+// Sync Variables and Objects
+AsyncUDP syncUdp;
+SlewClock animationClock;                                             // Time base of the animations, see animationMillis()
+LampSyncRole syncRole                 = LAMP_SYNC_OFF;
+uint8_t syncGroup                     = 1;                            // Lamps of a group use the multicast group 239.255.76.<group>
+int syncOffset                        = 0;                            // Time the animations of this lamp lag behind the group in ms
+bool syncRestart                      = true;                         // Set when the role or group changed
+bool syncJoined                       = false;                        // True while listening to the multicast group
+unsigned long syncInitTime            = 0;
+unsigned long syncBeaconTime          = 0;                            // Last beacon sent by the leader or received by a follower
+unsigned long syncRequestTime         = 0;                            // Last request sent by a follower
+uint32_t syncEpoch                    = 0;                            // Leader, counts the changes of the mode and its parameters
+uint32_t syncStateCrc                 = 0;                            // Leader, CRC of the mode and parameters of the last beacon
+IPAddress syncLeader                  = IPAddress(0, 0, 0, 0);        // Follower, the leader it follows
+uint32_t syncLeaderEpoch              = 0;                            // Follower, epoch of the last beacon applied
+LampSyncFilter syncFilter;                                            // Follower, drops delayed replies
+uint8_t syncBeacon[LAMP_SYNC_PACKET_MAX];                             // Follower, last beacon received in the network stack
+uint8_t syncBeaconLength              = 0;
+IPAddress syncBeaconAddress;
+volatile bool syncBeaconReceived      = false;
+uint32_t syncReply[4];                                                // Follower, timestamps of the last reply (t1 - t4)
+volatile bool syncReplyReceived       = false;
+struct SyncStats {
+  uint32_t  beacons;                                                  // Beacons sent or received
+  uint32_t  requests;                                                 // Requests answered or sent
+  uint32_t  replies;                                                  // Follower, replies received
+  uint32_t  rejected;                                                 // Follower, replies dropped for their delay
+  int32_t   error;                                                    // Follower, offset of the last reply used in ms
+  int32_t   errorAverage;                                             // Follower, average size of the offset in 1/16 ms
+  int32_t   delay;                                                    // Follower, round trip delay of the last reply used in ms
+} syncStats = { 0, 0, 0, 0, 0, 0, 0 };
+
+// Beat Variables and Objects
+AsyncUDP beatUdp;
+BeatClock beatClock;                                                  // Tempo and phase of the music, see BeatClock.h
+BeatOnsetDetector beatOnsets;                                         // Finds the onsets in the audio of the visualiser
+int beatLatency                       = 0;                            // Time the beat clock is read ahead in ms
+bool beatListening                    = false;                        // True while listening for tempo messages
+unsigned long beatInitTime            = 0;
+BeatMessage beatMessage;                                              // Last tempo message received in the network stack
+unsigned long beatMessageTime         = 0;                            // Time it arrived
+volatile bool beatMessageReceived     = false;
+struct BeatStats {
+  uint32_t  messages;                                                 // Tempo messages received
+  uint32_t  onsets;                                                   // Onsets found in the audio
+} beatStats = { 0, 0 };
+
+// Audio Variables and Objects
+AsyncUDP audioUdp;
+AudioFrameQueue audioQueue;                                           // Audio blocks waiting for the jitter delay of the visualiser
+bool audioListening                   = false;                        // True while listening for audio packets
+unsigned long audioInitTime           = 0;
+unsigned long audioLastPacketTime     = 0;
+uint8_t audioSequence                 = 0;                            // Sequence number of the last packet
+struct AudioStats {
+  uint32_t  packets;                                                  // Audio packets received
+  uint32_t  late;                                                     // Packets dropped for arriving after a newer one
+} audioStats = { 0, 0 };
+
+// Scheduler Variables and Objects
+ScheduleRule scheduleRules[SCHEDULE_MAX_RULES];                       // Timing and brightness of the rules
+String scheduleRuleSettings[SCHEDULE_MAX_RULES];                      // Settings applied by the rules as JSON
+uint8_t scheduleRuleCount             = 0;
+String scheduleJson                   = "";                           // Rules waiting to be written by handleConfigWrite()
+bool scheduleDirty                    = false;                        // True if the rules changed since they were written
+ScheduleWheel scheduleWheel;                                          // Rules waiting for their next occurrence
+uint32_t scheduleLastTime             = 0;                            // Local time of the last tick, 0 to reschedule all rules
+float scheduleLatitude                = 0;                            // Location used for sunrise and sunset
+float scheduleLongitude               = 0;
+int scheduleRampFrom                  = 0;                            // Brightness ramp started by a rule
+int scheduleRampTo                    = 0;
+int scheduleRampLast                  = 0;                            // Last brightness set by the ramp
+unsigned long scheduleRampTime        = 0;                            // Length of the ramp in ms
+unsigned long scheduleRampStart       = 0;                            // Start of the ramp, 0 if inactive
+
 // LED string object and Variables
 CRGBW ledString[NUM_LEDS];
 CRGB *ledsRGB = (CRGB *) &ledString[0];
@@ -160,137 +685,172 @@ int bottomNumLeds   = sizeof(bottomLeds) / sizeof(*bottomLeds);
 int leftNumLeds     = sizeof(leftLeds) / sizeof(*leftLeds);
 int rightNumLeds    = sizeof(rightLeds) / sizeof(*rightLeds);
 
+// Frame Time Variables
+// Gaps between the frames that were shown, a frame is late if it comes more than half a frame after it was due
+struct FrameTimeStats {
+  uint32_t  frames;                                                   // Frames in the mean
+  uint32_t  late;                                                     // Frames that came late
+  uint32_t  totalGap;                                                 // Sum of the gaps in us, for the mean
+  uint32_t  maxGap;                                                   // Longest gap in us
+  unsigned long lastTime;                                             // Time of the last frame in us, 0 after idling
+} frameTimeStats = { 0, 0, 0, 0, 0 };
+
+// Idle Variables
+bool lampIdle                   = false;                              // True while the light is off and nothing is rendered
+unsigned long lampIdleSince     = 0;                                  // Time the light went idle
+unsigned long lampIdleTotalTime = 0;                                  // Time spent idle before lampIdleSince
+
 // Base Variables of the Light
 String  Name                  = DEFAULT_NAME;                         // The default Name of the Device
 String  Mode                  = "";                                   // The default Mode of the Device
 bool    State                 = true;                                 // The Default Mode of the Light
 int     FadeTime              = 200;                                  // Fading time between states in ms
+int     Brightness            = 255;                                  // Global brightness applied on top of every mode
 String  currentMode           = Mode;                                 // Placeholder variable for changing mode
 String  previousMode          = "";                                   // Placeholder variable for changing mode
 bool    previousState         = false;                                // Placeholder variable for changing state
 float   modeChangeFadeAmount  = 0;                                    // Place holder for global brightness during mode change
 String  SketchName            = __FILE__;                             // Name of the sketch file (used for info page)
 
-//switch debounce variables
-int buttonState;                                                       // the current state from the input pin
-int lastButtonState = HIGH;                                            // the previous reading from the input pin
-unsigned long lastDebounceTime = 0;                                    // the last time the output pin was toggled
-unsigned long debounceDelay = 50;                                      // the debounce time; increase if the output flickers
-unsigned long lastTransistionTime = 0;                                 // last time the state changed
-unsigned long stateTransistionDelay = 1500;                            // if the button is held down then leave a second between turning on and off
-
-void intCallback(){
-  // read the state of the switch into a local variable:
-  int reading = digitalRead(SWITCH_PIN);
-
-  // If the switch changed, due to noise or pressing:
-  if (reading != lastButtonState) {
-    // reset the debouncing timer
-    lastDebounceTime = millis();
-  }
-lastButtonState = reading;  
-}
-
-void checkSwitchState(){
-  // read the state of the switch into a local variable:
-  int reading = digitalRead(SWITCH_PIN);
-
-  // If the switch changed, due to noise or pressing:
-  if (reading != lastButtonState) {
-    // reset the debouncing timer
-    lastDebounceTime = millis();
-  }
-  lastButtonState = reading;  
-
-  if ((millis() - lastDebounceTime) > debounceDelay) {
-    // whatever the reading is at, it's been there for longer than the debounce
-    // delay, so take it as the actual current state:
-
-    // if the button state has changed:
-    if (lastButtonState != buttonState) {
-      buttonState = lastButtonState;     
-      // toggle the state of the light when the button has been pressed
-      if (buttonState == LOW) {
-        if ((millis() - lastTransistionTime) > stateTransistionDelay){      
-          State ^= true;
-          lastTransistionTime = millis();
-          Serial.println("[checkSwitchState] - Lamp State Changed");
-        }
-      }
-    }
-  }
-}
-
-// Setup Method - Runs only once before the main loop. Useful for setting things up
+// Switch Variables and Objects
+SwitchEdgeQueue switchEdges;                                            // Raw edges from the switch ISR
+SwitchGestureDecoder switchGestures;                                    // Debounce and gesture decoding of the raw edges
+bool switchUsesInterrupt      = false;                                  // False if the pin has to be sampled in the loop
+bool switchWakeupArmed        = false;                                  // True while the pin wakes the lamp, see switchWakeupArm()
+uint8_t switchLastLevel       = HIGH;                                   // Last sampled level when polling the pin
+int switchDimDirection        = -1;                                     // Direction of the next long press brightness ramp
+int8_t switchPresetSlot       = -1;                                     // Slot of the preset last recalled by a double press
+unsigned long switchSleepFadeTime  = 30000;                             // Length of the hold-to-fade in ms
+unsigned long switchSleepFadeStart = 0;                                 // Start of the current hold-to-fade, 0 if inactive
+int switchSleepFadeFrom       = 255;                                    // Brightness before the long press, restored after the fade
+bool switchRestoreBrightness  = false;                                  // Set when the fade has finished but the light is not off yet
+
+// Setup Method - Runs only once before the main loop. Useful for setting things up. Only what is needed to show the first
+// frame is done here, everything else is started from handleBoot() once the LEDs are lit.
 void setup() {
-  // Add a short delay on start
-  delay(1000);
-
   // Start Serial
   Serial.begin(115200);
   Serial.println();
 
   // Check if the flash has been set up correctly
-  spiffsCorrectSize = checkFlashConfig();
-  if (spiffsCorrectSize) {
-
-    // Setup weak internal pullups
-    pinMode(SWITCH_PIN, INPUT);   
-    // Init interrupts to allow for switching the light on and off with the button
-    //attachInterrupt(digitalPinToInterrupt(SWITCH_PIN), intCallback, FALLING); 
-       
+  fileSystemMounted = checkFlashConfig();
+  if (fileSystemMounted) {
+    // Setup the switch and its interrupt
+    switchInit();
+
     // Init the LED's
     ledStringInit();
     ledModeInit();
 
-    // Get saved settings
-    getConfig();
-
-    // Start Wifi
-    wifiInit();
-
-    // Setup Webserver
-    webServerInit();
-
-    // Setup websockets
-    websocketsInit();
+    // Restore the config from the snapshot and show the first frame straight away
+    if (restoreConfigSnapshot()) renderFrame();
   }
   else Serial.println("[setup] -  Flash configuration was not set correctly. Please check your settings under \"tools->flash size:\"");
 }
 
+// Bring up the rest of the lamp one step per loop so the LEDs keep rendering in between
+void handleBoot() {
+  switch (bootStage++) {
+    case 0 : {
+      // Get saved settings from the JSON config if there was no snapshot
+      if (!configSnapshotLoaded) getConfig();
+      saveConfigSnapshot();
+
+      // Load the automation rules and index the presets
+      scheduleInit();
+      presetInit();
+    }
+    break;
+    case 1 : {
+      // Start Wifi and the NTP client
+      wifiInit();
+      ntpInit();
+    }
+    break;
+    case 2 : {
+      // Setup Webserver
+      webServerInit();
+    }
+    break;
+    case 3 : {
+      // Setup websockets
+      websocketsInit();
+      bootComplete = true;
+
+      // Debug
+      Serial.println("[handleBoot] - Start up complete after " + String(millis()) + "ms");
+    }
+    break;
+  }
+}
+
 // The Main Loop Methdo - This runs continuously
 void loop() {
   // Check if the flash was correctly setup
-  if (spiffsCorrectSize) {
-    // Handle the captive portal 
-    captivePortalDNS.processNextRequest();
+  if (fileSystemMounted) {
+    // Finish starting up in the background
+    if (!bootComplete) handleBoot();
+    else {
+      // Handle the captive portal 
+      captivePortalDNS.processNextRequest();
+
+      // Handle mDNS 
+      MDNS.update();
+
+      // Close dropped websockets and finish an update, requests are served by the network stack
+      handleWebServer();
+
+      // Apply the websocket messages that arrived since the last frame
+      handleInboundMessages();
 
-    // Handle mDNS 
-    MDNS.update();
+      // Hand the light back once the realtime frames stop
+      handleRealtime();
 
-    // Handle the webserver
-    restServer.handleClient();
-    
-    // Handle Websockets
-    webSocket.loop();
+      // Get the time when needed
+      handleNTP();
 
-    // Get the time when needed
-    handleNTP();
+      // Keep the animations in step with the other lamps of the sync group
+      handleSync();
 
-    // Update WS clients when needed
-    updateClients();
+      // Follow the tempo of the music
+      handleBeat();
 
-    // Handle the wifi connection 
-    handleWifiConnection();
+      // Listen for audio streamed to the visualiser
+      handleAudio();
 
-    //Check to see if switch has been pressed to turn light on/off
-    checkSwitchState();     
+      // Update WS clients when needed
+      updateClients();
+
+      // Run the automation rules
+      handleSchedule();
+
+      // Handle the wifi connection 
+      handleWifiConnection();
+    }
+
+    // Decode any presses of the switch
+    handleSwitch();
+
+    // Write config changes to the flash once they settle
+    handleConfigWrite();
 
     // Update the LED's
     handleMode();    
 
+    // Store a recalled preset once its first frame is out, and answer exports
+    handlePresets();
+
+    // Tell the clients what changed during this loop
+    handleStatePatch();
+
+    // Send the new frame to a client that asked for a preview
+    handlePreview();
+
     // Reset the sw watchdog timer
     ESP.wdtFeed();    
+
+    // Give the CPU a chance to light sleep while the light is off
+    if (lampIdle) delay(10);
   }
   else {
     delay(10000);
@@ -0,0 +1,175 @@
+// Switch Methods
+void switchInit() {
+  // Setup weak internal pullups
+  pinMode(SWITCH_PIN, INPUT);
+
+  // Start the decoder at the current level of the pin
+  switchLastLevel = digitalRead(SWITCH_PIN);
+  switchGestures.begin(switchLastLevel);
+
+  // Use an interrupt where the pin supports it, otherwise the pin is sampled in handleSwitch()
+  if (digitalPinToInterrupt(SWITCH_PIN) != NOT_AN_INTERRUPT) {
+    attachInterrupt(digitalPinToInterrupt(SWITCH_PIN), switchInterrupt, CHANGE);
+    switchUsesInterrupt = true;
+  }
+
+  // Debug
+  Serial.println("[switchInit] - Switch set up " + String(switchUsesInterrupt ? "with an interrupt" : "by polling the pin"));
+}
+
+// Only timestamp the edge here, debouncing and decoding is done in the main loop
+void ICACHE_RAM_ATTR switchInterrupt() {
+  switchEdges.push(millis(), digitalRead(SWITCH_PIN));
+}
+
+// Let a press of the switch wake the CPU from light sleep while the lamp is idle. The wakeup turns the edge interrupt
+// of the pin into a level interrupt, which would fire over and over while the button is held, so the interrupt is
+// detached and the pin is sampled in handleSwitch() until the switch is used again.
+void switchWakeupArm() {
+  if (!switchUsesInterrupt || switchWakeupArmed) return;
+  switchLastLevel = digitalRead(SWITCH_PIN);
+  if (switchLastLevel == LOW) return;
+  detachInterrupt(digitalPinToInterrupt(SWITCH_PIN));
+  gpio_pin_wakeup_enable(GPIO_ID_PIN(SWITCH_PIN), GPIO_PIN_INTR_LOLEVEL);
+  switchWakeupArmed = true;
+}
+
+// Hand the pin back to the edge interrupt, disabling the wakeup also disabled the interrupt of the pin
+void switchWakeupDisarm() {
+  if (!switchWakeupArmed) return;
+  gpio_pin_wakeup_disable();
+  attachInterrupt(digitalPinToInterrupt(SWITCH_PIN), switchInterrupt, CHANGE);
+  switchWakeupArmed = false;
+
+  // Catch an edge that came between the last sample and the interrupt
+  uint8_t reading = digitalRead(SWITCH_PIN);
+  if (reading != switchLastLevel) switchEdges.push(millis(), reading);
+}
+
+void handleSwitch() {
+  // Sample the pin when it cannot raise an interrupt, or while it only wakes the lamp
+  if (!switchUsesInterrupt || switchWakeupArmed) {
+    uint8_t reading = digitalRead(SWITCH_PIN);
+    if (reading != switchLastLevel) {
+      switchEdges.push(millis(), reading);
+      switchLastLevel = reading;
+
+      // The button is in use, the interrupt times its edges again
+      switchWakeupDisarm();
+    }
+  }
+
+  // Feed the queued edges to the decoder
+  SwitchEdge edge;
+  while (switchEdges.pop(edge)) {
+    switchGestures.edge(edge.time, edge.level);
+  }
+
+  // Act on every decoded gesture
+  SwitchEvent event;
+  while ((event = switchGestures.poll(millis())) != SWITCH_EVENT_NONE) {
+    handleSwitchEvent(event);
+  }
+
+  // Progress the hold-to-fade
+  handleSwitchSleepFade();
+}
+
+void handleSwitchEvent(SwitchEvent event) {
+  switch (event) {
+    case SWITCH_EVENT_SHORT_PRESS : {
+      // A press during the hold-to-fade cancels it and keeps the light on
+      if (switchSleepFadeStart) {
+        switchSleepFadeStart = 0;
+        Brightness = switchSleepFadeFrom;
+        Serial.println("[handleSwitchEvent] - Fade out cancelled");
+      }
+      else {
+        State ^= true;
+        Serial.println("[handleSwitchEvent] - Lamp State Changed");
+      }
+      sendLampState();
+    }
+    break;
+    case SWITCH_EVENT_DOUBLE_PRESS : {
+      // Recall the next stored preset, the clients are updated by handlePresets()
+      for (uint8_t step = 1; step <= PRESET_MAX; step++) {
+        uint8_t slot = (switchPresetSlot + step) % PRESET_MAX;
+        if (presetNames[slot] == "" || !presetRecall(presetNames[slot])) continue;
+        switchPresetSlot = slot;
+        State = true;
+        Serial.println("[handleSwitchEvent] - Recalled preset \"" + presetNames[slot] + "\"");
+        return;
+      }
+
+      // Without presets step to the next registered mode
+      auto modeIter = modes.find(Mode);
+      if (modeIter != modes.end()) modeIter++;
+      if (modeIter == modes.end()) modeIter = modes.begin();
+      Mode = modeIter->first;
+      State = true;
+      Serial.println("[handleSwitchEvent] - Mode stepped to " + Mode);
+      sendLampState();
+    }
+    break;
+    case SWITCH_EVENT_LONG_PRESS_START : {
+      switchSleepFadeStart = 0;
+      switchSleepFadeFrom = Brightness;
+      if (!State) {
+        // Come on dim and ramp up from there
+        State = true;
+        Brightness = 16;
+        switchDimDirection = 1;
+      }
+      else {
+        // Alternate the direction of the ramp with every long press
+        switchDimDirection = (Brightness >= 255) ? -1 : (Brightness <= 16) ? 1 : -switchDimDirection;
+      }
+    }
+    break;
+    case SWITCH_EVENT_LONG_PRESS_HOLD : {
+      Brightness = constrain(Brightness + switchDimDirection * 4, 16, 255);
+    }
+    break;
+    case SWITCH_EVENT_LONG_PRESS_END : {
+      // Only store the brightness once the button is released
+      if (!switchSleepFadeStart) {
+        Serial.println("[handleSwitchEvent] - Brightness set to " + String(Brightness));
+        sendLampState();
+      }
+    }
+    break;
+    case SWITCH_EVENT_HOLD_TO_FADE : {
+      // Fade from the brightness the light had before the ramp started
+      if (State) {
+        switchSleepFadeStart = millis();
+        Serial.println("[handleSwitchEvent] - Fading out over " + String(switchSleepFadeTime / 1000) + " seconds");
+      }
+    }
+    break;
+    default : {
+    }
+    break;
+  }
+}
+
+void handleSwitchSleepFade() {
+  if (switchSleepFadeStart) {
+    unsigned long elapsed = millis() - switchSleepFadeStart;
+    if (elapsed < switchSleepFadeTime && State) {
+      Brightness = switchSleepFadeFrom - (long)switchSleepFadeFrom * elapsed / switchSleepFadeTime;
+    }
+    else {
+      // Turn off, the brightness is restored once the light is fully off
+      switchSleepFadeStart = 0;
+      switchRestoreBrightness = true;
+      State = false;
+    }
+  }
+  else if (switchRestoreBrightness && (State || !previousState)) {
+    // Restore the brightness for the next time the light comes on
+    switchRestoreBrightness = false;
+    Brightness = switchSleepFadeFrom;
+    sendLampState();
+  }
+}
@@ -0,0 +1,191 @@
+/* SwitchGestures
+ *
+ * Edge queue and gesture decoder for the manual lamp switch. The interrupt
+ * only timestamps edges into SwitchEdgeQueue, debouncing and gesture
+ * decoding happen later in the main loop. Nothing in here depends on the
+ * Arduino core, so recorded edge timings can be replayed on any machine.
+ *
+ * The switch is active low, a LOW level means the button is pressed.
+*/
+
+#ifndef SwitchGestures_h
+#define SwitchGestures_h
+
+#include <stdint.h>
+
+struct SwitchEdge {
+  uint32_t  time;   // millis() at the time of the edge
+  uint8_t   level;  // pin level after the edge
+};
+
+/// Single producer (ISR) / single consumer (loop) ring buffer of raw edges.
+/// When the queue is full new edges are dropped and counted, the decoder
+/// will still settle on the correct level once the pin is stable again.
+#define SWITCH_EDGE_QUEUE_SIZE 32
+
+class SwitchEdgeQueue {
+private:
+  SwitchEdge        edges[SWITCH_EDGE_QUEUE_SIZE];
+  volatile uint8_t  head = 0;
+  volatile uint8_t  tail = 0;
+
+public:
+  volatile uint16_t dropped = 0;
+
+  bool push(uint32_t time, uint8_t level) {
+    uint8_t next = (head + 1) % SWITCH_EDGE_QUEUE_SIZE;
+    if (next == tail) {
+      dropped++;
+      return false;
+    }
+    edges[head].time = time;
+    edges[head].level = level;
+    head = next;
+    return true;
+  }
+
+  bool pop(SwitchEdge& edge) {
+    if (tail == head) return false;
+    edge = edges[tail];
+    tail = (tail + 1) % SWITCH_EDGE_QUEUE_SIZE;
+    return true;
+  }
+};
+
+enum SwitchEvent : uint8_t {
+  SWITCH_EVENT_NONE = 0,
+  SWITCH_EVENT_SHORT_PRESS,       // single press and release
+  SWITCH_EVENT_DOUBLE_PRESS,      // two short presses within doublePressTime
+  SWITCH_EVENT_LONG_PRESS_START,  // button held for longPressTime
+  SWITCH_EVENT_LONG_PRESS_HOLD,   // repeats every holdRepeatTime while held
+  SWITCH_EVENT_LONG_PRESS_END,    // button released after a long press
+  SWITCH_EVENT_HOLD_TO_FADE       // button held for holdToFadeTime
+};
+
+class SwitchGestureDecoder {
+public:
+  // Timings in milliseconds
+  uint16_t debounceTime     = 50;
+  uint16_t doublePressTime  = 300;
+  uint16_t longPressTime    = 600;
+  uint16_t holdRepeatTime   = 40;
+  uint16_t holdToFadeTime   = 5000;
+
+private:
+  // Debounce state
+  uint8_t   stableLevel     = 1;
+  uint8_t   candidateLevel  = 1;
+  uint32_t  candidateTime   = 0;
+
+  // Gesture state
+  bool      pressed         = false;
+  bool      longPress       = false;
+  bool      fadeSent        = false;
+  uint8_t   clickCount      = 0;
+  uint32_t  pressTime       = 0;
+  uint32_t  releaseTime     = 0;
+  uint32_t  lastHoldTime    = 0;
+
+  // Small FIFO of decoded events
+  SwitchEvent events[8];
+  uint8_t     eventHead     = 0;
+  uint8_t     eventTail     = 0;
+
+  void emit(SwitchEvent event) {
+    uint8_t next = (eventHead + 1) % 8;
+    if (next == eventTail) return;
+    events[eventHead] = event;
+    eventHead = next;
+  }
+
+  void onStableChange(uint8_t level, uint32_t time) {
+    stableLevel = level;
+    if (level == 0) {
+      // Button went down
+      pressed   = true;
+      longPress = false;
+      fadeSent  = false;
+      pressTime = time;
+    }
+    else if (pressed) {
+      // Button came up
+      pressed = false;
+      if (longPress) {
+        emit(SWITCH_EVENT_LONG_PRESS_END);
+        clickCount = 0;
+      }
+      else if (++clickCount >= 2) {
+        emit(SWITCH_EVENT_DOUBLE_PRESS);
+        clickCount = 0;
+      }
+      releaseTime = time;
+    }
+  }
+
+  // Run the time based parts of the decoder up to the given time
+  void advance(uint32_t now) {
+    if (pressed) {
+      if (!longPress && (uint32_t)(now - pressTime) >= longPressTime) {
+        longPress     = true;
+        clickCount    = 0;
+        lastHoldTime  = pressTime + longPressTime;
+        emit(SWITCH_EVENT_LONG_PRESS_START);
+      }
+      if (longPress && !fadeSent) {
+        while ((uint32_t)(now - lastHoldTime) >= holdRepeatTime) {
+          lastHoldTime += holdRepeatTime;
+          emit(SWITCH_EVENT_LONG_PRESS_HOLD);
+        }
+        if ((uint32_t)(now - pressTime) >= holdToFadeTime) {
+          fadeSent = true;
+          emit(SWITCH_EVENT_HOLD_TO_FADE);
+        }
+      }
+    }
+    else if (clickCount == 1 && (uint32_t)(now - releaseTime) > doublePressTime) {
+      clickCount = 0;
+      emit(SWITCH_EVENT_SHORT_PRESS);
+    }
+  }
+
+  // Commit the candidate level if it has been stable for the debounce time
+  void settle(uint32_t now) {
+    if (candidateLevel != stableLevel && (uint32_t)(now - candidateTime) >= debounceTime) {
+      uint32_t changeTime = candidateTime + debounceTime;
+      advance(changeTime);
+      onStableChange(candidateLevel, changeTime);
+    }
+  }
+
+public:
+  /// Set the idle level of the pin, call once before feeding edges
+  void begin(uint8_t level) {
+    stableLevel = candidateLevel = level ? 1 : 0;
+  }
+
+  /// Feed a raw, undebounced edge in time order
+  void edge(uint32_t time, uint8_t level) {
+    level = level ? 1 : 0;
+    settle(time);
+    advance(time);
+    if (level != candidateLevel) {
+      candidateLevel = level;
+      candidateTime = time;
+    }
+  }
+
+  /// Advance the decoder to now and return the next decoded event, call
+  /// repeatedly until SWITCH_EVENT_NONE is returned
+  SwitchEvent poll(uint32_t now) {
+    settle(now);
+    advance(now);
+    if (eventTail == eventHead) return SWITCH_EVENT_NONE;
+    SwitchEvent event = events[eventTail];
+    eventTail = (eventTail + 1) % 8;
+    return event;
+  }
+
+  bool isPressed() const { return pressed; }
+};
+
+#endif
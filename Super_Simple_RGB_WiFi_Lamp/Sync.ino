@@ -0,0 +1,229 @@
+// Sync Methods
+// The lamps of a sync group share the clock of their animations, see LampSync.h. The leader sends beacons with its
+// clock, mode and parameters to the multicast group and answers the time requests of the followers. The followers
+// take over the mode and slew their animation clock to the one of the leader. Each lamp can lag behind the group by
+// its offset, so an animation can chase from one lamp to the next.
+
+// Time base of the animations, the same on all lamps of a sync group apart from the offset of this lamp
+uint32_t animationMillis() {
+  return (uint32_t)animationClock.time(millis()) - syncOffset;
+}
+
+void syncApplyConfig(JsonVariant& syncSettings) {
+  LampSyncRole role = lampSyncRoleFromName(syncSettings["Role"] | lampSyncRoleName(syncRole));
+  uint8_t group = constrain(syncSettings["Group"] | (int)syncGroup, 1, 255);
+  if (role != syncRole || group != syncGroup) syncRestart = true;
+  syncRole = role;
+  syncGroup = group;
+  syncOffset = constrain(syncSettings["Offset"] | syncOffset, -LAMP_SYNC_OFFSET_MAX, LAMP_SYNC_OFFSET_MAX);
+
+  // Write back the values in use
+  syncSettings["Role"] = lampSyncRoleName(syncRole);
+  syncSettings["Group"] = syncGroup;
+  syncSettings["Offset"] = syncOffset;
+}
+
+// Join the multicast group of the sync group, which needs a network connection
+void syncInit() {
+  syncRestart = false;
+  syncInitTime = millis();
+  syncUdp.close();
+  syncJoined = false;
+  syncLeader = IPAddress(0, 0, 0, 0);
+  syncLeaderEpoch = 0;
+  syncFilter.reset();
+
+  // Correct small offsets within a few seconds, larger ones are a new leader or a lost connection
+  animationClock.stepThreshold = 250;
+
+  if (syncRole == LAMP_SYNC_OFF) return;
+  syncJoined = WiFi.isConnected() && syncUdp.listenMulticast(IPAddress(239, 255, 76, syncGroup), LAMP_SYNC_PORT);
+  if (syncJoined) syncUdp.onPacket(onSyncPacket);
+
+  // Debug
+  Serial.println("[syncInit] - " + String(lampSyncRoleName(syncRole)) + " in sync group " + String(syncGroup) + (syncJoined ? "" : ", waiting for the network"));
+}
+
+// Runs in the network stack. Requests are answered straight away, so the time they wait for the loop is not part of
+// the delay. Beacons and replies are kept for handleSync().
+void onSyncPacket(AsyncUDPPacket &_packet) {
+  RealtimeReader reader(_packet.data(), _packet.length());
+  uint8_t type = lampSyncReadHeader(reader, syncGroup);
+
+  if (type == LAMP_SYNC_REQUEST && syncRole == LAMP_SYNC_LEADER) {
+    uint32_t receiveTime = animationClock.time(millis());
+    uint32_t requestTime = reader.readI32();
+    if (reader.failed) return;
+
+    uint8_t reply[LAMP_SYNC_HEADER_SIZE + 12];
+    size_t length = lampSyncWriteHeader(reply, LAMP_SYNC_REPLY, syncGroup);
+    length += lampSyncWrite32(reply + length, requestTime);
+    length += lampSyncWrite32(reply + length, receiveTime);
+    length += lampSyncWrite32(reply + length, animationClock.time(millis()));
+    _packet.write(reply, length);
+    syncStats.requests++;
+  }
+  else if (type == LAMP_SYNC_REPLY && syncRole == LAMP_SYNC_FOLLOWER && !syncReplyReceived && (uint32_t)_packet.remoteIP() == (uint32_t)syncLeader) {
+    syncReply[3] = animationClock.time(millis());
+    for (uint8_t i = 0; i < 3; i++) syncReply[i] = reader.readI32();
+    syncReplyReceived = !reader.failed;
+  }
+  else if (type == LAMP_SYNC_BEACON && syncRole == LAMP_SYNC_FOLLOWER && !syncBeaconReceived && _packet.length() <= sizeof(syncBeacon)) {
+    memcpy(syncBeacon, _packet.data(), _packet.length());
+    syncBeaconLength = _packet.length();
+    syncBeaconAddress = _packet.remoteIP();
+    syncBeaconReceived = true;
+  }
+}
+
+void handleSync() {
+  // Keep the clock running and slewing
+  animationClock.update(millis());
+
+  // Join the group again after the settings changed, and once connected
+  if (syncRestart || (syncRole != LAMP_SYNC_OFF && !syncJoined && WiFi.isConnected() && millis() - syncInitTime > 10000)) syncInit();
+  if (!syncJoined) return;
+
+  if (syncRole == LAMP_SYNC_LEADER) {
+    if (millis() - syncBeaconTime >= LAMP_SYNC_BEACON_PERIOD) sendSyncBeacon();
+    return;
+  }
+
+  if (syncBeaconReceived) applySyncBeacon();
+  if (syncReplyReceived) applySyncReply();
+  if ((uint32_t)syncLeader == 0) return;
+
+  // Follow the next leader that is heard once this one has gone quiet
+  if (millis() - syncBeaconTime > LAMP_SYNC_LEADER_TIMEOUT) {
+    Serial.println("[handleSync] - Lost the leader " + syncLeader.toString());
+    syncLeader = IPAddress(0, 0, 0, 0);
+    syncFilter.reset();
+    return;
+  }
+
+  // Ask for the time more often until the filter has seen a few replies
+  unsigned long requestPeriod = syncFilter.samples() < LAMP_SYNC_FILTER_SIZE ? LAMP_SYNC_BEACON_PERIOD : 1000;
+  if (millis() - syncRequestTime >= requestPeriod) sendSyncRequest();
+}
+
+void sendSyncBeacon() {
+  syncBeaconTime = millis();
+  auto modeIter = modes.find(Mode);
+  if (modeIter == modes.end() || Mode.length() > LAMP_SYNC_NAME_MAX) return;
+
+  // Start a new epoch whenever the mode or its parameters changed. The first one is random, so the followers notice
+  // when the leader was restarted.
+  uint8_t parameters[MODE_SNAPSHOT_MAX_SIZE];
+  uint8_t parametersLength = modeIter->second->saveSnapshot(parameters);
+  uint32_t crc = snapshotCrc32(snapshotCrc32(0, (const uint8_t*)Mode.c_str(), Mode.length()), parameters, parametersLength);
+  if (crc != syncStateCrc || !syncEpoch) {
+    syncStateCrc = crc;
+    syncEpoch = syncEpoch ? syncEpoch + 1 : random(1, 0x7FFFFFFF);
+  }
+
+  uint8_t beacon[LAMP_SYNC_PACKET_MAX];
+  size_t length = lampSyncWriteHeader(beacon, LAMP_SYNC_BEACON, syncGroup);
+  length += lampSyncWrite32(beacon + length, animationClock.time(millis()));
+  length += lampSyncWrite32(beacon + length, syncEpoch);
+  beacon[length++] = Mode.length();
+  memcpy(beacon + length, Mode.c_str(), Mode.length());
+  length += Mode.length();
+  beacon[length++] = parametersLength;
+  memcpy(beacon + length, parameters, parametersLength);
+  length += parametersLength;
+  syncUdp.writeTo(beacon, length, IPAddress(239, 255, 76, syncGroup), LAMP_SYNC_PORT);
+  syncStats.beacons++;
+}
+
+void applySyncBeacon() {
+  RealtimeReader reader(syncBeacon, syncBeaconLength);
+  lampSyncReadHeader(reader, syncGroup);
+  uint32_t clock = reader.readI32();
+  uint32_t epoch = reader.readI32();
+  uint8_t nameLength = reader.readU8();
+  const uint8_t* name = reader.readBytes(nameLength);
+  uint8_t parametersLength = reader.readU8();
+  const uint8_t* parameters = reader.readBytes(parametersLength);
+  if (reader.failed || nameLength > LAMP_SYNC_NAME_MAX) {
+    syncBeaconReceived = false;
+    return;
+  }
+
+  // Follow the first leader that is heard and start from the clock of its beacon, the replies to the requests
+  // correct it for the time the beacon was held up
+  if ((uint32_t)syncLeader == 0) {
+    syncLeader = syncBeaconAddress;
+    syncLeaderEpoch = 0;
+    syncFilter.reset();
+    animationClock.step(clock, millis());
+
+    // Debug
+    Serial.println("[applySyncBeacon] - Following " + syncLeader.toString() + " in sync group " + String(syncGroup));
+  }
+  else if ((uint32_t)syncBeaconAddress != (uint32_t)syncLeader) {
+    syncBeaconReceived = false;
+    return;
+  }
+  syncBeaconTime = millis();
+  syncStats.beacons++;
+
+  // Take over the mode and its parameters when they changed, but not while streamed pixels are shown
+  char modeName[LAMP_SYNC_NAME_MAX + 1];
+  memcpy(modeName, name, nameLength);
+  modeName[nameLength] = '\0';
+  syncBeaconReceived = false;
+  if (epoch == syncLeaderEpoch || Mode == "Realtime") return;
+  syncLeaderEpoch = epoch;
+  auto modeIter = modes.find(modeName);
+  if (modeIter == modes.end() || modeIter->second == (ModeBase*)realtimeMode) return;
+
+  // The keys point to the mode map and the parameter table, both outlive the queue
+  uint8_t count = modeIter->second->countParameters();
+  DynamicJsonDocument jsonDocument(JSON_OBJECT_SIZE(2 + 2 * count));
+  jsonDocument["Mode"] = modeIter->first.c_str();
+  JsonObject settings = jsonDocument.createNestedObject(modeIter->first.c_str());
+  uint8_t position = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    const ModeParameter* parameter = modeIter->second->parameter(i);
+    uint8_t size = modeParameterSize(parameter->type);
+    if (position + size > parametersLength) break;
+    int32_t value = modeParameterRead(parameter->type, parameters + position);
+    position += size;
+    if (parameter->group) settings[parameter->group][parameter->name] = value;
+    else settings[parameter->name] = value;
+  }
+  queueInboundMessage(jsonDocument.as<JsonObjectConst>(), jsonDocument.memoryUsage());
+}
+
+void sendSyncRequest() {
+  syncRequestTime = millis();
+  uint8_t request[LAMP_SYNC_HEADER_SIZE + 4];
+  size_t length = lampSyncWriteHeader(request, LAMP_SYNC_REQUEST, syncGroup);
+  length += lampSyncWrite32(request + length, animationClock.time(millis()));
+  syncUdp.writeTo(request, length, syncLeader, LAMP_SYNC_PORT);
+  syncStats.requests++;
+}
+
+void applySyncReply() {
+  NtpSample sample = lampSyncCalculate(syncReply[0], syncReply[1], syncReply[2], syncReply[3]);
+  syncReplyReceived = false;
+  syncStats.replies++;
+  if (sample.delay < 0 || !syncFilter.accept(sample.delay)) {
+    syncStats.rejected++;
+    return;
+  }
+
+  // Slew the clock, the offset before the correction is the error of the sync
+  animationClock.adjust(sample.offset, millis());
+  syncStats.error = sample.offset;
+  syncStats.delay = sample.delay;
+  syncStats.errorAverage += (abs(syncStats.error) * 16 - syncStats.errorAverage) / 8;
+}
+
+String syncInfo() {
+  if (syncRole == LAMP_SYNC_OFF) return "off";
+  if (!syncJoined) return "waiting for the network";
+  if (syncRole == LAMP_SYNC_LEADER) return "leading group " + String(syncGroup) + ", " + String(syncStats.beacons) + " beacons, " + String(syncStats.requests) + " requests";
+  if ((uint32_t)syncLeader == 0) return "no leader in group " + String(syncGroup);
+  return "following " + syncLeader.toString() + ", error " + String(syncStats.error) + "ms (average " + String(syncStats.errorAverage / 16.0, 1) + "ms), delay " + String(syncStats.delay) + "ms, " + String(syncStats.rejected) + " of " + String(syncStats.replies) + " replies dropped";
+}
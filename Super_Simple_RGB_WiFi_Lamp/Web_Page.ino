@@ -1,1909 +1,921 @@
-// Created by Website/update_website.py
-const char websiteSource[] PROGMEM =
-  "<!DOCTYPE html>\n"
-  "<html>\n"
-  "\n"
-  "<head>\n"
-  "    <meta charset=\"utf-8\">\n"
-  "    <meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">\n"
-  "    <meta name=\"apple-mobile-web-app-capable\" content=\"yes\">\n"
-  "    <link rel=\"stylesheet\" href=\"https://maxcdn.bootstrapcdn.com/bootstrap/4.1.3/css/bootstrap.min.css\">\n"
-  "    <script src=\"https://ajax.googleapis.com/ajax/libs/jquery/3.3.1/jquery.min.js\"></script>\n"
-  "    <script src=\"https://cdnjs.cloudflare.com/ajax/libs/popper.js/1.14.3/umd/popper.min.js\"></script>\n"
-  "    <script src=\"https://maxcdn.bootstrapcdn.com/bootstrap/4.1.3/js/bootstrap.min.js\"></script>\n"
-  "\n"
-  "    <script type=\"text/javascript\" src=\"https://cdnjs.cloudflare.com/ajax/libs/tinyColorPicker/1.1.1/jqColorPicker.min.js\"></script>\n"
-  "\n"
-  "    <title>Lilly's Lamp</title>\n"
-  "    <script>\n"
-  "        var websock;\n"
-  "        var reconnectTimer;\n"
-  "\n"
-  "        function onStart() {\n"
-  "            $(\"#currentModeLabel\").html(\"Connecting to lamp...\")\n"
-  "            websock = new WebSocket('ws://' + window.location.hostname + ':81/');\n"
-  "            websock.onopen = function (evt) {\n"
-  "                console.log('websock opened');\n"
-  "            }\n"
-  "            websock.onclose = function (evt) {\n"
-  "                console.log('websock closed. Reconnecting in 5 seconds');\n"
-  "                $(\"#currentModeLabel\").html(\"Lost connection to lamp! Trying to reconnect.\");\n"
-  "                if (reconnectTimer) { clearTimeout(reconnectTimer); }\n"
-  "                reconnectTimer = setTimeout(function () { onStart(); }, 5000);\n"
-  "            }\n"
-  "            websock.onerror = function (evt) {\n"
-  "                console.log(evt);\n"
-  "            }\n"
-  "            websock.onmessage = function (evt) {\n"
-  "                console.log(\"Incoming Data is: \" + evt.data)\n"
-  "                routeMessage(evt.data)\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function routeMessage(jsonString) {\n"
-  "            let jsonMessage = JSON.parse(jsonString);\n"
-  "            // console.log(jsonMessage)\n"
-  "\n"
-  "            if (\"Mode\" in jsonMessage) {\n"
-  "                // console.log(\"Found Mode Message\")\n"
-  "                handleModeMessage(jsonMessage.Mode)\n"
-  "            }\n"
-  "            if (\"State\" in jsonMessage) {\n"
-  "                // console.log(\"Found State Message\")\n"
-  "                handleStateMessage(jsonMessage.State)\n"
-  "            }\n"
-  "            if (\"Name\" in jsonMessage) {\n"
-  "                // console.log(\"Found Name Message\")\n"
-  "                handleNameMessage(jsonMessage.Name)\n"
-  "            }\n"
-  "            if (\"Fade Time\" in jsonMessage) {\n"
-  "                // console.log(\"Found Fade Time Message\")\n"
-  "                handleFadeTimeMessage(jsonMessage[\"Fade Time\"])\n"
-  "            }\n"
-  "            if (\"Colour\" in jsonMessage) {\n"
-  "                // console.log(\"Found Colour Message\")\n"
-  "                handleColourMessage(jsonMessage.Colour)\n"
-  "            }\n"
-  "            if (\"Rainbow\" in jsonMessage) {\n"
-  "                // console.log(\"Found Rainbow Message\")\n"
-  "                handleRainbowMessage(jsonMessage.Rainbow)\n"
-  "            }\n"
-  "            if (\"Clock\" in jsonMessage) {\n"
-  "                // console.log(\"Found Clock Message\")\n"
-  "                handleClockMessage(jsonMessage.Clock)\n"
-  "            }\n"
-  "            if (\"Bell Curve\" in jsonMessage) {\n"
-  "                // console.log(\"Found Bell Curve Message\")\n"
-  "                handleBellCurveMessage(jsonMessage[\"Bell Curve\"])\n"
-  "            }\n"
-  "            if (\"Circle\" in jsonMessage) {\n"
-  "                // console.log(\"Found Circle Message\")\n"
-  "                handleCircleMessage(jsonMessage[\"Circle\"])\n"
-  "            }\n"
-  "            if (\"Sparkle\" in jsonMessage) {\n"
-  "                // console.log(\"Found Sparkle Message\")\n"
-  "                handleSparkleMessage(jsonMessage[\"Sparkle\"])\n"
-  "            }\n"
-  "            if (\"Color Wipe\" in jsonMessage) {\n"
-  "                // console.log(\"Found Color Wipe Message\")\n"
-  "                handleColorWipeMessage(jsonMessage[\"Color Wipe\"])\n"
-  "            }\n"
-  "            if (\"Saturation Fade\" in jsonMessage) {\n"
-  "                // console.log(\"Found Saturation Fade Message\")\n"
-  "                handleSaturationFadeMessage(jsonMessage[\"Saturation Fade\"])\n"
-  "            }\n"
-  "            if (\"Confetti\" in jsonMessage) {\n"
-  "                // console.log(\"Found Confetti Message\")\n"
-  "                handleConfettiMessage(jsonMessage[\"Confetti\"])\n"
-  "            }\n"
-  "            if (\"Fireflies\" in jsonMessage) {\n"
-  "                // console.log(\"Found Fireflies Message\")\n"
-  "                handleFirefliesMessage(jsonMessage[\"Fireflies\"])\n"
-  "            }\n"
-  "            if (\"Night Rider\" in jsonMessage) {\n"
-  "                // console.log(\"Found Night Rider Message\")\n"
-  "                handleNightRiderMessage(jsonMessage[\"Night Rider\"])\n"
-  "            }\n"
-  "            if (\"Visualiser\" in jsonMessage) {\n"
-  "                // console.log(\"Found Visualiser Message\")\n"
-  "                handleVisualiserMessage(jsonMessage[\"Visualiser\"])\n"
-  "            }\n"
-  "            if (\"Wifi\" in jsonMessage) {\n"
-  "                // console.log(\"Found Wifi Message\")\n"
-  "                handleWifiMessage(jsonMessage.Wifi)\n"
-  "            }\n"
-  "            if (\"Info\" in jsonMessage) {\n"
-  "                // console.log(\"Found Info Message\")\n"
-  "                handleInfoMessage(jsonMessage.Info)\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleModeMessage(jsonMessage) {\n"
-  "            // console.log(jsonMessage)\n"
-  "            if (typeof jsonMessage === \"string\") {\n"
-  "                $(\"#currentModeLabel\").html(jsonMessage)\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleStateMessage(jsonMessage) {\n"
-  "            // console.log(jsonMessage)\n"
-  "            if (typeof jsonMessage === \"boolean\") {\n"
-  "                if (jsonMessage) {\n"
-  "                    $(\"#stateButton\").val(\"ON\")\n"
-  "                    $(\"#stateButton\").html(\"Turn OFF\")\n"
-  "                }\n"
-  "                else {\n"
-  "                    $(\"#stateButton\").val(\"OFF\")\n"
-  "                    $(\"#stateButton\").html(\"Turn ON\")\n"
-  "                }\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleNameMessage(name) {\n"
-  "            if (typeof name === \"string\") {\n"
-  "                $(document).attr(\"title\", name);\n"
-  "                $(\"#HomeButton\").text(name);\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleFadeTimeMessage(jsonMessage) {\n"
-  "            if (typeof jsonMessage === \"number\") {\n"
-  "                $(\"#fadeTime\").val(jsonMessage)\n"
-  "                $(\"#fadeTimeLabel\").html(jsonMessage)\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleColourMessage(jsonMessage) {\n"
-  "            if (typeof jsonMessage === \"object\") {\n"
-  "                var newRed = currentRed\n"
-  "                var newGreen = currentGreen\n"
-  "                var newBlue = currentBlue\n"
-  "\n"
-  "                if ((\"Red\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Red === \"number\") {\n"
-  "                        newRed = jsonMessage.Red\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"Green\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Green === \"number\") {\n"
-  "                        newGreen = jsonMessage.Green\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"Blue\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Blue === \"number\") {\n"
-  "                        newBlue = jsonMessage.Blue\n"
-  "                    }\n"
-  "                }\n"
-  "\n"
-  "                setPickerColor(colourSelectButton, newRed, newGreen, newBlue);\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleRainbowMessage(jsonMessage) {\n"
-  "            if (typeof jsonMessage === \"object\") {\n"
-  "                if ((\"Hue\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Hue === \"number\") {\n"
-  "                        $(\"#rainbowHue\").val(Math.round(jsonMessage.Hue / 255 * 360))\n"
-  "                        $(\"#rainbowHueLabel\").html(Math.round(jsonMessage.Hue / 255 * 360))\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"Speed\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Speed === \"number\") {\n"
-  "                        $(\"#rainbowSpeed\").val(jsonMessage.Speed)\n"
-  "                        $(\"#rainbowSpeedLabel\").html(jsonMessage.Speed)\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"Brightness\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Brightness === \"number\") {\n"
-  "                        $(\"#rainbowBrightness\").val(Math.round(jsonMessage.Brightness / 255 * 100))\n"
-  "                        $(\"#rainbowBrightnessLabel\").html(Math.round(jsonMessage.Brightness / 255 * 100))\n"
-  "                    }\n"
-  "                }\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleClockMessage(jsonMessage) {\n"
-  "            if (typeof jsonMessage === \"object\") {\n"
-  "                if ((\"hourColour\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.hourColour === \"object\") {\n"
-  "                        var newRed = currentHourRed\n"
-  "                        var newGreen = currentHourGreen\n"
-  "                        var newBlue = currentHourBlue\n"
-  "\n"
-  "                        if ((\"Red\" in jsonMessage.hourColour)) {\n"
-  "                            if (typeof jsonMessage.hourColour.Red === \"number\") {\n"
-  "                                newRed = jsonMessage.hourColour.Red\n"
-  "                            }\n"
-  "                        }\n"
-  "                        if ((\"Green\" in jsonMessage.hourColour)) {\n"
-  "                            if (typeof jsonMessage.hourColour.Green === \"number\") {\n"
-  "                                newGreen = jsonMessage.hourColour.Green\n"
-  "                            }\n"
-  "                        }\n"
-  "                        if ((\"Blue\" in jsonMessage.hourColour)) {\n"
-  "                            if (typeof jsonMessage.hourColour.Blue === \"number\") {\n"
-  "                                newBlue = jsonMessage.hourColour.Blue\n"
-  "                            }\n"
-  "                        }\n"
-  "\n"
-  "                        setPickerColor(clockHourColourButton, newRed, newGreen, newBlue);\n"
-  "                    }\n"
-  "                }\n"
-  "\n"
-  "                if ((\"minuteColour\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.minuteColour === \"object\") {\n"
-  "                        var newRed = currentMinRed\n"
-  "                        var newGreen = currentMinGreen\n"
-  "                        var newBlue = currentMinBlue\n"
-  "\n"
-  "                        if ((\"Red\" in jsonMessage.minuteColour)) {\n"
-  "                            if (typeof jsonMessage.minuteColour.Red === \"number\") {\n"
-  "                                newRed = jsonMessage.minuteColour.Red\n"
-  "                            }\n"
-  "                        }\n"
-  "                        if ((\"Green\" in jsonMessage.minuteColour)) {\n"
-  "                            if (typeof jsonMessage.minuteColour.Green === \"number\") {\n"
-  "                                newGreen = jsonMessage.minuteColour.Green\n"
-  "                            }\n"
-  "                        }\n"
-  "                        if ((\"Blue\" in jsonMessage.minuteColour)) {\n"
-  "                            if (typeof jsonMessage.minuteColour.Blue === \"number\") {\n"
-  "                                newBlue = jsonMessage.minuteColour.Blue\n"
-  "                            }\n"
-  "                        }\n"
-  "\n"
-  "                        setPickerColor(clockMinuteColourButton, newRed, newGreen, newBlue);\n"
-  "                    }\n"
-  "                }\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleBellCurveMessage(jsonMessage) {\n"
-  "            if (typeof jsonMessage === \"object\") {\n"
-  "                var newRed = bellRed\n"
-  "                var newGreen = bellGreen\n"
-  "                var newBlue = bellBlue\n"
-  "\n"
-  "                if ((\"Red\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Red === \"number\") {\n"
-  "                        newRed = jsonMessage.Red\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"Green\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Green === \"number\") {\n"
-  "                        newGreen = jsonMessage.Green\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"Blue\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Blue === \"number\") {\n"
-  "                        newBlue = jsonMessage.Blue\n"
-  "                    }\n"
-  "                }\n"
-  "\n"
-  "                setPickerColor(bellCurveSelectButton, newRed, newGreen, newBlue);\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleCircleMessage(jsonMessage) {\n"
-  "            if (typeof jsonMessage === \"object\") {\n"
-  "\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleNightRiderMessage(jsonMessage) {\n"
-  "            if (typeof jsonMessage === \"object\") {\n"
-  "\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleSparkleMessage(jsonMessage) {\n"
-  "            if (typeof jsonMessage === \"object\") {\n"
-  "                var newRed = currentRed\n"
-  "                var newGreen = currentGreen\n"
-  "                var newBlue = currentBlue\n"
-  "\n"
-  "                if ((\"Red\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Red === \"number\") {\n"
-  "                        newRed = jsonMessage.Red\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"Green\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Green === \"number\") {\n"
-  "                        newGreen = jsonMessage.Green\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"Blue\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Blue === \"number\") {\n"
-  "                        newBlue = jsonMessage.Blue\n"
-  "                    }\n"
-  "                }\n"
-  "                setPickerColor(sparkleSelectButton, newRed, newGreen, newBlue);\n"
-  "\n"
-  "                if ((\"Speed\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Speed === \"number\") {\n"
-  "                        $(\"#sparkleSpeed\").val(jsonMessage.Speed)\n"
-  "                        $(\"#sparkleSpeedLabel\").html(jsonMessage.Speed)\n"
-  "                    }\n"
-  "                }\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleColorWipeMessage(jsonMessage) {\n"
-  "            if (typeof jsonMessage === \"object\") {\n"
-  "                var newRed = currentRed\n"
-  "                var newGreen = currentGreen\n"
-  "                var newBlue = currentBlue\n"
-  "\n"
-  "                if ((\"Red\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Red === \"number\") {\n"
-  "                        newRed = jsonMessage.Red\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"Green\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Green === \"number\") {\n"
-  "                        newGreen = jsonMessage.Green\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"Blue\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Blue === \"number\") {\n"
-  "                        newBlue = jsonMessage.Blue\n"
-  "                    }\n"
-  "                }\n"
-  "                setPickerColor(colorWipeSelectButton, newRed, newGreen, newBlue);\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleSaturationFadeMessage(jsonMessage) {\n"
-  "            if (typeof jsonMessage === \"object\") {\n"
-  "                if ((\"Hue\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Hue === \"number\") {\n"
-  "                        $(\"#saturationFadeHue\").val(Math.round(jsonMessage.Hue / 255 * 359))\n"
-  "                        $(\"#saturationFadeHueLabel\").html(Math.round(jsonMessage.Hue / 255 * 359))\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"Speed\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Speed === \"number\") {\n"
-  "                        $(\"#saturationFadeSpeed\").val(jsonMessage.Speed)\n"
-  "                        $(\"#saturationFadeSpeedLabel\").html(jsonMessage.Speed)\n"
-  "                    }\n"
-  "                }\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleConfettiMessage(jsonMessage) {\n"
-  "            if (typeof jsonMessage === \"object\") {\n"
-  "                var newRed = currentRed\n"
-  "                var newGreen = currentGreen\n"
-  "                var newBlue = currentBlue\n"
-  "\n"
-  "                if ((\"Red\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Red === \"number\") {\n"
-  "                        newRed = jsonMessage.Red\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"Green\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Green === \"number\") {\n"
-  "                        newGreen = jsonMessage.Green\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"Blue\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Blue === \"number\") {\n"
-  "                        newBlue = jsonMessage.Blue\n"
-  "                    }\n"
-  "                }\n"
-  "                setPickerColor(confettiSelectButton, newRed, newGreen, newBlue);\n"
-  "\n"
-  "                if ((\"Speed\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Speed === \"number\") {\n"
-  "                        $(\"#confettiSpeed\").val(jsonMessage.Speed)\n"
-  "                        $(\"#confettiSpeedLabel\").html(jsonMessage.Speed)\n"
-  "                    }\n"
-  "                }\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleFirefliesMessage(jsonMessage) {\n"
-  "            if (typeof jsonMessage === \"object\") {\n"
-  "                if (\"Hue\" in jsonMessage) {\n"
-  "                    if (typeof jsonMessage.Hue === \"number\") {\n"
-  "                        $(\"#firefliesHue\").val(Math.round(jsonMessage.Hue / 255 * 359))\n"
-  "                        $(\"#firefliesHueLabel\").html(Math.round(jsonMessage.Hue / 255 * 359))\n"
-  "                    }\n"
-  "                }\n"
-  "                if (\"Brightness\" in jsonMessage) {\n"
-  "                    if (typeof jsonMessage.Brightness === \"number\") {\n"
-  "                        $(\"#firefliesBrightness\").val(Math.round(jsonMessage.Brightness / 255 * 100))\n"
-  "                        $(\"#firefliesBrightnessLabel\").html(Math.round(jsonMessage.Brightness / 255 * 100))\n"
-  "                    }\n"
-  "                }\n"
-  "                if (\"MinimumFlashDelay\" in jsonMessage) {\n"
-  "                    if (typeof jsonMessage.MinimumFlashDelay === \"number\") {\n"
-  "                        $(\"#firefliesMinimumFlashDelay\").val(jsonMessage.MinimumFlashDelay)\n"
-  "                        $(\"#firefliesMinimumFlashDelayLabel\").html(jsonMessage.MinimumFlashDelay)\n"
-  "                    }\n"
-  "                }\n"
-  "                if (\"MaximumFlashDelay\" in jsonMessage) {\n"
-  "                    if (typeof jsonMessage.MaximumFlashDelay === \"number\") {\n"
-  "                        $(\"#firefliesMaximumFlashDelay\").val(jsonMessage.MaximumFlashDelay)\n"
-  "                        $(\"#firefliesMaximumFlashDelayLabel\").html(jsonMessage.MaximumFlashDelay)\n"
-  "                    }\n"
-  "                }\n"
-  "                if (\"FlashLength\" in jsonMessage) {\n"
-  "                    if (typeof jsonMessage.FlashLength === \"number\") {\n"
-  "                        $(\"#firefliesFlashLength\").val(jsonMessage.FlashLength)\n"
-  "                        $(\"#firefliesFlashLengthLabel\").html(jsonMessage.FlashLength)\n"
-  "                    }\n"
-  "                }\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleVisualiserMessage(jsonMessage) {\n"
-  "            if (typeof jsonMessage === \"object\") {\n"
-  "                if ((\"Period\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.Period === \"number\") {\n"
-  "                        $(\"#visualiserPeriod\").val(jsonMessage.Period)\n"
-  "                        $(\"#visualiserPeriodLabel\").html(Math.round(1000000 / jsonMessage.Period / 2))\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"MinThreshold\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.MinThreshold === \"number\") {\n"
-  "                        $(\"#visualiserMinThreshold\").val(jsonMessage.MinThreshold)\n"
-  "                        $(\"#visualiserMinThresholdLabel\").html(jsonMessage.MinThreshold)\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"MaxThreshold\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.MaxThreshold === \"number\") {\n"
-  "                        $(\"#visualiserMaxThreshold\").val(jsonMessage.MaxThreshold)\n"
-  "                        $(\"#visualiserMaxThresholdLabel\").html(jsonMessage.MaxThreshold)\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"FadeUp\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.FadeUp === \"number\") {\n"
-  "                        $(\"#visualiserFadeUp\").val(jsonMessage.FadeUp)\n"
-  "                        $(\"#visualiserFadeUpLabel\").html(jsonMessage.FadeUp)\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"FadeDown\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.FadeDown === \"number\") {\n"
-  "                        $(\"#visualiserFadeDown\").val(jsonMessage.FadeDown)\n"
-  "                        $(\"#visualiserFadeDownLabel\").html(jsonMessage.FadeDown)\n"
-  "                    }\n"
-  "                }\n"
-  "                if ((\"HueOffset\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.HueOffset === \"number\") {\n"
-  "                        $(\"#visualiserHueOffset\").val(Math.round(jsonMessage.HueOffset / 255 * 360))\n"
-  "                        $(\"#visualiserHueOffsetLabel\").html(Math.round(jsonMessage.HueOffset / 255 * 360))\n"
-  "                    }\n"
-  "                }\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleWifiMessage(jsonMessage) {\n"
-  "            // {\n"
-  "            //     \"Wifi\" : {\n"
-  "            //         \"ScanResults\" : [\n"
-  "            //             {\n"
-  "            //                 \"SSID\" : \"Test\",\n"
-  "            //                 \"RSSI\" : -70,\n"
-  "            //                 \"BSSID\" : \"MAC\",\n"
-  "            //                 \"Channel\" : 1,\n"
-  "            //                 \"Encrypt\" : \"Yes\"\n"
-  "            //             }\n"
-  "            //         ]\n"
-  "            //     }\n"
-  "            // }\n"
-  "\n"
-  "            // console.log(jsonMessage)\n"
-  "            if (typeof jsonMessage === \"object\") {\n"
-  "                if ((\"ScanResults\" in jsonMessage)) {\n"
-  "                    if (typeof jsonMessage.ScanResults === \"object\") {\n"
-  "                        let specific_tbody = document.getElementById(\"wifiTableBody\");\n"
-  "                        for (var i = specific_tbody.rows.length - 1; i > -1; i--) {\n"
-  "                            specific_tbody.deleteRow(i);\n"
-  "                        }\n"
-  "\n"
-  "                        for (var i = 0; i < jsonMessage.ScanResults.length; i++) {\n"
-  "                            let row = specific_tbody.insertRow(-1);\n"
-  "                            let ssidCell = row.insertCell(0).appendChild(document.createTextNode(jsonMessage.ScanResults[i].SSID));\n"
-  "                            let rssiCell = row.insertCell(1).appendChild(document.createTextNode(jsonMessage.ScanResults[i].RSSI));\n"
-  "                            let bssidCell = row.insertCell(2).appendChild(document.createTextNode(jsonMessage.ScanResults[i].BSSID));\n"
-  "                            let channelCell = row.insertCell(3).appendChild(document.createTextNode(jsonMessage.ScanResults[i].CHANNEL));\n"
-  "                            let encryptedCell = row.insertCell(4).appendChild(document.createTextNode(jsonMessage.ScanResults[i].ENCRYPT));\n"
-  "\n"
-  "                            row.addEventListener(\"click\", function () {\n"
-  "                                document.getElementById('SSIDInput').value = this.firstChild.innerHTML;\n"
-  "                            });\n"
-  "                        }\n"
-  "                    }\n"
-  "                }\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function handleInfoMessage(jsonMessage) {\n"
-  "            // {\n"
-  "            //     \"Sketch\":\"Super_Simple_RGB_WiFi_Lamp.ino\",\n"
-  "            //     \"Compile time\":\"Tue Dec 31 17:28:07 2019\",\n"
-  "            //     \"IDE Version\":\"1.8.10\",\n"
-  "            //     \"Esp Version\":\"SDK:2.2.2-dev(38a443e)/Core:2.6.3=20603000/lwIP:STABLE-2_1_2_RELEASE/glue:1.2-16-ge23a07e/BearSSL:89454af\",\n"
-  "            //     \"FastLED Version\":\"3003002\"\n"
-  "            // }\n"
-  "            if (typeof jsonMessage !== \"object\")\n"
-  "                return;\n"
-  "\n"
-  "            $.each(jsonMessage, function(key, value) {\n"
-  "                $(\"#Info\"+key).text(value);\n"
-  "            });\n"
-  "        }\n"
-  "\n"
-  "        function sendMessage(jsonMessage) {\n"
-  "            console.log(\"Sending: \" + JSON.stringify(jsonMessage))\n"
-  "            if (websock != null && websock.readyState == 1) {\n"
-  "                websock.send(JSON.stringify(jsonMessage));\n"
-  "            } else {\n"
-  "                console.warn(\"Websockets are closed\")\n"
-  "            }\n"
-  "        }\n"
-  "\n"
-  "        function setPickerColor(picker, r, g, b) {\n"
-  "            var rgb_color = 'rgb(' + r + ', ' + g + ', ' + b + ')';\n"
-  "            picker.val(rgb_color);\n"
-  "            picker.colorPicker.color.setColor(rgb_color);\n"
-  "            picker.css({\n"
-  "                backgroundColor: rgb_color,\n"
-  "                color: picker.colorPicker.color.colors.RGBLuminance > 0.22 ? '#222' : '#ddd'\n"
-  "            }).text(rgb_color);\n"
-  "        }\n"
-  "    </script>\n"
-  "\n"
-  "</head>\n"
-  "\n"
-  "<body class=\"bg-dark text-light text-justify\" onload=\"javascript:onStart();\">\n"
-  "    <nav class=\"navbar navbar-expand-sm bg-secondary navbar-dark fixed-top\" id=\"navbarHeader\">\n"
-  "        <div class=\"container-fluid\">\n"
-  "            <a class=\"navbar-brand\" href=\"#\" id=\"HomeButton\">Lilly's Lamp</a>\n"
-  "            <button class=\"navbar-toggler\" type=\"button\" data-toggle=\"collapse\" data-target=\"#collapsibleNavbar\">\n"
-  "                <span class=\"navbar-toggler-icon\"></span>\n"
-  "            </button>\n"
-  "            <div class=\"collapse navbar-collapse\" id=\"collapsibleNavbar\">\n"
-  "                <ul class=\"nav navbar-nav\">\n"
-  "                    <li class=\"nav-item\">\n"
-  "                        <a id=\"homeTabNavItem\" class=\"nav-link active\" data-toggle=\"tab\" href=\"#Home\">Home</a>\n"
-  "                    </li>\n"
-  "                    <li class=\"nav-item\">\n"
-  "                        <a id=\"colourTabNavItem\" class=\"nav-link\" data-toggle=\"tab\" href=\"#Colour\">Colour</a>\n"
-  "                    </li>\n"
-  "                    <li id=\"rainbowTabNavItem\" class=\"nav-item\">\n"
-  "                        <a class=\"nav-link\" data-toggle=\"tab\" href=\"#Rainbow\">Rainbow</a>\n"
-  "                    </li>\n"
-  "                    <li id=\"clockTabNavItem\" class=\"nav-item\">\n"
-  "                        <a class=\"nav-link\" data-toggle=\"tab\" href=\"#Clock\">Clock</a>\n"
-  "                    </li>\n"
-  "                    <li id=\"bellCurveTabNavItem\" class=\"nav-item\">\n"
-  "                        <a class=\"nav-link\" data-toggle=\"tab\" href=\"#BellCurve\">Bell Curve</a>\n"
-  "                    </li>\n"
-  "                    <li id=\"circleTabNavItem\" class=\"nav-item\">\n"
-  "                        <a class=\"nav-link\" data-toggle=\"tab\" href=\"#Circle\">Circle</a>\n"
-  "                    </li>\n"
-  "                    <li id=\"nightRiderTabNavItem\" class=\"nav-item\">\n"
-  "                        <a class=\"nav-link\" data-toggle=\"tab\" href=\"#NightRider\">Night Rider</a>\n"
-  "                    </li>\n"
-  "                    <li id=\"sparkleTabNavItem\" class=\"nav-item\">\n"
-  "                        <a class=\"nav-link\" data-toggle=\"tab\" href=\"#Sparkle\">Sparkle</a>\n"
-  "                    </li>\n"
-  "                    <li id=\"colorWipeTabNavItem\" class=\"nav-item\">\n"
-  "                        <a class=\"nav-link\" data-toggle=\"tab\" href=\"#ColorWipe\">Color Wipe</a>\n"
-  "                    </li>\n"
-  "                    <li id=\"saturationFadeTabNavItem\" class=\"nav-item\">\n"
-  "                        <a class=\"nav-link\" data-toggle=\"tab\" href=\"#SaturationFade\">Saturation Fade</a>\n"
-  "                    </li>\n"
-  "                    <li id=\"confettiTabNavItem\" class=\"nav-item\">\n"
-  "                        <a class=\"nav-link\" data-toggle=\"tab\" href=\"#Confetti\">Confetti</a>\n"
-  "                    </li>\n"
-  "                    <li id=\"firefliesTabNavItem\" class=\"nav-item\">\n"
-  "                        <a class=\"nav-link\" data-toggle=\"tab\" href=\"#Fireflies\">Fireflies</a>\n"
-  "                    </li>\n"
-  "                    <li id=\"visualiserTabNavItem\" class=\"nav-item\">\n"
-  "                        <a class=\"nav-link\" data-toggle=\"tab\" href=\"#Visualiser\">Visualiser</a>\n"
-  "                    </li>\n"
-  "                    <li id=\"wifiTabNavItem\" class=\"nav-item\">\n"
-  "                        <a class=\"nav-link\" data-toggle=\"tab\" href=\"#WfiConfig\">Wifi</a>\n"
-  "                    </li>\n"
-  "                    <li id=\"infoTabNavItem\" class=\"nav-item\">\n"
-  "                        <a class=\"nav-link\" data-toggle=\"tab\" href=\"#LampInfo\">Info</a>\n"
-  "                    </li>\n"
-  "                </ul>\n"
-  "                <script>\n"
-  "                    $(\"#colourTabNavItem\").click(function () {\n"
-  "                        sendMessage({ \"Mode\": \"Colour\" })\n"
-  "                    });\n"
-  "                    $(\"#rainbowTabNavItem\").click(function () {\n"
-  "                        sendMessage({ \"Mode\": \"Rainbow\" })\n"
-  "                    });\n"
-  "                    $(\"#clockTabNavItem\").click(function () {\n"
-  "                        sendMessage({ \"Mode\": \"Clock\" })\n"
-  "                    });\n"
-  "                    $(\"#bellCurveTabNavItem\").click(function () {\n"
-  "                        sendMessage({ \"Mode\": \"Bell Curve\" })\n"
-  "                    });\n"
-  "                    $(\"#circleTabNavItem\").click(function () {\n"
-  "                        sendMessage({ \"Mode\": \"Circle\" })\n"
-  "                    });\n"
-  "                    $(\"#nightRiderTabNavItem\").click(function () {\n"
-  "                        sendMessage({ \"Mode\": \"Night Rider\" })\n"
-  "                    });\n"
-  "                    $(\"#sparkleTabNavItem\").click(function () {\n"
-  "                        sendMessage({ \"Mode\": \"Sparkle\" })\n"
-  "                    });\n"
-  "                    $(\"#colorWipeTabNavItem\").click(function () {\n"
-  "                        sendMessage({ \"Mode\": \"Color Wipe\" })\n"
-  "                    });\n"
-  "                    $(\"#saturationFadeTabNavItem\").click(function () {\n"
-  "                        sendMessage({ \"Mode\": \"Saturation Fade\" })\n"
-  "                    });\n"
-  "                    $(\"#confettiTabNavItem\").click(function () {\n"
-  "                        sendMessage({ \"Mode\": \"Confetti\" })\n"
-  "                    });\n"
-  "                    $(\"#firefliesTabNavItem\").click(function () {\n"
-  "                        sendMessage({ \"Mode\": \"Fireflies\" })\n"
-  "                    });\n"
-  "                    $(\"#visualiserTabNavItem\").click(function () {\n"
-  "                        sendMessage({ \"Mode\": \"Visualiser\" })\n"
-  "                    });\n"
-  "                </script>\n"
-  "            </div>\n"
-  "        </div>\n"
-  "        <script>\n"
-  "            $(function () {\n"
-  "                $(\".nav-item\").click(function () {\n"
-  "                    $(\".collapse\").collapse('hide');\n"
-  "                });\n"
-  "            });\n"
-  "        </script>\n"
-  "    </nav>\n"
-  "    <div class=\"tab-content container\" style=\"margin-top:80px\">\n"
-  "        <div id=\"modeDisplay\" class=\"container\">\n"
-  "            <h1>Mode: <span id=\"currentModeLabel\"></span></h1>\n"
-  "            <div class=\"col mb-4\">\n"
-  "                <label for=\"fadeTime\">Fade Time: <span id=\"fadeTimeLabel\">200</span> milliseconds</label>\n"
-  "                <input id=\"fadeTime\" type=\"range\" min=\"0\" max=\"2000\" step=\"100\" value=\"200\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <button id=\"stateButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\" value=\"OFF\">Turn\n"
-  "                ON</button>\n"
-  "            <script>\n"
-  "                fadeTimeDebounce = Date.now()\n"
-  "\n"
-  "                $(\"#stateButton\").click(function () {\n"
-  "                    var newState = $(\"#stateButton\").val() == \"ON\" ? \"OFF\" : \"ON\"\n"
-  "                    onStateButtonEvent(newState)\n"
-  "                });\n"
-  "                $(\"#fadeTime\").on(\"input\", function () {\n"
-  "                    onFadeTimeEvent()\n"
-  "                });\n"
-  "                $(\"#fadeTime\").on(\"change\", function () {\n"
-  "                    onFadeTimeEvent()\n"
-  "                });\n"
-  "\n"
-  "                function onStateButtonEvent(currentState) {\n"
-  "                    if (currentState != $(\"#stateButton\").val()) {\n"
-  "                        if (currentState === \"OFF\") {\n"
-  "                            msgValue = false\n"
-  "                            $(\"#stateButton\").val(\"OFF\")\n"
-  "                            $(\"#stateButton\").html(\"Turn ON\")\n"
-  "                        }\n"
-  "                        else if (currentState === \"ON\") {\n"
-  "                            msgValue = true\n"
-  "                            $(\"#stateButton\").val(\"ON\")\n"
-  "                            $(\"#stateButton\").html(\"Turn OFF\")\n"
-  "                        }\n"
-  "\n"
-  "                        msg = {\n"
-  "                            \"State\": msgValue\n"
-  "                        }\n"
-  "\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "\n"
-  "                function onFadeTimeEvent() {\n"
-  "                    let currentFadeTimeValue = parseInt($(\"#fadeTime\").val(), 10)\n"
-  "                    $(\"#fadeTimeLabel\").html(currentFadeTimeValue)\n"
-  "\n"
-  "                    msg = {\n"
-  "                        \"Fade Time\": currentFadeTimeValue\n"
-  "                    }\n"
-  "\n"
-  "                    if (Date.now() - fadeTimeDebounce > 50) {\n"
-  "                        fadeTimeDebounce = Date.now()\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "            </script>\n"
-  "            <hr>\n"
-  "        </div>\n"
-  "        <div id=\"Home\" class=\"container tab-pane active\">\n"
-  "            <h1>Home</h1>\n"
-  "            <p>Hi Lilly welcome to your Lamp web page! Here you can change the mode to one of the pre programmed ones\n"
-  "                below. Click any of the buttons to interact with the light.</p>\n"
-  "            <button id=\"colourButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Colour</button>\n"
-  "            <button id=\"rainbowButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Rainbow</button>\n"
-  "            <button id=\"clockButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Clock</button>\n"
-  "            <button id=\"bellCurveButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Bell Curve</button>\n"
-  "            <button id=\"circleButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Circle</button>\n"
-  "            <button id=\"nightRiderButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Night Rider</button>\n"
-  "            <button id=\"sparkleButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Sparkle</button>\n"
-  "            <button id=\"colorWipeButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Colour Wipe</button>\n"
-  "            <button id=\"saturationFadeButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Saturation Fade</button>\n"
-  "            <button id=\"confettiButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Confetti</button>\n"
-  "            <button id=\"firefliesButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Fireflies</button>\n"
-  "            <button id=\"visualiserButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Visualiser</button>\n"
-  "            <button id=\"wifiButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Wifi Config</button>\n"
-  "            <button id=\"infoButton\" type=\"submit\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Info</button>\n"
-  "            <script>\n"
-  "                $(\"#HomeButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#Home\"]').tab('show')\n"
-  "                });\n"
-  "                $(\"#colourButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#Colour\"]').tab('show')\n"
-  "                    sendMessage({ \"Mode\": \"Colour\" })\n"
-  "                });\n"
-  "                $(\"#rainbowButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#Rainbow\"]').tab('show')\n"
-  "                    sendMessage({ \"Mode\": \"Rainbow\" })\n"
-  "                });\n"
-  "                $(\"#clockButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#Clock\"]').tab('show')\n"
-  "                    sendMessage({ \"Mode\": \"Clock\" })\n"
-  "                });\n"
-  "                $(\"#bellCurveButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#BellCurve\"]').tab('show')\n"
-  "                    sendMessage({ \"Mode\": \"Bell Curve\" })\n"
-  "                });\n"
-  "                $(\"#circleButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#Circle\"]').tab('show')\n"
-  "                    sendMessage({ \"Mode\": \"Circle\" })\n"
-  "                });\n"
-  "                $(\"#nightRiderButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#NightRider\"]').tab('show')\n"
-  "                    sendMessage({ \"Mode\": \"Night Rider\" })\n"
-  "                });\n"
-  "                $(\"#sparkleButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#Sparkle\"]').tab('show')\n"
-  "                    sendMessage({ \"Mode\": \"Sparkle\" })\n"
-  "                });\n"
-  "                $(\"#colorWipeButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#ColorWipe\"]').tab('show')\n"
-  "                    sendMessage({ \"Mode\": \"Color Wipe\" })\n"
-  "                });\n"
-  "                $(\"#saturationFadeButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#SaturationFade\"]').tab('show')\n"
-  "                    sendMessage({ \"Mode\": \"Saturation Fade\" })\n"
-  "                });\n"
-  "                $(\"#confettiButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#Confetti\"]').tab('show')\n"
-  "                    sendMessage({ \"Mode\": \"Confetti\" })\n"
-  "                });\n"
-  "                $(\"#firefliesButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#Fireflies\"]').tab('show')\n"
-  "                    sendMessage({ \"Mode\": \"Fireflies\" })\n"
-  "                });\n"
-  "                $(\"#visualiserButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#Visualiser\"]').tab('show')\n"
-  "                    sendMessage({ \"Mode\": \"Visualiser\" })\n"
-  "                });\n"
-  "                $(\"#wifiButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#WfiConfig\"]').tab('show')\n"
-  "                });\n"
-  "                $(\"#infoButton\").click(function () {\n"
-  "                    $('#navbarHeader a[href=\"#LampInfo\"]').tab('show')\n"
-  "                });\n"
-  "            </script>\n"
-  "        </div>\n"
-  "        <div id=\"Colour\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Colour Mode</h2>\n"
-  "            <p>Here you can set the light to any colour you desire. There are also a couple of buttons for setting the\n"
-  "                light to different shades of white</p>\n"
-  "\n"
-  "            <div class=\"row my-3\">\n"
-  "                <input id=\"colourSelectButton\" class=\"color col mb-2 mx-2 btn btn-lg btn-outline-light\" value=\"rgb(0,0,0)\"></input>\n"
-  "            </div>\n"
-  "            <div class=\"row my-3\">\n"
-  "                <button id=\"redButton\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Red</button>\n"
-  "                <button id=\"greenButton\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Green</button>\n"
-  "                <button id=\"blueButton\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Blue</button>\n"
-  "            </div>\n"
-  "            <div class=\"row my-3\">\n"
-  "                <button id=\"yellowButton\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Yellow</button>\n"
-  "                <button id=\"cyanButton\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Cyan</button>\n"
-  "                <button id=\"magentaButton\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Magenta</button>\n"
-  "            </div>\n"
-  "            <div class=\"row my-3\">\n"
-  "                <button id=\"2500Button\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">2500K</button>\n"
-  "                <button id=\"3000Button\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">3000K</button>\n"
-  "                <button id=\"4000Button\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">4000K</button>\n"
-  "            </div>\n"
-  "			<div class=\"row my-3\">\n"
-  "				<button id=\"whiteButton\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">White</button>\n"
-  "			</div>\n"
-  "			<div class=\"row my-3\">\n"
-  "				<label for=\"colourBrightness\">Colour Brightness: <span id=\"colourBrightnessLabel\">100</span>%</label>\n"
-  "				<input id=\"colourBrightness\" type=\"range\" min=\"0\" max=\"100\" step=\"1\" value=\"100\" class=\"form-control-range custom-range\">\n"
-  "			</div>\n"
-  "            <script>\n"
-  "                var currentRed = 0;\n"
-  "                var currentGreen = 0;\n"
-  "                var currentBlue = 0;\n"
-  "				var currentWhite = 0;\n"
-  "                var colourDebunce = Date.now();\n"
-  "				var colourLastMessage = \"\";\n"
-  "\n"
-  "                var colourSelectButton = $('#colourSelectButton').colorPicker({\n"
-  "                    customBG: '#222',\n"
-  "                    margin: '4px -2px 0',\n"
-  "                    doRender: 'div div',\n"
-  "                    preventFocus: true,\n"
-  "                    animationSpeed: 150,\n"
-  "                    forceAlpha: false,\n"
-  "\n"
-  "                    // demo on how to make plugins... mobile support plugin\n"
-  "                    buildCallback: function ($elm) {\n"
-  "                        this.$colorPatch = $elm.prepend('<div class=\"cp-disp\">').find('.cp-disp');\n"
-  "                    },\n"
-  "                    cssAddon:\n"
-  "                        '.cp-xy-slider {width:200px; height:200px;}' +\n"
-  "                        '.cp-xy-cursor {width:16px; height:16px; border-width:2px; margin:-8px}' +\n"
-  "                        '.cp-z-slider {height:200px; width:40px;}' +\n"
-  "                        '.cp-z-cursor {border-width:8px; margin-top:-8px;}' +\n"
-  "                        '.cp-alpha {height:40px;}' +\n"
-  "                        '.cp-alpha-cursor {border-width:8px; margin-left:-8px;}',\n"
-  "\n"
-  "                    renderCallback: function ($elm, toggled) {\n"
-  "                        var colors = this.color.colors;\n"
-  "                        onColourButtonEvent(Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255), 0)\n"
-  "                        setPickerColor(colourSelectButton, Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255))\n"
-  "                    }\n"
-  "                })\n"
-  "                $(\"#redButton\").click(function () {\n"
-  "                    onColourButtonEvent(255, 0, 0, 0)\n"
-  "                });\n"
-  "                $(\"#greenButton\").click(function () {\n"
-  "                    onColourButtonEvent(0, 255, 0, 0)\n"
-  "                });\n"
-  "                $(\"#blueButton\").click(function () {\n"
-  "                    onColourButtonEvent(0, 0, 255, 0)\n"
-  "                });\n"
-  "                $(\"#yellowButton\").click(function () {\n"
-  "                    onColourButtonEvent(255, 255, 0, 0)\n"
-  "                });\n"
-  "                $(\"#cyanButton\").click(function () {\n"
-  "                    onColourButtonEvent(0, 255, 255, 0)\n"
-  "                });\n"
-  "                $(\"#magentaButton\").click(function () {\n"
-  "                    onColourButtonEvent(255, 0, 255, 0)\n"
-  "                });\n"
-  "                $(\"#2500Button\").click(function () {\n"
-  "                    onColourButtonEvent(206, 57, 18, 0)\n"
-  "                });\n"
-  "                $(\"#3000Button\").click(function () {\n"
-  "                    onColourButtonEvent(235, 71, 30, 0)\n"
-  "                });\n"
-  "                $(\"#4000Button\").click(function () {\n"
-  "                    onColourButtonEvent(238, 99, 63, 0)\n"
-  "                });\n"
-  "				$(\"#whiteButton\").click(function () {\n"
-  "                    onColourButtonEvent(0, 0, 0, 255)\n"
-  "                });\n"
-  "				$(\"#colourBrightness\").on(\"input\", function () {\n"
-  "                    onColourBrightnessEvent()\n"
-  "				});\n"
-  "\n"
-  "                function onColourButtonEvent(red, green, blue, white) {\n"
-  "                    if (currentRed != red || currentGreen != green || currentBlue != blue || currentWhite != white) {\n"
-  "                        currentRed = red\n"
-  "                        currentGreen = green\n"
-  "                        currentBlue = blue\n"
-  "						currentWhite = white\n"
-  "\n"
-  "                        msg = {\n"
-  "                            \"State\": true,\n"
-  "                            \"Mode\": \"Colour\",\n"
-  "                            \"Colour\": {\n"
-  "                                \"Red\": red,\n"
-  "                                \"Green\": green,\n"
-  "                                \"Blue\": blue,\n"
-  "								\"White\": white\n"
-  "                            }\n"
-  "                        }\n"
-  "                        if (Date.now() - colourDebunce > 50) {\n"
-  "                            colourDebunce = Date.now()\n"
-  "                            sendMessage(msg)\n"
-  "                        }\n"
-  "                    }\n"
-  "                }\n"
-  "\n"
-  "				function onColourBrightnessEvent() {\n"
-  "                    let currentSpeedValue = parseFloat($(\"#colourBrightness\").val())\n"
-  "\n"
-  "                    $(\"#colourBrightnessLabel\").html(currentSpeedValue)\n"
-  "\n"
-  "                    msg = {\n"
-  "                        \"State\": true,\n"
-  "                        \"Mode\": \"Colour\",\n"
-  "                        \"Colour\": {\n"
-  "                            \"Brightness\": currentSpeedValue\n"
-  "                        }\n"
-  "                    }\n"
-  "\n"
-  "                    if (msg != colourLastMessage && Date.now() - colourDebunce > 50) {\n"
-  "                        colourDebunce = Date.now()\n"
-  "                        colourLastMessage = msg\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "            </Script>\n"
-  "        </div>\n"
-  "        <div id=\"Rainbow\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Rainbow Mode</h2>\n"
-  "            <p>Here you can set the mode to rainbow. This mode produces a rainbow all the way around the light and\n"
-  "                slowly shifts the colours clockwise. On this page you can set the speed of this as well as the\n"
-  "                brightness of the light</p>\n"
-  "            <div>\n"
-  "                <label for=\"rainbowHue\">Start Hue: <span id=\"rainbowHueLabel\">0</span> Degrees</label>\n"
-  "                <input id=\"rainbowHue\" type=\"range\" min=\"0\" max=\"359\" step=\"1\" value=\"0\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <div>\n"
-  "                <label for=\"rainbowBrightness\">Rainbow Brightness: <span id=\"rainbowBrightnessLabel\">100</span>%</label>\n"
-  "                <input id=\"rainbowBrightness\" type=\"range\" min=\"0\" max=\"100\" step=\"1\" value=\"100\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <div>\n"
-  "                <label for=\"rainbowSpeed\">Rainbow Speed: <span id=\"rainbowSpeedLabel\">10</span> seconds</label>\n"
-  "                <input id=\"rainbowSpeed\" type=\"range\" min=\"0\" max=\"10\" step=\"1\" value=\"10\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <script>\n"
-  "                var rainbowDebunce = Date.now()\n"
-  "                var rainbowLastMessage = \"\"\n"
-  "\n"
-  "                $(\"#rainbowHue\").on(\"input\", function () {\n"
-  "                    onRainboWHueEvent()\n"
-  "                });\n"
-  "                $(\"#rainbowHue\").on(\"change\", function () {\n"
-  "                    onRainboWHueEvent()\n"
-  "                });\n"
-  "                $(\"#rainbowSpeed\").on(\"input\", function () {\n"
-  "                    onRainboWEvent()\n"
-  "                });\n"
-  "                $(\"#rainbowSpeed\").on(\"change\", function () {\n"
-  "                    onRainboWEvent()\n"
-  "                });\n"
-  "                $(\"#rainbowBrightness\").on(\"input\", function () {\n"
-  "                    onRainboWEvent()\n"
-  "                });\n"
-  "                $(\"#rainbowBrightness\").on(\"change\", function () {\n"
-  "                    onRainboWEvent()\n"
-  "                });\n"
-  "\n"
-  "                function onRainboWHueEvent() {\n"
-  "\n"
-  "                    let currentHueValue = parseInt($(\"#rainbowHue\").val(), 10)\n"
-  "                    let currentBrightnessValue = parseInt($(\"#rainbowBrightness\").val(), 10)\n"
-  "\n"
-  "                    $(\"#rainbowSpeed\").val = 0;\n"
-  "                    $(\"#rainbowSpeedLabel\").html(0)\n"
-  "                    $(\"#rainbowHueLabel\").html(currentHueValue)\n"
-  "                    $(\"#rainbowBrightnessLabel\").html(currentBrightnessValue)\n"
-  "\n"
-  "                    msg = {\n"
-  "                        \"State\": true,\n"
-  "                        \"Mode\": \"Rainbow\",\n"
-  "                        \"Rainbow\": {\n"
-  "                            \"Hue\": Math.round(currentHueValue / 360 * 255),\n"
-  "                            \"Speed\": 0,\n"
-  "                            \"Brightness\": Math.round(currentBrightnessValue / 100 * 255)\n"
-  "                        }\n"
-  "                    }\n"
-  "\n"
-  "                    if (msg != rainbowLastMessage && Date.now() - rainbowDebunce > 50) {\n"
-  "                        rainbowDebunce = Date.now()\n"
-  "                        rainbowLastMessage = msg\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "\n"
-  "                function onRainboWEvent() {\n"
-  "                    let currentSpeedValue = parseFloat($(\"#rainbowSpeed\").val())\n"
-  "                    let currentBrightnessValue = parseInt($(\"#rainbowBrightness\").val(), 10)\n"
-  "\n"
-  "                    $(\"#rainbowSpeedLabel\").html(currentSpeedValue)\n"
-  "                    $(\"#rainbowBrightnessLabel\").html(currentBrightnessValue)\n"
-  "\n"
-  "                    msg = {\n"
-  "                        \"State\": true,\n"
-  "                        \"Mode\": \"Rainbow\",\n"
-  "                        \"Rainbow\": {\n"
-  "                            \"Speed\": currentSpeedValue,\n"
-  "                            \"Brightness\": Math.round(currentBrightnessValue / 100 * 255)\n"
-  "                        }\n"
-  "                    }\n"
-  "\n"
-  "                    if (msg != rainbowLastMessage && Date.now() - rainbowDebunce > 50) {\n"
-  "                        rainbowDebunce = Date.now()\n"
-  "                        rainbowLastMessage = msg\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "            </script>\n"
-  "        </div>\n"
-  "        <div id=\"Clock\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Clock Mode</h2>\n"
-  "            <p>In this mode the light will display the current time in 12 hr format uisng the\n"
-  "                top and bottom side of the light. On the top is the current hour, and the bottom is the minute. The left\n"
-  "                of teh light represents 0 and the right represents either 12hr or 60mins. You can choose the colour of\n"
-  "                the hour and minute light to what you would desire. If your clock is out of sync\n"
-  "                you can click the resync button (note this should be automatically done on the device for you)</p>\n"
-  "            <h2>Current Time: <span id=\"clockPrintOut\"></span></h2>\n"
-  "            <div class=\"row my-3\">\n"
-  "                <button id=\"clockHourColourButton\" class=\"color col mb-2 mx-2 btn btn-lg btn-outline-light\">Hour\n"
-  "                    Colour</button>\n"
-  "                <button id=\"clockMinuteColourButton\" class=\"color col mb-2 mx-2 btn btn-lg btn-outline-light\">Minute\n"
-  "                    Colour</button>\n"
-  "            </div>\n"
-  "\n"
-  "            <script>\n"
-  "                clockHourDebunce = Date.now()\n"
-  "                clockMinDebunce = Date.now()\n"
-  "                var currentHourRed = 0\n"
-  "                var currentHourGreen = 0\n"
-  "                var currentHourBlue = 0\n"
-  "                var currentMinRed = 0\n"
-  "                var currentMinGreen = 0\n"
-  "                var currentMinBlue = 0\n"
-  "\n"
-  "                var clockHourColourButton = $('#clockHourColourButton').colorPicker({\n"
-  "                    customBG: '#222',\n"
-  "                    margin: '4px -2px 0',\n"
-  "                    doRender: 'div div',\n"
-  "                    preventFocus: true,\n"
-  "                    animationSpeed: 150,\n"
-  "                    forceAlpha: false,\n"
-  "\n"
-  "                    // demo on how to make plugins... mobile support plugin\n"
-  "                    buildCallback: function ($elm) {\n"
-  "                        this.$colorPatch = $elm.prepend('<div class=\"cp-disp\">').find('.cp-disp');\n"
-  "                    },\n"
-  "                    cssAddon:\n"
-  "                        '.cp-disp {padding:10px; margin-bottom:6px; font-size:19px; height:20px; line-height:20px}' +\n"
-  "                        '.cp-xy-slider {width:200px; height:200px;}' +\n"
-  "                        '.cp-xy-cursor {width:16px; height:16px; border-width:2px; margin:-8px}' +\n"
-  "                        '.cp-z-slider {height:200px; width:40px;}' +\n"
-  "                        '.cp-z-cursor {border-width:8px; margin-top:-8px;}' +\n"
-  "                        '.cp-alpha {height:40px;}' +\n"
-  "                        '.cp-alpha-cursor {border-width:8px; margin-left:-8px;}',\n"
-  "\n"
-  "                    renderCallback: function ($elm, toggled) {\n"
-  "                        var colors = this.color.colors;\n"
-  "                        onHourPickerEvent(Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255))\n"
-  "                        setPickerColor(clockHourColourButton, Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255))\n"
-  "                    }\n"
-  "                })\n"
-  "                var clockMinuteColourButton = $('#clockMinuteColourButton').colorPicker({\n"
-  "                    customBG: '#222',\n"
-  "                    margin: '4px -2px 0',\n"
-  "                    doRender: 'div div',\n"
-  "                    preventFocus: true,\n"
-  "                    animationSpeed: 150,\n"
-  "                    forceAlpha: false,\n"
-  "\n"
-  "                    // demo on how to make plugins... mobile support plugin\n"
-  "                    buildCallback: function ($elm) {\n"
-  "                        this.$colorPatch = $elm.prepend('<div class=\"cp-disp\">').find('.cp-disp');\n"
-  "                    },\n"
-  "                    cssAddon:\n"
-  "                        '.cp-disp {padding:10px; margin-bottom:6px; font-size:19px; height:20px; line-height:20px}' +\n"
-  "                        '.cp-xy-slider {width:200px; height:200px;}' +\n"
-  "                        '.cp-xy-cursor {width:16px; height:16px; border-width:2px; margin:-8px}' +\n"
-  "                        '.cp-z-slider {height:200px; width:40px;}' +\n"
-  "                        '.cp-z-cursor {border-width:8px; margin-top:-8px;}' +\n"
-  "                        '.cp-alpha {height:40px;}' +\n"
-  "                        '.cp-alpha-cursor {border-width:8px; margin-left:-8px;}',\n"
-  "\n"
-  "                    renderCallback: function ($elm, toggled) {\n"
-  "                        var colors = this.color.colors;\n"
-  "                        onMinPickerEvent(Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255))\n"
-  "                        setPickerColor(clockMinuteColourButton, Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255))\n"
-  "                    }\n"
-  "                })\n"
-  "\n"
-  "                $(function () {\n"
-  "                    clockTick()\n"
-  "                });\n"
-  "\n"
-  "                function clockTick() {\n"
-  "                    let today = new Date();\n"
-  "                    let h = (today.getHours() % 12 < 10) ? \"0\" + today.getHours() % 12 : today.getHours() % 12\n"
-  "                    let m = (today.getMinutes() < 10) ? \"0\" + today.getMinutes() : today.getMinutes()\n"
-  "                    let s = (today.getSeconds() < 10) ? \"0\" + today.getSeconds() : today.getSeconds()\n"
-  "                    let ampm = (today.getHours() >= 12) ? 'PM' : 'AM';\n"
-  "                    h = (today.getHours() != 0) ? h : \"12\";\n"
-  "\n"
-  "                    var t = setTimeout(clockTick, 1000);\n"
-  "                    $(\"#clockPrintOut\").html(h + \":\" + m + \":\" + s + \" \" + ampm)\n"
-  "                }\n"
-  "\n"
-  "                function onHourPickerEvent(red, green, blue) {\n"
-  "                    if (currentHourRed != red || currentHourGreen != green || currentHourBlue != blue) {\n"
-  "                        currentHourRed = red\n"
-  "                        currentHourGreen = green\n"
-  "                        currentHourBlue = blue\n"
-  "\n"
-  "                        msg = {\n"
-  "                            \"State\": true,\n"
-  "                            \"Mode\": \"Clock\",\n"
-  "                            \"Clock\": {\n"
-  "                                \"hourColour\": {\n"
-  "                                    \"Red\": red,\n"
-  "                                    \"Green\": green,\n"
-  "                                    \"Blue\": blue\n"
-  "                                }\n"
-  "                            }\n"
-  "                        }\n"
-  "\n"
-  "                        if (Date.now() - clockHourDebunce > 50) {\n"
-  "                            clockHourDebunce = Date.now()\n"
-  "                            sendMessage(msg)\n"
-  "                        }\n"
-  "                    }\n"
-  "                }\n"
-  "\n"
-  "                function onMinPickerEvent(red, green, blue) {\n"
-  "                    if (currentMinRed != red || currentMinGreen != green || currentMinBlue != blue) {\n"
-  "                        currentMinRed = red\n"
-  "                        currentMinGreen = green\n"
-  "                        currentMinBlue = blue\n"
-  "\n"
-  "                        msg = {\n"
-  "                            \"State\": true,\n"
-  "                            \"Mode\": \"Clock\",\n"
-  "                            \"Clock\": {\n"
-  "                                \"minColour\": {\n"
-  "                                    \"Red\": red,\n"
-  "                                    \"Green\": green,\n"
-  "                                    \"Blue\": blue\n"
-  "                                }\n"
-  "                            }\n"
-  "                        }\n"
-  "\n"
-  "                        if (Date.now() - clockMinDebunce > 50) {\n"
-  "                            clockMinDebunce = Date.now()\n"
-  "                            sendMessage(msg)\n"
-  "                        }\n"
-  "                    }\n"
-  "                }\n"
-  "            </script>\n"
-  "\n"
-  "        </div>\n"
-  "        <div id=\"BellCurve\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Bell Curve Mode</h2>\n"
-  "            <p>In this mode the lamp will shape the light into a bell curve. This is meant to be more asthetically\n"
-  "                pleasing than the regular colour mode.</p>\n"
-  "            <div class=\"row my-3\">\n"
-  "                <input id=\"bellCurveSelectButton\" class=\"color col mb-2 mx-2 btn btn-lg btn-outline-light\" value=\"rgb(0,0,0)\">\n"
-  "            </div>\n"
-  "            <script>\n"
-  "                bellCurveDebunce = Date.now()\n"
-  "                var bellRed = 0\n"
-  "                var bellGreen = 0\n"
-  "                var bellBlue = 0\n"
-  "\n"
-  "                var bellCurveSelectButton = $('#bellCurveSelectButton').colorPicker({\n"
-  "                    customBG: '#222',\n"
-  "                    margin: '4px -2px 0',\n"
-  "                    doRender: 'div div',\n"
-  "                    preventFocus: true,\n"
-  "                    animationSpeed: 150,\n"
-  "                    forceAlpha: false,\n"
-  "\n"
-  "                    // demo on how to make plugins... mobile support plugin\n"
-  "                    buildCallback: function ($elm) {\n"
-  "                        this.$colorPatch = $elm.prepend('<div class=\"cp-disp\">').find('.cp-disp');\n"
-  "                    },\n"
-  "                    cssAddon:\n"
-  "                        '.cp-disp {padding:10px; margin-bottom:6px; font-size:19px; height:20px; line-height:20px}' +\n"
-  "                        '.cp-xy-slider {width:200px; height:200px;}' +\n"
-  "                        '.cp-xy-cursor {width:16px; height:16px; border-width:2px; margin:-8px}' +\n"
-  "                        '.cp-z-slider {height:200px; width:40px;}' +\n"
-  "                        '.cp-z-cursor {border-width:8px; margin-top:-8px;}' +\n"
-  "                        '.cp-alpha {height:40px;}' +\n"
-  "                        '.cp-alpha-cursor {border-width:8px; margin-left:-8px;}',\n"
-  "\n"
-  "                    renderCallback: function ($elm, toggled) {\n"
-  "                        var colors = this.color.colors;\n"
-  "                        onOnBellCurvePickerEvent(Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255))\n"
-  "                        setPickerColor(bellCurveSelectButton, Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255))\n"
-  "                    }\n"
-  "                })\n"
-  "\n"
-  "                function onOnBellCurvePickerEvent(red, green, blue) {\n"
-  "                    if (bellRed != red || bellGreen != green || bellBlue != blue) {\n"
-  "                        msg = {\n"
-  "                            \"State\": true,\n"
-  "                            \"Mode\": \"Bell Curve\",\n"
-  "                            \"Bell Curve\": {\n"
-  "                                \"Red\": red,\n"
-  "                                \"Green\": green,\n"
-  "                                \"Blue\": blue\n"
-  "                            }\n"
-  "                        }\n"
-  "\n"
-  "                        if (Date.now() - bellCurveDebunce > 50) {\n"
-  "                            bellCurveDebunce = Date.now()\n"
-  "                            sendMessage(msg)\n"
-  "                        }\n"
-  "                    }\n"
-  "                }\n"
-  "\n"
-  "            </script>\n"
-  "        </div>\n"
-  "        <div id=\"Circle\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Circle Mode</h2>\n"
-  "            <p>A simple dot moving round the lamp.\n"
-  "        </div>\n"
-  "        <div id=\"NightRider\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Night Rider Mode</h2>\n"
-  "            <p>Knight Rider. A shadowy flight into the dangerous world of a man who does not exist.\n"
-  "                Michael Knight: a young loner on a crusade to champion the cause of the innocent,\n"
-  "                the helpless, the powerless, in a world of criminals who operate above the law.</p>\n"
-  "        </div>\n"
-  "        <div id=\"Sparkle\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Sparkle Mode</h2>\n"
-  "            <p>This is the Sparkle mode..</p>\n"
-  "            <!--\n"
-  "            <div>\n"
-  "                <label for=\"sparkleSpeed\"><b>Sparkle Speed</b>: <span id=\"sparkleSpeedLabel\">30</span> milliseconds</label>\n"
-  "                <input id=\"sparkleSpeed\" type=\"range\" min=\"10\" max=\"255\" step=\"5\" value=\"30\"\n"
-  "                    class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            -->\n"
-  "            <div class=\"row my-3\">\n"
-  "                <input id=\"sparkleSelectButton\" class=\"color col mb-2 mx-2 btn btn-lg btn-outline-light\" value=\"rgb(0,0,0)\"></input>\n"
-  "            </div>\n"
-  "            <script>\n"
-  "                var sparkleLastMessage = \"\"\n"
-  "                $(\"#sparkleSpeed\").on(\"input\", function () {\n"
-  "                    onSparkleEvent()\n"
-  "                });\n"
-  "                $(\"#sparkleSpeed\").on(\"change\", function () {\n"
-  "                    onSparkleEvent()\n"
-  "                });\n"
-  "                var sparkleRed = 0;\n"
-  "                var sparkleGreen = 0;\n"
-  "                var sparkleBlue = 0;\n"
-  "                var sparkleDebunce = Date.now()\n"
-  "\n"
-  "                var sparkleSelectButton = $('#sparkleSelectButton').colorPicker({\n"
-  "                    customBG: '#222',\n"
-  "                    margin: '4px -2px 0',\n"
-  "                    doRender: 'div div',\n"
-  "                    preventFocus: true,\n"
-  "                    animationSpeed: 150,\n"
-  "                    forceAlpha: false,\n"
-  "\n"
-  "                    // demo on how to make plugins... mobile support plugin\n"
-  "                    buildCallback: function ($elm) {\n"
-  "                        this.$colorPatch = $elm.prepend('<div class=\"cp-disp\">').find('.cp-disp');\n"
-  "                    },\n"
-  "                    cssAddon:\n"
-  "                        '.cp-xy-slider {width:200px; height:200px;}' +\n"
-  "                        '.cp-xy-cursor {width:16px; height:16px; border-width:2px; margin:-8px}' +\n"
-  "                        '.cp-z-slider {height:200px; width:40px;}' +\n"
-  "                        '.cp-z-cursor {border-width:8px; margin-top:-8px;}' +\n"
-  "                        '.cp-alpha {height:40px;}' +\n"
-  "                        '.cp-alpha-cursor {border-width:8px; margin-left:-8px;}',\n"
-  "\n"
-  "                    renderCallback: function ($elm, toggled) {\n"
-  "                        var colors = this.color.colors;\n"
-  "                        onSparkleButtonEvent(Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255))\n"
-  "                        setPickerColor(sparkleSelectButton, Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255))\n"
-  "                    }\n"
-  "                })\n"
-  "\n"
-  "                function onSparkleEvent() {\n"
-  "                    let currentSpeedValue = parseFloat($(\"#sparkleSpeed\").val())\n"
-  "\n"
-  "                    $(\"#sparkleSpeedLabel\").html(currentSpeedValue)\n"
-  "\n"
-  "                    msg = {\n"
-  "                        \"State\": true,\n"
-  "                        \"Mode\": \"Sparkle\",\n"
-  "                        \"Sparkle\": {\n"
-  "                            \"Speed\": currentSpeedValue,\n"
-  "                        }\n"
-  "                    }\n"
-  "\n"
-  "                    if (msg != sparkleLastMessage && Date.now() - sparkleDebunce > 50) {\n"
-  "                        sparkleDebunce = Date.now()\n"
-  "                        sparkleLastMessage = msg\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "\n"
-  "                function onSparkleButtonEvent(red, green, blue) {\n"
-  "                    if (currentRed != red || currentGreen != green || currentBlue != blue) {\n"
-  "                        currentRed = red\n"
-  "                        currentGreen = green\n"
-  "                        currentBlue = blue\n"
-  "\n"
-  "                        msg = {\n"
-  "                            \"State\": true,\n"
-  "                            \"Mode\": \"Sparkle\",\n"
-  "                            \"Sparkle\": {\n"
-  "                                \"Red\": red,\n"
-  "                                \"Green\": green,\n"
-  "                                \"Blue\": blue\n"
-  "                            }\n"
-  "                        }\n"
-  "                        if (Date.now() - sparkleDebunce > 50) {\n"
-  "                            sparkleDebunce = Date.now()\n"
-  "                            sendMessage(msg)\n"
-  "                        }\n"
-  "                    }\n"
-  "                    if (msg != sparkleLastMessage && Date.now() - sparkleDebunce > 50) {\n"
-  "                        sparkleDebunce = Date.now()\n"
-  "                        sparkleLastMessage = msg\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "\n"
-  "            </Script>\n"
-  "        </div>\n"
-  "        <div id=\"ColorWipe\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Color Wipe Mode</h2>\n"
-  "            <p>Color Wipe will fill the light with a color in a wiping fashion then wipe the light away.</p>\n"
-  "            <div class=\"row my-3\">\n"
-  "                <input id=\"colorWipeSelectButton\" class=\"color col mb-2 mx-2 btn btn-lg btn-outline-light\" value=\"rgb(0,0,0)\"></input>\n"
-  "            </div>\n"
-  "            <script>\n"
-  "                var colorWipeLastMessage = \"\"\n"
-  "                var colorWipeRed = 0\n"
-  "                var colorWipeGreen = 0\n"
-  "                var colorWipeBlue = 0\n"
-  "                var colorWipeDebunce = Date.now()\n"
-  "\n"
-  "                var colorWipeSelectButton = $('#colorWipeSelectButton').colorPicker({\n"
-  "                    customBG: '#222',\n"
-  "                    margin: '4px -2px 0',\n"
-  "                    doRender: 'div div',\n"
-  "                    preventFocus: true,\n"
-  "                    animationSpeed: 150,\n"
-  "                    forceAlpha: false,\n"
-  "\n"
-  "                    // demo on how to make plugins... mobile support plugin\n"
-  "                    buildCallback: function ($elm) {\n"
-  "                        this.$colorPatch = $elm.prepend('<div class=\"cp-disp\">').find('.cp-disp');\n"
-  "                    },\n"
-  "                    cssAddon:\n"
-  "                        '.cp-disp {padding:10px; margin-bottom:6px; font-size:19px; height:20px; line-height:20px}' +\n"
-  "                        '.cp-xy-slider {width:200px; height:200px;}' +\n"
-  "                        '.cp-xy-cursor {width:16px; height:16px; border-width:2px; margin:-8px}' +\n"
-  "                        '.cp-z-slider {height:200px; width:40px;}' +\n"
-  "                        '.cp-z-cursor {border-width:8px; margin-top:-8px;}' +\n"
-  "                        '.cp-alpha {height:40px;}' +\n"
-  "                        '.cp-alpha-cursor {border-width:8px; margin-left:-8px;}',\n"
-  "\n"
-  "                    renderCallback: function ($elm, toggled) {\n"
-  "                        var colors = this.color.colors;\n"
-  "                        onColorWipeButtonEvent(Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255))\n"
-  "\n"
-  "                        setPickerColor(colorWipeSelectButton, Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255))\n"
-  "                    }\n"
-  "                })\n"
-  "\n"
-  "                function onColorWipeButtonEvent(red, green, blue) {\n"
-  "                    if (currentRed != red || currentGreen != green || currentBlue != blue) {\n"
-  "                        currentRed = red\n"
-  "                        currentGreen = green\n"
-  "                        currentBlue = blue\n"
-  "\n"
-  "                        msg = {\n"
-  "                            \"State\": true,\n"
-  "                            \"Mode\": \"Color Wipe\",\n"
-  "                            \"Color Wipe\": {\n"
-  "                                \"Red\": red,\n"
-  "                                \"Green\": green,\n"
-  "                                \"Blue\": blue\n"
-  "                            }\n"
-  "                        }\n"
-  "\n"
-  "                        if (Date.now() - colorWipeDebunce > 50) {\n"
-  "                            colorWipeDebunce = Date.now()\n"
-  "                            sendMessage(msg)\n"
-  "                        }\n"
-  "                        if (msg != colorWipeLastMessage && Date.now() - colorWipeDebunce > 50) {\n"
-  "                            colorWipeDebunce = Date.now()\n"
-  "                            colorWipeLastMessage = msg\n"
-  "                            sendMessage(msg)\n"
-  "                        }\n"
-  "                    }\n"
-  "                }\n"
-  "\n"
-  "            </script>\n"
-  "        </div>\n"
-  "        <div id=\"Confetti\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Confetti Mode</h2>\n"
-  "            <p>Confetti will flash random colors to emulate confetti.</p>\n"
-  "            <!--\n"
-  "            <div>\n"
-  "                <label for=\"confettiSpeed\"><b>Confetti Speed</b>: <span id=\"confettiSpeedLabel\">30</span> milliseconds</label>\n"
-  "                <input id=\"confettiSpeed\" type=\"range\" min=\"10\" max=\"255\" step=\"5\" value=\"30\"\n"
-  "                    class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            -->\n"
-  "            <script>\n"
-  "                var confettiLastMessage = \"\"\n"
-  "                var confettiRed = 0;\n"
-  "                var confettiGreen = 0;\n"
-  "                var confettiBlue = 0;\n"
-  "                var confettiSpeed = 30;\n"
-  "                var confettiDebunce = Date.now()\n"
-  "\n"
-  "                var confettiSelectButton = $('#confettiSelectButton').colorPicker({\n"
-  "                    customBG: '#222',\n"
-  "                    margin: '4px -2px 0',\n"
-  "                    doRender: 'div div',\n"
-  "                    preventFocus: true,\n"
-  "                    animationSpeed: 150,\n"
-  "                    forceAlpha: false,\n"
-  "\n"
-  "                    // demo on how to make plugins... mobile support plugin\n"
-  "                    buildCallback: function ($elm) {\n"
-  "                        this.$colorPatch = $elm.prepend('<div class=\"cp-disp\">').find('.cp-disp');\n"
-  "                    },\n"
-  "                    cssAddon:\n"
-  "                        '.cp-xy-slider {width:200px; height:200px;}' +\n"
-  "                        '.cp-xy-cursor {width:16px; height:16px; border-width:2px; margin:-8px}' +\n"
-  "                        '.cp-z-slider {height:200px; width:40px;}' +\n"
-  "                        '.cp-z-cursor {border-width:8px; margin-top:-8px;}' +\n"
-  "                        '.cp-alpha {height:40px;}' +\n"
-  "                        '.cp-alpha-cursor {border-width:8px; margin-left:-8px;}',\n"
-  "\n"
-  "                    renderCallback: function ($elm, toggled) {\n"
-  "                        var colors = this.color.colors;\n"
-  "                        onConfettiButtonEvent(Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255))\n"
-  "                        setPickerColor(confettiSelectButton, Math.round(colors.rgb.r * 255), Math.round(colors.rgb.g * 255), Math.round(colors.rgb.b * 255))\n"
-  "                    }\n"
-  "                })\n"
-  "\n"
-  "                $(\"#confettiSpeed\").on(\"input\", function () {\n"
-  "                    onConfettiEvent()\n"
-  "                });\n"
-  "                $(\"#confettiSpeed\").on(\"change\", function () {\n"
-  "                    onConfettiEvent()\n"
-  "                });\n"
-  "\n"
-  "                function onConfettiEvent() {\n"
-  "                    let currentSpeedValue = parseFloat($(\"#confettiSpeed\").val())\n"
-  "\n"
-  "                    $(\"#confettiSpeedLabel\").html(currentSpeedValue)\n"
-  "\n"
-  "                    msg = {\n"
-  "                        \"State\": true,\n"
-  "                        \"Mode\": \"Confetti\",\n"
-  "                        \"Confetti\": {\n"
-  "                            \"Speed\": currentSpeedValue,\n"
-  "                        }\n"
-  "                    }\n"
-  "\n"
-  "                    if (msg != confettiLastMessage && Date.now() - confettiDebunce > 50) {\n"
-  "                        confettiDebunce = Date.now()\n"
-  "                        confettiLastMessage = msg\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "\n"
-  "                function onConfettiButtonEvent(red, green, blue) {\n"
-  "                    if (currentRed != red || currentGreen != green || currentBlue != blue) {\n"
-  "                        currentRed = red\n"
-  "                        currentGreen = green\n"
-  "                        currentBlue = blue\n"
-  "\n"
-  "                        msg = {\n"
-  "                            \"State\": true,\n"
-  "                            \"Mode\": \"Confetti\",\n"
-  "                            \"Confetti\": {\n"
-  "                                \"Red\": red,\n"
-  "                                \"Green\": green,\n"
-  "                                \"Blue\": blue\n"
-  "                            }\n"
-  "                        }\n"
-  "                        if (Date.now() - confettiDebunce > 50) {\n"
-  "                            confettiDebunce = Date.now()\n"
-  "                            sendMessage(msg)\n"
-  "                        }\n"
-  "                    }\n"
-  "                    if (msg != confettiLastMessage && Date.now() - confettiDebunce > 50) {\n"
-  "                        confettiDebunce = Date.now()\n"
-  "                        confettiLastMessage = msg\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "            </Script>\n"
-  "        </div>\n"
-  "        <div id=\"Fireflies\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Fireflies Mode</h2>\n"
-  "            <p class=\"text-center\">\n"
-  "                Here come real stars to fill the upper skies,<br />\n"
-  "                And here on earth come emulating flies,<br />\n"
-  "                That though they never equal stars in size,<br />\n"
-  "                (And they were never really stars at heart)<br />\n"
-  "                Achieve at times a very star-like start.<br />\n"
-  "                Only, of course, they can't sustain the part.<br />\n"
-  "                -- Robert Frost, \"Fireflies in the Garden\"\n"
-  "            </p>\n"
-  "            <div>\n"
-  "                <label for=\"firefliesHue\">Hue: <span id=\"firefliesHueLabel\">0</span> Degrees</label>\n"
-  "                <input id=\"firefliesHue\" type=\"range\" min=\"0\" max=\"359\" step=\"1\" value=\"0\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <div>\n"
-  "                <label for=\"firefliesBrightness\">Brightness: <span id=\"firefliesBrightnessLabel\">100</span>%</label>\n"
-  "                <input id=\"firefliesBrightness\" type=\"range\" min=\"0\" max=\"100\" step=\"1\" value=\"100\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <div>\n"
-  "                <label for=\"firefliesMinimumFlashDelay\">Minimum Flash Delay: <span id=\"firefliesMinimumFlashDelayLabel\">1000</span> milliseconds</label>\n"
-  "                <input id=\"firefliesMinimumFlashDelay\" type=\"range\" min=\"100\" max=\"30000\" step=\"100\" value=\"1000\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <div>\n"
-  "                <label for=\"firefliesMaximumFlashDelay\">Maximum Flash Delay: <span id=\"firefliesMaximumFlashDelayLabel\">5000</span> milliseconds</label>\n"
-  "                <input id=\"firefliesMaximumFlashDelay\" type=\"range\" min=\"100\" max=\"30000\" step=\"100\" value=\"5000\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <div>\n"
-  "                <label for=\"firefliesFlashLength\">Flash Length: <span id=\"firefliesFlashLengthLabel\">500</span> milliseconds</label>\n"
-  "                <input id=\"firefliesFlashLength\" type=\"range\" min=\"50\" max=\"15000\" step=\"50\" value=\"500\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <script>\n"
-  "                var firefliesDebunce = Date.now()\n"
-  "\n"
-  "                $(\"#firefliesHue\").on(\"input\", function () {\n"
-  "                    onfirefliesEvent()\n"
-  "                });\n"
-  "                $(\"#firefliesHue\").on(\"change\", function () {\n"
-  "                    onfirefliesEvent()\n"
-  "                });\n"
-  "                $(\"#firefliesBrightness\").on(\"input\", function () {\n"
-  "                    onfirefliesEvent()\n"
-  "                });\n"
-  "                $(\"#firefliesBrightness\").on(\"change\", function () {\n"
-  "                    onfirefliesEvent()\n"
-  "                });\n"
-  "                $(\"#firefliesMinimumFlashDelay\").on(\"input\", function () {\n"
-  "                    onfirefliesEvent()\n"
-  "                });\n"
-  "                $(\"#firefliesMinimumFlashDelay\").on(\"change\", function () {\n"
-  "                    onfirefliesEvent()\n"
-  "                });\n"
-  "                $(\"#firefliesMaximumFlashDelay\").on(\"input\", function () {\n"
-  "                    onfirefliesEvent()\n"
-  "                });\n"
-  "                $(\"#firefliesMaximumFlashDelay\").on(\"change\", function () {\n"
-  "                    onfirefliesEvent()\n"
-  "                });\n"
-  "                $(\"#firefliesFlashLength\").on(\"input\", function () {\n"
-  "                    onfirefliesEvent()\n"
-  "                });\n"
-  "                $(\"#firefliesFlashLength\").on(\"change\", function () {\n"
-  "                    onfirefliesEvent()\n"
-  "                });\n"
-  "                function onfirefliesEvent() {\n"
-  "                    let currentHueValue = parseInt($(\"#firefliesHue\").val(), 10)\n"
-  "                    let currentBrightnessValue = parseInt($(\"#firefliesBrightness\").val(), 10)\n"
-  "                    let currentMinimumFlashDelay = parseInt($(\"#firefliesMinimumFlashDelay\").val(), 10)\n"
-  "                    let currentMaximumFlashDelay = parseInt($(\"#firefliesMaximumFlashDelay\").val(), 10)\n"
-  "                    let currentFlashLength = parseInt($(\"#firefliesFlashLength\").val(), 10)\n"
-  "\n"
-  "                    $(\"#firefliesHueLabel\").html(currentHueValue)\n"
-  "                    $(\"#firefliesBrightnessLabel\").html(currentBrightnessValue)\n"
-  "                    $(\"#firefliesMinimumFlashDelayLabel\").html(currentMinimumFlashDelay)\n"
-  "                    $(\"#firefliesMaximumFlashDelayLabel\").html(currentMaximumFlashDelay)\n"
-  "                    $(\"#firefliesFlashLengthLabel\").html(currentFlashLength)\n"
-  "\n"
-  "                    msg = {\n"
-  "                        \"State\": true,\n"
-  "                        \"Mode\": \"Fireflies\",\n"
-  "                        \"Fireflies\": {\n"
-  "                            \"Hue\": Math.round(currentHueValue / 359 * 255),\n"
-  "                            \"Brightness\": Math.round(currentBrightnessValue / 100 * 255),\n"
-  "                            \"MinimumFlashDelay\": currentMinimumFlashDelay,\n"
-  "                            \"MaximumFlashDelay\": currentMaximumFlashDelay,\n"
-  "                            \"FlashLength\": currentFlashLength\n"
-  "                        }\n"
-  "                    }\n"
-  "\n"
-  "                    if (Date.now() - firefliesDebunce > 50) {\n"
-  "                        firefliesDebunce = Date.now()\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "            </script>\n"
-  "        </div>\n"
-  "        <div id=\"SaturationFade\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Saturation Fade Mode</h2>\n"
-  "            <p>Fade between a color and white</p>\n"
-  "            <div>\n"
-  "                <label for=\"saturationFadeHue\">Hue: <span id=\"saturationFadeHueLabel\">0</span> Degrees</label>\n"
-  "                <input id=\"saturationFadeHue\" type=\"range\" min=\"0\" max=\"359\" step=\"1\" value=\"0\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <div>\n"
-  "                <label for=\"saturationFadeSpeed\">Fade Speed: <span id=\"saturationFadeSpeedLabel\">10</span> seconds</label>\n"
-  "                <input id=\"saturationFadeSpeed\" type=\"range\" min=\"0\" max=\"10\" step=\"1\" value=\"10\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <script>\n"
-  "                var saturationFadeDebunce = Date.now()\n"
-  "\n"
-  "                $(\"#saturationFadeHue\").on(\"input\", function () {\n"
-  "                    onSaturationFadeEvent()\n"
-  "                });\n"
-  "                $(\"#saturationFadeHue\").on(\"change\", function () {\n"
-  "                    onSaturationFadeEvent()\n"
-  "                });\n"
-  "                $(\"#saturationFadeSpeed\").on(\"input\", function () {\n"
-  "                    onSaturationFadeEvent()\n"
-  "                });\n"
-  "                $(\"#saturationFadeSpeed\").on(\"change\", function () {\n"
-  "                    onSaturationFadeEvent()\n"
-  "                });\n"
-  "                function onSaturationFadeEvent() {\n"
-  "                    let currentHueValue = parseInt($(\"#saturationFadeHue\").val(), 10)\n"
-  "                    let currentSpeedValue = parseInt($(\"#saturationFadeSpeed\").val(), 10)\n"
-  "\n"
-  "                    $(\"#saturationFadeHueLabel\").html(currentHueValue)\n"
-  "                    $(\"#saturationFadeSpeedLabel\").html(currentSpeedValue)\n"
-  "\n"
-  "                    msg = {\n"
-  "                        \"State\": true,\n"
-  "                        \"Mode\": \"Saturation Fade\",\n"
-  "                        \"Saturation Fade\": {\n"
-  "                            \"Hue\": Math.round(currentHueValue / 359 * 255),\n"
-  "                            \"Speed\": currentSpeedValue\n"
-  "                        }\n"
-  "                    }\n"
-  "\n"
-  "                    if (Date.now() - saturationFadeDebunce > 50) {\n"
-  "                        saturationFadeDebunce = Date.now()\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "            </script>\n"
-  "        </div>\n"
-  "        <div id=\"Visualiser\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Visualiser Mode</h2>\n"
-  "            <p> Here you can set the mode to Visualiser. This mode does an FFT on the ADC of the ESP8266 and maps the\n"
-  "                frequencies\n"
-  "                to the number of top and bottom LED's. To use this mode, an input source must be present on the ADC such\n"
-  "                as an amplified mic\n"
-  "                or an input from a music source such as a Chromecast.\n"
-  "            </p>\n"
-  "            <div>\n"
-  "                <label for=\"visualiserPeriod\"><b>Frequency Range</b>: <span id=\"visualiserPeriodLabel\">2000</span>Hz</label>\n"
-  "                <input id=\"visualiserPeriod\" type=\"range\" min=\"100\" max=\"2000\" step=\"50\" value=\"250\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <div>\n"
-  "                <label for=\"visualiserMinThreshold\"><b>Minimum Threshold</b>: <span id=\"visualiserMinThresholdLabel\">100</span></label>\n"
-  "                <input id=\"visualiserMinThreshold\" type=\"range\" min=\"0\" max=\"300\" step=\"10\" value=\"100\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <div>\n"
-  "                <label for=\"visualiserMaxThreshold\"><b>Maximum Threshold</b>: <span id=\"visualiserMaxThresholdLabel\">750</span></label>\n"
-  "                <input id=\"visualiserMaxThreshold\" type=\"range\" min=\"400\" max=\"3000\" step=\"50\" value=\"750\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <div>\n"
-  "                <label for=\"visualiserFadeUp\"><b>Fade Up Delay</b>: <span id=\"visualiserFadeUpLabel\">32</span></label>\n"
-  "                <input id=\"visualiserFadeUp\" type=\"range\" min=\"0\" max=\"255\" step=\"1\" value=\"32\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <div>\n"
-  "                <label for=\"visualiserFadeDown\"><b>Fade Down Delay</b>: <span id=\"visualiserFadeDownLabel\">32</span></label>\n"
-  "                <input id=\"visualiserFadeDown\" type=\"range\" min=\"0\" max=\"255\" step=\"1\" value=\"32\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <div>\n"
-  "                <label for=\"visualiserHueOffset\"><b>Hue Offset</b>: <span id=\"visualiserHueOffsetLabel\">170</span></label>\n"
-  "                <input id=\"visualiserHueOffset\" type=\"range\" min=\"0\" max=\"359\" step=\"1\" value=\"170\" class=\"form-control-range custom-range\">\n"
-  "            </div>\n"
-  "            <h6 class=\"pt-4\">Variable Description</h6>\n"
-  "            <ul>\n"
-  "                <li><b>Frequency Range</b> - The displayed frequency spectrum from left to right starting from 0Hz</li>\n"
-  "                <li><b>Minimum Threshold</b> - The minimum value of the FFT calculations to map to the zero brightness\n"
-  "                    of the LED's, useful to remove noise</li>\n"
-  "                <li><b>Maximum Threshold</b> - The maximum ceiling value value of the FFT to map to max brightness of\n"
-  "                    the LED's</li>\n"
-  "                <li><b>Fade Up Delay</b> - A multiplier to control the speed of animation when setting the light to new\n"
-  "                    brightness</li>\n"
-  "                <li><b>Fade Down Delay</b> - A multiplier to control how fast the LED's fade out when no new brightness\n"
-  "                    has been set</li>\n"
-  "                <li><b>Hue Offset</b> - The offset hue value from 0 for the start of the rainbow</li>\n"
-  "            </ul>\n"
-  "\n"
-  "            <script>\n"
-  "                var visualiserDebunce = Date.now()\n"
-  "                var lastVisualiserMessaeg = \"\"\n"
-  "\n"
-  "                $(\"#visualiserPeriod\").on(\"input\", function () {\n"
-  "                    onVisualiserEvent()\n"
-  "                });\n"
-  "                $(\"#visualiserPeriod\").on(\"change\", function () {\n"
-  "                    onVisualiserEvent()\n"
-  "                });\n"
-  "                $(\"#visualiserMinThreshold\").on(\"input\", function () {\n"
-  "                    onVisualiserEvent()\n"
-  "                });\n"
-  "                $(\"#visualiserMinThreshold\").on(\"change\", function () {\n"
-  "                    onVisualiserEvent()\n"
-  "                });\n"
-  "                $(\"#visualiserMaxThreshold\").on(\"input\", function () {\n"
-  "                    onVisualiserEvent()\n"
-  "                });\n"
-  "                $(\"#visualiserMaxThreshold\").on(\"change\", function () {\n"
-  "                    onVisualiserEvent()\n"
-  "                });\n"
-  "                $(\"#visualiserFadeUp\").on(\"input\", function () {\n"
-  "                    onVisualiserEvent()\n"
-  "                });\n"
-  "                $(\"#visualiserFadeUp\").on(\"change\", function () {\n"
-  "                    onVisualiserEvent()\n"
-  "                });\n"
-  "                $(\"#visualiserFadeDown\").on(\"input\", function () {\n"
-  "                    onVisualiserEvent()\n"
-  "                });\n"
-  "                $(\"#visualiserFadeDown\").on(\"change\", function () {\n"
-  "                    onVisualiserEvent()\n"
-  "                });\n"
-  "                $(\"#visualiserHueOffset\").on(\"input\", function () {\n"
-  "                    onVisualiserEvent()\n"
-  "                });\n"
-  "                $(\"#visualiserHueOffset\").on(\"change\", function () {\n"
-  "                    onVisualiserEvent()\n"
-  "                });\n"
-  "\n"
-  "                function onVisualiserEvent() {\n"
-  "                    let currentPeriod = parseInt($(\"#visualiserPeriod\").val(), 10)\n"
-  "                    let currentMinThreshold = parseInt($(\"#visualiserMinThreshold\").val(), 10)\n"
-  "                    let currentMaxThreshold = parseInt($(\"#visualiserMaxThreshold\").val(), 10)\n"
-  "                    let currentFadeUp = parseInt($(\"#visualiserFadeUp\").val(), 10)\n"
-  "                    let currentFadeDown = parseInt($(\"#visualiserFadeDown\").val(), 10)\n"
-  "                    let currentHueOffset = parseInt($(\"#visualiserHueOffset\").val(), 10)\n"
-  "\n"
-  "                    $(\"#visualiserPeriodLabel\").html(Math.round(1000000 / currentPeriod / 2))\n"
-  "                    $(\"#visualiserMinThresholdLabel\").html(currentMinThreshold)\n"
-  "                    $(\"#visualiserMaxThresholdLabel\").html(currentMaxThreshold)\n"
-  "                    $(\"#visualiserFadeUpLabel\").html(currentFadeUp)\n"
-  "                    $(\"#visualiserFadeDownLabel\").html(currentFadeDown)\n"
-  "                    $(\"#visualiserHueOffsetLabel\").html(currentHueOffset)\n"
-  "\n"
-  "                    msg = {\n"
-  "                        \"State\": true,\n"
-  "                        \"Mode\": \"Visualiser\",\n"
-  "                        \"Visualiser\": {\n"
-  "                            \"Period\": currentPeriod,\n"
-  "                            \"MinThreshold\": currentMinThreshold,\n"
-  "                            \"MaxThreshold\": currentMaxThreshold,\n"
-  "                            \"FadeUp\": currentFadeUp,\n"
-  "                            \"FadeDown\": currentFadeDown,\n"
-  "                            \"HueOffset\": Math.round(currentHueOffset / 360 * 255)\n"
-  "                        }\n"
-  "                    }\n"
-  "\n"
-  "                    if (msg != lastVisualiserMessaeg && Date.now() - visualiserDebunce > 50) {\n"
-  "                        lastVisualiserMessaeg = msg\n"
-  "                        visualiserDebunce = Date.now()\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "            </script>\n"
-  "        </div>\n"
-  "        <div id=\"WfiConfig\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Wifi Configuration</h2>\n"
-  "            <p>This is the WiFi configuration page. Here you can choose the wifi access point to connect to or go back\n"
-  "                to access point mode. This will be remebered through reboot for you so you wont have to set this up\n"
-  "                every time. <b>Please allow a few seconds for this page to update the table.</b> </p>\n"
-  "            <div class=\"table-responsive\">\n"
-  "                <table class=\"table table-hover\">\n"
-  "                    <thead id=\"wifiTableHead\">\n"
-  "                        <tr>\n"
-  "                            <th>SSID</th>\n"
-  "                            <th>RSSI</th>\n"
-  "                            <th>BSSID</th>\n"
-  "                            <th>Channel</th>\n"
-  "                            <th>Encrypted</th>\n"
-  "                        </tr>\n"
-  "                    </thead>\n"
-  "                    <tbody id=\"wifiTableBody\">\n"
-  "                    </tbody>\n"
-  "                </table>\n"
-  "            </div>\n"
-  "\n"
-  "            <button id=\"rescanButton\" class=\"col mb-2 mx-2 btn btn-lg btn-outline-light\">Rescan</button>\n"
-  "\n"
-  "            <div id=\"wifiConfigForm\">\n"
-  "                <div class=\"form-group\">\n"
-  "                    <label for=\"SSIDInput\">SSID</label>\n"
-  "                    <input id=\"SSIDInput\" class=\"form-control\" placeholder=\"SSID\" type=\"text\">\n"
-  "                </div>\n"
-  "                <div class=\"form-group\">\n"
-  "                    <label for=\"PassInput\">Password</label>\n"
-  "                    <input id=\"PassInput\" class=\"form-control\" placeholder=\"Password\" type=\"text\">\n"
-  "                </div>\n"
-  "                <button id=\"wifiConfigSubmitButton\" type=\"submit\" class=\"btn btn-lg btn-outline-light\">Submit</button>\n"
-  "            </div>\n"
-  "\n"
-  "            <script>\n"
-  "                wifiDebounce = Date.now()\n"
-  "\n"
-  "                $(\"#rescanButton\").click(function () {\n"
-  "                    onRescanWifiEvent()\n"
-  "                });\n"
-  "                $(\"#wifiConfigSubmitButton\").click(function () {\n"
-  "                    onSubmitWifiEvent()\n"
-  "                });\n"
-  "\n"
-  "                function onRescanWifiEvent() {\n"
-  "                    msg = {\n"
-  "                        \"Wifi\": {\n"
-  "                            \"Rescan\": true\n"
-  "                        }\n"
-  "                    }\n"
-  "\n"
-  "                    if (Date.now() - wifiDebounce > 2000) {\n"
-  "                        wifiDebounce = Date.now()\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "\n"
-  "                function onSubmitWifiEvent() {\n"
-  "                    msg = {\n"
-  "                        \"Wifi\": {\n"
-  "                            \"SSID\": $(\"#SSIDInput\").val(),\n"
-  "                            \"Password\": $(\"#PassInput\").val()\n"
-  "                        }\n"
-  "                    }\n"
-  "\n"
-  "                    $(\"#SSIDInput\").val(\"\")\n"
-  "                    $(\"#PassInput\").val(\"\")\n"
-  "\n"
-  "                    if (Date.now() - wifiDebounce > 2000) {\n"
-  "                        wifiDebounce = Date.now()\n"
-  "                        sendMessage(msg)\n"
-  "                    }\n"
-  "                }\n"
-  "            </script>\n"
-  "    </div>\n"
-  "        <div id=\"LampInfo\" class=\"container pb-5 tab-pane fade\">\n"
-  "            <h2>Lamp information</h2>\n"
-  "            <p>This page gives you some information about the state and software of the current device</p>\n"
-  "            <div class=\"table-responsive\">\n"
-  "                <table class=\"table table-hover text-left\">\n"
-  "                    <tr>\n"
-  "                        <th>Sketch</th>\n"
-  "                        <td id=\"InfoSketch\"></td>\n"
-  "                    </tr>\n"
-  "                    <tr>\n"
-  "                        <th>Compile time</th>\n"
-  "                        <td id=\"InfoCompileTime\"></td>\n"
-  "                    </tr>\n"
-  "                    <tr>\n"
-  "                        <th>ESP Version</th>\n"
-  "                        <td id=\"InfoESPVersion\"></td>\n"
-  "                    </tr>\n"
-  "                    <tr>\n"
-  "                        <th>IDE Version</th>\n"
-  "                        <td id=\"InfoIDEVersion\"></td>\n"
-  "                    </tr>\n"
-  "                    <tr>\n"
-  "                        <th>FastLED VErsion</th>\n"
-  "                        <td id=\"InfoFastLEDVersion\"></td>\n"
-  "                    </tr>\n"
-  "                    <tr>\n"
-  "                        <th>Current time</th>\n"
-  "                        <td id=\"InfoTime\"></td>\n"
-  "                    </tr>\n"
-  "                </table>\n"
-  "            </div>\n"
-  "        </div>\n"
-  "    </div>\n"
-  "</body>\n"
-  "\n"
-  "</html>\n"
-;
+// Created by Website/update_website.py, do not edit
+// The website minified and gzipped, with the ETags of the files
+
+const char websitePageEtag[] = "\"3382edc662cef647\"";
+const uint8_t websitePage[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3d, 0xfd, 0x73, 0xdb, 0x36,
+  0xb2, 0xbf, 0xeb, 0xaf, 0x40, 0xd8, 0xbe, 0x5a, 0xba, 0x48, 0xb2, 0xec, 0xc4, 0x69, 0xeb, 0xc4,
+  0xea, 0x24, 0x76, 0x7c, 0xc9, 0x5d, 0xbe, 0xc6, 0xf6, 0x35, 0x73, 0x2f, 0x93, 0x77, 0x03, 0x89,
+  0x90, 0xc4, 0x86, 0x22, 0x75, 0x24, 0x65, 0x45, 0xed, 0xe5, 0x7f, 0x7f, 0xbb, 0x8b, 0x0f, 0x82,
+  0x24, 0x28, 0x8b, 0xb6, 0xd2, 0xce, 0xdd, 0xdc, 0xbb, 0xd7, 0x98, 0xc2, 0xc7, 0xee, 0x02, 0x58,
+  0x2c, 0x16, 0x8b, 0xc5, 0xe2, 0xc9, 0xbd, 0xb3, 0xb7, 0xa7, 0x57, 0x7f, 0x7f, 0xf7, 0x9c, 0xcd,
+  0xb2, 0x79, 0x38, 0x6c, 0x3d, 0xd1, 0x7f, 0x04, 0xf7, 0xe1, 0xcf, 0x5c, 0x64, 0x9c, 0x8d, 0x67,
+  0x3c, 0x49, 0x45, 0x76, 0xe2, 0x2d, 0xb3, 0x49, 0xef, 0x07, 0x4f, 0x27, 0x47, 0x7c, 0x2e, 0x4e,
+  0xbc, 0xeb, 0x40, 0xac, 0x16, 0x71, 0x92, 0x79, 0x6c, 0x1c, 0x47, 0x99, 0x88, 0xa0, 0xd8, 0x2a,
+  0xf0, 0xb3, 0xd9, 0x89, 0x2f, 0xae, 0x83, 0xb1, 0xe8, 0xd1, 0x8f, 0x2e, 0x0b, 0xa2, 0x20, 0x0b,
+  0x78, 0xd8, 0x4b, 0xc7, 0x3c, 0x14, 0x27, 0x07, 0x25, 0x20, 0x7c, 0xb1, 0x08, 0x45, 0x6f, 0x1e,
+  0x8f, 0x02, 0xf8, 0xb3, 0x12, 0xa3, 0x1e, 0x24, 0xf4, 0xc6, 0x7c, 0xc1, 0x47, 0xa1, 0xb0, 0x00,
+  0xaf, 0x45, 0x8a, 0x15, 0xc3, 0x20, 0xfa, 0xc4, 0x12, 0x11, 0x9e, 0x78, 0x69, 0xb6, 0x0e, 0x45,
+  0x3a, 0x13, 0x02, 0xd0, 0xcf, 0x12, 0x31, 0x39, 0xf1, 0x42, 0x3e, 0x5f, 0xf4, 0xc7, 0x69, 0xfa,
+  0xd3, 0xf5, 0xc9, 0xc1, 0x60, 0x70, 0xc4, 0x1f, 0x1d, 0x1d, 0xf1, 0x83, 0x83, 0xef, 0x27, 0x47,
+  0x3f, 0x3c, 0xc0, 0xaa, 0xe9, 0x38, 0x09, 0x16, 0x19, 0x4b, 0x93, 0xb1, 0x2a, 0xfa, 0x0b, 0x96,
+  0x9c, 0x4c, 0x1e, 0x8d, 0xbf, 0x7f, 0xf0, 0x68, 0xf4, 0xe3, 0x83, 0xc1, 0xd1, 0xe4, 0x7b, 0xc1,
+  0xbd, 0xe1, 0x93, 0x7d, 0x59, 0x12, 0xaa, 0x64, 0x41, 0x16, 0x8a, 0xe1, 0xab, 0x20, 0x0c, 0xd7,
+  0x7b, 0x29, 0x7b, 0x05, 0x95, 0x9e, 0xec, 0xcb, 0x34, 0x0d, 0x6e, 0xd8, 0xba, 0xe6, 0x09, 0x03,
+  0xb2, 0xd3, 0x78, 0xfc, 0xe9, 0x31, 0xfd, 0x48, 0x04, 0x10, 0x1d, 0x89, 0x71, 0x76, 0x15, 0xcc,
+  0x45, 0xf2, 0xb8, 0x35, 0x59, 0x46, 0xe3, 0x2c, 0x88, 0x23, 0x16, 0x47, 0x97, 0x19, 0x4f, 0xb2,
+  0x76, 0x87, 0xfd, 0xd6, 0xfa, 0xb6, 0xed, 0x7d, 0x33, 0x5e, 0x26, 0x09, 0xb4, 0xed, 0x75, 0xec,
+  0x8b, 0x57, 0x7c, 0x24, 0x42, 0xaf, 0xd3, 0xc7, 0x11, 0x68, 0x7b, 0xa7, 0xb2, 0x7e, 0x10, 0x4d,
+  0x59, 0x16, 0x33, 0xa2, 0xb5, 0xdf, 0xf7, 0x3a, 0x2d, 0x85, 0x86, 0x9d, 0xb0, 0x48, 0xac, 0xd8,
+  0x7b, 0x31, 0xba, 0x84, 0x5f, 0x22, 0x6b, 0xef, 0xad, 0xd2, 0xe3, 0xfd, 0xfd, 0x3d, 0x76, 0x9f,
+  0xad, 0x82, 0xc8, 0x8f, 0x57, 0xfd, 0x30, 0x1e, 0x73, 0x44, 0xd9, 0x9f, 0xc5, 0x69, 0x06, 0xc9,
+  0x7b, 0xfb, 0xab, 0x74, 0xaf, 0xf3, 0x58, 0x03, 0xe8, 0x8f, 0x82, 0x88, 0x27, 0xeb, 0xab, 0xf5,
+  0x42, 0x00, 0x2c, 0x8f, 0x27, 0x09, 0x5f, 0x8f, 0x96, 0x93, 0x89, 0x48, 0xbc, 0xbc, 0x4c, 0x1c,
+  0xc5, 0x0b, 0x11, 0x41, 0xbe, 0xa1, 0xbf, 0x2d, 0xae, 0x33, 0xa4, 0x1d, 0x9a, 0x97, 0xc6, 0xa1,
+  0x00, 0x2c, 0x53, 0x40, 0xad, 0x68, 0xc2, 0xc2, 0xc2, 0x47, 0x24, 0xc1, 0x84, 0xb5, 0x17, 0x89,
+  0x40, 0xe6, 0xb8, 0xe0, 0x99, 0x60, 0x43, 0x36, 0xe8, 0xb0, 0x54, 0x44, 0xfe, 0x6b, 0x91, 0xa6,
+  0x7c, 0x2a, 0xda, 0xbf, 0x31, 0xef, 0x9d, 0xcc, 0xf7, 0x8e, 0x99, 0x5d, 0xf2, 0x4b, 0xa7, 0xf5,
+  0xc5, 0xc2, 0x3f, 0x0e, 0xe3, 0x54, 0x6c, 0x4d, 0x00, 0x95, 0xf6, 0xfb, 0xec, 0x42, 0x77, 0x3f,
+  0x76, 0x5f, 0x10, 0xb1, 0x23, 0xc0, 0x0d, 0x29, 0x3e, 0x75, 0xc0, 0xc6, 0x6e, 0x7f, 0x85, 0x9d,
+  0xa5, 0x2b, 0x03, 0x3a, 0xd5, 0xf7, 0xf7, 0xd8, 0x55, 0xb2, 0x56, 0x63, 0x61, 0xc6, 0x16, 0x86,
+  0x43, 0xb6, 0xb4, 0x38, 0xda, 0x40, 0x1d, 0x10, 0x22, 0x78, 0x82, 0xbf, 0xe2, 0x65, 0x56, 0xce,
+  0x7e, 0xcc, 0xbe, 0xb4, 0x8a, 0x49, 0xd0, 0x3e, 0x98, 0x5f, 0xba, 0x78, 0xde, 0x54, 0x84, 0x64,
+  0x18, 0x06, 0xaa, 0x75, 0xd9, 0xd1, 0x60, 0x30, 0x00, 0xa4, 0x76, 0x0f, 0x89, 0x24, 0x89, 0x93,
+  0x9b, 0x7a, 0x08, 0x93, 0x8a, 0xd5, 0xe6, 0x72, 0x20, 0x5c, 0x15, 0xb1, 0x49, 0xf0, 0xd9, 0xf7,
+  0x39, 0x4c, 0xd0, 0x20, 0x4a, 0x33, 0x1e, 0x8d, 0x45, 0x3c, 0x61, 0x4f, 0x91, 0x47, 0x9e, 0x11,
+  0x8f, 0x60, 0xb1, 0x19, 0x8f, 0xfc, 0x50, 0x3c, 0x23, 0x36, 0xd2, 0xc3, 0x8a, 0x3c, 0x79, 0x06,
+  0xd5, 0x7e, 0x86, 0xe1, 0x34, 0x30, 0x3a, 0x1d, 0x68, 0x6f, 0xb6, 0x4c, 0x22, 0x20, 0xc0, 0x26,
+  0xca, 0x7b, 0x19, 0x8d, 0xe3, 0x39, 0xf6, 0xea, 0x19, 0x61, 0x4a, 0x8f, 0x99, 0x07, 0x8c, 0x6a,
+  0xaa, 0xb5, 0x12, 0xe8, 0x0e, 0xa1, 0x41, 0xe7, 0xc9, 0x5f, 0xe0, 0x7f, 0x38, 0xc9, 0x80, 0xb0,
+  0x4c, 0x5c, 0x8a, 0x7f, 0xe2, 0x5c, 0x58, 0x86, 0x61, 0x3e, 0xc9, 0x0a, 0xf5, 0x7e, 0x49, 0xb1,
+  0x0b, 0x13, 0x40, 0x83, 0x44, 0x87, 0x22, 0x63, 0x98, 0xf2, 0xda, 0x34, 0xff, 0x2f, 0x97, 0x6f,
+  0xdf, 0xf4, 0x17, 0x28, 0xe1, 0xec, 0xa2, 0x72, 0x60, 0x3d, 0x80, 0xee, 0x21, 0x03, 0x59, 0x55,
+  0x74, 0x0f, 0xdd, 0x6b, 0x7b, 0xe7, 0x80, 0xb5, 0x9a, 0xfd, 0xdd, 0x77, 0x39, 0x65, 0xf7, 0x4e,
+  0x24, 0x6d, 0x98, 0x68, 0x15, 0xea, 0xeb, 0x3c, 0x53, 0xf0, 0x3e, 0x3b, 0x40, 0xc0, 0xa5, 0x29,
+  0x72, 0x21, 0xd2, 0x75, 0x34, 0x86, 0x19, 0x92, 0x25, 0x4b, 0x35, 0x35, 0xac, 0x46, 0x97, 0x00,
+  0x42, 0x26, 0xd1, 0xfc, 0x8e, 0x27, 0x20, 0x54, 0x33, 0x91, 0xa4, 0x2e, 0xd2, 0xe5, 0xa8, 0xe5,
+  0x65, 0xec, 0x6e, 0xd2, 0xc0, 0xf2, 0xdc, 0x8e, 0x06, 0x8a, 0x33, 0xa5, 0x1e, 0x1c, 0xe6, 0xba,
+  0x00, 0x61, 0xba, 0x01, 0x71, 0x89, 0x94, 0xd7, 0xc3, 0xa0, 0x6c, 0x17, 0x10, 0xca, 0x30, 0x50,
+  0xde, 0x00, 0x65, 0xf5, 0x40, 0x30, 0xd7, 0x05, 0x03, 0xd3, 0x0d, 0x88, 0x73, 0xee, 0x0b, 0x86,
+  0xb3, 0xad, 0x1e, 0x0e, 0x16, 0xc1, 0x12, 0x0e, 0x58, 0x1f, 0xac, 0xfa, 0x1f, 0x0d, 0xcc, 0xd3,
+  0x38, 0x8c, 0x97, 0x49, 0x3d, 0x40, 0x99, 0xef, 0x22, 0x4d, 0xe6, 0xe4, 0x80, 0x40, 0x6e, 0x7f,
+  0xda, 0x00, 0x07, 0xb3, 0x9d, 0x60, 0x30, 0xc3, 0x40, 0x79, 0x26, 0x80, 0xe7, 0x4e, 0x97, 0xc9,
+  0xf5, 0x86, 0x36, 0x62, 0x19, 0x2a, 0xe2, 0x6c, 0xa4, 0x05, 0xc1, 0x6a, 0x65, 0x90, 0x8c, 0xc3,
+  0x0d, 0x20, 0x65, 0xbe, 0x13, 0x9e, 0xaa, 0x9a, 0xc3, 0xba, 0x84, 0x39, 0xf7, 0x69, 0x13, 0x30,
+  0x55, 0xc0, 0x09, 0x4d, 0x57, 0x2e, 0x0e, 0x40, 0xc2, 0xde, 0x07, 0x0b, 0xb1, 0x79, 0x10, 0x12,
+  0x2c, 0xe2, 0xa6, 0x30, 0x87, 0x60, 0x83, 0x8d, 0x26, 0x22, 0xcb, 0x82, 0x4d, 0x40, 0x65, 0x89,
+  0x1a, 0x98, 0xaa, 0x7a, 0x0e, 0xf1, 0x4d, 0x30, 0x9d, 0x65, 0xec, 0x22, 0xf0, 0xc5, 0x06, 0x76,
+  0xa1, 0x42, 0x54, 0xc6, 0x09, 0xd6, 0x86, 0x91, 0x43, 0x7e, 0x1f, 0x4c, 0x36, 0xd0, 0x89, 0xb9,
+  0x2e, 0xc6, 0xc1, 0xf4, 0x7c, 0x50, 0x50, 0xdc, 0xd4, 0x8f, 0x08, 0xe4, 0x3a, 0x67, 0x28, 0xa4,
+  0x5b, 0xac, 0xc7, 0xb3, 0x4d, 0x4c, 0xc7, 0x33, 0x17, 0x08, 0x4c, 0x37, 0x20, 0x5e, 0x46, 0x93,
+  0xb8, 0x1e, 0x04, 0xe6, 0xba, 0x40, 0x60, 0xba, 0x01, 0x01, 0xca, 0x05, 0x2c, 0xa9, 0x9b, 0x24,
+  0xa0, 0x2c, 0xe0, 0x14, 0x7f, 0x32, 0xcb, 0x86, 0x45, 0x8a, 0xca, 0x26, 0x58, 0x58, 0xa0, 0x06,
+  0x16, 0x66, 0x21, 0xac, 0x09, 0x70, 0x57, 0x1b, 0xd7, 0x9f, 0x39, 0x48, 0x45, 0x84, 0x85, 0x7f,
+  0x2d, 0x51, 0xab, 0xd6, 0x15, 0x9d, 0x5b, 0x2b, 0x68, 0xab, 0xb2, 0x1b, 0xab, 0x74, 0xed, 0x0a,
+  0x1f, 0x30, 0xe5, 0xa3, 0x5c, 0x29, 0xbf, 0xe4, 0xeb, 0xe2, 0x46, 0x61, 0xad, 0xf1, 0x67, 0xa0,
+  0x11, 0xc2, 0x62, 0x5f, 0x58, 0x24, 0x61, 0xa5, 0x02, 0x5d, 0x1b, 0x17, 0x46, 0xef, 0x26, 0xc5,
+  0xd5, 0x86, 0xe8, 0xc2, 0x5e, 0x27, 0xe6, 0x6f, 0x42, 0x3f, 0x8a, 0x41, 0x6d, 0xe0, 0x91, 0xa7,
+  0xcb, 0x95, 0xaa, 0x22, 0x49, 0xb4, 0x34, 0x3e, 0x5b, 0x66, 0x59, 0x0c, 0xc5, 0xfa, 0xd7, 0x1c,
+  0xd4, 0xb9, 0xb7, 0x6f, 0x40, 0x65, 0xae, 0xe6, 0x49, 0x5d, 0xef, 0x0a, 0x54, 0x12, 0xf6, 0xf6,
+  0xfc, 0xdc, 0x43, 0x42, 0x45, 0x08, 0x7a, 0x66, 0x3d, 0x1c, 0x2a, 0xb5, 0x19, 0xd0, 0x1b, 0xaf,
+  0xa6, 0xc3, 0xed, 0x45, 0x09, 0xf7, 0x3b, 0xa5, 0xa6, 0x62, 0x92, 0xa3, 0x8b, 0xfd, 0x78, 0xbc,
+  0x9c, 0x43, 0x0f, 0x77, 0xfa, 0x3c, 0xcb, 0x92, 0xb6, 0x47, 0x7b, 0x0e, 0xaf, 0x4b, 0xc5, 0x95,
+  0x16, 0xfb, 0x22, 0x9e, 0xe7, 0xa4, 0x64, 0xe2, 0x73, 0xd6, 0x56, 0x99, 0x0e, 0x22, 0x36, 0xac,
+  0x68, 0x37, 0x75, 0x7d, 0xb4, 0x9c, 0x8f, 0x40, 0xd0, 0xe8, 0x6e, 0x9e, 0x28, 0x48, 0xaa, 0x6f,
+  0x0a, 0x03, 0x6e, 0xe7, 0x37, 0x62, 0x8b, 0xda, 0xf5, 0xf1, 0x26, 0xe2, 0xe2, 0xd1, 0x2f, 0xa0,
+  0x46, 0x13, 0x71, 0xa8, 0x13, 0x82, 0x02, 0x7a, 0x21, 0x7c, 0x50, 0x8e, 0x14, 0x7f, 0xc2, 0x0f,
+  0x9d, 0xfe, 0xe7, 0x44, 0xd0, 0x5e, 0x46, 0xe5, 0xd0, 0x4f, 0x9d, 0xf7, 0x2c, 0x5c, 0x8a, 0x3c,
+  0x0b, 0x7f, 0x11, 0xd2, 0x36, 0x68, 0x60, 0x7e, 0x65, 0xde, 0xd7, 0x93, 0xd4, 0x27, 0xdc, 0xa5,
+  0x3e, 0x33, 0x24, 0x95, 0x0a, 0x52, 0x37, 0x48, 0x2c, 0x44, 0x4b, 0x13, 0x3c, 0xaa, 0x2d, 0x55,
+  0x4c, 0xba, 0x91, 0x95, 0xc2, 0x16, 0x36, 0x6c, 0x5e, 0x13, 0x64, 0xb2, 0x73, 0xaa, 0xb8, 0x54,
+  0xa7, 0x95, 0x8b, 0x12, 0x26, 0x10, 0xa0, 0xef, 0x02, 0xd8, 0x98, 0x26, 0xb4, 0xaa, 0xb6, 0xc7,
+  0x34, 0xbc, 0x97, 0x22, 0x84, 0xb1, 0x92, 0x1c, 0xdb, 0x55, 0x43, 0xd5, 0x35, 0x43, 0xd3, 0xd5,
+  0x03, 0xe1, 0x66, 0xe0, 0x3a, 0xcd, 0xa7, 0x01, 0x83, 0xc8, 0xe6, 0xcf, 0x80, 0x92, 0x1a, 0x75,
+  0x6d, 0x43, 0x27, 0xe4, 0xb5, 0xb6, 0xe2, 0xbb, 0x17, 0x50, 0xb0, 0x9e, 0xf7, 0x30, 0x77, 0x03,
+  0xff, 0x61, 0xf6, 0x66, 0x1e, 0xb4, 0xc8, 0xd9, 0x8e, 0xe8, 0xed, 0x39, 0xb3, 0x58, 0xe7, 0x26,
+  0x26, 0x6d, 0x4e, 0x48, 0x23, 0xd6, 0x2d, 0xd7, 0xbb, 0x81, 0x8b, 0x9b, 0x53, 0xd3, 0x80, 0xb7,
+  0x4b, 0xb5, 0x9c, 0x6c, 0x8e, 0x3c, 0xfa, 0xc2, 0x94, 0xdb, 0x96, 0xd3, 0x65, 0x83, 0x60, 0x27,
+  0x0c, 0xdb, 0xd6, 0xe6, 0x9c, 0x69, 0xd7, 0xdb, 0x8a, 0x37, 0x5f, 0x07, 0x51, 0x3d, 0x6b, 0x42,
+  0xe6, 0x06, 0xce, 0x84, 0xdc, 0x1b, 0x18, 0xd3, 0xa6, 0x66, 0x5b, 0xaa, 0xb7, 0x67, 0xce, 0x72,
+  0xad, 0x1b, 0xd9, 0xf3, 0x56, 0xe4, 0x34, 0x62, 0xd1, 0x6a, 0xcd, 0x9b, 0x98, 0xf4, 0x56, 0x34,
+  0x35, 0x60, 0xd4, 0x4a, 0xbd, 0x5a, 0x56, 0x7d, 0x6d, 0x95, 0xdc, 0x96, 0x59, 0x1d, 0xa2, 0x79,
+  0xd3, 0x4e, 0xf2, 0xb6, 0xeb, 0x37, 0xe8, 0x0e, 0xa1, 0x83, 0x4b, 0x31, 0xd9, 0xc5, 0x9f, 0x98,
+  0xfe, 0xdf, 0x65, 0x7b, 0xd7, 0xcb, 0xf6, 0x48, 0x0f, 0xec, 0xdd, 0x56, 0xee, 0x3a, 0xab, 0x40,
+  0x03, 0xde, 0x70, 0xa9, 0xd5, 0x9b, 0xf6, 0xc8, 0x77, 0x03, 0x5d, 0x6f, 0x7a, 0xf8, 0xaf, 0x3a,
+  0xfa, 0x9f, 0xc0, 0xd7, 0xa9, 0x1c, 0xdf, 0xbb, 0x71, 0xf5, 0x06, 0x63, 0xd2, 0x7f, 0xb9, 0xe4,
+  0x3f, 0x65, 0xd3, 0x42, 0x23, 0x7c, 0x47, 0x3e, 0xa9, 0xb5, 0x0f, 0xfe, 0x97, 0x4d, 0xfe, 0x33,
+  0xd8, 0x44, 0x0e, 0x70, 0x33, 0x2e, 0xc1, 0xc1, 0x29, 0x1a, 0x00, 0x01, 0xdd, 0x6f, 0xae, 0xf4,
+  0x33, 0x31, 0x02, 0x8e, 0x42, 0x6a, 0xce, 0x78, 0x26, 0xfa, 0x51, 0xbc, 0x6a, 0x77, 0x72, 0x26,
+  0x5b, 0xe8, 0x72, 0x67, 0x41, 0xba, 0x08, 0xf9, 0xba, 0x6d, 0x12, 0xba, 0xec, 0x9a, 0x23, 0x3e,
+  0x3c, 0x56, 0x5a, 0x05, 0xd9, 0x78, 0xc6, 0xf2, 0xbc, 0xfe, 0xe5, 0x2c, 0x5e, 0xd1, 0x21, 0x21,
+  0x4f, 0x05, 0xf3, 0xde, 0x89, 0x64, 0x0c, 0xbc, 0xe1, 0x1d, 0x33, 0x79, 0x50, 0xc7, 0x5e, 0xf3,
+  0x6c, 0xd6, 0x4f, 0xe2, 0x65, 0xe4, 0xb7, 0x09, 0x08, 0xdb, 0x67, 0x87, 0x47, 0x47, 0xec, 0x4f,
+  0xec, 0x60, 0x30, 0xe8, 0xb0, 0xfb, 0xcc, 0xfb, 0x1f, 0x4f, 0x55, 0x7d, 0x01, 0xfd, 0x7d, 0x73,
+  0xb5, 0x07, 0x47, 0x3f, 0x52, 0x35, 0x76, 0x26, 0xa6, 0xd0, 0x1b, 0xa9, 0xae, 0x7d, 0x9e, 0x88,
+  0x7f, 0x2e, 0x45, 0x34, 0x5e, 0x3b, 0x61, 0x00, 0x32, 0xfc, 0x3f, 0x80, 0x62, 0xa0, 0x11, 0x94,
+  0x17, 0xbf, 0x7a, 0x2d, 0x5f, 0x4c, 0xf8, 0x32, 0xcc, 0x4c, 0x35, 0x59, 0xe2, 0xbe, 0xdd, 0xc6,
+  0xbf, 0x45, 0x41, 0xc6, 0x7e, 0x02, 0xa4, 0x78, 0xaa, 0x58, 0x4a, 0x3e, 0x66, 0x9e, 0x57, 0x32,
+  0x44, 0x99, 0x12, 0x2f, 0x7d, 0x65, 0x51, 0x35, 0x29, 0xd8, 0x53, 0x0a, 0x8f, 0xb4, 0xcf, 0x16,
+  0xf0, 0xfc, 0x19, 0xa8, 0x5d, 0xb0, 0x7f, 0xfd, 0x0b, 0x41, 0x16, 0x30, 0xd1, 0xa9, 0x53, 0x3f,
+  0x11, 0x30, 0x2e, 0x63, 0xd1, 0xde, 0xff, 0xf0, 0x7f, 0x4f, 0x7b, 0xff, 0xcb, 0x7b, 0xbf, 0x0e,
+  0x7a, 0x3f, 0x7e, 0xdc, 0x9f, 0x76, 0x55, 0xf1, 0xfc, 0xbc, 0xce, 0xab, 0x0a, 0x8f, 0x8d, 0xe7,
+  0x74, 0x48, 0x55, 0xc5, 0xa8, 0x5c, 0xca, 0xc7, 0x2c, 0xf4, 0x9f, 0xe0, 0x41, 0x44, 0xe7, 0xcc,
+  0xdf, 0xb6, 0xf7, 0xfa, 0x58, 0xb4, 0x67, 0xa8, 0x4c, 0x3f, 0xe0, 0xa9, 0x6a, 0x0f, 0x13, 0x4f,
+  0x3c, 0xf4, 0x1f, 0x50, 0x0d, 0xdc, 0xf3, 0x3e, 0xee, 0x75, 0x5a, 0x45, 0x56, 0x94, 0x76, 0xe5,
+  0xe2, 0xbc, 0x90, 0x69, 0x2d, 0x83, 0xa4, 0x2f, 0xe6, 0x8b, 0x6c, 0x0d, 0x2c, 0x5a, 0x29, 0xd3,
+  0x07, 0x62, 0x9f, 0xf3, 0xf1, 0xcc, 0x3a, 0xe1, 0x2e, 0xf4, 0x30, 0x39, 0x0d, 0x14, 0x38, 0x54,
+  0xce, 0x4c, 0xb5, 0x25, 0xee, 0xa8, 0xa1, 0xa6, 0x36, 0x05, 0x28, 0x74, 0x36, 0x8d, 0x98, 0x69,
+  0x79, 0x12, 0x87, 0xb2, 0xdd, 0x4f, 0xfc, 0xe0, 0x9a, 0x8d, 0x43, 0x9e, 0xa6, 0x27, 0xde, 0x7c,
+  0xdd, 0x7b, 0x80, 0x5e, 0x1e, 0x90, 0x34, 0x84, 0x56, 0xaa, 0x72, 0x7d, 0xbe, 0x58, 0x08, 0xe0,
+  0x3b, 0x2c, 0x1c, 0xa2, 0xf5, 0x12, 0x4a, 0xc8, 0xbf, 0x7b, 0xda, 0x0a, 0x0b, 0x4d, 0xf0, 0xba,
+  0x80, 0x5d, 0xd9, 0x5b, 0x73, 0x72, 0xc9, 0xda, 0x89, 0xc3, 0x09, 0x9c, 0xd5, 0x69, 0xd9, 0x90,
+  0x40, 0xd9, 0x88, 0xd0, 0xa1, 0x04, 0xff, 0x18, 0x38, 0x81, 0x4f, 0x60, 0xb0, 0x82, 0xb6, 0x93,
+  0x16, 0x01, 0x3a, 0xa6, 0x73, 0x8e, 0xec, 0x4c, 0x32, 0x7f, 0x07, 0xfe, 0xcf, 0x45, 0x7b, 0x10,
+  0x2d, 0x96, 0x19, 0x43, 0x69, 0x77, 0xe2, 0x25, 0x3c, 0x9a, 0xa2, 0x0f, 0x8d, 0x6c, 0x37, 0x90,
+  0x3f, 0xef, 0xa9, 0x1a, 0x3d, 0xca, 0x82, 0x75, 0x21, 0xcd, 0xe2, 0xb9, 0xfc, 0xe1, 0x19, 0x02,
+  0x61, 0x34, 0xfc, 0x63, 0x20, 0xb0, 0xcb, 0x60, 0x37, 0x79, 0x6c, 0xa1, 0x86, 0x2d, 0x23, 0xa4,
+  0xf1, 0xcf, 0x85, 0x34, 0xfe, 0xb9, 0xcb, 0xd2, 0x4c, 0x2c, 0xec, 0xc4, 0x4b, 0xf8, 0xad, 0x44,
+  0xd0, 0x71, 0x95, 0xf4, 0xd6, 0x97, 0x4e, 0x3f, 0x8e, 0xa0, 0x1f, 0x88, 0xd4, 0xf1, 0x8c, 0xb0,
+  0x77, 0x0b, 0xbe, 0x08, 0x68, 0xfb, 0x06, 0xae, 0x00, 0x26, 0xb2, 0x79, 0xf0, 0x39, 0xa6, 0x97,
+  0x47, 0x9b, 0x3e, 0x53, 0xf1, 0x12, 0x72, 0xbe, 0x6d, 0x67, 0xb3, 0x20, 0x95, 0xa6, 0xe9, 0x4e,
+  0x17, 0xe4, 0x15, 0xfc, 0x43, 0xb0, 0xfa, 0x19, 0xb9, 0xba, 0x20, 0x43, 0x29, 0x74, 0x30, 0xff,
+  0x55, 0xff, 0x49, 0xc6, 0x55, 0x3d, 0xa8, 0xba, 0x07, 0x73, 0xeb, 0x8e, 0x4f, 0xb6, 0x38, 0x82,
+  0x69, 0xb0, 0xb6, 0xbb, 0xe6, 0xd8, 0x4d, 0x73, 0x05, 0xb9, 0x3b, 0xc5, 0x55, 0x27, 0x9a, 0xa6,
+  0xf6, 0x4c, 0x50, 0xc2, 0xe8, 0xa7, 0xc2, 0x0c, 0x2d, 0xe5, 0x7e, 0x04, 0xe9, 0x67, 0x65, 0xdb,
+  0x64, 0xe6, 0x20, 0x2d, 0x1a, 0xd1, 0x79, 0xa1, 0x94, 0xff, 0xa1, 0x28, 0xe4, 0x3e, 0x56, 0x96,
+  0xd0, 0xed, 0xe6, 0x28, 0x1e, 0x17, 0xa0, 0x70, 0xc6, 0xf9, 0x84, 0x03, 0x56, 0x07, 0xde, 0x2e,
+  0x69, 0x4f, 0x19, 0x3a, 0x5a, 0xd8, 0x34, 0x65, 0x6a, 0x01, 0xd2, 0xd0, 0x96, 0xc6, 0x77, 0x3b,
+  0x4e, 0x23, 0x8e, 0x06, 0x4e, 0x8d, 0x61, 0xc9, 0xd4, 0x47, 0x22, 0x85, 0x05, 0xc6, 0xb5, 0x7c,
+  0x34, 0xa1, 0x59, 0xae, 0xda, 0x9d, 0xf2, 0x10, 0xff, 0xf6, 0xa5, 0x24, 0x20, 0x69, 0x2c, 0xa5,
+  0xd3, 0x48, 0xa5, 0x91, 0x6a, 0x9c, 0xa9, 0x56, 0x6d, 0x76, 0x75, 0x10, 0x25, 0xee, 0xd6, 0x17,
+  0xa6, 0x4e, 0xc3, 0xea, 0x87, 0x5b, 0x97, 0x6c, 0xcd, 0xd3, 0x29, 0xa2, 0x69, 0x29, 0xf7, 0x0e,
+  0xe9, 0xaa, 0xd2, 0x6d, 0x49, 0x87, 0x91, 0x63, 0x5a, 0x4c, 0x64, 0x29, 0xb3, 0x76, 0x68, 0xa0,
+  0xd4, 0x1c, 0xea, 0x46, 0x5c, 0x3b, 0x73, 0xdd, 0x86, 0xf5, 0x6a, 0x14, 0xa0, 0x21, 0x3b, 0x1a,
+  0x54, 0xe7, 0x8b, 0x53, 0x3d, 0xb2, 0xfd, 0x68, 0x00, 0xb7, 0x73, 0x22, 0xd7, 0x1c, 0x88, 0x37,
+  0x3e, 0x4f, 0xb8, 0x1c, 0xf3, 0xe8, 0x42, 0xa4, 0x20, 0xd4, 0xd2, 0x26, 0x9a, 0xa7, 0x55, 0xad,
+  0x02, 0x98, 0x86, 0x7e, 0x21, 0xc6, 0x40, 0xe1, 0xf8, 0x1f, 0xd9, 0x28, 0xf6, 0xd7, 0xd0, 0x3c,
+  0x7d, 0x20, 0xd8, 0x9f, 0x8a, 0xec, 0x79, 0x28, 0xf0, 0xf3, 0xd9, 0x1a, 0x98, 0xcd, 0x5b, 0x41,
+  0xb1, 0x2b, 0x74, 0x95, 0x7c, 0x06, 0x05, 0xd1, 0x27, 0x8d, 0x94, 0x02, 0x54, 0x24, 0x03, 0xec,
+  0xee, 0x02, 0x1c, 0xd0, 0xac, 0x56, 0x69, 0x3f, 0x14, 0xd1, 0x34, 0x9b, 0x41, 0x47, 0x1f, 0x3c,
+  0x86, 0x32, 0x43, 0xd6, 0xc3, 0xbf, 0xbd, 0x1e, 0x31, 0x53, 0xb1, 0xb8, 0x0f, 0x4a, 0x6d, 0x26,
+  0x2e, 0xa0, 0x53, 0x03, 0x52, 0x5c, 0x0b, 0xa0, 0x07, 0x58, 0xfb, 0x49, 0x5d, 0xab, 0x14, 0x16,
+  0x28, 0x73, 0xff, 0xbe, 0x6e, 0x54, 0x82, 0x6b, 0x7a, 0x99, 0xa4, 0x20, 0x4a, 0x45, 0x92, 0x21,
+  0x8e, 0xde, 0x01, 0x20, 0xa1, 0xc6, 0xa7, 0x81, 0x7f, 0x8a, 0x1e, 0x28, 0x27, 0x58, 0x45, 0x95,
+  0xc0, 0x84, 0xf6, 0xa0, 0xa3, 0xe4, 0xf4, 0xe9, 0x2c, 0x08, 0x7d, 0x73, 0x4a, 0xda, 0x1f, 0x27,
+  0x02, 0x86, 0xff, 0x0a, 0xd6, 0xd0, 0x37, 0xc0, 0x1e, 0xed, 0x1a, 0x9a, 0x3e, 0x04, 0x1f, 0xfb,
+  0x97, 0x97, 0x2f, 0xcf, 0x3a, 0x0a, 0x4f, 0x02, 0x88, 0xdc, 0x78, 0x0e, 0xee, 0x8c, 0xe7, 0x02,
+  0x10, 0x69, 0x3c, 0xa3, 0xfa, 0x06, 0x1d, 0xde, 0x19, 0xd1, 0x33, 0xbb, 0x45, 0xb8, 0xb6, 0x45,
+  0x22, 0x74, 0xe3, 0x7a, 0x70, 0x67, 0x5c, 0xa7, 0x2f, 0x9e, 0xbe, 0x79, 0xf3, 0xfc, 0x95, 0xc6,
+  0x06, 0xaa, 0x7b, 0xb2, 0x5e, 0x64, 0xa2, 0xa6, 0x6d, 0x0f, 0xef, 0x8c, 0xef, 0xf9, 0x9b, 0xd3,
+  0x8b, 0xbf, 0xbf, 0xbb, 0x42, 0x7c, 0x08, 0x9b, 0xfb, 0x3e, 0x89, 0xe5, 0x57, 0x01, 0xa8, 0x1b,
+  0xb0, 0x66, 0xb7, 0xbd, 0x71, 0x08, 0x5b, 0xb1, 0x82, 0xe6, 0x80, 0xbc, 0x56, 0x37, 0x57, 0xf6,
+  0xb0, 0xab, 0x5e, 0xa2, 0xce, 0xb1, 0x47, 0x2b, 0x0e, 0x6d, 0xf2, 0x50, 0x61, 0xe8, 0x4f, 0x82,
+  0x24, 0xcd, 0x88, 0x4c, 0x68, 0x00, 0x40, 0x7e, 0x71, 0xf5, 0xfa, 0x15, 0x30, 0xbc, 0x65, 0xf4,
+  0xae, 0x5a, 0x09, 0xdd, 0xee, 0x30, 0x1b, 0x04, 0xc8, 0x3d, 0x7b, 0x9e, 0xab, 0x1d, 0xc5, 0xe3,
+  0xda, 0xfd, 0x76, 0x1c, 0x96, 0xfc, 0x02, 0xa4, 0x03, 0x02, 0x60, 0xc5, 0x2c, 0x6a, 0x45, 0xf5,
+  0x0c, 0x9e, 0xaa, 0x75, 0xea, 0xf7, 0xd6, 0xa8, 0x1d, 0x14, 0x16, 0x6b, 0x03, 0x94, 0xf2, 0xea,
+  0xa0, 0xca, 0xc5, 0xa6, 0x0e, 0xec, 0xdb, 0xc9, 0x04, 0xa4, 0x7a, 0x0d, 0x5c, 0x99, 0x59, 0x07,
+  0x58, 0xe6, 0x76, 0x5c, 0x87, 0x0a, 0x4e, 0x4f, 0xa1, 0x5d, 0xf5, 0xee, 0x2b, 0x60, 0x40, 0xd8,
+  0x77, 0x3a, 0x3d, 0x1c, 0x46, 0x80, 0x5a, 0xe5, 0x3b, 0x28, 0x56, 0x39, 0x9d, 0x72, 0xd1, 0x3a,
+  0x7f, 0x87, 0xbc, 0xc2, 0x97, 0x1a, 0x62, 0x3e, 0x90, 0xd3, 0x54, 0xca, 0x60, 0x1b, 0xce, 0x9e,
+  0xf1, 0xc4, 0xfb, 0xe8, 0xe8, 0x49, 0x44, 0x94, 0x42, 0x01, 0xc8, 0xaf, 0xe9, 0xca, 0x0a, 0x14,
+  0x47, 0xa7, 0xd6, 0xf8, 0x4e, 0x35, 0xee, 0xd4, 0x6f, 0xfb, 0x02, 0x95, 0x53, 0xab, 0x60, 0x3e,
+  0x03, 0xdb, 0x9f, 0xc4, 0xda, 0xb2, 0x3d, 0x20, 0xf1, 0xe4, 0xd0, 0x75, 0x1f, 0xd2, 0xd5, 0x2e,
+  0x47, 0x66, 0xea, 0xe9, 0x55, 0x1e, 0xf8, 0x82, 0x47, 0x31, 0x79, 0x4f, 0x29, 0xf2, 0xf0, 0xbb,
+  0x3f, 0x5a, 0x67, 0xe2, 0x95, 0x5c, 0xbf, 0x9e, 0xb0, 0x43, 0x54, 0x1d, 0x28, 0x19, 0x26, 0xfa,
+  0xdf, 0x82, 0x28, 0xfb, 0x01, 0x16, 0x08, 0xa0, 0x99, 0x1d, 0x14, 0x19, 0xa0, 0x58, 0xe4, 0xa0,
+  0x03, 0x1d, 0xcc, 0x06, 0x9f, 0x1f, 0x0c, 0x2a, 0x3e, 0x5c, 0xe7, 0xa8, 0x56, 0xb4, 0xb5, 0xcb,
+  0x96, 0x34, 0xc7, 0xd8, 0xee, 0xe9, 0x50, 0xcd, 0x4e, 0x7b, 0xc5, 0xd7, 0x31, 0xec, 0x5f, 0x94,
+  0x03, 0xb2, 0x95, 0xf1, 0x2e, 0xf8, 0x0c, 0x3a, 0x14, 0x64, 0x7c, 0xf8, 0x58, 0xd9, 0xd3, 0xd7,
+  0x7a, 0x8b, 0x35, 0x1e, 0x86, 0x32, 0x15, 0xb6, 0x56, 0x5f, 0x26, 0x04, 0x5d, 0xb3, 0xc9, 0x83,
+  0xbb, 0xc8, 0x9b, 0xc2, 0x87, 0xcd, 0xd2, 0x24, 0xa0, 0x95, 0xd5, 0x61, 0x7f, 0xa8, 0xf4, 0x8a,
+  0xb1, 0x29, 0x2c, 0x23, 0xc4, 0x68, 0x77, 0xec, 0xc1, 0xa3, 0xf6, 0x83, 0x2e, 0xe9, 0x7f, 0x1d,
+  0xfb, 0x02, 0x80, 0xa4, 0x40, 0xeb, 0x1c, 0x30, 0x36, 0x54, 0xb7, 0xb3, 0x81, 0x40, 0x59, 0xc0,
+  0x50, 0x85, 0xf8, 0x62, 0x25, 0x61, 0xd8, 0x11, 0xfd, 0x5c, 0xc4, 0x69, 0x40, 0x64, 0xe2, 0x78,
+  0xac, 0x40, 0x6a, 0x0b, 0xd6, 0x56, 0x45, 0xee, 0x03, 0x53, 0x3c, 0x51, 0x84, 0xe5, 0xbc, 0x82,
+  0x74, 0x9b, 0x4a, 0xf7, 0x4f, 0x4a, 0x3c, 0x13, 0x2b, 0x21, 0x44, 0x2a, 0xc1, 0x32, 0x62, 0xee,
+  0x7c, 0x72, 0xd2, 0x6e, 0xe9, 0xef, 0x13, 0x76, 0x98, 0x5b, 0x5f, 0x2c, 0x6d, 0x08, 0xeb, 0xc3,
+  0x86, 0xc9, 0x20, 0x7b, 0x22, 0xdb, 0x4b, 0x6a, 0x50, 0x97, 0x59, 0xb5, 0x4b, 0x3d, 0xf0, 0x41,
+  0xd7, 0xb8, 0x7f, 0xff, 0x63, 0xb5, 0x63, 0x65, 0x3d, 0xdd, 0xbb, 0x5f, 0x5a, 0x7e, 0xc2, 0x57,
+  0x6a, 0x70, 0xda, 0x85, 0x71, 0x53, 0x30, 0xa5, 0xcd, 0xa4, 0xbd, 0x40, 0xd0, 0x46, 0xf9, 0x22,
+  0x4b, 0xad, 0x4c, 0x63, 0xc3, 0x21, 0x3b, 0x80, 0x79, 0xf0, 0x27, 0x32, 0xd0, 0xed, 0xb3, 0x07,
+  0x07, 0x54, 0x64, 0xaa, 0x4c, 0xac, 0xed, 0xbc, 0xd4, 0x51, 0x87, 0x7d, 0x87, 0x73, 0xe5, 0x3c,
+  0x2f, 0xfc, 0xe8, 0x81, 0x54, 0x6a, 0xe4, 0xf2, 0xa9, 0x8a, 0x62, 0xa1, 0x83, 0xf3, 0x02, 0x44,
+  0x65, 0x32, 0xf3, 0x92, 0xe9, 0xa8, 0x8d, 0x5b, 0x24, 0xcb, 0xb4, 0x07, 0xb4, 0xd0, 0xae, 0xa8,
+  0x5b, 0x4a, 0x27, 0x02, 0x9c, 0x39, 0x23, 0x92, 0x27, 0x90, 0xd1, 0x29, 0xd8, 0xc9, 0x0a, 0x1d,
+  0xa1, 0x99, 0x93, 0x47, 0xd7, 0x3c, 0xdd, 0xa4, 0x32, 0xeb, 0x5e, 0xa2, 0x82, 0x9e, 0x64, 0xd7,
+  0x7b, 0xaa, 0x1a, 0x48, 0x94, 0x7b, 0x85, 0x89, 0x65, 0xae, 0x2f, 0x68, 0x93, 0x12, 0x88, 0x30,
+  0x34, 0xa8, 0x53, 0x71, 0x04, 0x7d, 0x2a, 0xd3, 0xda, 0xde, 0xa1, 0xef, 0x49, 0x83, 0x02, 0xfc,
+  0x22, 0xf6, 0xbd, 0xc4, 0x0b, 0x4a, 0x78, 0xbf, 0xe6, 0x9b, 0xc1, 0x60, 0xe0, 0x15, 0xb2, 0x2e,
+  0x60, 0x2a, 0xb7, 0x07, 0x5d, 0x06, 0xff, 0xaf, 0x20, 0xa9, 0xab, 0x52, 0xea, 0xd7, 0x4c, 0xe0,
+  0xf9, 0xa6, 0xb6, 0x63, 0x85, 0xcb, 0x79, 0x84, 0x2d, 0xa2, 0x0e, 0x99, 0xf3, 0xcf, 0xed, 0x02,
+  0x85, 0xfd, 0xab, 0x78, 0xa1, 0x26, 0x58, 0xb7, 0x28, 0x9a, 0xfa, 0xcf, 0xe2, 0x2c, 0x8b, 0xe7,
+  0x2a, 0x13, 0xfb, 0xef, 0x50, 0x2b, 0xe2, 0x1b, 0xc0, 0xbd, 0x12, 0x93, 0xac, 0x06, 0xde, 0x05,
+  0x52, 0x55, 0x01, 0x97, 0x06, 0xbf, 0x0a, 0x03, 0x2e, 0x88, 0xda, 0x76, 0x8b, 0x80, 0x17, 0x14,
+  0xfd, 0xa5, 0xb6, 0x41, 0x06, 0x92, 0xd1, 0x29, 0x0e, 0x26, 0xcc, 0x27, 0xbf, 0xab, 0x6a, 0x74,
+  0xb1, 0x80, 0xba, 0xcb, 0x52, 0xe9, 0xd3, 0x12, 0xa7, 0x17, 0xe6, 0x12, 0xc0, 0xf8, 0x88, 0x03,
+  0x39, 0xe8, 0x54, 0xfb, 0x5c, 0x82, 0x06, 0x3e, 0x25, 0xa2, 0x61, 0x4e, 0x13, 0x96, 0xc2, 0x6f,
+  0xfa, 0xea, 0xb1, 0xc3, 0xfc, 0x0b, 0xe7, 0x58, 0xb5, 0xcb, 0xab, 0x46, 0x1a, 0x22, 0x3e, 0xc0,
+  0x8b, 0x3b, 0xe5, 0xb6, 0xa4, 0x08, 0x06, 0xfe, 0x0b, 0x00, 0x53, 0xdb, 0x4a, 0xea, 0x40, 0x37,
+  0xd4, 0x0f, 0x26, 0xac, 0x50, 0x5f, 0x3a, 0x2d, 0xe7, 0x90, 0x7e, 0x1d, 0xe4, 0x05, 0x7e, 0xe9,
+  0x4a, 0x3e, 0xe9, 0xe1, 0xe5, 0x94, 0x0a, 0x19, 0xc4, 0x24, 0xdb, 0x11, 0x01, 0x3c, 0x7e, 0x80,
+  0xc6, 0x1b, 0xc4, 0xae, 0x20, 0x3a, 0x50, 0x5b, 0x5c, 0xe7, 0x40, 0x27, 0x19, 0xaf, 0x69, 0xa3,
+  0x0f, 0x4c, 0x13, 0x4c, 0xf3, 0xeb, 0x09, 0x28, 0xf2, 0xf6, 0x17, 0xf7, 0x7a, 0x58, 0xe3, 0x35,
+  0x6e, 0xae, 0x05, 0xd1, 0x12, 0xd6, 0x0f, 0xd2, 0xca, 0x5a, 0xdb, 0xc9, 0xd7, 0x6d, 0x5a, 0xc2,
+  0x08, 0x14, 0x6e, 0x64, 0xc8, 0x3c, 0xed, 0x7d, 0x93, 0x27, 0xe0, 0x1e, 0x3e, 0xff, 0xa5, 0x0d,
+  0xea, 0x37, 0x68, 0x5d, 0x41, 0xe4, 0x8b, 0xcf, 0xca, 0x3d, 0x58, 0xc9, 0xc1, 0x11, 0x9d, 0x45,
+  0x29, 0xeb, 0xb7, 0xfa, 0x21, 0xad, 0xc2, 0xe9, 0x72, 0x34, 0x0f, 0x32, 0x63, 0x16, 0x86, 0xfe,
+  0x62, 0xf3, 0x51, 0xef, 0x90, 0xcd, 0x3f, 0xc3, 0x3f, 0xa3, 0x2c, 0xc2, 0xff, 0x7a, 0xe1, 0x94,
+  0xfe, 0x40, 0xcf, 0x84, 0x41, 0x24, 0x7a, 0x21, 0xf6, 0x0e, 0x1a, 0xcd, 0x25, 0x24, 0x34, 0x15,
+  0xdb, 0x3e, 0xc7, 0x32, 0xb5, 0x4f, 0xfb, 0xb1, 0xe2, 0x1d, 0xb6, 0x56, 0xf5, 0xe2, 0x1f, 0x34,
+  0xcd, 0x3b, 0x66, 0x74, 0xc3, 0x69, 0xcc, 0xc3, 0x10, 0xbe, 0xc9, 0x0b, 0xfa, 0x0b, 0x75, 0x7a,
+  0xb1, 0xf5, 0xca, 0x2a, 0x2b, 0xc1, 0x57, 0x75, 0x46, 0x1b, 0x76, 0x69, 0x38, 0x0a, 0x77, 0xcd,
+  0x2e, 0xa1, 0x1c, 0x6c, 0xa2, 0xe4, 0x15, 0x33, 0xba, 0xf3, 0x25, 0x77, 0x55, 0xc1, 0xa4, 0x3c,
+  0x48, 0x38, 0x8a, 0xfa, 0x42, 0xe1, 0xbd, 0xfc, 0xfa, 0x96, 0xbe, 0x3a, 0x07, 0x5b, 0x57, 0x7f,
+  0x4d, 0xc6, 0x2e, 0x54, 0x22, 0xe9, 0xd6, 0x96, 0xce, 0x42, 0x5a, 0xda, 0x9b, 0x60, 0x3f, 0xce,
+  0x4d, 0x6b, 0x9a, 0xb8, 0x15, 0x4f, 0xa2, 0xb6, 0xf7, 0x5e, 0x42, 0x00, 0xd6, 0x62, 0x3c, 0x11,
+  0xea, 0x1e, 0x63, 0xf9, 0x80, 0xaa, 0x74, 0xee, 0xb8, 0xa0, 0x6f, 0xe0, 0xef, 0x2e, 0x9b, 0x76,
+  0xd9, 0x48, 0x9f, 0x12, 0xc3, 0x62, 0xfb, 0x0f, 0x3a, 0xb9, 0x86, 0x71, 0xdf, 0xc3, 0x95, 0x17,
+  0xcf, 0x74, 0x12, 0x3c, 0xd0, 0xe9, 0x32, 0xfc, 0x9c, 0xe6, 0x9f, 0x23, 0xfc, 0xec, 0xec, 0x41,
+  0x77, 0x13, 0x28, 0xda, 0x50, 0x98, 0xea, 0x1d, 0x93, 0x4c, 0x3f, 0xdf, 0x59, 0xdf, 0xd0, 0xd0,
+  0x4c, 0xd2, 0xe0, 0x2a, 0x9d, 0xa6, 0xed, 0xdf, 0x5a, 0x23, 0x3e, 0xfe, 0x34, 0xa5, 0x85, 0x9b,
+  0x0a, 0x1e, 0xe7, 0x64, 0x75, 0x5b, 0x63, 0x99, 0x52, 0x0b, 0x9d, 0xfe, 0x4d, 0xfb, 0x17, 0x7f,
+  0x7e, 0xf6, 0x6a, 0x09, 0x8b, 0x09, 0x97, 0xb6, 0xbf, 0x41, 0xff, 0xf0, 0x90, 0xfd, 0xc4, 0xf6,
+  0xbe, 0x39, 0x3c, 0x3c, 0xdc, 0x63, 0xc7, 0xf0, 0xe1, 0xfb, 0xfe, 0x1e, 0x9e, 0x23, 0x10, 0x17,
+  0xda, 0x94, 0x7c, 0x69, 0x59, 0xf7, 0x77, 0xf7, 0xd5, 0x55, 0x66, 0xb2, 0xa2, 0x29, 0x7e, 0x1f,
+  0x4d, 0x7b, 0x3e, 0x4f, 0x3e, 0x31, 0xac, 0x29, 0xf9, 0x5a, 0x7e, 0xfe, 0xb2, 0x4c, 0x33, 0x18,
+  0x34, 0x8f, 0xc5, 0x51, 0x18, 0x73, 0xff, 0xc4, 0xfb, 0x85, 0xc3, 0x72, 0x45, 0x90, 0x8e, 0xf3,
+  0x8b, 0x98, 0x78, 0x91, 0x38, 0xe2, 0xe6, 0x2c, 0x09, 0x3e, 0x47, 0x78, 0xd2, 0x4e, 0x7f, 0x7a,
+  0xe2, 0xf3, 0x02, 0x24, 0x45, 0x2f, 0x9d, 0x33, 0x40, 0x22, 0x6f, 0x9d, 0xc2, 0x6e, 0x46, 0xe7,
+  0x12, 0xd6, 0x09, 0xac, 0x51, 0x7e, 0x2f, 0x8b, 0x17, 0x1e, 0x0b, 0x7c, 0x5d, 0xff, 0x05, 0x50,
+  0x09, 0x9b, 0x3d, 0x00, 0x6d, 0x1d, 0x53, 0x99, 0xb3, 0x89, 0xde, 0x24, 0x5c, 0x06, 0x3e, 0xe6,
+  0xf2, 0x22, 0xda, 0xde, 0x28, 0x01, 0x74, 0xfa, 0xf6, 0xf3, 0x37, 0x12, 0xa2, 0x75, 0x2f, 0xa0,
+  0x74, 0x71, 0x99, 0x63, 0x47, 0x48, 0x41, 0x50, 0x04, 0x93, 0xc5, 0xd3, 0x69, 0x88, 0x37, 0x92,
+  0xa4, 0x7c, 0x90, 0x65, 0x3c, 0x46, 0x47, 0x83, 0x32, 0x8f, 0xa4, 0x44, 0xc8, 0x17, 0xa9, 0xd0,
+  0xc9, 0x3c, 0x99, 0xe2, 0xad, 0xf0, 0x6f, 0x54, 0x7a, 0x30, 0xc2, 0xab, 0x0e, 0x08, 0x8d, 0x6e,
+  0x5a, 0x43, 0x37, 0xb8, 0x71, 0xf4, 0x82, 0x31, 0x12, 0xa6, 0x4e, 0xc4, 0x5a, 0x46, 0x9e, 0x94,
+  0x5a, 0x2e, 0x71, 0xe9, 0x8e, 0xcb, 0x71, 0x63, 0x03, 0x9d, 0x18, 0x97, 0xa1, 0x85, 0x4f, 0xd7,
+  0x83, 0x3f, 0xf2, 0xca, 0xb8, 0x95, 0xd7, 0x0b, 0x32, 0x31, 0x97, 0x7d, 0x89, 0xc0, 0x66, 0xd0,
+  0x5b, 0x57, 0x7c, 0x04, 0x80, 0x5e, 0x62, 0xba, 0x5d, 0x90, 0x6e, 0x9a, 0x73, 0x98, 0x7d, 0xd7,
+  0xa2, 0xd4, 0x17, 0x19, 0x1f, 0x99, 0x4e, 0xc7, 0xee, 0xf6, 0x86, 0xf8, 0xaf, 0xec, 0xe0, 0xfd,
+  0x30, 0xb8, 0x01, 0xa5, 0x74, 0x87, 0xdf, 0x80, 0x74, 0x03, 0x36, 0x75, 0x1a, 0x3a, 0x94, 0x7f,
+  0x4b, 0x18, 0x11, 0x78, 0x02, 0x1c, 0x33, 0x8a, 0x57, 0x35, 0xd0, 0x73, 0x42, 0xb6, 0x47, 0x79,
+  0x21, 0x21, 0x7a, 0x43, 0xf5, 0xe1, 0x40, 0x4a, 0xee, 0xa4, 0x3b, 0x44, 0x29, 0xaf, 0x41, 0x0e,
+  0xe9, 0x8f, 0x03, 0x9d, 0x71, 0x4c, 0xdc, 0x21, 0x4a, 0xe3, 0xc5, 0xea, 0x0d, 0xf3, 0xcb, 0x8f,
+  0xae, 0xa6, 0x92, 0x3b, 0xe3, 0x2e, 0xdb, 0x2a, 0xaf, 0x46, 0x0e, 0xe5, 0x5f, 0x07, 0xc6, 0xc8,
+  0x78, 0x3a, 0xee, 0x10, 0x6b, 0xee, 0x3e, 0xe9, 0x0d, 0xad, 0xfb, 0x84, 0x0e, 0xf4, 0xca, 0x5b,
+  0x6e, 0x87, 0xb8, 0xf5, 0xf5, 0xcd, 0xa1, 0xfa, 0x70, 0xf5, 0xb2, 0x76, 0xbe, 0xda, 0x65, 0x47,
+  0x6b, 0x98, 0x72, 0xf6, 0xc8, 0xcb, 0x9e, 0xae, 0x06, 0x73, 0x50, 0xd3, 0x28, 0x78, 0x02, 0xdd,
+  0x9a, 0xda, 0x61, 0xbb, 0x0b, 0x80, 0xa1, 0xf9, 0xe6, 0x37, 0xc3, 0x04, 0x67, 0x37, 0x48, 0xe7,
+  0xa2, 0x9d, 0xf6, 0x82, 0xba, 0x93, 0x3a, 0xd4, 0x5f, 0x0e, 0xbc, 0x93, 0x00, 0x0a, 0x87, 0x81,
+  0x48, 0x77, 0x88, 0xf8, 0x5c, 0xc3, 0xf4, 0x86, 0xe6, 0xd3, 0x81, 0xfa, 0x3a, 0x48, 0x97, 0x3c,
+  0x0c, 0xd2, 0x9d, 0x72, 0xfb, 0xcf, 0x06, 0xa8, 0x37, 0xcc, 0xbf, 0x5d, 0xd2, 0x53, 0xf0, 0x30,
+  0x0b, 0xe6, 0xbb, 0x1c, 0xf5, 0x0b, 0x05, 0x12, 0xe4, 0xa7, 0xfa, 0x72, 0xe0, 0x55, 0x87, 0x78,
+  0xbb, 0xc2, 0xf9, 0x7e, 0x12, 0xe0, 0xe8, 0x06, 0x53, 0x6f, 0x88, 0xe7, 0x9c, 0x0e, 0x84, 0x41,
+  0x34, 0x89, 0x77, 0x88, 0x10, 0xf5, 0x0b, 0x32, 0xf3, 0x0e, 0xf1, 0x5f, 0x1b, 0xdf, 0xfe, 0x32,
+  0xb4, 0x42, 0xa5, 0xd0, 0xdd, 0xd1, 0xf2, 0xf2, 0xd7, 0xd9, 0x66, 0xdb, 0xa0, 0x4e, 0x94, 0xcd,
+  0x55, 0x7b, 0xb5, 0x55, 0x40, 0x80, 0xd5, 0x25, 0xaf, 0x11, 0x44, 0xbd, 0xbe, 0xd9, 0x20, 0xcb,
+  0x0b, 0x5a, 0x33, 0x12, 0xe5, 0x25, 0x7e, 0x0b, 0x9c, 0x6b, 0xc1, 0x6a, 0x04, 0xd2, 0xbe, 0xd1,
+  0x6f, 0x93, 0x59, 0x5e, 0x8c, 0x9a, 0xd1, 0xa9, 0xee, 0xf3, 0x5b, 0x00, 0x9d, 0x6b, 0x4d, 0x23,
+  0xa0, 0x85, 0x0b, 0xee, 0x16, 0xe4, 0xea, 0x32, 0xd2, 0x08, 0xac, 0x89, 0x17, 0x60, 0xb7, 0xde,
+  0xb1, 0x48, 0x34, 0xe6, 0x25, 0x1d, 0x35, 0xc0, 0x26, 0xb5, 0x6e, 0x01, 0x68, 0x46, 0x71, 0x51,
+  0xba, 0x97, 0x28, 0xaf, 0xc8, 0xf5, 0x86, 0x84, 0xeb, 0xb8, 0x04, 0x16, 0x50, 0x97, 0xd0, 0x6e,
+  0x04, 0x35, 0x97, 0xd0, 0x36, 0x58, 0xa7, 0x40, 0x6e, 0x04, 0xd7, 0x92, 0xbe, 0x1a, 0xb0, 0xbd,
+  0x43, 0x43, 0x2f, 0x3c, 0xf3, 0x27, 0x17, 0x14, 0x45, 0xd0, 0x40, 0x49, 0xdf, 0x08, 0x27, 0x37,
+  0x76, 0x2c, 0x62, 0x36, 0x0a, 0x1d, 0xf3, 0xd9, 0xde, 0x9b, 0x01, 0x33, 0xee, 0x69, 0xdb, 0x41,
+  0x09, 0x39, 0xc0, 0x2c, 0x6e, 0x3d, 0x40, 0xaa, 0xf5, 0x54, 0xc8, 0xa9, 0xdc, 0x75, 0xd2, 0x63,
+  0x14, 0x6b, 0xea, 0xc4, 0x9b, 0xc3, 0xae, 0x27, 0x88, 0x70, 0xf7, 0x76, 0xfc, 0xc3, 0x60, 0xf1,
+  0x59, 0x6f, 0xd8, 0x50, 0xa2, 0xa2, 0x5f, 0x8a, 0xf2, 0xe7, 0xf1, 0x2a, 0x3b, 0x38, 0x2c, 0x38,
+  0x3b, 0x18, 0x62, 0x8f, 0x1c, 0x33, 0xb9, 0x3b, 0xa2, 0xf5, 0xbd, 0x7c, 0x8d, 0x5e, 0xef, 0x8b,
+  0x60, 0xdf, 0x7a, 0x50, 0xd9, 0x12, 0xa1, 0x91, 0xe6, 0x21, 0xed, 0x67, 0xc8, 0xdb, 0x70, 0x12,
+  0x27, 0xb0, 0x52, 0xeb, 0xeb, 0xd8, 0x43, 0x13, 0x97, 0xc4, 0x46, 0x50, 0xbc, 0x8d, 0x3d, 0x3c,
+  0x1c, 0x0c, 0x14, 0x02, 0x36, 0x87, 0x9d, 0x61, 0xa0, 0xe2, 0x22, 0x69, 0x3f, 0xc7, 0x96, 0xf2,
+  0x1d, 0xb4, 0x6b, 0x7a, 0x45, 0x4f, 0x42, 0xd8, 0x91, 0x9f, 0x78, 0x03, 0x0f, 0x7d, 0x00, 0x4f,
+  0xbc, 0x43, 0x34, 0x6b, 0x93, 0xeb, 0xdf, 0x89, 0x77, 0x80, 0x9f, 0x74, 0xb2, 0x47, 0xe9, 0xdb,
+  0xfb, 0x1c, 0x9a, 0xa1, 0x57, 0x3b, 0x53, 0x52, 0xc1, 0xac, 0x6b, 0xf6, 0x77, 0xb6, 0x59, 0x69,
+  0xaa, 0xf0, 0x16, 0xff, 0x10, 0x2f, 0xeb, 0xb7, 0xde, 0xbe, 0xb1, 0xb6, 0x9d, 0x9a, 0x17, 0x74,
+  0x83, 0xcf, 0xc4, 0x28, 0xae, 0xba, 0x14, 0x55, 0x2f, 0xff, 0xbb, 0x58, 0x50, 0xf9, 0xdc, 0x2b,
+  0xfb, 0x10, 0x73, 0x87, 0x13, 0xa0, 0xe3, 0x47, 0x8c, 0x4d, 0x80, 0xde, 0xc9, 0x48, 0x14, 0xba,
+  0x23, 0xc3, 0xcf, 0x16, 0xd9, 0x18, 0x74, 0x61, 0xe9, 0x7f, 0xa6, 0x81, 0x59, 0xb3, 0x3c, 0xbf,
+  0x7f, 0x6f, 0x3c, 0x28, 0x2b, 0x0e, 0x10, 0x4a, 0x72, 0x41, 0x31, 0x09, 0xa6, 0xb6, 0xba, 0xc3,
+  0xf5, 0xb2, 0xbe, 0x7e, 0x31, 0x8c, 0x59, 0x91, 0x50, 0xc5, 0xc9, 0x92, 0x58, 0x65, 0x0c, 0xb5,
+  0xd3, 0xd0, 0x96, 0x56, 0xd3, 0x1d, 0xce, 0xe2, 0x74, 0x04, 0x4e, 0x71, 0x17, 0xd0, 0xe5, 0x2b,
+  0x9d, 0xfe, 0xac, 0xbc, 0x35, 0x26, 0x3c, 0x4c, 0xc5, 0xdd, 0xe3, 0x34, 0x90, 0x19, 0xae, 0x06,
+  0xe9, 0x9b, 0x32, 0x4e, 0x3c, 0x75, 0xbb, 0x7b, 0x88, 0x89, 0x8a, 0xab, 0x9c, 0xc6, 0x40, 0x77,
+  0x0a, 0x36, 0x39, 0xac, 0x55, 0x46, 0x43, 0x1f, 0x74, 0x49, 0xda, 0x75, 0xa6, 0x26, 0xd7, 0x72,
+  0x86, 0xad, 0x84, 0x6b, 0x90, 0x3e, 0xb1, 0xf5, 0x81, 0x1a, 0x5c, 0x20, 0x3b, 0x39, 0xe9, 0x79,
+  0xec, 0xa3, 0x63, 0x27, 0x76, 0xe5, 0xe3, 0x50, 0xf0, 0xe6, 0xab, 0xcc, 0x2b, 0xed, 0xc8, 0xb7,
+  0x79, 0xc2, 0x39, 0xbb, 0xc4, 0x92, 0xdc, 0xb3, 0x24, 0x97, 0x1c, 0x5a, 0x04, 0x93, 0x29, 0xa6,
+  0x22, 0x7b, 0x19, 0x8a, 0x74, 0x90, 0x79, 0x42, 0xdb, 0x72, 0xa4, 0x2c, 0x96, 0x16, 0x1b, 0x12,
+  0xb3, 0x8b, 0xe1, 0x8b, 0x80, 0x91, 0xa9, 0x8c, 0xad, 0x44, 0x38, 0x86, 0x0c, 0x8c, 0xf4, 0xb6,
+  0xc6, 0x1b, 0xd5, 0xa8, 0xd8, 0xa2, 0xf1, 0x17, 0x7a, 0x75, 0x2a, 0xee, 0xb1, 0x17, 0x22, 0x11,
+  0x98, 0x81, 0x47, 0x59, 0xca, 0x6f, 0x99, 0x65, 0x33, 0x21, 0xbd, 0xe6, 0xa1, 0x4e, 0x0c, 0x58,
+  0xe2, 0x09, 0x25, 0x2d, 0x12, 0xfc, 0x2f, 0x9e, 0x26, 0x7c, 0x3e, 0x17, 0x3e, 0xe6, 0xa4, 0x2d,
+  0xe8, 0xe9, 0x78, 0xd5, 0x67, 0xa7, 0x28, 0x3a, 0x18, 0x8f, 0xd6, 0xba, 0xac, 0x14, 0x46, 0x29,
+  0x42, 0x08, 0x60, 0xe9, 0x49, 0x80, 0x50, 0xb6, 0x0a, 0xb2, 0x19, 0x65, 0x92, 0x14, 0xeb, 0x3f,
+  0xd9, 0x5f, 0x14, 0x65, 0xe4, 0xd8, 0xba, 0xb7, 0x7b, 0x77, 0x21, 0x69, 0x0c, 0x4a, 0x46, 0x2e,
+  0x5a, 0xa8, 0x94, 0x82, 0xbd, 0x33, 0x5c, 0xc6, 0x90, 0xe4, 0x42, 0x46, 0xaa, 0xf7, 0xee, 0x9a,
+  0x25, 0x4d, 0x48, 0x2e, 0x44, 0x46, 0x29, 0xdf, 0x19, 0x32, 0xdb, 0x70, 0xe4, 0x6c, 0x1a, 0x29,
+  0xdc, 0xbb, 0x6b, 0x9b, 0xb2, 0x18, 0xb9, 0x50, 0xe5, 0x8a, 0xfc, 0xce, 0xd0, 0x15, 0xcc, 0x44,
+  0x2e, 0x9c, 0x4a, 0xc5, 0xdf, 0x19, 0x42, 0x63, 0x1e, 0x72, 0xf6, 0xa5, 0x56, 0xfe, 0x77, 0x3c,
+  0x03, 0x94, 0x55, 0xc8, 0xd9, 0xbe, 0xc2, 0xbe, 0x60, 0x77, 0xcd, 0x2c, 0x9b, 0x81, 0xdc, 0xcd,
+  0x95, 0x1a, 0xff, 0x0e, 0x5b, 0xab, 0xad, 0x3f, 0x2e, 0x74, 0x66, 0x2f, 0xb1, 0x33, 0x7c, 0x96,
+  0xcd, 0xc7, 0x85, 0x30, 0xdf, 0x65, 0xec, 0x0c, 0xa3, 0x6d, 0xe8, 0x71, 0xa1, 0x44, 0x9b, 0xcb,
+  0xce, 0x90, 0xa1, 0x99, 0x85, 0x49, 0x9b, 0x8b, 0x1b, 0x1b, 0x1a, 0x5c, 0x76, 0x86, 0x4d, 0x1a,
+  0x59, 0x0c, 0x1a, 0x5a, 0x0b, 0x67, 0x87, 0x43, 0x75, 0x3e, 0x0d, 0xab, 0xda, 0xa1, 0xb5, 0x2a,
+  0x5a, 0x27, 0xcb, 0x43, 0x7b, 0xc5, 0xb4, 0x15, 0xf4, 0x29, 0x79, 0x86, 0x22, 0x66, 0xaf, 0xb0,
+  0x0b, 0x90, 0x75, 0xd1, 0xeb, 0x5f, 0xba, 0x1d, 0xba, 0xb4, 0x7a, 0x8f, 0xd1, 0x0d, 0xb7, 0x59,
+  0x1c, 0x82, 0x64, 0x38, 0x51, 0xe7, 0xbb, 0x74, 0xa2, 0xab, 0x5b, 0x8a, 0xa7, 0x6b, 0x6e, 0x45,
+  0x5f, 0xc2, 0xbf, 0xe4, 0xd7, 0xbb, 0x9c, 0x4e, 0xd7, 0x42, 0x2b, 0x27, 0x2c, 0x8c, 0xe3, 0x1a,
+  0xe9, 0x2f, 0x31, 0x9f, 0x91, 0x83, 0xfb, 0xce, 0x70, 0x4b, 0x70, 0xea, 0x70, 0xdf, 0x3d, 0x40,
+  0xe8, 0x70, 0xa0, 0x06, 0x48, 0x79, 0x1c, 0x29, 0x6a, 0x2c, 0x8f, 0x24, 0x8d, 0x7a, 0xd5, 0x83,
+  0x5d, 0x15, 0x21, 0xf7, 0x98, 0x0c, 0xab, 0xec, 0xfd, 0x78, 0x08, 0x5b, 0x2b, 0xe9, 0x40, 0x03,
+  0x7b, 0xae, 0x47, 0x03, 0x1c, 0x52, 0x09, 0x67, 0xab, 0xed, 0xa2, 0xe5, 0xcc, 0xe8, 0x69, 0x6a,
+  0x18, 0xfe, 0xb2, 0x37, 0x8d, 0x56, 0x21, 0xb5, 0x6f, 0x3c, 0x30, 0xdb, 0xc6, 0x09, 0xfa, 0x02,
+  0xa6, 0x6c, 0x01, 0x6a, 0x95, 0xdc, 0x3c, 0xba, 0xf6, 0x8e, 0x36, 0x16, 0xc7, 0xf6, 0xf1, 0xc0,
+  0x6c, 0x1f, 0xcd, 0xe6, 0xd1, 0x6c, 0xd2, 0x0e, 0xee, 0xb8, 0x73, 0x54, 0xa8, 0x77, 0xc7, 0x4d,
+  0x78, 0x0f, 0x71, 0xa1, 0x87, 0xad, 0x32, 0xa0, 0xe8, 0x73, 0xab, 0x46, 0x73, 0x41, 0xbb, 0xfb,
+  0x54, 0xea, 0x6d, 0x9c, 0x91, 0xc7, 0xae, 0xbe, 0xed, 0x02, 0x9d, 0x1f, 0x82, 0xe6, 0x47, 0xea,
+  0x5c, 0x26, 0xe6, 0x8b, 0x58, 0x2b, 0x7e, 0xf3, 0x65, 0x1a, 0x8c, 0xfb, 0xec, 0x8a, 0x2f, 0x18,
+  0x0f, 0x63, 0x19, 0x61, 0x18, 0x67, 0x8f, 0x29, 0xd8, 0xa5, 0x4f, 0x72, 0x4f, 0x07, 0x3d, 0x76,
+  0xc1, 0x82, 0x14, 0x13, 0x5a, 0x7e, 0xbc, 0x8a, 0x10, 0x03, 0x54, 0x25, 0x70, 0x2a, 0x9e, 0x6f,
+  0xca, 0xd0, 0xc7, 0x03, 0x2a, 0x44, 0x22, 0x5b, 0xc5, 0x09, 0xea, 0x98, 0x3e, 0xfd, 0xce, 0xc5,
+  0x2b, 0xe0, 0x49, 0x25, 0x8e, 0x00, 0x6b, 0xa3, 0x7e, 0xa9, 0x7c, 0xa1, 0xe7, 0xf1, 0xb5, 0x48,
+  0xa5, 0x3a, 0x0a, 0x90, 0x5b, 0x82, 0x27, 0x20, 0xae, 0x13, 0xa4, 0x68, 0xce, 0x3f, 0x09, 0x06,
+  0xf2, 0x01, 0x1d, 0x1e, 0x31, 0xdf, 0x17, 0x21, 0x37, 0xba, 0x6b, 0x19, 0xd5, 0xab, 0xe7, 0x67,
+  0x69, 0x55, 0x5b, 0x45, 0x90, 0xd0, 0xca, 0x9d, 0x8d, 0x0b, 0xc0, 0xaa, 0xd3, 0xea, 0x78, 0x76,
+  0xa6, 0x7a, 0x67, 0x77, 0xf3, 0x5a, 0x01, 0x74, 0x9f, 0x56, 0x3b, 0x24, 0xa8, 0x35, 0xe5, 0x2a,
+  0xae, 0xdb, 0x43, 0xe9, 0xa8, 0xbd, 0x90, 0x8e, 0xda, 0xae, 0xf9, 0x53, 0xa9, 0xe2, 0x16, 0xbb,
+  0xb2, 0x59, 0xca, 0x4f, 0xbc, 0x38, 0xb5, 0x0e, 0x1e, 0x99, 0x19, 0xf5, 0xd0, 0x2b, 0x6e, 0x94,
+  0x36, 0x0b, 0x08, 0xdb, 0xf9, 0x7d, 0xa8, 0x3e, 0x6c, 0xd9, 0x50, 0xf1, 0x78, 0x1f, 0x6e, 0x6d,
+  0x51, 0xb2, 0x41, 0x3b, 0xa4, 0x42, 0xef, 0xf0, 0xc8, 0xd8, 0x95, 0x8e, 0x8c, 0x64, 0x38, 0x32,
+  0xed, 0xb8, 0x8d, 0x60, 0xb0, 0x8f, 0x1d, 0x8a, 0x1c, 0xb8, 0x95, 0x01, 0x93, 0x82, 0x99, 0x92,
+  0xa3, 0x12, 0x54, 0x34, 0x71, 0x98, 0x8b, 0x86, 0xfd, 0x0a, 0xb7, 0x35, 0x84, 0xac, 0x6b, 0xd7,
+  0x82, 0x2f, 0xb9, 0xfd, 0x6f, 0xb0, 0xda, 0xd4, 0xe2, 0x28, 0xde, 0x0c, 0x38, 0x2e, 0x5a, 0x08,
+  0x6a, 0xae, 0x16, 0x74, 0x3a, 0xe8, 0x41, 0xf9, 0xb0, 0x4a, 0x4f, 0x7e, 0x35, 0xa2, 0xde, 0xfe,
+  0xb4, 0xe9, 0x6e, 0x84, 0xfb, 0x8a, 0x45, 0x67, 0x13, 0x92, 0xa6, 0xed, 0xd5, 0xb5, 0x1d, 0x2d,
+  0x2d, 0x61, 0x25, 0x73, 0x48, 0xde, 0x46, 0xcb, 0xbe, 0x60, 0xb3, 0x4e, 0x21, 0xd2, 0xa6, 0xdb,
+  0xf4, 0xbc, 0xf7, 0x8d, 0xed, 0xc8, 0xc3, 0xf8, 0x07, 0xdb, 0x3b, 0xe4, 0x23, 0x3a, 0xcb, 0xf1,
+  0x51, 0x7b, 0x2f, 0x85, 0xd5, 0x64, 0xaf, 0x78, 0x80, 0x61, 0xb6, 0xf0, 0x4d, 0x21, 0xab, 0x83,
+  0xb0, 0x32, 0xec, 0xc6, 0xc7, 0x66, 0xb7, 0x44, 0xaf, 0x4f, 0xcd, 0xb6, 0xc4, 0x5f, 0x7b, 0xc8,
+  0x76, 0xdb, 0xd6, 0xd3, 0x19, 0xdb, 0xb6, 0x8d, 0xaf, 0x3f, 0x90, 0xbb, 0x25, 0xfa, 0xdc, 0x5b,
+  0x64, 0x4b, 0x12, 0x36, 0x1e, 0xe0, 0xdd, 0xb6, 0x0f, 0x54, 0x50, 0xed, 0x2d, 0x3b, 0x61, 0xd3,
+  0x69, 0xdf, 0x2d, 0x29, 0xb0, 0xbc, 0x48, 0xb6, 0xa4, 0xe2, 0x86, 0xe3, 0xc1, 0x5b, 0xd2, 0x61,
+  0x02, 0x82, 0x6f, 0x47, 0xc4, 0xc6, 0xc3, 0xc4, 0x3b, 0x4c, 0x47, 0xe9, 0x5d, 0xd2, 0x60, 0x46,
+  0xde, 0x78, 0xf8, 0x78, 0xdb, 0xfe, 0x28, 0x7a, 0x9a, 0x6c, 0xdb, 0x2d, 0x5b, 0x9c, 0x58, 0xde,
+  0xba, 0x77, 0x74, 0x24, 0xf4, 0x6d, 0x3b, 0x67, 0xd3, 0x01, 0xe7, 0x2d, 0x89, 0xc8, 0xcf, 0x37,
+  0xb7, 0xa4, 0xe2, 0xa6, 0x03, 0xd1, 0x5b, 0xd2, 0x61, 0x9d, 0x87, 0x6e, 0x49, 0x88, 0xe3, 0x04,
+  0x15, 0x29, 0xb1, 0x2c, 0x18, 0x4d, 0x69, 0xc8, 0x3d, 0x44, 0xea, 0x16, 0x27, 0xcb, 0x60, 0xd1,
+  0x14, 0xb8, 0xf1, 0x06, 0xa9, 0x83, 0x5d, 0xd9, 0xf6, 0xbb, 0x31, 0xe0, 0x59, 0x42, 0x5e, 0x3c,
+  0xb7, 0x42, 0xe8, 0x73, 0xb4, 0x7b, 0x27, 0x14, 0x45, 0x67, 0x83, 0x83, 0x39, 0xa2, 0x80, 0xaf,
+  0x4d, 0x40, 0x0a, 0x0a, 0x8e, 0xc3, 0x2a, 0xf0, 0xb5, 0x48, 0x93, 0x48, 0x1a, 0x12, 0x67, 0xed,
+  0x6d, 0xdd, 0x74, 0x15, 0x6f, 0x2b, 0x96, 0x1e, 0xe1, 0x61, 0x3f, 0xc1, 0x7f, 0x25, 0xa5, 0xc8,
+  0xde, 0xab, 0x57, 0xce, 0x88, 0xca, 0x18, 0x65, 0xf4, 0x8a, 0x0a, 0x50, 0xef, 0x05, 0xc8, 0x73,
+  0x8d, 0x8c, 0x8e, 0x33, 0xed, 0x6d, 0xb3, 0xd7, 0x69, 0x6d, 0xfd, 0xf6, 0x4f, 0xb1, 0xa5, 0x8a,
+  0xa8, 0x8d, 0x91, 0x62, 0xb4, 0xba, 0x59, 0x31, 0x5a, 0x58, 0xea, 0xa6, 0xa3, 0x8d, 0x1d, 0xf7,
+  0x23, 0x45, 0x95, 0x0e, 0xdc, 0xaa, 0xab, 0xb6, 0x7f, 0xda, 0xc8, 0xed, 0xfb, 0xa0, 0x2d, 0x75,
+  0x5a, 0x49, 0xab, 0x9c, 0x60, 0x2d, 0x46, 0xbd, 0xa3, 0xfc, 0x18, 0x6b, 0x42, 0xde, 0x83, 0x64,
+  0x7f, 0x50, 0x36, 0x6b, 0x94, 0x13, 0xc6, 0x0c, 0x51, 0x38, 0xa3, 0xd2, 0xc6, 0x04, 0xe5, 0xe6,
+  0x1e, 0xd3, 0xa9, 0x93, 0xd4, 0x3b, 0xa9, 0x8c, 0x2f, 0x52, 0x10, 0x72, 0x64, 0x08, 0x80, 0x5a,
+  0x78, 0xfb, 0x80, 0xec, 0x03, 0x1c, 0xaf, 0x2d, 0x2e, 0x42, 0x3a, 0xcc, 0xd2, 0x87, 0x53, 0xb8,
+  0xfb, 0xd7, 0xf6, 0x0c, 0xb4, 0x41, 0x18, 0x90, 0x7e, 0x80, 0x8f, 0x02, 0xa1, 0xb9, 0x2d, 0x9d,
+  0x71, 0x34, 0x81, 0x40, 0xa5, 0xd5, 0x2c, 0xc8, 0x84, 0xb4, 0x02, 0x58, 0x9b, 0x4e, 0xbc, 0x69,
+  0x25, 0x83, 0x2f, 0xd9, 0x1b, 0xc3, 0x6a, 0x78, 0x70, 0x7b, 0x93, 0x0e, 0x58, 0x6f, 0x71, 0xd8,
+  0x8f, 0x57, 0x1f, 0x06, 0x5d, 0xf8, 0x5f, 0x07, 0x2d, 0x64, 0x84, 0xcb, 0xb9, 0x0d, 0xb6, 0x29,
+  0xb2, 0x4f, 0xbc, 0x84, 0x5f, 0xa5, 0x64, 0xfb, 0xf3, 0x2d, 0xe1, 0xbb, 0x8d, 0x13, 0x74, 0xbf,
+  0xf1, 0x0e, 0x80, 0x29, 0x96, 0x5c, 0x8d, 0xdd, 0x03, 0x9a, 0x7d, 0x07, 0xc8, 0x18, 0x9b, 0xce,
+  0x02, 0xbc, 0x75, 0x47, 0xad, 0x05, 0x1a, 0xb6, 0xee, 0x80, 0xf8, 0xef, 0x04, 0xa0, 0xe6, 0xd0,
+  0x63, 0xcd, 0xef, 0xd2, 0x5b, 0xa7, 0x50, 0xdd, 0x0d, 0x78, 0x0e, 0x33, 0x15, 0xe6, 0xd6, 0x1d,
+  0x60, 0xbf, 0x96, 0x10, 0x6e, 0xd3, 0x65, 0x87, 0x47, 0x83, 0xc1, 0x1d, 0x30, 0x63, 0xf5, 0xbf,
+  0xba, 0x9b, 0xf5, 0x60, 0x70, 0x27, 0xc8, 0x58, 0xbd, 0x06, 0xf2, 0xc3, 0xbb, 0x41, 0x7e, 0x58,
+  0x82, 0xbc, 0x75, 0x5f, 0x91, 0x18, 0xb9, 0x03, 0xe2, 0xf7, 0x52, 0x0c, 0x6d, 0x40, 0x5c, 0x0a,
+  0x87, 0xa7, 0x7c, 0x5c, 0x65, 0x3c, 0x3c, 0x7d, 0xd9, 0xa2, 0x6c, 0x4e, 0x42, 0x37, 0x9f, 0x3c,
+  0x0a, 0x27, 0x5d, 0xfe, 0xb6, 0xd3, 0x74, 0xa4, 0xca, 0x62, 0xaa, 0x8a, 0x29, 0x59, 0x4c, 0x24,
+  0xfa, 0xac, 0x54, 0x42, 0xe8, 0x8a, 0x69, 0x64, 0xe7, 0xbf, 0xe2, 0x69, 0x96, 0xbf, 0x60, 0xe6,
+  0x79, 0x76, 0x9e, 0x2d, 0x45, 0xe5, 0xd5, 0xbf, 0x6f, 0xaa, 0x19, 0x7b, 0x1d, 0xfb, 0xde, 0x55,
+  0x1b, 0xa3, 0x1b, 0x46, 0xa0, 0xc0, 0x9d, 0xf2, 0x30, 0xc4, 0x9b, 0x5b, 0xc7, 0xd6, 0xf2, 0xfa,
+  0xad, 0x08, 0xe7, 0x5d, 0x26, 0x5d, 0x7e, 0x7d, 0xed, 0xe2, 0x24, 0xaf, 0x68, 0xe9, 0xd8, 0x29,
+  0xf6, 0xb5, 0xad, 0xc7, 0xad, 0x38, 0xb2, 0x03, 0x8a, 0x4b, 0x87, 0x15, 0xeb, 0x1e, 0xb7, 0xba,
+  0xdd, 0x05, 0xe2, 0xb9, 0x9f, 0xc8, 0xcb, 0xe2, 0xb0, 0x86, 0xba, 0xf3, 0xa7, 0x37, 0xe4, 0x8f,
+  0x4c, 0x3e, 0x2d, 0xc1, 0x37, 0xbe, 0x38, 0xf1, 0x75, 0xa9, 0x50, 0x21, 0xc5, 0xc8, 0xb0, 0x62,
+  0x16, 0x0f, 0xb7, 0x8e, 0xe6, 0xea, 0x22, 0x00, 0x41, 0x17, 0x65, 0x07, 0xd4, 0x1a, 0xad, 0x07,
+  0xd9, 0xeb, 0xc5, 0xf6, 0xb0, 0x00, 0x86, 0x01, 0x67, 0x99, 0x3c, 0xf2, 0x05, 0xa2, 0x11, 0x28,
+  0x03, 0x2d, 0x07, 0x55, 0x10, 0xfa, 0x0d, 0xdb, 0xe8, 0xa0, 0xcc, 0x12, 0xf3, 0xcd, 0x1b, 0x59,
+  0xa6, 0xad, 0x28, 0xda, 0x9b, 0x0f, 0x40, 0x19, 0x9e, 0x25, 0xad, 0x1b, 0x00, 0x1b, 0x3c, 0xea,
+  0xb2, 0xa3, 0xef, 0x41, 0x3b, 0xfc, 0xa1, 0x00, 0xcc, 0x12, 0xd0, 0x0d, 0x80, 0x3d, 0x00, 0x8a,
+  0xbe, 0x3f, 0xe8, 0xb2, 0x07, 0xc5, 0x6e, 0x7b, 0x78, 0x3b, 0x60, 0x40, 0xd1, 0x8f, 0x3f, 0x76,
+  0xd9, 0xa3, 0x07, 0x05, 0x60, 0xb6, 0xa0, 0x6d, 0xca, 0x1e, 0xb2, 0xd7, 0x2a, 0x3e, 0x82, 0xd5,
+  0xe2, 0x09, 0xde, 0xce, 0x9e, 0xca, 0x78, 0xb8, 0x23, 0x8a, 0xa3, 0x47, 0x68, 0x4b, 0x0e, 0x80,
+  0x28, 0x52, 0x61, 0xfb, 0x84, 0xf1, 0x2a, 0xfe, 0xf5, 0xaf, 0xa2, 0x4c, 0x85, 0x64, 0x19, 0xa3,
+  0x22, 0xcf, 0x20, 0xb1, 0x0a, 0xe9, 0x14, 0x8e, 0x22, 0x4f, 0x96, 0x82, 0x15, 0xd2, 0x0d, 0x86,
+  0x82, 0xc0, 0x06, 0xe0, 0xad, 0x92, 0xb4, 0x26, 0xc0, 0xad, 0xa2, 0xb0, 0x46, 0xa0, 0xad, 0x92,
+  0xa8, 0x26, 0x80, 0x37, 0x05, 0xbe, 0xd3, 0x4b, 0x07, 0xa4, 0xa8, 0xaf, 0x63, 0x2c, 0x8c, 0x31,
+  0x97, 0x31, 0x66, 0xad, 0x0f, 0xe9, 0x32, 0x32, 0xf2, 0xb1, 0xea, 0x8f, 0x96, 0x8c, 0x5d, 0x7c,
+  0x2c, 0xfb, 0xa5, 0xe5, 0x11, 0x36, 0xf8, 0x29, 0xb1, 0x7d, 0x71, 0x39, 0xd6, 0x15, 0x17, 0x0b,
+  0xed, 0x55, 0x57, 0xbf, 0x84, 0xb8, 0x5d, 0xea, 0xd0, 0xa9, 0xee, 0xb2, 0x66, 0x3f, 0x62, 0x8c,
+  0xb6, 0xdb, 0x6f, 0x48, 0x54, 0x95, 0x2d, 0x76, 0x24, 0xda, 0x65, 0x4e, 0x99, 0xa1, 0x71, 0x0b,
+  0x12, 0xa4, 0x32, 0x75, 0x91, 0xc4, 0xfe, 0x72, 0x0c, 0x1b, 0x09, 0xae, 0x73, 0x61, 0x57, 0x12,
+  0x52, 0xad, 0x15, 0x5f, 0xc3, 0x2e, 0x05, 0x85, 0xb0, 0xb5, 0xad, 0xe1, 0x91, 0xdf, 0x4a, 0x41,
+  0x22, 0x85, 0x6b, 0xd8, 0x81, 0x04, 0x93, 0x4c, 0x9e, 0x62, 0xca, 0x9e, 0x48, 0x19, 0x99, 0x99,
+  0x57, 0x41, 0x0a, 0xbb, 0x9c, 0xb7, 0x11, 0x2d, 0x59, 0xe4, 0xcc, 0x57, 0x21, 0x28, 0x5d, 0x08,
+  0xf4, 0xd3, 0x9b, 0xc8, 0x22, 0x3c, 0x45, 0x5f, 0xc0, 0x10, 0xff, 0xe2, 0x66, 0x67, 0x94, 0x20,
+  0xa6, 0x08, 0x7a, 0x4f, 0x9f, 0x7b, 0x12, 0xea, 0xca, 0x0e, 0x67, 0x93, 0x3a, 0x61, 0x2e, 0x52,
+  0x96, 0x7c, 0xde, 0xcd, 0xf6, 0x4f, 0x9a, 0xa9, 0x1b, 0xec, 0xfe, 0xb0, 0x42, 0xb1, 0xab, 0x5f,
+  0xaa, 0x16, 0xca, 0xde, 0x35, 0x3d, 0xb4, 0x0a, 0xa0, 0x29, 0xbe, 0xf4, 0x4e, 0x97, 0x9d, 0xa3,
+  0x1c, 0x24, 0xf0, 0x3e, 0x12, 0x86, 0x2d, 0x3c, 0x38, 0x64, 0xb3, 0x04, 0xb7, 0x78, 0x73, 0x9e,
+  0xb1, 0x65, 0x90, 0xaa, 0x3d, 0x5e, 0x16, 0x2f, 0xe8, 0x60, 0x77, 0x44, 0x71, 0x21, 0x58, 0x8a,
+  0xfb, 0x7c, 0xbb, 0xfd, 0xaa, 0x4b, 0x71, 0x20, 0xf5, 0xd9, 0xb4, 0x01, 0x8d, 0x2f, 0xe6, 0x74,
+  0xcd, 0xb1, 0xb0, 0x82, 0xa0, 0xca, 0xc8, 0x47, 0x4a, 0xd4, 0xf9, 0xb3, 0x98, 0x64, 0x2d, 0x04,
+  0x2a, 0x66, 0x8a, 0xda, 0x44, 0x90, 0x3d, 0x24, 0x82, 0x81, 0x1c, 0x18, 0x00, 0x49, 0x39, 0x4b,
+  0x04, 0x90, 0x9c, 0x00, 0xe5, 0x40, 0x38, 0x6c, 0x12, 0x1f, 0x0d, 0x00, 0x68, 0xda, 0x67, 0x7f,
+  0x37, 0xde, 0x99, 0x31, 0x3e, 0x1e, 0x9c, 0x73, 0x02, 0x10, 0xde, 0xc2, 0x5f, 0x48, 0x17, 0x41,
+  0x95, 0x44, 0xe4, 0x5b, 0xe3, 0xd5, 0x0c, 0xda, 0x8e, 0x5c, 0xb1, 0x8a, 0x97, 0xa1, 0x6f, 0xb6,
+  0xc6, 0x2f, 0x27, 0xd2, 0x15, 0x94, 0xf8, 0x08, 0x1b, 0x80, 0xd1, 0x96, 0x30, 0x1a, 0xea, 0x3a,
+  0x1a, 0xb7, 0x8c, 0x2f, 0x28, 0xb9, 0x74, 0x12, 0x9d, 0xf4, 0x6a, 0xab, 0x8e, 0xbe, 0xd0, 0x8e,
+  0xe2, 0x4c, 0xc8, 0x21, 0x49, 0x67, 0x04, 0x76, 0x04, 0x5b, 0xec, 0x25, 0x74, 0x05, 0xcf, 0x02,
+  0x0c, 0x7e, 0xb0, 0x66, 0x3e, 0x39, 0x8d, 0x46, 0xea, 0x64, 0x1d, 0x9f, 0xcd, 0xa6, 0xad, 0x36,
+  0x40, 0xee, 0x48, 0xf6, 0xc2, 0x91, 0x56, 0x7d, 0x5a, 0xf6, 0xef, 0x27, 0x9a, 0xde, 0x25, 0x41,
+  0x94, 0xbd, 0x5d, 0x66, 0xf6, 0xed, 0x81, 0xc3, 0xad, 0xd4, 0x6b, 0xe7, 0x8b, 0x45, 0xb7, 0xdf,
+  0x7c, 0x0f, 0x11, 0x54, 0x6b, 0x93, 0x27, 0x69, 0xcd, 0xbb, 0x33, 0x77, 0x40, 0x29, 0x81, 0x55,
+  0x91, 0x96, 0x54, 0x76, 0xd3, 0x52, 0xa7, 0x64, 0xd4, 0x64, 0x39, 0x33, 0x2d, 0x75, 0x5d, 0xbd,
+  0xeb, 0x65, 0xe2, 0x80, 0x95, 0x1f, 0xf4, 0x72, 0x65, 0x68, 0xbd, 0xdf, 0x4e, 0x97, 0x6f, 0x30,
+  0x39, 0x52, 0x9d, 0x50, 0xd4, 0xb3, 0x4b, 0x79, 0xb2, 0x6b, 0xd4, 0xb4, 0xb2, 0xef, 0xca, 0xfb,
+  0xba, 0xfa, 0x3e, 0x62, 0x93, 0x90, 0x7f, 0x0f, 0x6d, 0xbf, 0xb3, 0xe5, 0xab, 0x5b, 0xbf, 0x8b,
+  0xb6, 0x6f, 0x46, 0xa3, 0xca, 0xd2, 0xf6, 0x78, 0x54, 0x73, 0xbf, 0xee, 0x88, 0x00, 0xbe, 0x3f,
+  0x7a, 0x40, 0x5c, 0x6f, 0x4b, 0xfd, 0x4e, 0x1b, 0xb0, 0xa2, 0xda, 0x2a, 0x6f, 0x72, 0xa2, 0x3a,
+  0x5b, 0x52, 0x50, 0xad, 0x0c, 0x75, 0x9f, 0x22, 0x8b, 0x7d, 0xbe, 0x56, 0xa1, 0xe8, 0x70, 0xfe,
+  0xb7, 0x55, 0x98, 0xd3, 0x19, 0x86, 0x39, 0xa3, 0x4c, 0x0c, 0xf7, 0x85, 0xac, 0x96, 0x42, 0x9d,
+  0xff, 0xc1, 0x35, 0xf3, 0x09, 0xf9, 0x0f, 0xfc, 0xc4, 0xd0, 0x3b, 0xe5, 0x3e, 0x73, 0x97, 0x39,
+  0x76, 0xa7, 0x13, 0xe8, 0x79, 0x01, 0xb4, 0xec, 0x34, 0x2c, 0x50, 0x03, 0x37, 0x2f, 0x70, 0xec,
+  0x48, 0x94, 0xb1, 0xb8, 0x0a, 0x10, 0x2f, 0xa5, 0x3b, 0x4e, 0x3d, 0xc4, 0xbc, 0xc0, 0xb1, 0x23,
+  0x91, 0x20, 0xf2, 0xf9, 0x62, 0xee, 0xec, 0x81, 0xe1, 0x09, 0x34, 0x03, 0x61, 0xee, 0xbd, 0x7b,
+  0x4d, 0x31, 0x59, 0x9e, 0xbe, 0xde, 0x7b, 0xdc, 0x72, 0xf7, 0x16, 0x68, 0xe2, 0x84, 0x7e, 0x86,
+  0xa7, 0x03, 0x07, 0x87, 0xca, 0x66, 0x91, 0xc9, 0x80, 0xd0, 0xb8, 0xaa, 0x81, 0x58, 0x6f, 0x9b,
+  0x21, 0x41, 0xb3, 0x3a, 0x3d, 0x75, 0x6f, 0xdc, 0x04, 0xcc, 0x1a, 0xa7, 0xcc, 0xfa, 0x33, 0x0a,
+  0xb6, 0x8f, 0x4d, 0x99, 0x9b, 0xaf, 0x94, 0xde, 0x98, 0xc0, 0x2f, 0x24, 0xb9, 0x53, 0xbc, 0x42,
+  0x53, 0x96, 0x52, 0xe5, 0xbd, 0x48, 0x69, 0x13, 0xa2, 0x25, 0x7d, 0x65, 0x23, 0x92, 0xcb, 0x7a,
+  0xc7, 0x66, 0xc4, 0xc8, 0x7b, 0xb5, 0x21, 0xb1, 0xf6, 0x1d, 0xf9, 0xd2, 0x61, 0xed, 0x3d, 0xec,
+  0x85, 0xa3, 0xb0, 0xff, 0xb0, 0x16, 0x0e, 0xda, 0x83, 0xdc, 0xb8, 0xdd, 0x20, 0xd5, 0x11, 0x77,
+  0x1b, 0xf4, 0x41, 0x9b, 0x0d, 0xeb, 0xa5, 0xcb, 0x26, 0x9b, 0x0f, 0xb5, 0x2b, 0xa8, 0x6e, 0x37,
+  0xca, 0x2b, 0xa8, 0xd9, 0x71, 0x6c, 0x5c, 0x5a, 0x6b, 0x36, 0x1d, 0x76, 0xd8, 0xf5, 0xa2, 0xb4,
+  0xba, 0x61, 0x60, 0xd4, 0xd2, 0x59, 0x19, 0x17, 0xb3, 0x78, 0x3a, 0x86, 0x45, 0x2f, 0xa0, 0xd5,
+  0x51, 0x31, 0x0b, 0xb1, 0x35, 0x28, 0xd6, 0x32, 0x5c, 0x18, 0x93, 0x7c, 0x19, 0xbe, 0xf5, 0x90,
+  0x80, 0xc6, 0xb9, 0xeb, 0x11, 0xb1, 0xb4, 0x96, 0xc2, 0x80, 0xd4, 0x69, 0x33, 0xb5, 0x9b, 0xc0,
+  0xba, 0x43, 0xa9, 0xdc, 0xd5, 0xa5, 0xc1, 0xce, 0x24, 0x77, 0x77, 0xb9, 0x69, 0x7b, 0x42, 0xf7,
+  0xab, 0x70, 0x77, 0x92, 0xce, 0xf8, 0xc2, 0xde, 0xb2, 0xc0, 0x7c, 0x8f, 0xc9, 0x8f, 0x16, 0xf2,
+  0xc6, 0x08, 0x49, 0xed, 0x10, 0xb1, 0xb6, 0xe0, 0x11, 0x69, 0xec, 0x23, 0xdc, 0x46, 0xe2, 0x99,
+  0x55, 0x0a, 0xf5, 0x94, 0x3e, 0xdd, 0x5a, 0x84, 0x82, 0xa7, 0xf2, 0x90, 0x8a, 0x47, 0x4a, 0x25,
+  0x9f, 0x2e, 0x43, 0x63, 0x22, 0x25, 0xe4, 0xfd, 0x2d, 0xcf, 0xa6, 0x9c, 0x6f, 0xe0, 0xed, 0xf6,
+  0x78, 0xaa, 0xa2, 0xab, 0x1a, 0x9c, 0xb5, 0xea, 0xa8, 0x7a, 0x1e, 0xd1, 0x68, 0x84, 0xe6, 0x5d,
+  0xc4, 0x42, 0x4a, 0x41, 0x69, 0x74, 0x36, 0x44, 0x29, 0x29, 0xce, 0xbc, 0xaf, 0xab, 0xa2, 0xbc,
+  0x8d, 0x0c, 0x5f, 0xfd, 0x81, 0xaa, 0x4a, 0xcd, 0x0b, 0x87, 0xbf, 0x8b, 0xa2, 0x62, 0x49, 0xc0,
+  0x9a, 0xce, 0xa8, 0x93, 0x84, 0x7a, 0xf4, 0x73, 0x19, 0x98, 0x8f, 0xbf, 0x2d, 0xfd, 0x0c, 0x0f,
+  0x58, 0x72, 0xef, 0x26, 0xa9, 0x65, 0xf9, 0xa9, 0xa1, 0x10, 0xca, 0x7f, 0x35, 0x16, 0x58, 0x15,
+  0x71, 0x55, 0x61, 0x6b, 0x2d, 0xaf, 0x36, 0xf3, 0x7b, 0x63, 0x81, 0xa5, 0x1d, 0xdd, 0x1a, 0xd8,
+  0x51, 0xa8, 0x46, 0x51, 0x52, 0x3d, 0x65, 0x69, 0x30, 0xc7, 0x13, 0x70, 0x3f, 0xc6, 0xe7, 0x95,
+  0xae, 0x51, 0xa0, 0x58, 0x76, 0x27, 0x10, 0x5b, 0xfd, 0xed, 0xcf, 0x91, 0x54, 0x88, 0xa7, 0x1a,
+  0xbb, 0x8f, 0xe5, 0x45, 0xd7, 0x80, 0x68, 0xcb, 0x93, 0xae, 0x48, 0xf9, 0x5f, 0xa3, 0x3c, 0xa7,
+  0xcf, 0x9e, 0xd2, 0xa1, 0x7c, 0xbc, 0x5a, 0xb3, 0x89, 0x25, 0x57, 0xc9, 0xd6, 0x80, 0xbe, 0x14,
+  0xd0, 0xa4, 0x94, 0xad, 0xe2, 0x24, 0x24, 0xcb, 0x17, 0x67, 0x73, 0x10, 0x99, 0xab, 0x59, 0x0c,
+  0xad, 0x16, 0x29, 0x8b, 0xa0, 0xe9, 0xe2, 0x33, 0x86, 0x61, 0x6c, 0xbd, 0x0e, 0xc6, 0x33, 0x2e,
+  0x42, 0x26, 0x81, 0x1f, 0x43, 0xc9, 0x35, 0x74, 0xc6, 0x94, 0x85, 0x31, 0x12, 0x09, 0x5c, 0xcc,
+  0xd9, 0x38, 0x59, 0xa6, 0x5c, 0xda, 0xf4, 0xa0, 0xec, 0x7c, 0x11, 0x28, 0x9b, 0xc6, 0x98, 0x2f,
+  0x53, 0x63, 0x35, 0x0a, 0xa2, 0x28, 0xc6, 0xc7, 0xc6, 0xba, 0xd2, 0x14, 0x23, 0x42, 0xe8, 0xe2,
+  0x34, 0x95, 0xb7, 0x1c, 0x16, 0xf1, 0x4a, 0x24, 0xf2, 0x67, 0x80, 0x00, 0x0d, 0x59, 0x30, 0xd0,
+  0x18, 0x09, 0x30, 0x4c, 0x89, 0xb4, 0x78, 0x21, 0x12, 0x74, 0xa8, 0xe0, 0xa3, 0xf8, 0x5a, 0x2f,
+  0x22, 0xab, 0x7e, 0x23, 0x4b, 0x9c, 0xed, 0x85, 0x58, 0x37, 0x2a, 0xc6, 0x49, 0x70, 0xfb, 0x21,
+  0x51, 0x55, 0x8a, 0xc3, 0xa1, 0x17, 0x2d, 0x24, 0x54, 0x17, 0xa0, 0x15, 0xa8, 0x19, 0xc9, 0x26,
+  0x68, 0xd6, 0x0d, 0x87, 0xa7, 0xf9, 0xd2, 0xe5, 0x78, 0xe6, 0xf2, 0x2b, 0xfb, 0x55, 0xd8, 0xe7,
+  0xa3, 0x0a, 0x7b, 0xf9, 0xac, 0xd2, 0xce, 0x2b, 0x9c, 0x9d, 0xaa, 0xb4, 0xd2, 0xd9, 0xa9, 0x76,
+  0x0b, 0x2d, 0x9c, 0x9d, 0xaa, 0xc4, 0xda, 0xd5, 0xd1, 0xd1, 0x70, 0xb5, 0xd0, 0x39, 0x72, 0xbe,
+  0xee, 0x32, 0x77, 0x69, 0xbb, 0xb5, 0xfe, 0x21, 0x4b, 0x9c, 0xf3, 0xb1, 0xd3, 0xdf, 0x7b, 0x81,
+  0x73, 0x74, 0xc3, 0x0d, 0x6a, 0xfe, 0xed, 0x0f, 0x81, 0xee, 0x74, 0xd6, 0x73, 0xd3, 0xf2, 0xa8,
+  0x67, 0x21, 0x24, 0xe9, 0xcf, 0xbb, 0x2f, 0x8c, 0x25, 0x7e, 0xd6, 0xcb, 0xe2, 0x26, 0x36, 0x77,
+  0x2e, 0x8a, 0x08, 0x18, 0x1b, 0x70, 0xef, 0xc4, 0x35, 0xfb, 0xbe, 0xfb, 0x8e, 0xdd, 0x19, 0xab,
+  0x6b, 0x4e, 0x03, 0xc6, 0xba, 0x60, 0x0d, 0x97, 0x1b, 0xfc, 0xdc, 0xa4, 0xaf, 0x74, 0x43, 0x57,
+  0x37, 0xe9, 0x2f, 0x5d, 0x94, 0xaf, 0x56, 0x3a, 0xed, 0x23, 0x30, 0xd2, 0x77, 0xe1, 0xe4, 0x83,
+  0xae, 0xe3, 0x49, 0x81, 0x27, 0x97, 0x95, 0x60, 0x41, 0x57, 0xf2, 0x78, 0x3a, 0x53, 0x4b, 0x54,
+  0x84, 0x69, 0xf6, 0xde, 0x83, 0xaf, 0xf8, 0xba, 0x99, 0x78, 0xb6, 0xbc, 0xb9, 0xb7, 0x97, 0xd0,
+  0xce, 0x27, 0x66, 0x7f, 0x47, 0x19, 0x6d, 0xf0, 0x3b, 0xa5, 0xb4, 0xc9, 0x2d, 0x98, 0xaa, 0x75,
+  0x62, 0xc9, 0x52, 0x6d, 0xbc, 0xe7, 0x0b, 0x86, 0x6a, 0x9d, 0x5a, 0x6f, 0x57, 0x77, 0xf5, 0x80,
+  0xe5, 0xb7, 0x52, 0xc9, 0xfb, 0xfa, 0xae, 0x2b, 0xd6, 0x25, 0x80, 0x3f, 0xc6, 0x7c, 0xea, 0x7e,
+  0x77, 0xf8, 0xf7, 0x16, 0xd9, 0xce, 0xae, 0xf8, 0xf7, 0x14, 0xda, 0xd6, 0xdc, 0x54, 0xe7, 0xf1,
+  0xea, 0xd7, 0xdd, 0x45, 0x77, 0x85, 0xc3, 0xed, 0x63, 0xf8, 0x7a, 0xd6, 0x77, 0xc8, 0x4b, 0x4b,
+  0x78, 0x3b, 0xa7, 0x65, 0x59, 0x7c, 0xdf, 0x12, 0x73, 0xcd, 0x94, 0xaf, 0x15, 0xe2, 0x1b, 0x37,
+  0x5a, 0xe6, 0x92, 0x46, 0x13, 0x29, 0x2e, 0xeb, 0x94, 0x65, 0xb8, 0x4a, 0x95, 0x12, 0x1c, 0xa0,
+  0xcd, 0x18, 0x46, 0xb6, 0x8e, 0xe7, 0x7a, 0xc2, 0xc2, 0xa6, 0x42, 0xcc, 0x97, 0x78, 0x55, 0x99,
+  0xe9, 0xab, 0x28, 0x4d, 0x05, 0xb4, 0x8e, 0x7b, 0xea, 0x96, 0x84, 0x32, 0xb7, 0x46, 0x10, 0xca,
+  0xcc, 0xa2, 0xaf, 0x9f, 0x4a, 0x2c, 0x3b, 0xfb, 0xe9, 0x7b, 0x32, 0x45, 0x6f, 0x3f, 0x95, 0xba,
+  0x41, 0x0e, 0x56, 0x5f, 0x91, 0x36, 0x62, 0xb0, 0x9a, 0xf5, 0xb5, 0xa5, 0xa0, 0x7d, 0xd7, 0xe7,
+  0x0f, 0x12, 0x82, 0xae, 0x57, 0xb5, 0x7f, 0x7f, 0x19, 0x58, 0xed, 0x88, 0x7f, 0x57, 0x11, 0xa8,
+  0xb8, 0x9f, 0x04, 0xa0, 0xfa, 0xde, 0x85, 0xf8, 0x2b, 0xf2, 0x75, 0x2e, 0x83, 0x36, 0xf0, 0xfb,
+  0x4d, 0xba, 0xab, 0x6b, 0x2e, 0x56, 0xa5, 0xdf, 0x2d, 0x10, 0xbb, 0x27, 0xf9, 0x2d, 0xf4, 0x57,
+  0xeb, 0x5e, 0xd8, 0xf6, 0x92, 0xcf, 0x54, 0x2a, 0x88, 0x3e, 0x13, 0x76, 0x12, 0x1f, 0x20, 0x40,
+  0xc3, 0x08, 0xc5, 0x8a, 0x24, 0x87, 0x29, 0x8a, 0x43, 0x86, 0x01, 0x89, 0x59, 0x9a, 0x71, 0x29,
+  0x02, 0x8d, 0x6e, 0xbb, 0x5c, 0x50, 0x04, 0x8e, 0x4f, 0x00, 0xae, 0xfb, 0x64, 0x94, 0xb0, 0xfd,
+  0x61, 0xeb, 0x69, 0xe4, 0x33, 0xba, 0xc4, 0x01, 0xac, 0x2b, 0x78, 0x02, 0x5a, 0x2f, 0x01, 0x90,
+  0x52, 0x93, 0x14, 0xde, 0xd0, 0x2a, 0x7d, 0x85, 0xbe, 0x2e, 0xd9, 0x2c, 0x5e, 0x4e, 0x29, 0xc8,
+  0xd8, 0x9a, 0x45, 0xe2, 0x1a, 0x20, 0x8a, 0x7f, 0x2e, 0x0d, 0x3e, 0x50, 0x96, 0xf1, 0xfd, 0x1b,
+  0x5d, 0xa3, 0xfd, 0x54, 0xda, 0xbe, 0x30, 0x46, 0x5a, 0x22, 0x54, 0x79, 0x24, 0x0f, 0xbd, 0xae,
+  0xa8, 0x02, 0x40, 0x9c, 0x21, 0xe6, 0x8e, 0xa6, 0x68, 0x3c, 0x0b, 0xa0, 0x14, 0xa6, 0xa3, 0x9b,
+  0x11, 0xba, 0x73, 0x41, 0x1d, 0x59, 0x1a, 0x54, 0xd6, 0x4f, 0x82, 0xbe, 0xb2, 0xbe, 0x2a, 0xfe,
+  0x36, 0x0a, 0xd7, 0x5d, 0x32, 0xf7, 0xe0, 0x99, 0xa1, 0xe8, 0x4a, 0x64, 0x63, 0x1e, 0xed, 0x65,
+  0x2c, 0x5d, 0xa6, 0xd8, 0xbf, 0xd2, 0x4c, 0x64, 0xd5, 0xe9, 0xf5, 0xd8, 0x45, 0x3c, 0x12, 0x49,
+  0xc6, 0xce, 0x93, 0x38, 0xcd, 0xba, 0xd6, 0x9d, 0x3d, 0xa6, 0x8a, 0xff, 0x99, 0x27, 0x3e, 0x70,
+  0x75, 0xab, 0xd1, 0x6a, 0x61, 0x05, 0xab, 0xae, 0x33, 0x0f, 0x15, 0xaf, 0x58, 0x36, 0xb1, 0x12,
+  0x15, 0xaf, 0x59, 0x16, 0x57, 0x42, 0x4a, 0x19, 0x89, 0x6c, 0x85, 0x13, 0x5e, 0x6f, 0x5b, 0xd0,
+  0x59, 0xc9, 0x7d, 0xa1, 0x66, 0xa3, 0xc5, 0xa8, 0x74, 0x9d, 0xb3, 0xae, 0x25, 0x26, 0x40, 0x75,
+  0x13, 0x37, 0x3f, 0x55, 0xa7, 0x48, 0x3c, 0xde, 0xfa, 0x92, 0x86, 0xae, 0x85, 0x7c, 0xd6, 0x6d,
+  0xb1, 0x4c, 0x67, 0x20, 0xcb, 0x46, 0x6b, 0x68, 0x8a, 0x8a, 0x85, 0xc7, 0x62, 0xe4, 0x1b, 0xf2,
+  0x08, 0xa3, 0x97, 0xfe, 0xf4, 0xcb, 0x2a, 0xf4, 0x26, 0x4e, 0x9c, 0xc5, 0xd0, 0x62, 0xe5, 0x16,
+  0x46, 0x3b, 0xb1, 0x14, 0xf6, 0x6f, 0xe3, 0x99, 0x20, 0xee, 0x37, 0x27, 0x47, 0x2d, 0x13, 0x1b,
+  0x4f, 0x06, 0x46, 0xa1, 0xa0, 0x34, 0xd4, 0x4b, 0x53, 0x34, 0x5b, 0xe2, 0x12, 0xc8, 0x94, 0x91,
+  0x93, 0x6e, 0x60, 0xa1, 0x8d, 0x93, 0x4e, 0x9c, 0x62, 0x94, 0x09, 0x51, 0xac, 0x2a, 0x8c, 0xf1,
+  0x1f, 0x1d, 0xd3, 0x24, 0x93, 0x67, 0xd0, 0xcd, 0x94, 0x8a, 0x3c, 0xb6, 0x77, 0x4d, 0xdf, 0xda,
+  0x17, 0x37, 0xb7, 0xef, 0xdd, 0xbc, 0x56, 0xb1, 0x7f, 0xd9, 0x46, 0x47, 0xca, 0xbc, 0x96, 0xed,
+  0x4b, 0x49, 0x86, 0x5c, 0x28, 0x7d, 0x7e, 0x7e, 0xa5, 0x9d, 0xcc, 0x9e, 0x9e, 0x9d, 0x6a, 0x73,
+  0xec, 0xf3, 0xcb, 0x77, 0x3f, 0x1c, 0x3e, 0x7a, 0x24, 0xdd, 0xe1, 0xf8, 0x42, 0xfa, 0x3a, 0x4e,
+  0x12, 0x10, 0x03, 0x22, 0x1a, 0x03, 0xfb, 0xb7, 0x54, 0x37, 0xca, 0x20, 0x23, 0x54, 0xab, 0xe8,
+  0x11, 0xf8, 0xea, 0xf9, 0xd9, 0x5e, 0x0a, 0xf8, 0x62, 0xb6, 0x4c, 0x45, 0x3e, 0x42, 0xe8, 0xf7,
+  0xc7, 0xe4, 0x46, 0x37, 0x85, 0xd9, 0x3c, 0xa6, 0x48, 0x37, 0x19, 0x9e, 0xd7, 0x29, 0xf7, 0x3d,
+  0x9b, 0x96, 0x74, 0x39, 0x9e, 0xb5, 0x38, 0x51, 0xc9, 0xe7, 0x8b, 0x30, 0x98, 0x04, 0x02, 0x9d,
+  0xf3, 0xc6, 0x2d, 0x62, 0x7d, 0x05, 0x66, 0x92, 0x00, 0x36, 0x2e, 0x03, 0xe6, 0x68, 0x98, 0x58,
+  0x11, 0x1d, 0x34, 0x39, 0x3b, 0x9d, 0x41, 0xb6, 0x18, 0x83, 0x60, 0x47, 0x8b, 0x37, 0x08, 0x3e,
+  0xa8, 0x22, 0xed, 0xd2, 0x76, 0x88, 0x1a, 0xec, 0x35, 0x19, 0xfe, 0x26, 0x03, 0xc1, 0x35, 0x67,
+  0x01, 0x3e, 0xb8, 0xb3, 0xf4, 0x83, 0x58, 0x37, 0x13, 0xcd, 0xfa, 0xe4, 0x94, 0x3c, 0x9e, 0x49,
+  0xbb, 0x40, 0x28, 0xb8, 0x0e, 0x8a, 0x83, 0x94, 0x62, 0x8c, 0x1e, 0xd1, 0x6f, 0x26, 0x4a, 0xec,
+  0xd8, 0xf3, 0x9a, 0x3d, 0x66, 0x8f, 0x74, 0xcd, 0x45, 0x86, 0x21, 0x58, 0x7e, 0xe6, 0x49, 0x80,
+  0x4f, 0x38, 0xb3, 0x33, 0x21, 0xb5, 0x52, 0x98, 0xb4, 0x30, 0xea, 0x8f, 0xe8, 0x5d, 0x13, 0x0a,
+  0xda, 0x3e, 0x7c, 0x32, 0x1a, 0x9e, 0xab, 0x71, 0x59, 0xb3, 0x0b, 0x34, 0xdd, 0x3f, 0xd9, 0x1f,
+  0x0d, 0x61, 0x29, 0xc4, 0xb9, 0xa2, 0x3c, 0x3b, 0xa1, 0xdb, 0x26, 0xa6, 0x0c, 0x3e, 0xb3, 0x0c,
+  0x5a, 0xc0, 0x5c, 0xf6, 0x1c, 0x3a, 0x59, 0x92, 0xb7, 0xad, 0x9c, 0x55, 0x28, 0x77, 0x69, 0x4d,
+  0xc0, 0xbc, 0xc1, 0x8b, 0x5f, 0x4d, 0x70, 0x78, 0xc4, 0xf3, 0x3a, 0x88, 0x82, 0x39, 0x54, 0xbc,
+  0x9a, 0xc1, 0x58, 0x61, 0x58, 0x2f, 0x0b, 0xd3, 0x5c, 0xe5, 0xc9, 0xd7, 0x73, 0x15, 0x17, 0x21,
+  0x6f, 0x8d, 0x79, 0x38, 0xa6, 0x95, 0x46, 0xc5, 0xb1, 0x04, 0x6e, 0xd2, 0x73, 0xf0, 0x57, 0x91,
+  0xc4, 0x2c, 0x77, 0xa0, 0x6d, 0xa9, 0x5a, 0xc4, 0x3a, 0x5d, 0xe4, 0x9b, 0xc9, 0x32, 0x24, 0xda,
+  0x04, 0x86, 0x20, 0x82, 0xf9, 0x09, 0x9d, 0x55, 0x24, 0x88, 0x7f, 0xae, 0x27, 0x48, 0xe5, 0x8d,
+  0x45, 0x10, 0x62, 0x8b, 0x24, 0x61, 0x15, 0xf2, 0x72, 0x8a, 0xa0, 0x02, 0x2b, 0x78, 0xf3, 0xb6,
+  0x0c, 0x31, 0x05, 0xa4, 0x24, 0x89, 0xff, 0xb6, 0x80, 0x21, 0x81, 0x9e, 0x55, 0x08, 0x9f, 0x02,
+  0xff, 0xc1, 0x84, 0x5f, 0xe8, 0xc0, 0x48, 0x2a, 0x08, 0x4d, 0xd1, 0x7d, 0x98, 0x43, 0x0f, 0x49,
+  0xb1, 0xbb, 0x42, 0x16, 0xb2, 0xae, 0x4c, 0xe6, 0xae, 0xa6, 0x91, 0x58, 0x59, 0x2e, 0xc5, 0x55,
+  0xbc, 0x18, 0x15, 0x66, 0x2b, 0xcc, 0x78, 0xcf, 0x76, 0xc2, 0xd3, 0x2c, 0xef, 0x51, 0x12, 0x24,
+  0xe4, 0xa3, 0x4a, 0xe8, 0x23, 0x42, 0x66, 0x77, 0xff, 0x0c, 0x66, 0xcc, 0x48, 0x48, 0xca, 0x0a,
+  0x98, 0x5f, 0x40, 0x97, 0xc9, 0x07, 0x79, 0xad, 0xfe, 0x55, 0x4f, 0x56, 0xce, 0x4c, 0xa7, 0x4a,
+  0x96, 0x31, 0x72, 0x93, 0x58, 0x49, 0xf7, 0x74, 0xa2, 0x03, 0x7b, 0x5a, 0x50, 0x71, 0xde, 0x9c,
+  0xab, 0x8d, 0x89, 0x82, 0x7b, 0x40, 0x61, 0xae, 0x38, 0x1d, 0xaf, 0xe9, 0xa9, 0x25, 0x9f, 0xf1,
+  0x04, 0x6a, 0x69, 0x42, 0xe2, 0x81, 0x89, 0x9c, 0xa4, 0xd8, 0xa7, 0x7a, 0xc5, 0x50, 0xf3, 0xb8,
+  0x0b, 0xe8, 0x11, 0x40, 0xc6, 0xd7, 0x0c, 0x9f, 0x54, 0x2a, 0xa0, 0xfb, 0x4b, 0x90, 0xe1, 0xcc,
+  0xb7, 0xfb, 0xee, 0x05, 0xf4, 0x11, 0x05, 0xd7, 0x32, 0x10, 0x0d, 0x8e, 0x99, 0x40, 0x8f, 0x5c,
+  0x8e, 0x1e, 0x47, 0x20, 0x16, 0x46, 0xe8, 0x38, 0x81, 0xb3, 0x1d, 0x34, 0x16, 0x9e, 0x24, 0x01,
+  0x30, 0xe3, 0x12, 0xf5, 0x1c, 0x50, 0x4c, 0xe8, 0x6a, 0x6c, 0x9a, 0x81, 0xfe, 0xd5, 0xc2, 0xbb,
+  0xec, 0xa0, 0x62, 0x51, 0x72, 0xe1, 0x91, 0x83, 0x92, 0xec, 0xcf, 0xaf, 0xd8, 0x37, 0x10, 0xfd,
+  0x56, 0x1c, 0x41, 0xb5, 0x78, 0x3b, 0x0f, 0x92, 0xde, 0x07, 0xe7, 0x01, 0x29, 0xc1, 0xa6, 0x18,
+  0xf9, 0xb4, 0xf7, 0xcb, 0x01, 0x6a, 0x8d, 0x0b, 0x34, 0x86, 0x0a, 0x60, 0x7c, 0x3c, 0x46, 0x96,
+  0x5f, 0xc4, 0x81, 0x74, 0x9f, 0x00, 0x00, 0x11, 0x08, 0x09, 0x0a, 0x5c, 0x9b, 0xc0, 0xda, 0x49,
+  0x3d, 0x81, 0xb2, 0xb0, 0x50, 0x90, 0x0e, 0xab, 0xe4, 0x8a, 0x42, 0xdb, 0xf3, 0x11, 0x6a, 0xa5,
+  0x73, 0x01, 0xeb, 0x81, 0x40, 0x85, 0x30, 0x21, 0x1d, 0x32, 0x11, 0xa3, 0x38, 0xce, 0xb4, 0xe3,
+  0x32, 0x76, 0xa6, 0x74, 0xa4, 0x46, 0x3f, 0x70, 0x0c, 0xc8, 0x67, 0xe2, 0x9a, 0x01, 0x94, 0xe5,
+  0xa2, 0x25, 0x48, 0x11, 0xc4, 0xa5, 0xb3, 0xcf, 0x60, 0xd0, 0xde, 0xa1, 0xcb, 0x06, 0x5e, 0x3d,
+  0xc6, 0x20, 0x69, 0x9c, 0x4d, 0x80, 0x61, 0x55, 0x20, 0x29, 0xc5, 0x67, 0xda, 0x67, 0x1f, 0xc0,
+  0x2c, 0x17, 0x3e, 0xcf, 0x64, 0xa3, 0x32, 0x94, 0x99, 0x7d, 0x1a, 0xe5, 0x8a, 0x48, 0xa6, 0xbc,
+  0x1e, 0xc8, 0x8b, 0x05, 0x08, 0x24, 0x15, 0xf5, 0x97, 0xd2, 0x0a, 0x05, 0x24, 0x88, 0xde, 0x0c,
+  0x59, 0x8c, 0x4a, 0xe0, 0x73, 0x61, 0xf6, 0x8b, 0x1c, 0xa1, 0xc0, 0xe0, 0x06, 0x94, 0x95, 0x50,
+  0xfe, 0x10, 0xdf, 0x10, 0x7f, 0xb2, 0x0f, 0x1f, 0xf4, 0x0b, 0x9f, 0x79, 0xcf, 0x7f, 0x3d, 0x2b,
+  0x66, 0x9e, 0xca, 0xd7, 0xd8, 0xf3, 0x84, 0xe7, 0xfa, 0xc1, 0x74, 0x95, 0xb4, 0x4f, 0x40, 0xf7,
+  0x33, 0xf5, 0x48, 0x59, 0x46, 0xaf, 0x94, 0x15, 0xb0, 0x3f, 0x83, 0x14, 0x72, 0x11, 0xa1, 0x3c,
+  0xfa, 0xc0, 0x64, 0x67, 0xec, 0x3b, 0x68, 0xec, 0xf8, 0x4e, 0x17, 0x66, 0x2f, 0x08, 0x40, 0x29,
+  0xc8, 0x99, 0x26, 0x47, 0x32, 0xe5, 0x79, 0x9c, 0xcc, 0xbd, 0xba, 0xf0, 0x67, 0xa5, 0x58, 0x62,
+  0xe6, 0xb5, 0x75, 0x4f, 0x75, 0x5a, 0x35, 0x26, 0x58, 0x5e, 0x64, 0x8b, 0xc8, 0x92, 0x58, 0xb8,
+  0x26, 0xa4, 0xe4, 0x36, 0xe4, 0xbc, 0x83, 0x6c, 0x45, 0x0e, 0x7e, 0x82, 0x24, 0x71, 0x06, 0x2f,
+  0xcc, 0x8b, 0x6d, 0x13, 0xec, 0x52, 0x01, 0xba, 0x39, 0xd2, 0x65, 0xde, 0x85, 0x97, 0x14, 0x87,
+  0x6e, 0x63, 0x6c, 0xba, 0x1b, 0x62, 0x12, 0x52, 0xe1, 0xaa, 0xaf, 0xfb, 0xec, 0x61, 0x51, 0xab,
+  0xc0, 0x17, 0xea, 0x19, 0x3d, 0xdd, 0x0e, 0x32, 0xe4, 0x21, 0xc9, 0x10, 0x8c, 0xcc, 0x61, 0x76,
+  0x46, 0x29, 0xea, 0xbf, 0x74, 0x59, 0x41, 0x06, 0xaf, 0x43, 0xc1, 0x96, 0x67, 0xe4, 0xcb, 0x18,
+  0xcf, 0xf2, 0x54, 0x39, 0x65, 0xdf, 0x46, 0xca, 0x73, 0x0b, 0xe6, 0xad, 0x9f, 0x9a, 0x2b, 0x1a,
+  0x31, 0x5e, 0xc8, 0x48, 0x55, 0xb0, 0xc3, 0x16, 0x6a, 0x57, 0x52, 0x17, 0x54, 0x4b, 0xa0, 0x2c,
+  0x48, 0xde, 0x69, 0x7d, 0x7b, 0x6d, 0x09, 0x85, 0xba, 0xb1, 0x93, 0xa3, 0xd4, 0xb7, 0x70, 0x24,
+  0x12, 0x0e, 0xdd, 0x20, 0x66, 0x81, 0xc2, 0x42, 0xc4, 0x92, 0xbc, 0x0e, 0xe8, 0xb1, 0xdf, 0xd6,
+  0x78, 0x86, 0xc2, 0x83, 0xd6, 0xa5, 0x58, 0x13, 0xa6, 0xf5, 0x56, 0x7c, 0xfb, 0x35, 0x97, 0x0d,
+  0x74, 0x2c, 0x0e, 0x0d, 0x6e, 0xce, 0xcb, 0x58, 0xeb, 0x22, 0x0e, 0x55, 0x78, 0x8e, 0x21, 0x7e,
+  0xe6, 0xcc, 0x93, 0x92, 0x95, 0xca, 0x40, 0xcf, 0xcb, 0x39, 0x39, 0x08, 0x2a, 0xc4, 0xa4, 0xe1,
+  0x0d, 0x61, 0xb1, 0x7d, 0xb2, 0xaf, 0xbe, 0x4d, 0xe2, 0x2b, 0x0a, 0xa6, 0x52, 0x4d, 0x3f, 0xa7,
+  0x5e, 0x2d, 0xe4, 0xec, 0x4b, 0xc4, 0xcd, 0xa6, 0x01, 0x52, 0x48, 0x4c, 0xa1, 0x9a, 0xa2, 0x18,
+  0xa4, 0x3a, 0x11, 0x4a, 0x05, 0x1b, 0xc7, 0x20, 0x3c, 0x3c, 0xca, 0x83, 0xf7, 0x1d, 0x78, 0xcd,
+  0x89, 0x94, 0xaa, 0x88, 0xa2, 0x52, 0xfe, 0x40, 0x1b, 0x51, 0xa7, 0x8e, 0x56, 0xbb, 0xfc, 0xd6,
+  0xc4, 0xf6, 0xf0, 0x4a, 0xa6, 0x8e, 0x3b, 0xa8, 0xbe, 0xf5, 0x83, 0x16, 0x56, 0xe8, 0x41, 0xf7,
+  0x2b, 0x15, 0x86, 0x93, 0xbe, 0xda, 0x94, 0xd6, 0x36, 0x6a, 0x94, 0x1e, 0xf5, 0x0f, 0x53, 0x14,
+  0x04, 0x7f, 0xdd, 0xed, 0x4d, 0x29, 0xdc, 0x51, 0xbf, 0x28, 0xbf, 0x09, 0x51, 0x23, 0x9a, 0xea,
+  0x00, 0xc9, 0x42, 0x2e, 0x40, 0x35, 0x1d, 0xb2, 0x45, 0x44, 0xc4, 0x96, 0x87, 0xc2, 0x4a, 0x59,
+  0x24, 0xe3, 0x50, 0x87, 0xc5, 0x29, 0xce, 0x26, 0x1d, 0x73, 0x05, 0x0d, 0x95, 0xc8, 0x32, 0xa5,
+  0x48, 0x36, 0x25, 0x7e, 0xb5, 0xc3, 0x18, 0x1e, 0x40, 0x1d, 0xc9, 0x1e, 0xae, 0x4a, 0x36, 0xe3,
+  0xd8, 0xb5, 0x06, 0xd2, 0x20, 0x5c, 0xba, 0xd6, 0x5a, 0xe9, 0x47, 0xdb, 0xab, 0x0e, 0x93, 0xb5,
+  0x5d, 0x15, 0x8b, 0x29, 0x4b, 0xac, 0xdb, 0x7a, 0x5a, 0x18, 0xd4, 0x21, 0xc3, 0xd7, 0x54, 0xe8,
+  0x3d, 0xd9, 0xda, 0xb1, 0xbe, 0xe9, 0x99, 0x88, 0xca, 0xc8, 0xb8, 0x49, 0xa3, 0x75, 0x54, 0x76,
+  0x70, 0xbe, 0xfe, 0xe6, 0x9d, 0x6b, 0xd6, 0x34, 0x59, 0x24, 0x5f, 0x0f, 0x55, 0x11, 0xc2, 0xea,
+  0xaa, 0xec, 0xa9, 0xa7, 0x30, 0xca, 0x35, 0x3c, 0xf5, 0xc4, 0xfa, 0x57, 0x68, 0x7c, 0xfd, 0xe1,
+  0x94, 0x89, 0x41, 0xd5, 0x40, 0xf9, 0xa6, 0xc7, 0x1e, 0x30, 0xee, 0x55, 0x32, 0x77, 0xa8, 0xde,
+  0xa4, 0x80, 0x4e, 0x03, 0xb4, 0x07, 0x48, 0x15, 0x97, 0x6e, 0x4e, 0x9a, 0xc2, 0xe8, 0x8f, 0xb6,
+  0xcc, 0xf4, 0x9e, 0x28, 0x93, 0xf6, 0xa8, 0x34, 0x9e, 0x64, 0x2b, 0xdc, 0x3a, 0xa8, 0x0d, 0x92,
+  0xbe, 0x1b, 0x29, 0xef, 0xf9, 0xed, 0x40, 0x69, 0x55, 0x8f, 0xd8, 0xc2, 0xee, 0xbe, 0xa0, 0xa3,
+  0x7e, 0x12, 0xd9, 0x78, 0xa6, 0xf5, 0x4e, 0xa9, 0xd0, 0x62, 0x67, 0xc8, 0x74, 0xb4, 0x43, 0x64,
+  0xbe, 0x51, 0x3f, 0x75, 0xa5, 0xd3, 0x78, 0xbe, 0xc0, 0x3d, 0x98, 0x7c, 0xa2, 0xae, 0x5c, 0x55,
+  0xe5, 0x5e, 0x29, 0x6b, 0x97, 0xa3, 0xfe, 0xf3, 0xcb, 0x77, 0xec, 0x67, 0x58, 0xff, 0xa9, 0xe3,
+  0xca, 0xd5, 0x21, 0x53, 0xe5, 0xd5, 0xd4, 0x7e, 0x79, 0xf6, 0xbc, 0xbe, 0x36, 0x64, 0x6e, 0xae,
+  0x7d, 0x0e, 0x5b, 0x60, 0xd8, 0xfd, 0xb2, 0x9f, 0x9f, 0xd7, 0x40, 0x50, 0x05, 0x36, 0x43, 0x39,
+  0xb5, 0x2e, 0xc5, 0x56, 0x41, 0x6c, 0x68, 0xfa, 0x4b, 0x3f, 0xa4, 0x8b, 0x9f, 0x81, 0x8f, 0xa6,
+  0x17, 0x07, 0xfd, 0x3e, 0x7a, 0xbb, 0xa9, 0xec, 0x1a, 0x18, 0x08, 0x5e, 0xda, 0xf8, 0x8d, 0x49,
+  0xd3, 0xd1, 0x0c, 0xcc, 0x3c, 0xc7, 0xbc, 0xba, 0x8e, 0x48, 0xb4, 0x96, 0xe6, 0xa8, 0x8c, 0x79,
+  0x1b, 0x5a, 0x41, 0x7b, 0x4f, 0xb3, 0x27, 0x74, 0x82, 0x78, 0x2f, 0x97, 0x0a, 0x2c, 0x51, 0x03,
+  0xe4, 0xcd, 0xd5, 0x3b, 0xd2, 0x29, 0xab, 0x75, 0xdf, 0x64, 0x0b, 0x12, 0xf2, 0xee, 0x7a, 0x97,
+  0xe3, 0x99, 0xf0, 0x97, 0xa1, 0x03, 0xa7, 0xce, 0xa9, 0x65, 0x5b, 0x5c, 0x70, 0xd8, 0x2a, 0x09,
+  0x32, 0x7c, 0x5c, 0xa0, 0xca, 0xb7, 0x98, 0xfd, 0x9e, 0x72, 0x6b, 0x20, 0xe4, 0xef, 0x32, 0x96,
+  0x2b, 0xdb, 0xf6, 0x5d, 0x17, 0xcd, 0xce, 0x76, 0x6e, 0x68, 0xa4, 0x0c, 0x17, 0x5e, 0xae, 0x40,
+  0x81, 0x6b, 0xdd, 0x15, 0x9e, 0xa2, 0xa1, 0xa2, 0x5a, 0x83, 0x92, 0x6b, 0xaa, 0x98, 0x18, 0xf3,
+  0xe5, 0x4a, 0x3a, 0x2c, 0x99, 0xbb, 0x9a, 0x12, 0xad, 0x8e, 0x1e, 0xd4, 0x39, 0x35, 0x15, 0xf1,
+  0xc5, 0x73, 0xb4, 0x8e, 0x44, 0xbc, 0x5a, 0xf5, 0x2f, 0x69, 0x1c, 0x3d, 0xc5, 0xac, 0x52, 0xdd,
+  0xf2, 0x26, 0xb6, 0xf4, 0x47, 0x6f, 0x75, 0xf1, 0xa6, 0xd7, 0xf0, 0xff, 0x01, 0x2c, 0xa3, 0x63,
+  0x5d, 0xa4, 0xb8, 0x00, 0x00,
+};
+
+const char websiteStyleEtag[] = "\"1c3b6450a1ec9c1b\"";
+const uint8_t websiteStyle[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x58, 0xe9, 0x92, 0xa4, 0x36,
+  0x12, 0x7e, 0x15, 0xdc, 0x13, 0x13, 0xd5, 0xed, 0x41, 0x34, 0x50, 0x57, 0x37, 0x44, 0x4f, 0xf8,
+  0x08, 0x6f, 0xec, 0xfe, 0xf0, 0xfe, 0x58, 0xc7, 0x3e, 0x80, 0x00, 0x51, 0xe0, 0x06, 0x44, 0x80,
+  0xa8, 0xc3, 0x04, 0xef, 0xee, 0xd4, 0x01, 0x88, 0x02, 0x7a, 0x67, 0x1d, 0x8e, 0x99, 0x2e, 0x0a,
+  0x29, 0x95, 0xfa, 0x94, 0xc7, 0x97, 0xa9, 0xfa, 0xde, 0xfc, 0xde, 0xf3, 0x02, 0x12, 0xd3, 0x8a,
+  0xf0, 0x6f, 0x38, 0x66, 0xa4, 0x6a, 0x03, 0x7a, 0x45, 0x75, 0xfa, 0x47, 0x5a, 0x9c, 0xbc, 0x80,
+  0x56, 0x11, 0xa9, 0x10, 0x8c, 0x74, 0x09, 0xcb, 0xb3, 0x16, 0x5d, 0x48, 0xf0, 0x9e, 0x32, 0xc4,
+  0xc8, 0x95, 0x71, 0x19, 0x82, 0x70, 0xf4, 0x7b, 0x53, 0x33, 0xcf, 0xb1, 0xed, 0xcf, 0xfe, 0x30,
+  0x8b, 0x4b, 0x94, 0xa4, 0xa7, 0x24, 0x83, 0x3f, 0x86, 0x42, 0x9a, 0xd1, 0xca, 0x63, 0x15, 0x2e,
+  0xea, 0x12, 0x57, 0xa4, 0x60, 0x5d, 0x40, 0xa3, 0x5b, 0x9b, 0xe3, 0xea, 0x94, 0x16, 0x9e, 0xed,
+  0xc7, 0xb4, 0x60, 0x28, 0xc6, 0x79, 0x9a, 0xdd, 0x3c, 0x84, 0xcb, 0x32, 0x23, 0xa8, 0xbe, 0xd5,
+  0x8c, 0xe4, 0xe6, 0x4f, 0x59, 0x5a, 0xbc, 0xff, 0x8a, 0xc3, 0xdf, 0xc4, 0xeb, 0x3f, 0x40, 0xce,
+  0x7c, 0xf8, 0x8d, 0x9c, 0x28, 0x31, 0xfe, 0xfb, 0xaf, 0x07, 0xf3, 0x3f, 0x34, 0xa0, 0x8c, 0x9a,
+  0x0f, 0xff, 0x24, 0xd9, 0x99, 0xb0, 0x34, 0xc4, 0xc6, 0xbf, 0x49, 0x43, 0x1e, 0xcc, 0x1f, 0xab,
+  0x14, 0x67, 0x66, 0x0d, 0xdb, 0xa1, 0x9a, 0x54, 0x69, 0x2c, 0x37, 0xe0, 0x60, 0x3d, 0xa7, 0x22,
+  0xb9, 0x7c, 0xbd, 0x10, 0x8e, 0xcd, 0xdb, 0xd9, 0xb6, 0x0f, 0x9b, 0x10, 0x94, 0xc8, 0x77, 0xc7,
+  0xda, 0x77, 0x89, 0x63, 0x26, 0xae, 0x99, 0xec, 0xcc, 0xe4, 0xa0, 0x40, 0x22, 0x46, 0x4b, 0x00,
+  0xaa, 0x5e, 0x60, 0x57, 0x46, 0x73, 0xcf, 0xda, 0xdf, 0x2b, 0xdb, 0xcf, 0x94, 0xb9, 0xa0, 0xac,
+  0x1d, 0xb7, 0x77, 0xc5, 0x9a, 0x2e, 0x71, 0xf5, 0x31, 0x31, 0xb2, 0xd3, 0x46, 0x1c, 0x25, 0x75,
+  0x68, 0xa7, 0xc0, 0xbb, 0xd2, 0x6c, 0x32, 0x93, 0xe1, 0x20, 0x23, 0x1f, 0xe1, 0x12, 0xa2, 0x41,
+  0xab, 0x03, 0x0b, 0x68, 0x06, 0x5e, 0xec, 0x70, 0x2b, 0x5d, 0xf1, 0xc9, 0xb6, 0x8f, 0x41, 0x1c,
+  0xfb, 0xc2, 0x89, 0x11, 0x09, 0x69, 0x85, 0x59, 0x4a, 0x0b, 0xaf, 0xa0, 0x05, 0xe9, 0x32, 0x1c,
+  0x90, 0xac, 0x8d, 0xd2, 0xba, 0xcc, 0xf0, 0xcd, 0x4b, 0x0b, 0x71, 0xa0, 0x20, 0xa3, 0xe1, 0xfb,
+  0xd2, 0xf9, 0xbb, 0xa0, 0x81, 0x97, 0xc2, 0x4c, 0x8b, 0xb2, 0x61, 0x66, 0x4d, 0x32, 0x12, 0xb2,
+  0x65, 0xcf, 0xa6, 0x45, 0x02, 0xce, 0x60, 0x9a, 0x33, 0xfa, 0x11, 0xdd, 0x64, 0x6a, 0x4c, 0xa9,
+  0x6d, 0xc3, 0xa6, 0xaa, 0x01, 0x70, 0x49, 0xd3, 0x02, 0x02, 0xb3, 0x0b, 0x71, 0x71, 0xc6, 0x75,
+  0x7b, 0x26, 0x15, 0x77, 0x77, 0x86, 0x30, 0x04, 0x58, 0xe1, 0xe5, 0x69, 0x14, 0x65, 0xa4, 0xb3,
+  0x82, 0x13, 0x8a, 0x70, 0xf5, 0xde, 0x06, 0x38, 0x7c, 0x3f, 0x55, 0xb4, 0x29, 0x22, 0x15, 0x7a,
+  0x9f, 0xb6, 0xbb, 0x2d, 0xde, 0xd9, 0x42, 0xa2, 0x86, 0xe3, 0x16, 0x20, 0x76, 0x5b, 0x10, 0x3b,
+  0x84, 0xc7, 0xfd, 0x31, 0xea, 0x2c, 0x61, 0x17, 0x11, 0xbb, 0xbd, 0xc1, 0xe2, 0x97, 0xf8, 0x35,
+  0xc6, 0x6a, 0x86, 0xc7, 0x7b, 0x1a, 0xdf, 0x5a, 0xf1, 0x22, 0x21, 0xa8, 0xa1, 0x7e, 0x29, 0x89,
+  0x99, 0x3e, 0xcb, 0xdf, 0xd5, 0x54, 0x48, 0xf8, 0x41, 0xf4, 0x49, 0x39, 0xd2, 0x59, 0x00, 0x8b,
+  0x61, 0xb0, 0x44, 0x65, 0x8e, 0x5f, 0x51, 0x9c, 0x35, 0x69, 0xd4, 0x5e, 0xd2, 0x88, 0x25, 0x32,
+  0xc3, 0x4a, 0x1c, 0x45, 0x90, 0x97, 0xa8, 0x92, 0x01, 0xb6, 0x2f, 0xaf, 0xc3, 0x10, 0xdf, 0x45,
+  0x8e, 0x28, 0x3f, 0x49, 0x19, 0xdc, 0x30, 0xda, 0x8f, 0x08, 0x11, 0x3e, 0xd0, 0xfd, 0x90, 0x93,
+  0x28, 0xc5, 0xc6, 0x63, 0x0e, 0xa3, 0x52, 0xfd, 0xfe, 0x78, 0x28, 0xaf, 0x4f, 0xed, 0xb8, 0x39,
+  0xb8, 0xf1, 0xda, 0xcf, 0xed, 0xec, 0xf2, 0xda, 0x2d, 0x2c, 0x3a, 0x1e, 0x5e, 0x56, 0x17, 0x1d,
+  0xdd, 0x95, 0x45, 0xaf, 0xaf, 0xee, 0xea, 0xa2, 0xd7, 0xc3, 0xca, 0x22, 0xc7, 0xb5, 0xed, 0xd5,
+  0x55, 0x8e, 0x23, 0x01, 0x5a, 0x15, 0xbd, 0x0c, 0xa1, 0x1b, 0x67, 0xe4, 0xea, 0xf3, 0x0f, 0x74,
+  0xa9, 0x70, 0xe9, 0xf1, 0x8f, 0xa9, 0x65, 0x90, 0x6e, 0x2c, 0x61, 0x1a, 0x31, 0xc2, 0x5d, 0x91,
+  0xb5, 0x25, 0xad, 0x53, 0x91, 0x14, 0x15, 0xc9, 0x20, 0x3b, 0xce, 0xc4, 0xff, 0x7f, 0xbd, 0x20,
+  0xb6, 0x0e, 0x70, 0x9d, 0xd6, 0x3c, 0x13, 0xf8, 0x0b, 0x44, 0xdb, 0xc5, 0x73, 0x7c, 0x0d, 0x37,
+  0x28, 0xeb, 0xac, 0x0b, 0x82, 0x67, 0xab, 0x8f, 0xe4, 0x01, 0x72, 0xdb, 0xa5, 0x6c, 0xe3, 0x33,
+  0xbb, 0xbb, 0x19, 0xa7, 0x9f, 0xba, 0x8e, 0x8b, 0x24, 0x30, 0xc9, 0x50, 0xfa, 0x01, 0x7b, 0xd1,
+  0x1b, 0xda, 0xea, 0x14, 0xe2, 0x68, 0x72, 0x3a, 0x8b, 0x58, 0x25, 0x83, 0xed, 0xfa, 0xa3, 0x09,
+  0x49, 0xa5, 0xa1, 0x0c, 0xd0, 0x7e, 0x98, 0x50, 0x4b, 0xb6, 0x62, 0x26, 0x60, 0xc5, 0x32, 0x7b,
+  0xdc, 0xd3, 0xee, 0x2c, 0x07, 0xfc, 0x4b, 0x92, 0x32, 0xe0, 0xfe, 0x12, 0x87, 0x04, 0xb8, 0x48,
+  0x38, 0x6c, 0x31, 0xd5, 0xfd, 0x06, 0x78, 0x1d, 0x49, 0xb2, 0x11, 0xa4, 0xe5, 0xcb, 0x32, 0xe5,
+  0x39, 0xe5, 0xd5, 0xa8, 0x69, 0x96, 0x46, 0x86, 0x56, 0x6d, 0x7a, 0xd7, 0x78, 0xd6, 0xf6, 0xc8,
+  0xc1, 0x1b, 0xd6, 0x71, 0x64, 0xee, 0xb1, 0x2a, 0xdc, 0x55, 0x01, 0xa5, 0x12, 0x55, 0x38, 0x4a,
+  0x9b, 0xda, 0xb3, 0x5c, 0xb1, 0x66, 0xc6, 0x19, 0xfa, 0x3e, 0xe2, 0xbb, 0x0c, 0x1a, 0x31, 0x69,
+  0x58, 0xce, 0xbe, 0x36, 0x08, 0xae, 0x09, 0x02, 0xbb, 0x52, 0xe0, 0xc7, 0xfb, 0xe5, 0x33, 0x09,
+  0x61, 0x3e, 0x94, 0x9d, 0xda, 0x01, 0xb3, 0x40, 0xec, 0xdc, 0xe1, 0xed, 0xd1, 0x4c, 0x21, 0x0e,
+  0xf6, 0xe7, 0x9a, 0xc4, 0x71, 0x16, 0x38, 0xac, 0x5f, 0x74, 0x47, 0x6c, 0xb3, 0x55, 0x5e, 0x42,
+  0xcf, 0x9c, 0x8b, 0xe6, 0x13, 0x38, 0xe4, 0xe9, 0xd0, 0x6b, 0x75, 0x1d, 0x77, 0xef, 0xbe, 0xce,
+  0x0d, 0xa3, 0x6b, 0xf6, 0x62, 0x1a, 0x36, 0x75, 0xab, 0xd4, 0x40, 0x36, 0x88, 0x06, 0x23, 0xc1,
+  0x11, 0xa4, 0x83, 0x6d, 0xf0, 0x7f, 0x16, 0xaf, 0x82, 0x46, 0x75, 0x0a, 0xf0, 0xa3, 0xbb, 0x7b,
+  0x31, 0xdd, 0xdd, 0xab, 0xe9, 0xee, 0x6d, 0xd3, 0xda, 0x3f, 0x75, 0x16, 0xf4, 0x26, 0x39, 0x4f,
+  0x9d, 0xa6, 0x6c, 0x97, 0x42, 0x54, 0x4c, 0x73, 0x52, 0xa8, 0xe8, 0x58, 0xb6, 0x64, 0xc4, 0x69,
+  0x19, 0xab, 0x1c, 0x0b, 0x91, 0x14, 0x3e, 0xba, 0xd2, 0x7c, 0xc6, 0x17, 0x83, 0xf3, 0xd0, 0x37,
+  0x86, 0x87, 0x3a, 0xd5, 0xee, 0x75, 0x6f, 0xef, 0x8f, 0x4b, 0xc7, 0x85, 0x7a, 0x3a, 0x8b, 0xc2,
+  0x4f, 0x21, 0x89, 0x76, 0x11, 0x5e, 0x8c, 0xa5, 0x29, 0x72, 0x65, 0xa2, 0xa9, 0x73, 0x5e, 0xec,
+  0x20, 0x02, 0xb5, 0xdf, 0x66, 0x37, 0xdb, 0x74, 0xdc, 0x2d, 0x58, 0x6d, 0x6f, 0x82, 0xfe, 0xa7,
+  0xa9, 0x76, 0xd8, 0xb9, 0x38, 0x11, 0x28, 0x2c, 0x50, 0xa6, 0x68, 0x2e, 0xdf, 0x56, 0x6d, 0xd5,
+  0x4d, 0xc5, 0xc6, 0x94, 0xe0, 0x66, 0xe8, 0x8d, 0x65, 0xfb, 0x38, 0xe4, 0x59, 0x8b, 0x26, 0x1d,
+  0x05, 0x14, 0x39, 0xd1, 0x9d, 0x68, 0x86, 0x1f, 0x4f, 0x94, 0xe1, 0xb2, 0x26, 0x5e, 0xff, 0x45,
+  0x89, 0x1a, 0x2c, 0x31, 0xfb, 0x6f, 0xd1, 0x18, 0xf5, 0xd2, 0x05, 0x77, 0xc9, 0x0f, 0xfc, 0xd3,
+  0xab, 0x13, 0x54, 0x34, 0x9a, 0x39, 0x22, 0xc4, 0x25, 0x07, 0x9d, 0x51, 0xfa, 0x3e, 0x62, 0xd8,
+  0x85, 0x60, 0x20, 0x85, 0xe4, 0xbe, 0x75, 0x90, 0x91, 0xe4, 0x0f, 0x5d, 0xae, 0x88, 0x2b, 0xf7,
+  0x5e, 0xb1, 0xd2, 0x82, 0x44, 0x4a, 0x18, 0x8c, 0x77, 0xaf, 0x40, 0x30, 0x32, 0x43, 0xe6, 0x6d,
+  0x84, 0xf2, 0x06, 0xff, 0x67, 0xd9, 0x47, 0xee, 0x0a, 0xb9, 0xba, 0x22, 0x75, 0x49, 0x81, 0x20,
+  0xce, 0xeb, 0xa6, 0xf7, 0xb9, 0xc6, 0x38, 0xa3, 0x17, 0x74, 0x95, 0x65, 0xda, 0x2a, 0xf0, 0x39,
+  0xc0, 0xd5, 0x42, 0x35, 0xfa, 0xa8, 0xca, 0x89, 0xb3, 0x21, 0xe0, 0xd2, 0xbc, 0xee, 0xa9, 0x55,
+  0x35, 0x28, 0x22, 0x20, 0x60, 0xc4, 0x13, 0x24, 0x8b, 0x02, 0xc2, 0x2e, 0x84, 0x14, 0xfe, 0x9c,
+  0x6d, 0xfa, 0x9d, 0xbf, 0xce, 0x9a, 0x91, 0xbf, 0x73, 0xe3, 0x7e, 0x17, 0x14, 0x40, 0xac, 0x45,
+  0xcb, 0x65, 0x43, 0xaf, 0x3e, 0xd6, 0xd6, 0x71, 0xf5, 0x30, 0x1c, 0x8a, 0x63, 0x3f, 0x3e, 0x29,
+  0x7f, 0x2b, 0xac, 0xb9, 0xd0, 0x6e, 0x2e, 0x54, 0x9e, 0x01, 0x1a, 0x3c, 0x16, 0xce, 0x1c, 0xa5,
+  0x15, 0x14, 0x1f, 0x45, 0xf5, 0x4d, 0x5e, 0x4c, 0xeb, 0xff, 0x7d, 0x4b, 0xce, 0xaf, 0x05, 0x35,
+  0xc0, 0x60, 0xb7, 0x8c, 0xc8, 0x2e, 0x9b, 0x6b, 0x47, 0xfc, 0x76, 0x73, 0x17, 0x0b, 0xeb, 0x9e,
+  0xe0, 0x40, 0x8c, 0x71, 0xd9, 0xb4, 0x05, 0xb1, 0xef, 0xf6, 0x1f, 0x16, 0xf5, 0xe9, 0xd6, 0x6a,
+  0xdd, 0x88, 0x88, 0x34, 0xbd, 0x21, 0x99, 0xbb, 0x6d, 0x58, 0xcf, 0xe8, 0xe9, 0x94, 0x41, 0x94,
+  0x0f, 0xb8, 0xdc, 0x15, 0x8e, 0x5c, 0x30, 0xae, 0xf3, 0x71, 0xb9, 0xfc, 0xb0, 0x66, 0x2f, 0x33,
+  0xe6, 0x14, 0x14, 0x4a, 0x21, 0xa8, 0x96, 0x83, 0x46, 0xa5, 0x94, 0xb5, 0x07, 0x48, 0x23, 0x81,
+  0xcd, 0x29, 0x45, 0xf5, 0x13, 0x23, 0x4e, 0xf0, 0x0e, 0x24, 0x6a, 0x49, 0x30, 0x33, 0xa4, 0x25,
+  0xd4, 0x43, 0x3f, 0x8a, 0x3c, 0x30, 0x18, 0xd1, 0x90, 0x74, 0xa9, 0x50, 0xf1, 0xbb, 0x87, 0x31,
+  0x0d, 0xe8, 0xb1, 0x36, 0x2c, 0x4b, 0x4d, 0x5d, 0xaa, 0xd1, 0x07, 0xa7, 0xf1, 0xfe, 0x4f, 0x14,
+  0xc1, 0xff, 0xb9, 0x5a, 0xb1, 0xd1, 0x9a, 0x8e, 0xe3, 0x37, 0x29, 0xb1, 0xa6, 0xb5, 0x7d, 0x15,
+  0x77, 0x1f, 0x15, 0xeb, 0x88, 0xa7, 0x6d, 0xc6, 0x5c, 0xc2, 0x79, 0xfa, 0x50, 0xb3, 0x74, 0xad,
+  0x66, 0xf3, 0x34, 0xc7, 0x27, 0xe2, 0x35, 0x55, 0xf6, 0xf8, 0x10, 0x61, 0x86, 0x3d, 0xf1, 0xfe,
+  0x5c, 0x9f, 0x4f, 0x5f, 0xae, 0x79, 0xe6, 0x87, 0x09, 0xae, 0x6a, 0xc2, 0xde, 0x1a, 0x16, 0xbf,
+  0x98, 0x9f, 0xb7, 0x3f, 0xc3, 0xb8, 0x71, 0x4e, 0xc9, 0xe5, 0x27, 0x7a, 0x7d, 0xdb, 0xf0, 0x3a,
+  0xb9, 0xe5, 0xff, 0x37, 0x06, 0xc8, 0x16, 0xf5, 0xdb, 0x26, 0x61, 0xac, 0xf4, 0x9e, 0x9f, 0x2f,
+  0x97, 0x8b, 0x75, 0xd9, 0x5a, 0xb4, 0x3a, 0x3d, 0xc3, 0xe5, 0xc2, 0xe6, 0xda, 0x36, 0x9f, 0xb7,
+  0xbf, 0xc0, 0xfa, 0x12, 0xb3, 0xc4, 0xa8, 0xa1, 0x72, 0xbe, 0x93, 0xb7, 0xcd, 0x00, 0xde, 0x18,
+  0x3f, 0x6c, 0x38, 0xe2, 0x46, 0x49, 0x70, 0xcb, 0x91, 0x10, 0x97, 0x20, 0xc9, 0xa1, 0x0e, 0xc3,
+  0x39, 0x24, 0x54, 0x95, 0xa5, 0xf0, 0x78, 0xdb, 0x38, 0xf6, 0x30, 0x2c, 0x42, 0xf3, 0x6d, 0xe3,
+  0x6e, 0x8c, 0xe8, 0x6d, 0xf3, 0xeb, 0xce, 0x38, 0x26, 0xae, 0x0b, 0x0f, 0x67, 0x2f, 0x9f, 0xee,
+  0x16, 0x9e, 0x9b, 0x67, 0x89, 0x83, 0x43, 0x82, 0x6f, 0x0f, 0x4f, 0x1f, 0xdc, 0xd7, 0x94, 0xe1,
+  0xc8, 0xb5, 0xc4, 0x3c, 0x36, 0x73, 0x99, 0xe9, 0xbc, 0x88, 0x78, 0x90, 0xdd, 0x86, 0xea, 0xa3,
+  0xef, 0x69, 0x58, 0x08, 0xd5, 0x0c, 0x57, 0xac, 0x9b, 0x69, 0x98, 0x73, 0xfe, 0x48, 0xf3, 0x77,
+  0xe4, 0x38, 0xac, 0xd1, 0xe3, 0xa9, 0xbd, 0x63, 0x48, 0x80, 0xf1, 0xf1, 0x82, 0x55, 0x5a, 0x9b,
+  0xf4, 0x1c, 0x93, 0x1b, 0xcc, 0xaa, 0xba, 0x81, 0xf0, 0x74, 0xce, 0x36, 0xbe, 0x4b, 0xf3, 0x92,
+  0x56, 0x0c, 0x03, 0xb3, 0x68, 0x44, 0xa8, 0x97, 0xd8, 0x05, 0x55, 0x7d, 0x94, 0xf7, 0x9a, 0x04,
+  0x71, 0x43, 0x63, 0x95, 0x5e, 0x49, 0xc4, 0xcb, 0xd1, 0x58, 0x95, 0xc5, 0x90, 0x2f, 0x7f, 0x8c,
+  0xe9, 0x09, 0x59, 0x15, 0x82, 0x3f, 0xa0, 0xb3, 0x8f, 0xc8, 0x15, 0xf8, 0x62, 0x6b, 0x8b, 0x9b,
+  0xa5, 0x6c, 0x83, 0x0a, 0xca, 0x1e, 0xad, 0x3a, 0xa1, 0x97, 0xa7, 0xa9, 0x7a, 0xde, 0x2b, 0xf4,
+  0x4e, 0xfa, 0x2a, 0x5e, 0x00, 0x15, 0xf9, 0x48, 0x46, 0xa5, 0xec, 0xa4, 0x8c, 0x00, 0x48, 0x1c,
+  0x91, 0x56, 0xbb, 0x90, 0x50, 0x28, 0x6d, 0x29, 0xbb, 0xc9, 0x0b, 0x07, 0x0f, 0x58, 0x5c, 0x49,
+  0x21, 0x1d, 0x89, 0x12, 0xe2, 0xe5, 0x23, 0x2c, 0x51, 0x49, 0xcb, 0x46, 0x3b, 0x23, 0x0e, 0x80,
+  0xa5, 0x1b, 0x46, 0xb4, 0x13, 0xed, 0xec, 0x69, 0x1b, 0xd2, 0x17, 0x09, 0x08, 0xcc, 0x85, 0x0e,
+  0xd9, 0x75, 0xdd, 0x95, 0x4b, 0x95, 0xde, 0xd5, 0xf2, 0xe6, 0xeb, 0x05, 0xfe, 0xf4, 0x2e, 0x8a,
+  0x73, 0x17, 0x00, 0xaa, 0xcf, 0xab, 0xb7, 0x72, 0xf1, 0xe3, 0x40, 0xcf, 0xf4, 0xf2, 0x85, 0xd1,
+  0x26, 0x4c, 0x10, 0x0e, 0x87, 0x5f, 0xb6, 0xfc, 0x19, 0x9d, 0x48, 0x3b, 0x40, 0x15, 0x04, 0x38,
+  0x60, 0xcb, 0x47, 0x46, 0x0d, 0xf0, 0xa1, 0x09, 0xcd, 0xac, 0x6d, 0x6a, 0xc5, 0xe8, 0xc9, 0x5c,
+  0x10, 0x14, 0x6e, 0x36, 0x39, 0x45, 0x4e, 0x44, 0x05, 0xd0, 0xa4, 0x21, 0xab, 0x48, 0x77, 0x33,
+  0xa0, 0xfa, 0xfd, 0xfc, 0xf0, 0x97, 0x81, 0xcb, 0x4e, 0x03, 0x00, 0x01, 0x76, 0x40, 0x05, 0x1f,
+  0xb6, 0xfc, 0x88, 0xf9, 0x79, 0x62, 0x3e, 0x21, 0x3e, 0xec, 0xde, 0x96, 0x48, 0xfe, 0xb6, 0xb6,
+  0xe0, 0x60, 0x55, 0x3c, 0x0f, 0x23, 0x50, 0xf1, 0x5d, 0xfd, 0xaa, 0x87, 0x5e, 0xb8, 0x77, 0x65,
+  0xed, 0xd6, 0x3a, 0xe5, 0xf1, 0xfe, 0xd3, 0x7b, 0x77, 0x2f, 0xba, 0xff, 0xc9, 0x85, 0x85, 0xcb,
+  0x73, 0xeb, 0xfa, 0xea, 0x07, 0x3d, 0x44, 0xce, 0x00, 0xbf, 0x56, 0x61, 0x2d, 0x2d, 0xb7, 0x8e,
+  0x4b, 0x65, 0x54, 0x9f, 0x60, 0x0a, 0xdb, 0x6e, 0x34, 0x21, 0x4f, 0x40, 0xe4, 0x2e, 0x06, 0x9f,
+  0x84, 0xf7, 0xed, 0x60, 0xfe, 0x04, 0x5c, 0x1d, 0x3c, 0x92, 0x18, 0x17, 0x00, 0x00,
+};
+
+const char websiteScriptEtag[] = "\"888ec192c17b62a2\"";
+const uint8_t websiteScript[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x19, 0x6b, 0x73, 0xdb, 0x36,
+  0xf2, 0xbb, 0x7e, 0x05, 0xc2, 0x73, 0x5b, 0x30, 0x96, 0x69, 0x49, 0x79, 0xf4, 0xe2, 0x8b, 0x9b,
+  0x49, 0xdd, 0x4c, 0xd3, 0x99, 0x3c, 0x7a, 0x49, 0x3e, 0xb4, 0xe3, 0xf8, 0x66, 0x20, 0x0a, 0x14,
+  0x59, 0xd3, 0xa4, 0x4a, 0x42, 0xb2, 0x3d, 0xae, 0xff, 0xfb, 0xed, 0x03, 0x20, 0x01, 0x3d, 0x6c,
+  0xe7, 0x8b, 0x48, 0x2e, 0x76, 0x17, 0xfb, 0xc6, 0x2e, 0x24, 0xb3, 0x65, 0x95, 0x9a, 0xa2, 0xae,
+  0x84, 0x8c, 0xc5, 0xcd, 0xa0, 0xfb, 0xfa, 0xef, 0x52, 0x37, 0xd7, 0xb2, 0xaa, 0x67, 0xba, 0x45,
+  0xb8, 0xc9, 0x8b, 0x36, 0xa1, 0x2f, 0x71, 0x2c, 0xe8, 0xc9, 0xa0, 0x52, 0x57, 0x73, 0x93, 0x3b,
+  0x98, 0xfd, 0x1c, 0xdc, 0xf6, 0x7c, 0xf6, 0xa4, 0x51, 0xcd, 0x5c, 0x1b, 0x64, 0x52, 0x64, 0xc2,
+  0x7e, 0x89, 0xa2, 0x6a, 0x8d, 0xaa, 0x52, 0x5d, 0x67, 0xbc, 0x53, 0x3c, 0x68, 0xb4, 0x59, 0x36,
+  0x95, 0xe0, 0x75, 0x46, 0xbd, 0x5e, 0xe0, 0xba, 0xa5, 0x38, 0x3e, 0x3e, 0x16, 0x91, 0x63, 0x1b,
+  0x39, 0x76, 0xb3, 0x3a, 0x5d, 0x5e, 0xe8, 0xca, 0x24, 0x8d, 0x56, 0xb3, 0xeb, 0xcf, 0x46, 0x19,
+  0xcd, 0x98, 0x65, 0xad, 0x66, 0x45, 0x35, 0x07, 0xc4, 0x0e, 0x45, 0xcd, 0x66, 0x6f, 0x56, 0xf0,
+  0xf2, 0xae, 0x68, 0x8d, 0xae, 0x74, 0x23, 0xa3, 0x5f, 0x3e, 0xbe, 0x3f, 0xa9, 0x2b, 0x83, 0x30,
+  0x40, 0xd7, 0xb3, 0x68, 0x68, 0x77, 0x8b, 0x07, 0xba, 0x6c, 0xb5, 0xfd, 0x90, 0x9d, 0x70, 0x95,
+  0xbe, 0xb4, 0x86, 0x39, 0x3d, 0x8b, 0x41, 0xcb, 0x1d, 0x52, 0xb6, 0xa6, 0xe1, 0xad, 0x7d, 0x95,
+  0x13, 0x00, 0x5e, 0xc8, 0x38, 0x49, 0x73, 0xd5, 0xbc, 0x36, 0x72, 0x14, 0x33, 0xee, 0x4b, 0x42,
+  0x2b, 0x81, 0xd4, 0xe8, 0x8b, 0x45, 0x49, 0xf2, 0xf7, 0x22, 0xa7, 0xa0, 0x96, 0xd1, 0x6f, 0x4a,
+  0x8d, 0x5f, 0x32, 0x72, 0x28, 0x51, 0x3c, 0x70, 0xaf, 0x49, 0x51, 0x81, 0x2a, 0x6f, 0xbf, 0xbc,
+  0x7f, 0x07, 0x74, 0xc1, 0x4e, 0x9b, 0x42, 0xbf, 0x6e, 0x1a, 0x75, 0x9d, 0x2c, 0x9a, 0xda, 0xd4,
+  0x28, 0x75, 0xd2, 0x96, 0x45, 0xaa, 0x93, 0x54, 0x95, 0xa5, 0xec, 0xd8, 0xa5, 0x6c, 0x0f, 0x10,
+  0xb3, 0x28, 0x67, 0x1f, 0xc8, 0xfd, 0xa8, 0xe9, 0xb7, 0xf0, 0xea, 0xa4, 0xff, 0x1b, 0x31, 0x3f,
+  0xeb, 0x52, 0xa7, 0xa6, 0x6e, 0x5e, 0xe3, 0x2e, 0x6c, 0xdc, 0xed, 0x1c, 0xad, 0x05, 0x5f, 0x89,
+  0x53, 0x7e, 0x3b, 0x13, 0x47, 0x82, 0xcd, 0xbc, 0x97, 0x68, 0x95, 0x62, 0x90, 0xf5, 0xb1, 0x5a,
+  0x4f, 0xff, 0x02, 0xae, 0x43, 0x91, 0x55, 0xce, 0xca, 0x2c, 0x50, 0xd1, 0xd2, 0xd3, 0xae, 0xc7,
+  0x14, 0xd2, 0x75, 0x23, 0x24, 0x1a, 0xb8, 0x00, 0x0e, 0xa3, 0xff, 0xc0, 0xe3, 0xa5, 0xe0, 0x65,
+  0x1b, 0xae, 0x00, 0xda, 0xdf, 0x8f, 0x89, 0x49, 0x56, 0xb1, 0x0a, 0xbc, 0x7e, 0x5a, 0x9c, 0x0d,
+  0x45, 0x31, 0x14, 0xdd, 0x17, 0xfb, 0x2c, 0x53, 0x10, 0x1b, 0xb1, 0x98, 0x82, 0x6f, 0xce, 0x07,
+  0xb7, 0x82, 0x22, 0xc5, 0xdb, 0xe6, 0x5c, 0x5f, 0x43, 0x78, 0x5b, 0xa2, 0xad, 0x6c, 0x01, 0x03,
+  0x18, 0xc3, 0x6f, 0xc7, 0x1a, 0x21, 0xdb, 0x98, 0x3b, 0x2b, 0x31, 0x1a, 0x99, 0x22, 0xab, 0x40,
+  0x0d, 0xb2, 0x58, 0x6f, 0x7d, 0x02, 0x6f, 0x1a, 0x89, 0x8d, 0xd3, 0xa7, 0x6e, 0x02, 0x32, 0xbe,
+  0x01, 0x24, 0xd9, 0xa3, 0x20, 0x1c, 0x74, 0x04, 0x3c, 0xe1, 0x84, 0xb4, 0xa0, 0x21, 0xa5, 0x74,
+  0x2c, 0x6e, 0xfb, 0xd4, 0x04, 0x46, 0x56, 0x84, 0xa4, 0xae, 0x82, 0x9d, 0x34, 0xe6, 0x55, 0xeb,
+  0xdc, 0xe1, 0xe1, 0x93, 0x50, 0x32, 0xac, 0x31, 0x68, 0x24, 0xe4, 0x8d, 0x01, 0x8b, 0x2c, 0x99,
+  0x38, 0x69, 0x17, 0x65, 0x01, 0x31, 0x2e, 0xa2, 0x78, 0x8b, 0x9c, 0x84, 0x83, 0x52, 0x22, 0xe1,
+  0x66, 0x26, 0xd3, 0x32, 0x6f, 0x0f, 0xf2, 0xde, 0xc6, 0x4e, 0xcc, 0x14, 0xa2, 0xf2, 0x7c, 0x8b,
+  0x4d, 0xd8, 0x29, 0xb1, 0xf0, 0x25, 0xad, 0x2b, 0x19, 0x11, 0x7e, 0x44, 0x8c, 0xee, 0xd1, 0x82,
+  0xe1, 0x84, 0x2f, 0x79, 0xd3, 0xbe, 0xe6, 0xa9, 0x34, 0xd5, 0x6d, 0x5b, 0x37, 0x12, 0x1c, 0xb4,
+  0xd0, 0x8d, 0xb9, 0xf6, 0x8c, 0xd2, 0x33, 0x59, 0xa9, 0x72, 0xa9, 0x9d, 0x30, 0xf4, 0x41, 0x01,
+  0xb0, 0xac, 0x66, 0x3a, 0x2b, 0x2a, 0x3d, 0x0b, 0xa5, 0xb3, 0x85, 0xf6, 0x95, 0xe8, 0xdd, 0x79,
+  0x3a, 0x3a, 0x3b, 0x75, 0x3b, 0x60, 0xb2, 0x74, 0x94, 0x0f, 0x11, 0xdd, 0xa3, 0x3c, 0x16, 0xbc,
+  0x3b, 0x29, 0x61, 0x0d, 0x07, 0x10, 0x80, 0x77, 0x8a, 0x44, 0x84, 0x01, 0x65, 0x87, 0x16, 0x73,
+  0x73, 0x11, 0xae, 0x76, 0x35, 0xc8, 0x61, 0x18, 0x7d, 0x65, 0x02, 0x0c, 0x04, 0xd8, 0x52, 0xeb,
+  0x70, 0x94, 0x31, 0x4d, 0xe0, 0x9a, 0x4a, 0x5d, 0x40, 0xe0, 0x05, 0x66, 0xb1, 0xc5, 0x15, 0x57,
+  0xb8, 0x5c, 0x72, 0x22, 0x44, 0xf1, 0x96, 0x84, 0x43, 0xa4, 0x98, 0x75, 0x46, 0xd6, 0x92, 0xf2,
+  0x0b, 0x81, 0x9c, 0x5d, 0x6b, 0x51, 0xfc, 0x2d, 0x46, 0xff, 0xfe, 0xfb, 0xd0, 0xea, 0x09, 0x54,
+  0xa7, 0xd7, 0xb0, 0x45, 0x31, 0x5d, 0x42, 0xb9, 0x7e, 0x75, 0xc7, 0xa2, 0x64, 0xa1, 0x1e, 0xee,
+  0x1b, 0xd6, 0x1a, 0xd7, 0x5a, 0x8f, 0x8d, 0x55, 0xab, 0x5d, 0xe7, 0xec, 0xac, 0x65, 0x4f, 0x2b,
+  0x74, 0x2b, 0x82, 0x3b, 0x97, 0xfa, 0x99, 0xd0, 0xb6, 0x81, 0xb1, 0x5b, 0x73, 0x5d, 0xf2, 0xd1,
+  0x7e, 0x4f, 0xb0, 0x7c, 0xe4, 0x52, 0xa9, 0xda, 0xb6, 0x98, 0x57, 0x56, 0x34, 0xa4, 0x1d, 0x0a,
+  0xc7, 0xa2, 0xdf, 0x04, 0x0e, 0x11, 0x73, 0x1d, 0x6c, 0xf3, 0x80, 0x0d, 0x08, 0xee, 0xc5, 0x07,
+  0xd0, 0x47, 0x91, 0xc7, 0x54, 0x2d, 0x16, 0xba, 0x9a, 0x05, 0x5c, 0xed, 0x21, 0xe5, 0x17, 0x13,
+  0xd4, 0x6e, 0xaf, 0x5b, 0x60, 0x6f, 0xdc, 0xb5, 0x73, 0xe1, 0x88, 0x17, 0xaa, 0xe1, 0x4d, 0x29,
+  0x30, 0xee, 0xaa, 0x93, 0x28, 0x2c, 0x63, 0x5b, 0x99, 0x4e, 0xf0, 0x8c, 0x94, 0x05, 0x44, 0x00,
+  0x55, 0xa5, 0xb4, 0xac, 0x2b, 0x8d, 0x47, 0xa6, 0x34, 0xcd, 0x92, 0xbc, 0xde, 0x55, 0xd0, 0x5e,
+  0x1b, 0xa3, 0xa6, 0xdf, 0x68, 0x20, 0x92, 0xb2, 0x2c, 0xaa, 0x73, 0x27, 0x23, 0x4b, 0x5d, 0x05,
+  0x8d, 0x42, 0x70, 0xd4, 0x4a, 0xc4, 0x0e, 0xe3, 0x30, 0xca, 0x1b, 0x9d, 0x45, 0x70, 0xf0, 0x92,
+  0xbd, 0xd4, 0x0a, 0x68, 0x09, 0x09, 0x64, 0x6e, 0x75, 0x0b, 0x65, 0x37, 0x01, 0x60, 0xc4, 0xa7,
+  0xd5, 0x23, 0x62, 0xfe, 0xcf, 0x3f, 0xe2, 0x11, 0xc0, 0x5c, 0x42, 0x0c, 0xe0, 0x7d, 0xf3, 0x40,
+  0x27, 0xb2, 0x03, 0xe2, 0xa4, 0x40, 0xe2, 0x95, 0xde, 0x5a, 0xbc, 0x6b, 0x93, 0xeb, 0x06, 0xad,
+  0x47, 0x2f, 0xb0, 0x27, 0x04, 0x13, 0x96, 0x6e, 0x68, 0xda, 0x2e, 0xea, 0x15, 0x08, 0xe7, 0x68,
+  0xd1, 0x54, 0x56, 0x2c, 0x87, 0x02, 0xa5, 0xbe, 0x5f, 0x1f, 0xac, 0x77, 0x1d, 0x76, 0x2f, 0x3e,
+  0xb8, 0x50, 0xec, 0x84, 0x1d, 0xf4, 0x81, 0xfc, 0x81, 0xee, 0x81, 0xaf, 0xa1, 0xd8, 0x14, 0x85,
+  0x14, 0x5d, 0x17, 0x07, 0xa3, 0x47, 0x41, 0x67, 0x0a, 0xe5, 0x4a, 0x4d, 0x0f, 0x90, 0x1d, 0x58,
+  0xec, 0x3e, 0xa1, 0x87, 0xd0, 0xef, 0xe5, 0xf5, 0x65, 0x44, 0x4e, 0x26, 0x11, 0x76, 0x09, 0x8f,
+  0x5b, 0xae, 0x21, 0xf4, 0x3b, 0x66, 0xd0, 0x7f, 0x46, 0xd4, 0xaf, 0x10, 0x4a, 0x9d, 0x65, 0x90,
+  0xed, 0x6f, 0x75, 0x31, 0xcf, 0xcd, 0x56, 0xae, 0x6e, 0x4f, 0x3f, 0xc5, 0xeb, 0xb2, 0x54, 0x8b,
+  0x56, 0x07, 0xf1, 0xa5, 0xe8, 0xf9, 0x80, 0x28, 0x43, 0xe9, 0x18, 0x99, 0x2b, 0x6d, 0x5e, 0xa0,
+  0x40, 0xee, 0x98, 0x5b, 0x57, 0xde, 0x6e, 0x4f, 0x75, 0x67, 0x9d, 0x92, 0xd7, 0xd6, 0x29, 0x7d,
+  0xa9, 0xbb, 0x72, 0xe5, 0xad, 0x9b, 0x7a, 0x3e, 0x2f, 0x7b, 0xce, 0xa4, 0xd6, 0x1d, 0xad, 0x7b,
+  0x77, 0x52, 0x6f, 0xb4, 0x08, 0xdc, 0x4c, 0x13, 0x37, 0xb0, 0x04, 0x41, 0x13, 0xdb, 0x18, 0xdb,
+  0x68, 0x87, 0x84, 0xdd, 0x06, 0x96, 0xd1, 0xe9, 0x4c, 0x19, 0x75, 0xc0, 0xb4, 0x67, 0x11, 0x65,
+  0xf0, 0xb2, 0x2c, 0x39, 0x29, 0x18, 0xda, 0xa5, 0x03, 0xd5, 0x69, 0x02, 0xad, 0x25, 0x9a, 0xc7,
+  0x22, 0xb2, 0x3d, 0x3e, 0x44, 0x13, 0x9d, 0x58, 0xbc, 0xe9, 0xa2, 0xa1, 0xe7, 0x2f, 0x3a, 0x53,
+  0xcb, 0x12, 0x87, 0x8b, 0x3d, 0xcb, 0x28, 0xc6, 0xe2, 0xd0, 0x1b, 0x40, 0x74, 0xc6, 0x7d, 0xe8,
+  0x3e, 0x2e, 0x00, 0x68, 0xb3, 0xbd, 0xbb, 0xc8, 0x48, 0x6f, 0x08, 0xb7, 0x2e, 0x66, 0x20, 0xe4,
+  0x2d, 0x2b, 0x0e, 0xa9, 0xce, 0xac, 0x27, 0x75, 0x59, 0x37, 0xad, 0xec, 0x1a, 0xc9, 0x94, 0xbe,
+  0xc1, 0xb0, 0x37, 0xa2, 0x99, 0x4f, 0x8f, 0xf0, 0x71, 0x24, 0x46, 0x43, 0x31, 0xa7, 0x5f, 0x00,
+  0x8c, 0xc4, 0xed, 0x50, 0x7c, 0xfa, 0xf5, 0xe7, 0x77, 0xcb, 0x8b, 0xa2, 0xc2, 0x11, 0x8f, 0x40,
+  0xc0, 0x95, 0x39, 0xf9, 0x23, 0x83, 0x36, 0x04, 0x0b, 0xe2, 0xb5, 0x3b, 0xfe, 0xd1, 0x8b, 0xb0,
+  0x03, 0x2c, 0x42, 0x4a, 0xb7, 0x9a, 0x30, 0xed, 0x2a, 0x3b, 0x04, 0x16, 0x3b, 0x6f, 0xd8, 0x12,
+  0xa9, 0x55, 0xc8, 0x2c, 0xc5, 0xa2, 0x63, 0xe3, 0x3e, 0x15, 0x2f, 0xa1, 0xfd, 0x4f, 0x46, 0x4f,
+  0x5e, 0x4c, 0xfe, 0x0d, 0x01, 0x90, 0x8a, 0x43, 0x31, 0x9e, 0x24, 0x2f, 0x26, 0xe0, 0xe4, 0xf7,
+  0xca, 0xe4, 0xc9, 0xa2, 0xbe, 0x94, 0x32, 0x15, 0xfb, 0x88, 0xf3, 0xec, 0x59, 0x8c, 0xcb, 0xf8,
+  0x32, 0x14, 0x93, 0xe4, 0x29, 0x14, 0x26, 0x5f, 0xfb, 0x84, 0xe5, 0x82, 0xdf, 0x00, 0xea, 0x2b,
+  0x8d, 0xa3, 0x46, 0x32, 0x19, 0x4f, 0x9e, 0x8b, 0xc7, 0x56, 0x30, 0x09, 0xe8, 0x09, 0x94, 0x1e,
+  0xdc, 0xe0, 0xc7, 0xf1, 0xb3, 0x49, 0xb8, 0x30, 0xe7, 0x85, 0xd1, 0x8f, 0x93, 0xb5, 0x85, 0x69,
+  0xd0, 0x59, 0x6e, 0x98, 0xc2, 0x1a, 0xea, 0x42, 0x19, 0xea, 0xfd, 0x0f, 0xff, 0xf7, 0xb5, 0x7d,
+  0x0c, 0x64, 0x5f, 0x25, 0x3c, 0xe5, 0xd7, 0xd9, 0x7e, 0x0c, 0xcf, 0xe1, 0x8e, 0xf7, 0xaf, 0xf8,
+  0xb3, 0x77, 0x98, 0xe8, 0x2b, 0x9d, 0xda, 0x5e, 0x08, 0x8a, 0x7e, 0x64, 0x2b, 0x15, 0xb1, 0xec,
+  0xda, 0x21, 0x72, 0x33, 0xd9, 0x09, 0x14, 0xe4, 0xb5, 0xd3, 0x31, 0x0c, 0x31, 0x13, 0x36, 0xd5,
+  0x04, 0x0d, 0x35, 0xdf, 0xc0, 0x98, 0xac, 0x61, 0x4c, 0x37, 0x30, 0x9e, 0x04, 0x18, 0x60, 0xe6,
+  0x40, 0x93, 0x7f, 0xc9, 0xd3, 0xd1, 0xc1, 0x0b, 0x75, 0x90, 0x9d, 0xdd, 0x4c, 0x6e, 0xe3, 0xdd,
+  0x1f, 0xa4, 0x47, 0xf1, 0x70, 0x45, 0xc8, 0x8c, 0xbf, 0xc1, 0x44, 0xdd, 0x2b, 0x32, 0x7e, 0xee,
+  0xeb, 0xb1, 0x86, 0x30, 0x09, 0x11, 0xa6, 0x1b, 0x08, 0x4f, 0x7c, 0x04, 0xd1, 0x0f, 0xb7, 0x58,
+  0x3d, 0x3c, 0xf7, 0x81, 0x67, 0xbe, 0xd4, 0x6f, 0xdb, 0x95, 0xa4, 0xd8, 0x75, 0xae, 0xbb, 0x02,
+  0x75, 0xd9, 0x2c, 0xea, 0x8a, 0xa3, 0x64, 0x28, 0x28, 0x26, 0xf8, 0x31, 0xe5, 0x43, 0xbb, 0x51,
+  0xd5, 0x1c, 0xc3, 0x0a, 0xf1, 0x0f, 0x7a, 0x33, 0xee, 0xc4, 0x47, 0x23, 0x8e, 0xc8, 0x00, 0x4c,
+  0xf9, 0x93, 0x18, 0xb9, 0x32, 0x4f, 0x5b, 0x1e, 0x53, 0x00, 0x63, 0x44, 0x22, 0xa6, 0xe4, 0x28,
+  0x04, 0xce, 0xcc, 0x02, 0x34, 0x61, 0xb2, 0x7d, 0x01, 0x6a, 0x7d, 0x27, 0x9e, 0xf7, 0xa5, 0xde,
+  0xa7, 0x9e, 0x5b, 0x6a, 0x22, 0xb2, 0xc4, 0x8d, 0x4f, 0x3c, 0x61, 0xba, 0x0e, 0xa9, 0xb1, 0x48,
+  0x73, 0x1f, 0xe9, 0x69, 0x3f, 0xe8, 0xde, 0x88, 0xfc, 0x08, 0xb0, 0x0f, 0xc5, 0x73, 0xe8, 0x2f,
+  0x8f, 0x48, 0x59, 0x10, 0x1c, 0xf2, 0x95, 0x71, 0x0f, 0x09, 0x42, 0xa5, 0x66, 0xc5, 0xab, 0xb7,
+  0xbe, 0x7d, 0xf3, 0x76, 0xf5, 0xa5, 0xfe, 0x34, 0x9f, 0x4a, 0x78, 0x71, 0xf6, 0xcd, 0xc2, 0x19,
+  0xc3, 0x81, 0xb1, 0x9b, 0x92, 0x15, 0x6c, 0x0e, 0xa8, 0x49, 0x0e, 0x39, 0x67, 0xd5, 0xb4, 0x72,
+  0x20, 0x74, 0x05, 0xb2, 0xf2, 0xf3, 0x31, 0x3d, 0x5b, 0x78, 0x76, 0x7e, 0x02, 0x09, 0x3a, 0x1f,
+  0x9c, 0x0f, 0xc5, 0x53, 0xc0, 0x85, 0xc7, 0xd8, 0xbf, 0xda, 0xa0, 0x50, 0xcb, 0xe4, 0xb3, 0x98,
+  0x42, 0x2a, 0x93, 0x4f, 0x62, 0x0a, 0x9d, 0x4c, 0x8e, 0xe3, 0x50, 0x6c, 0x30, 0xc8, 0x67, 0xba,
+  0x32, 0x72, 0x71, 0x61, 0x19, 0x44, 0xf0, 0x09, 0x03, 0xf1, 0x3e, 0xef, 0xd4, 0xd4, 0x30, 0x44,
+  0x58, 0x23, 0x3e, 0xe6, 0xa4, 0xd9, 0x17, 0xd8, 0x7e, 0x6c, 0x22, 0xcc, 0xef, 0x43, 0x98, 0x7a,
+  0x08, 0x71, 0x04, 0xb2, 0xa0, 0x49, 0x60, 0x1e, 0xac, 0x7e, 0x87, 0x53, 0x55, 0x63, 0x11, 0xa5,
+  0xd0, 0x75, 0x6d, 0x45, 0xdd, 0x74, 0x70, 0xaf, 0x95, 0x5a, 0xe0, 0xb3, 0x75, 0x06, 0x4d, 0x6d,
+  0x29, 0x5f, 0xa7, 0xe1, 0xf7, 0x87, 0xf4, 0xb8, 0x9a, 0xaf, 0xb9, 0xfc, 0x36, 0x17, 0xcc, 0x4e,
+  0x47, 0x4d, 0x4e, 0x2e, 0x6f, 0x9d, 0xe3, 0xf1, 0x40, 0xa1, 0x2e, 0xb8, 0x5e, 0x2c, 0x17, 0x77,
+  0xdc, 0x97, 0xcd, 0x0a, 0xec, 0x69, 0x09, 0x8b, 0x3b, 0x8d, 0x0f, 0x34, 0x48, 0xc2, 0x49, 0xb9,
+  0x38, 0x20, 0x68, 0x64, 0x17, 0xfd, 0x4b, 0xb4, 0x1f, 0x5e, 0x02, 0x99, 0x20, 0xf4, 0x63, 0x44,
+  0x6c, 0x57, 0xd1, 0x4f, 0x1b, 0xa0, 0x83, 0x74, 0xd9, 0xc0, 0x60, 0x0b, 0x2b, 0x87, 0xb0, 0xe4,
+  0x7e, 0x43, 0xac, 0x1c, 0x26, 0xe6, 0x2d, 0xb0, 0xad, 0xa4, 0x3f, 0x90, 0x3e, 0xed, 0xdf, 0x4b,
+  0x68, 0x5f, 0xf1, 0xc8, 0x23, 0xa9, 0xb2, 0xa2, 0x69, 0x0d, 0x0d, 0x19, 0xb4, 0x3a, 0xa5, 0xd3,
+  0x8d, 0x97, 0x80, 0xa1, 0x5d, 0xe9, 0xa3, 0x08, 0x26, 0x12, 0xe8, 0x8c, 0xd0, 0x9a, 0xcc, 0x87,
+  0xe7, 0xb4, 0x64, 0xaa, 0xd2, 0xf3, 0x39, 0xb9, 0xde, 0x9d, 0xb6, 0x7d, 0xbc, 0x75, 0x09, 0xc3,
+  0x79, 0x87, 0xa9, 0x40, 0x66, 0x1e, 0x93, 0x99, 0xc7, 0xd0, 0x8f, 0xc7, 0x8e, 0x59, 0x2f, 0x8c,
+  0xe5, 0x5b, 0xea, 0x0c, 0x7d, 0xe5, 0x32, 0x63, 0x3c, 0x1a, 0x61, 0x34, 0x7d, 0x17, 0xed, 0x24,
+  0x30, 0x35, 0xfa, 0x4a, 0x8e, 0x5d, 0x5a, 0xc5, 0x01, 0x15, 0x68, 0xb7, 0x8b, 0xc4, 0xa5, 0x68,
+  0x8f, 0xec, 0x1f, 0x89, 0x7c, 0x03, 0x73, 0x33, 0xa0, 0x38, 0xeb, 0x9a, 0x0a, 0xb9, 0x45, 0x49,
+  0xac, 0x0a, 0x31, 0x5e, 0x04, 0xb0, 0xa1, 0x78, 0x06, 0xe0, 0x28, 0xc6, 0x19, 0xdf, 0xbe, 0x26,
+  0xbc, 0x7e, 0x02, 0x23, 0x05, 0x9a, 0x2e, 0xde, 0x01, 0xe7, 0x99, 0xe3, 0x86, 0xe3, 0xfe, 0xc8,
+  0x86, 0x3f, 0xb4, 0x3e, 0x7b, 0xd2, 0xc6, 0x31, 0x64, 0x3b, 0x5f, 0xe6, 0xf9, 0xd2, 0xce, 0x1a,
+  0x35, 0xb7, 0x37, 0x9d, 0x43, 0x81, 0xad, 0x34, 0x35, 0x56, 0xdc, 0x86, 0x6e, 0x36, 0xb9, 0x8b,
+  0xba, 0x80, 0x79, 0xb6, 0x99, 0xd5, 0x97, 0xd5, 0xf6, 0x56, 0xd7, 0x52, 0x82, 0xd2, 0xbf, 0x33,
+  0xea, 0x89, 0x5a, 0x40, 0x9e, 0x69, 0x69, 0x5b, 0x4d, 0x06, 0xfe, 0x36, 0x8b, 0x07, 0xd4, 0xb6,
+  0x33, 0xdd, 0xae, 0x3e, 0x14, 0xda, 0xbe, 0xfb, 0x24, 0x41, 0x2e, 0xdb, 0x25, 0xf1, 0x2e, 0xba,
+  0x73, 0xd5, 0xde, 0x23, 0x4d, 0x2c, 0x7c, 0x71, 0xc2, 0xcb, 0xb3, 0xac, 0xe1, 0x59, 0xa2, 0x6f,
+  0x70, 0x6c, 0xe9, 0xd8, 0x5a, 0x7a, 0xc7, 0xee, 0x0a, 0x84, 0xc6, 0x05, 0x34, 0x2e, 0x47, 0xdf,
+  0xce, 0xc1, 0xa0, 0x81, 0xd9, 0x15, 0x42, 0xca, 0xc6, 0x28, 0x88, 0xfb, 0x33, 0x66, 0x06, 0x84,
+  0xc9, 0x49, 0x59, 0x00, 0xda, 0x27, 0x58, 0x06, 0x53, 0x70, 0x50, 0x1f, 0xf7, 0xc2, 0x58, 0x15,
+  0x52, 0x42, 0xfa, 0x03, 0x0f, 0x31, 0xbe, 0x3f, 0xce, 0x0c, 0x1d, 0x64, 0xf8, 0x71, 0x59, 0xcc,
+  0x4c, 0xce, 0xa4, 0x58, 0xb4, 0x30, 0xcc, 0xb7, 0x93, 0xff, 0xe9, 0xc8, 0x21, 0xba, 0x3b, 0xea,
+  0x9c, 0x46, 0x3d, 0x28, 0x56, 0x14, 0xce, 0x68, 0x13, 0xd2, 0x06, 0xb2, 0xe2, 0x3e, 0x55, 0x30,
+  0x71, 0xee, 0xd2, 0x23, 0xdf, 0xa9, 0xc7, 0x03, 0x05, 0xb1, 0xf1, 0xfc, 0x6d, 0x43, 0xd8, 0x8e,
+  0x18, 0xe3, 0x94, 0xeb, 0xcf, 0x99, 0x63, 0x5b, 0xd0, 0x28, 0x81, 0x71, 0x0c, 0xe3, 0x85, 0xee,
+  0xdf, 0x0b, 0xf0, 0x6a, 0x08, 0xde, 0x3a, 0x16, 0x38, 0x09, 0xbd, 0xf1, 0x80, 0x4e, 0x52, 0x3e,
+  0x3e, 0x82, 0xae, 0xab, 0xcf, 0x7e, 0xcf, 0x84, 0x8e, 0x7e, 0x97, 0x19, 0xb9, 0xe6, 0x06, 0x65,
+  0xaf, 0xf3, 0x3f, 0x54, 0xa4, 0xcb, 0xa2, 0x82, 0x14, 0x4d, 0x16, 0x6a, 0xae, 0xff, 0xf8, 0x48,
+  0x83, 0x3b, 0x96, 0xa9, 0xc5, 0x55, 0x14, 0x10, 0x72, 0x2d, 0x23, 0xba, 0x69, 0x6d, 0x4c, 0x7d,
+  0x11, 0x52, 0xfe, 0xd9, 0x51, 0x3e, 0x75, 0xd4, 0xdd, 0xb1, 0x36, 0xad, 0x67, 0xd7, 0xc1, 0x9d,
+  0x13, 0xdb, 0x6c, 0x10, 0x9c, 0xd8, 0x04, 0x1b, 0x84, 0xd7, 0xdf, 0xeb, 0xc7, 0x30, 0x1e, 0xec,
+  0xfa, 0xb2, 0x1b, 0xea, 0xfa, 0xac, 0x0b, 0x8c, 0xec, 0xae, 0x47, 0x3a, 0xee, 0xb1, 0xd7, 0x1b,
+  0xb8, 0x2b, 0x80, 0xb5, 0xdd, 0x6d, 0xab, 0x7b, 0xc7, 0xc4, 0x7e, 0x6f, 0x31, 0x5b, 0x8b, 0x0d,
+  0xa8, 0xc8, 0x8f, 0xbc, 0x6d, 0xbb, 0xab, 0x12, 0x7f, 0x74, 0x8f, 0x09, 0x6b, 0x6d, 0x98, 0xdf,
+  0xbc, 0x5c, 0x21, 0xdd, 0xf1, 0x76, 0x25, 0x8c, 0x25, 0x30, 0x94, 0x75, 0xc0, 0x1e, 0x68, 0x60,
+  0x5f, 0xff, 0xa2, 0xff, 0x56, 0xb0, 0x91, 0x81, 0x75, 0x19, 0xff, 0x1f, 0x83, 0x72, 0x85, 0x62,
+  0x20, 0x1d, 0x00, 0x00,
+};
+
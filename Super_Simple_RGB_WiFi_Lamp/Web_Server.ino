@@ -1,40 +1,138 @@
 void webServerInit() {
   // Set the URI's of the server
-  restServer.onNotFound(serve404);
-  restServer.on("/", servePage);
-  restServer.begin();
+  webServer.onNotFound(serve404);
+  webServer.on("/", HTTP_GET, servePage);
+  webServer.on("/lamp.css", HTTP_GET, [](AsyncWebServerRequest *request) {
+    serveGzip(request, "text/css", websiteStyle, sizeof(websiteStyle), websiteStyleEtag, WEBSITE_ASSET_CACHE);
+  });
+  webServer.on("/lamp.js", HTTP_GET, [](AsyncWebServerRequest *request) {
+    serveGzip(request, "application/javascript", websiteScript, sizeof(websiteScript), websiteScriptEtag, WEBSITE_ASSET_CACHE);
+  });
+  webServer.on("/preset", HTTP_ANY, servePreset, nullptr, servePresetBody);
 
   // Set up OTA on the server
   otaInit();
+  webServer.begin();
 
   // Debug
   Serial.println("[webServerInit] - Webserver was set up correctly");
 }
 
-void serve404() {
-  restServer.send(404, "text/html", "");
+void serve404(AsyncWebServerRequest *request) {
+  request->send(404, "text/html", "");
 }
 
-void servePage() {
+void servePage(AsyncWebServerRequest *request) {
   // Debug
   Serial.println("[servePage] - Serving webpage");
 
   // Set the bool
   webSocketConnecting = true;
 
-  restServer.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-  restServer.sendHeader("Pragma", "no-cache");
-  restServer.sendHeader("Expires", "-1");
-  restServer.setContentLength(CONTENT_LENGTH_UNKNOWN);
-  restServer.send(200, "text/html", String(""));
-  restServer.sendContent_P(websiteSource);
-  restServer.sendContent("");
-  restServer.client().stop();
+  // The browser checks the page on every load, so it picks up the assets of a new firmware
+  serveGzip(request, "text/html", websitePage, sizeof(websitePage), websitePageEtag, WEBSITE_PAGE_CACHE);
 
   // Scan for the networks in the area
   // scanForNetworks();
 }
 
+// Send a file of the website as it was gzipped by Website/update_website.py, or 304 if the browser has it already.
+// The file is read from the flash in pieces as the client takes them.
+void serveGzip(AsyncWebServerRequest *request, const char* contentType, const uint8_t* data, size_t length, const char* etag, const char* cacheControl) {
+  AsyncWebServerResponse *response;
+  if (request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value().indexOf(etag) >= 0) {
+    response = request->beginResponse(304);
+  }
+  else {
+    response = request->beginResponse_P(200, contentType, data, length);
+    response->addHeader("Content-Encoding", "gzip");
+  }
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", cacheControl);
+  request->send(response);
+}
+
+// Presets over REST. GET /preset lists them and GET /preset?export=Name returns one as JSON. Changes are posted to
+// /preset?recall=Name, ?save=Name and ?delete=Name, and an exported preset is imported by posting it to
+// /preset?import=Name. Changes are queued like the websocket messages and carried out by the loop, which also looks
+// up the name and then sends the new list of presets to the websocket clients.
+void servePreset(AsyncWebServerRequest *request) {
+  static const char* parameters[] = { "recall", "save", "delete", "import" };
+  static const char* commands[] = { "Recall", "Save", "Delete", "Import" };
+  int8_t command = -1;
+  for (uint8_t i = 0; i < 4; i++) {
+    if (request->hasParam(parameters[i])) command = i;
+  }
+
+  // Reading only
+  if (command < 0) {
+    String response;
+    bool success = true;
+    if (request->hasParam("export")) {
+      DynamicJsonDocument jsonDocument(DEVICE_CONFIG_SIZE);
+      success = presetExport(request->getParam("export")->value(), jsonDocument.to<JsonObject>());
+      serializeJson(jsonDocument, response);
+    }
+    else {
+      StaticJsonDocument<JSON_ARRAY_SIZE(PRESET_MAX) + JSON_OBJECT_SIZE(1)> jsonDocument;
+      presetAddNames(jsonDocument);
+      serializeJson(jsonDocument, response);
+    }
+    request->send(success ? 200 : 404, "application/json", response);
+    return;
+  }
+
+  if (request->method() != HTTP_POST) {
+    request->send(405, "application/json", "{}");
+    return;
+  }
+
+  // The message goes through the document of the websocket messages, both are only handled in the network context.
+  // An import was wrapped into its message by servePresetBody() and is parsed in place.
+  size_t size = 0;
+  bool valid = true;
+  if (command == 3) {
+    char* message = (char*)request->_tempObject;
+    valid = message && !deserializeJson(messageDocument, message) && messageDocument["Preset"]["Import"]["Settings"].is<JsonObject>();
+    if (valid) size = strlen(message);
+  }
+  else messageDocument["Preset"][commands[command]] = request->getParam(parameters[command])->value();
+
+  // The preset is changed by the loop, the request is only accepted here
+  bool queued = valid && queueInboundMessage(messageDocument.as<JsonObjectConst>(), messageDocument.memoryUsage() + size);
+  messageDocument.clear();
+  if (!valid) request->send(400, "application/json", "{}");
+  else request->send(queued ? 202 : 503, "application/json", queued ? "{\"Queued\":true}" : "{\"Queued\":false}");
+}
+
+// Length of the start of an import message, {"Preset":{"Import":{"Name":"Evening","Settings": with the name
+// escaped. It is written to the buffer if there is one, which needs room for the whole wrapper.
+size_t presetImportPrefix(const String& name, char* buffer, size_t size) {
+  StaticJsonDocument<3 * JSON_OBJECT_SIZE(1)> wrapper;
+  wrapper["Preset"]["Import"]["Name"] = name.c_str();
+  size_t length = measureJson(wrapper) - 3;
+  if (buffer) {
+    serializeJson(wrapper, buffer, size);
+    memcpy(buffer + length, ",\"Settings\":", 12);
+  }
+  return length + 12;
+}
+
+// Collect the body of an import, it arrives in pieces before servePreset() is called. It is written straight into
+// the message of the import, so it is only held once. The library frees it.
+void servePresetBody(AsyncWebServerRequest *request, uint8_t *data, size_t length, size_t index, size_t total) {
+  if (total > DEVICE_CONFIG_SIZE || !request->hasParam("import")) return;
+  const String& name = request->getParam("import")->value();
+  size_t offset = presetImportPrefix(name, nullptr, 0);
+  if (index == 0) {
+    request->_tempObject = malloc(offset + total + 4);
+    if (!request->_tempObject) return;
+    presetImportPrefix(name, (char*)request->_tempObject, offset + total + 4);
+    strcpy((char*)request->_tempObject + offset + total, "}}}");
+  }
+  if (request->_tempObject) memcpy((char*)request->_tempObject + offset + index, data, length);
+}
+
 void scanForNetworks() {
   WiFi.scanNetworksAsync([&](int _networksFound) {
     updateWifiConfigTable(_networksFound);
@@ -54,26 +152,75 @@ void updateWifiConfigTable(int _numNetworks) {
     }
   }
   
-  // Loop through each of the found networks and put in HTML table
-  String wsMessage = "{\"Wifi\":{\"ScanResults\":[";
+  // Stream the found networks into the frame buffer, one small document per network
+  char* payload = websocketPayload();
+  size_t length = strlcpy(payload, "{\"Wifi\":{\"ScanResults\":[", WEBSOCKET_FRAME_SIZE);
+  char number[12];
   for(std::map<int32_t, int>::reverse_iterator  _orderedRSSI = orderedRSSI.rbegin(); _orderedRSSI != orderedRSSI.rend(); ++_orderedRSSI) {
-    wsMessage += "{\"SSID\":\"" + WiFi.SSID(_orderedRSSI->second) + "\",";
-    wsMessage += "\"BSSID\":\"" + WiFi.BSSIDstr(_orderedRSSI->second) + "\",";
-    wsMessage += "\"CHANNEL\":\"" + String(WiFi.channel(_orderedRSSI->second)) + "\",";
-    wsMessage += "\"RSSI\":\"" + String(WiFi.RSSI(_orderedRSSI->second)) + "\",";
-    wsMessage += "\"ENCRYPT\":\"" + String((WiFi.encryptionType(_orderedRSSI->second) == ENC_TYPE_NONE) ? "No" : "Yes") + "\"";
-    wsMessage += "}";
-    wsMessage += _orderedRSSI != --orderedRSSI.rend() ? "," : "";
+    StaticJsonDocument<JSON_OBJECT_SIZE(5) + 96> network;
+    network["SSID"] = WiFi.SSID(_orderedRSSI->second);
+    network["BSSID"] = WiFi.BSSIDstr(_orderedRSSI->second);
+    snprintf(number, sizeof(number), "%d", WiFi.channel(_orderedRSSI->second));
+    network["CHANNEL"] = (char*)number;
+    snprintf(number, sizeof(number), "%d", (int)WiFi.RSSI(_orderedRSSI->second));
+    network["RSSI"] = (char*)number;
+    network["ENCRYPT"] = (WiFi.encryptionType(_orderedRSSI->second) == ENC_TYPE_NONE) ? "No" : "Yes";
+
+    // Keep room for the separator and the closing brackets, the weakest networks are left out
+    if (length + measureJson(network) + 4 >= WEBSOCKET_FRAME_SIZE) break;
+    if (_orderedRSSI != orderedRSSI.rbegin()) payload[length++] = ',';
+    length += serializeJson(network, payload + length, WEBSOCKET_FRAME_SIZE - length);
   }
-  wsMessage += "]}}";
+  length += strlcpy(payload + length, "]}}", WEBSOCKET_FRAME_SIZE - length);
 
   // Send if the client is connected 
-  if (webSocket.connectedClients(false)) webSocket.broadcastTXT(wsMessage);
+  if (webSocket.count()) webSocket.textAll(payload, length);
 
   // Debug 
   Serial.println("[updateWifiConfigTable] - Number of Valid Networks Sent was: " + String(orderedRSSI.size()));
 }
 
+// Updates are uploaded to /update as a form, like the ESP8266HTTPUpdateServer took them
 void otaInit() {
-  OTAServer.setup(&restServer, "/update");
+  webServer.on("/update", HTTP_GET, [](AsyncWebServerRequest *request) {
+    request->send(200, "text/html", F("<html><body><form method='POST' action='' enctype='multipart/form-data'><input type='file' accept='.bin' name='update'><input type='submit' value='Update Firmware'></form></body></html>"));
+  });
+  webServer.on("/update", HTTP_POST, serveUpdate, serveUpdateUpload);
+}
+
+void serveUpdate(AsyncWebServerRequest *request) {
+  bool success = !Update.hasError() && Update.isFinished();
+  AsyncWebServerResponse *response = request->beginResponse(200, "text/html", success ? F("Update Success! Rebooting...") : F("Update Failed"));
+  response->addHeader("Connection", "close");
+  request->send(response);
+
+  // Restart once the answer is out
+  if (success) {
+    otaRestart = true;
+    otaRestartTime = millis();
+  }
+}
+
+// Write the firmware as it arrives, in the network stack
+void serveUpdateUpload(AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t length, bool final) {
+  if (index == 0) {
+    Serial.println("[serveUpdateUpload] - Receiving update " + filename);
+    Update.runAsync(true);
+    if (!Update.begin((ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000)) Update.printError(Serial);
+  }
+  if (!Update.hasError() && Update.write(data, length) != length) Update.printError(Serial);
+  if (final) {
+    if (Update.end(true)) Serial.println("[serveUpdateUpload] - Update of " + String(index + length) + " bytes written");
+    else Update.printError(Serial);
+  }
+}
+
+void handleWebServer() {
+  // Free the websockets that were closed, the library keeps them until asked
+  webSocket.cleanupClients(WEBSOCKET_CLIENTS_MAX);
+
+  if (otaRestart && millis() - otaRestartTime > 500) {
+    Serial.println("[handleWebServer] - Restarting after the update");
+    ESP.restart();
+  }
 }
@@ -1,94 +1,270 @@
 void websocketsInit() {
-  // Start the WS Server
-  webSocket.begin();
-
-  // Set the callback for messages
+  // Set the callback for messages and add the WS Server to the webserver
   webSocket.onEvent(webSocketEvent);
+  webServer.addHandler(&webSocket);
 
   // Debug
-  Serial.println("[websocketsInit] - Websocket server is now running on port " + String(81));
+  Serial.println("[websocketsInit] - Websocket server is now running on port 80 at /ws");
 }
 
-void webSocketEvent(uint8_t num, WStype_t type, uint8_t *payload, size_t length) {
+// Runs in the network stack, like the UDP receivers it never interrupts the loop
+void webSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *payload, size_t length) {
+  // Look up the number of the client
+  uint8_t num = 0;
+  while (num < WEBSOCKET_CLIENTS_MAX && websocketClientIds[num] != client->id()) num++;
+
   switch (type) {
-    case WStype_DISCONNECTED : {
+    case WS_EVT_DISCONNECT : {
+      if (num == WEBSOCKET_CLIENTS_MAX) return;
       Serial.println("[webSocketEvent] - Disconnected from client number " + String(num));
+      websocketClientIds[num] = 0;
+      clientsConnected &= ~(1 << num);
+      clientsNeedUpdate &= ~(1 << num);
+      previewSubscribe(num, 0);
+      presetExports[num] = "";
       webSocketConnecting = false;
     }
     break;
-    case WStype_CONNECTED : {
+    case WS_EVT_CONNECT : {
+      // Give the client a free number, there is no room for more clients
+      num = 0;
+      while (num < WEBSOCKET_CLIENTS_MAX && websocketClientIds[num] != 0) num++;
+      if (num == WEBSOCKET_CLIENTS_MAX) {
+        Serial.println("[webSocketEvent] - Too many clients, closing the connection from " + client->remoteIP().toString());
+        client->close();
+        return;
+      }
+      websocketClientIds[num] = client->id();
+
       // Debug
-      Serial.println("[webSocketEvent] - Connected to client number " + String(num) + " at " + webSocket.remoteIP(num).toString());
+      Serial.println("[webSocketEvent] - Connected to client number " + String(num) + " at " + client->remoteIP().toString());
 
-      // Set the boolean 
-      clientNeedsUpdate = true;
+      // Mark the client, only it is sent the current state
+      clientsConnected |= 1 << num;
+      clientsNeedUpdate |= 1 << num;
     }
     break;
-    case WStype_TEXT : {
-      if (!processingMessage) {
-        // Set the processing bool to true - drops new messages quickly
-        processingMessage = true;
-
-        // Start a JSON buffer and try parse the message
-        DynamicJsonDocument jsonDocument(1024); // 536 max
-        DeserializationError jsonError = deserializeJson(jsonDocument, payload);
-
-        // if there is no error pass it to the config method
-        if (jsonError) {
-          Serial.print("[webSocketEvent] - Error parsing websocket message: ");
-          Serial.println(jsonError.c_str());
+    case WS_EVT_DATA : {
+      // Only whole messages are handled, the largest inbound message fits a single frame
+      AwsFrameInfo *info = (AwsFrameInfo*)arg;
+      if (num == WEBSOCKET_CLIENTS_MAX || !info->final || info->index != 0 || info->len != length) return;
+
+      // Realtime pixels and commands, see Realtime.ino
+      if (info->opcode == WS_BINARY) {
+        realtimeMessage(num, payload, length);
+        return;
+      }
+      if (info->opcode != WS_TEXT) return;
+      inboundStats.received++;
+
+      // Parse the message in place into the static message document, its strings point into the payload
+      DeserializationError jsonError = deserializeJson(messageDocument, (char*)payload, length);
+      jsonArenaMeasure(messageDocument, jsonArenaStats.messagePeak, jsonError == DeserializationError::NoMemory, "webSocketEvent");
+
+      // Queue the message, it is applied by handleInboundMessages()
+      if (jsonError) {
+        inboundStats.dropped++;
+        Serial.print("[webSocketEvent] - Error parsing websocket message: ");
+        Serial.println(jsonError.c_str());
+      }
+      else if (messageDocument.is<JsonObject>()) {
+        // A client that missed a state patch asks for the whole state
+        if (messageDocument.containsKey("Resync")) {
+          clientsNeedUpdate |= 1 << num;
+          messageDocument.remove("Resync");
         }
-        else {
-          // Debug 
-          // Serial.print("Incoming Websocket message is: ");
-          // serializeJson(jsonDocument, Serial);
-          // Serial.println();
-
-          // Parse config
-          parseConfig(jsonDocument);
-          addLampInfo(jsonDocument);
-
-          // Send the updated config back to the clients via websocket
-          websocketSend(jsonDocument);
+        // The preview is only sent to the clients that ask for it, see Preview.ino
+        if (messageDocument.containsKey("Preview")) {
+          previewSubscribe(num, messageDocument["Preview"] | 0);
+          messageDocument.remove("Preview");
         }
-        
-        // Set the processing bool to false to allow more messages
-        processingMessage = false;
+        // Exports are only sent back to the client that asks, see handlePresets()
+        if (messageDocument["Preset"].containsKey("Export")) {
+          presetExports[num] = messageDocument["Preset"]["Export"] | "";
+          messageDocument["Preset"].remove("Export");
+          if (messageDocument["Preset"].size() == 0) messageDocument.remove("Preset");
+        }
+        // Taps are timed as they arrive, queued ones could be held up by a frame or merged
+        if (messageDocument["Beat"]["Tap"] | false) {
+          beatClock.tap(millis());
+          messageDocument["Beat"].remove("Tap");
+          if (messageDocument["Beat"].size() == 0) messageDocument.remove("Beat");
+        }
+        if (messageDocument.size() > 0) queueInboundMessage(messageDocument.as<JsonObjectConst>(), messageDocument.memoryUsage() + length);
       }
+
+      // Do not keep pointers into the payload
+      messageDocument.clear();
     }
     break;
-    case WStype_BIN: {
-      Serial.println("[webSocketEvent] - Binary Data Not Supported");
-    }
-    break; 
     default : {
-      // Serial.println("[webSocketEvent] - Invalid WStype Used");
+      // Serial.println("[webSocketEvent] - Invalid AwsEventType Used");
     }
     break;
   }
 }
 
+// Connected client with the given number, nullptr if there is none
+AsyncWebSocketClient* websocketClient(uint8_t num) {
+  if (num >= WEBSOCKET_CLIENTS_MAX || !websocketClientIds[num]) return nullptr;
+  AsyncWebSocketClient *client = webSocket.client(websocketClientIds[num]);
+  return client && client->status() == WS_CONNECTED ? client : nullptr;
+}
+
+// True if a message for the client would be queued. A slow client misses messages instead of piling them up.
+bool websocketCanSend(uint8_t num) {
+  AsyncWebSocketClient *client = websocketClient(num);
+  if (!client) return false;
+  if (client->queueIsFull()) {
+    websocketQueueFull++;
+    return false;
+  }
+  return true;
+}
+
+// Outbound messages are serialized into the static frame buffer, the websocket library copies them into its queue
+char* websocketPayload() {
+  return websocketFrame;
+}
+
+// Serialize the message into the frame buffer, returns its length or 0 if it does not fit
+size_t websocketSerialize(JsonDocument& jsonMessage) {
+  // A message that fills the buffer was most likely cut off
+  size_t length = serializeJson(jsonMessage, websocketPayload(), WEBSOCKET_FRAME_SIZE);
+  if (length >= WEBSOCKET_FRAME_SIZE - 1) {
+    websocketFrameOverflows++;
+    Serial.println("[websocketSerialize] - Message of " + String(measureJson(jsonMessage)) + " bytes does not fit the frame, dropped");
+    return 0;
+  }
+  return length;
+}
+
+// Append a member to the object being written into the frame buffer, length is the length written so far and starts
+// at 1 for the opening brace. The keys are plain names and are not escaped. Returns false if the member does not fit,
+// room is kept for the closing brackets.
+bool websocketAppendMember(size_t& length, const char* key, JsonVariantConst value) {
+  char* payload = websocketPayload();
+  size_t keyLength = strlen(key);
+  size_t needed = keyLength + measureJson(value) + 4;
+  if (length + needed + 4 >= WEBSOCKET_FRAME_SIZE) {
+    websocketFrameOverflows++;
+    Serial.println("[websocketAppendMember] - \"" + String(key) + "\" does not fit the frame, message dropped");
+    return false;
+  }
+  if (length > 1) payload[length++] = ',';
+  payload[length++] = '"';
+  memcpy(payload + length, key, keyLength);
+  length += keyLength;
+  payload[length++] = '"';
+  payload[length++] = ':';
+  length += serializeJson(value, payload + length, WEBSOCKET_FRAME_SIZE - length);
+  return true;
+}
+
 bool websocketSend(JsonDocument& jsonMessage) {
-  // Serialize the string
-  String buffer;
-  serializeJson(jsonMessage, buffer); 
+  size_t length = websocketSerialize(jsonMessage);
+  if (!length) return false;
+
+  // Broadcast the message, the clients share one copy of it. The library drops it for a client whose queue is full.
+  // Serial.println("[websocketSend] - Sending: " + String(websocketPayload()));
+  if (!webSocket.count()) return true;
+  AsyncWebSocketMessageBuffer *buffer = webSocket.makeBuffer(length);
+  if (!buffer) return false;
+  memcpy(buffer->get(), websocketPayload(), length);
+  for (uint8_t num = 0; num < WEBSOCKET_CLIENTS_MAX; num++) {
+    AsyncWebSocketClient *client = websocketClient(num);
+    if (client && client->queueIsFull()) websocketQueueFull++;
+  }
+  webSocket.textAll(buffer);
+  return true;
+}
+
+bool websocketSendTo(uint8_t num, JsonDocument& jsonMessage) {
+  size_t length = websocketSerialize(jsonMessage);
+  if (!length) return false;
+  return websocketSendFrameTo(num, length);
+}
+
+// Send the message already written into the frame buffer to one client
+bool websocketSendFrameTo(uint8_t num, size_t length) {
+  if (!websocketCanSend(num)) return false;
+  websocketClient(num)->text(websocketPayload(), length);
+  return true;
+}
+
+// Merge a message into the inbound queue, later values replace earlier ones. All strings are copied, so the payload
+// can go once this returns. Size is the most memory the message can take in the queue, its nodes and strings.
+// Returns false if the message was dropped.
+bool queueInboundMessage(JsonObjectConst message, size_t size) {
+  // The memory of replaced values is only freed when the queue is applied, drop what might not fit. The strings of
+  // a parsed message are at most as long as the message itself.
+  if (inboundQueue.memoryUsage() + size > INBOUND_QUEUE_SIZE - INBOUND_ECHO_RESERVE) {
+    inboundStats.dropped++;
+    Serial.println("[queueInboundMessage] - Inbound queue is full, message dropped");
+    return false;
+  }
+
+  // Debug
+  // Serial.print("[queueInboundMessage] - Incoming Websocket message is: ");
+  // serializeJson(message, Serial);
+  // Serial.println();
+
+  JsonObject queue = inboundQueue.as<JsonObject>();
+  if (queue.isNull()) queue = inboundQueue.to<JsonObject>();
+  else inboundStats.coalesced++;
+  mergeConfig(queue, message);
+  return true;
+}
+
+// Apply the queued messages at once, the clients are told about the changes by the next state patch
+void handleInboundMessages() {
+  if (inboundQueue.isNull()) return;
+
+  // Parse config
+  parseConfig(inboundQueue);
+  jsonArenaMeasure(inboundQueue, jsonArenaStats.queuePeak, false, "handleInboundMessages");
+  inboundQueue.clear();
+}
 
-  // Broadcast the message
-  // Serial.println("[websocketSend] - Sending: " + buffer);
-  webSocket.broadcastTXT(buffer.c_str());
+// Send the changes of the state since the last loop to all clients as one patch, e.g.
+//   { "Seq" : 42, "Rainbow" : { "Speed" : 5 } }
+// The patches are numbered, a client that sees a gap asks for the whole state with { "Resync" : true }.
+void handleStatePatch() {
+  if (statePatchOverflow) {
+    // The changes did not fit, the clients are sent the whole state instead
+    stateSeq++;
+    statePatchOverflow = false;
+    statePatch.clear();
+    invalidateClientState();
+    clientsNeedUpdate |= clientsConnected;
+    return;
+  }
+  if (statePatch.as<JsonObject>().size() == 0) return;
+
+  statePatch["Seq"] = ++stateSeq;
+  websocketSend(statePatch);
+  statePatch.clear();
+
+  // The cached state carries the sequence number
+  invalidateClientState();
 }
 
 bool updateClients() {
-  // Send the current values of everything to the clients when one connects
-  if (clientNeedsUpdate){
-    // Debug 
-    Serial.println("[updateClients] - Sending updated values to clients");
+  // Send the current values of everything to the clients that just connected
+  if (clientsNeedUpdate) {
+    for (uint8_t num = 0; num < WEBSOCKET_CLIENTS_MAX; num++) {
+      if (!(clientsNeedUpdate & (1 << num))) continue;
 
-    // Get and Send
-    sendConfigViaWS();
+      // Debug
+      Serial.println("[updateClients] - Sending current values to client number " + String(num));
+
+      // Get and Send, the controls need to be built before the values arrive
+      sendParametersViaWS(num);
+      sendConfigViaWS(num);
+    }
 
-    // Reset the Boolean
-    clientNeedsUpdate = false;
+    // Reset the clients
+    clientsNeedUpdate = 0;
 
     // Set the connecting boolean 
     webSocketConnecting = false;
@@ -1,94 +1,217 @@
 // Wifi Methods
-void wifiInit() {
-  // Make sure the wifi does not autoconnect but always reconnects
-  WiFi.setAutoConnect(false);
-  WiFi.setAutoReconnect(true);
-  
-  // Set callbacks for connection and disconnection of wifi
-  stationConnectedHandler = WiFi.onStationModeGotIP(onWifiConnected);
-  stationDisconnectedHandler = WiFi.onStationModeDisconnected(onWifiDisconnected);
-}
+// Radio access for the connection state machine in WifiConnection.h
+class EspWifiDriver : public WifiDriver {
+public:
+  virtual bool isConnected() {
+    return WiFi.isConnected();
+  }
 
-void handleWifiConnection() {
-  if (!WiFi.isConnected() && !wifiStarting && SSID != "") {
-    // Set the Host name to the device name
-    String hostName = Name != "" ? Name : DEFAULT_NAME;
-    hostName.replace(" ", "-");
-    
-    // Disconnect the WS if connected
-    webSocket.disconnect();
-
-    // Disconnect the wifi - for stability
-    WiFi.disconnect();
-    WiFi.softAPdisconnect(false);
+  virtual bool connectFailed() {
+    wl_status_t status = WiFi.status();
+    return status == WL_NO_SSID_AVAIL || status == WL_CONNECT_FAILED || status == WL_WRONG_PASSWORD;
+  }
 
-    // Start in softAP and Station Mode
-    WiFi.mode(WIFI_AP_STA);
+  virtual bool hasCache() {
+    return wifiCacheValid(wifiCache);
+  }
 
-    // Setup the softap
-    WiFi.softAPConfig(accessPointIP, accessPointIP, IPAddress(255, 255, 255, 0));
-    WiFi.softAP(hostName);
-    
-    // Setup the station
-    WiFi.hostname(hostName);
+  virtual void dropCache() {
+    // Forget the copies in RTC memory and flash as well, or the next start tries the same access point again
+    memset(&wifiCache, 0, sizeof(wifiCache));
+    ESP.rtcUserMemoryWrite(WIFI_CACHE_RTC_OFFSET, (uint32_t*)&wifiCache, sizeof(wifiCache));
+    fileSystem.remove("/Wifi.bin");
+  }
+
+  virtual void connectFast() {
+    // Station only unless the soft AP is still serving clients
+    if (!softApStarted) WiFi.mode(WIFI_STA);
+    else WiFi.enableSTA(true);
+    WiFi.hostname(wifiHostName());
+#ifdef STATIC_IP
+    WiFi.config(IPAddress(STATIC_IP), IPAddress(STATIC_GATEWAY), IPAddress(STATIC_SUBNET), IPAddress(STATIC_DNS));
+#else
+    WiFi.config(IPAddress(wifiCache.ip), IPAddress(wifiCache.gateway), IPAddress(wifiCache.subnet), IPAddress(wifiCache.dns));
+#endif
+    WiFi.begin(SSID.c_str(), (Password != "") ? Password.c_str() : nullptr, wifiCache.channel, wifiCache.bssid);
+
+    // Debug
+    Serial.println("[connectFast] - Attempting fast connection to \"" + SSID + "\" on channel " + String(wifiCache.channel));
+  }
+
+  virtual void connect() {
+    // Drop the cached lease as it might be the reason the fast connection failed
+    WiFi.enableSTA(true);
+    WiFi.hostname(wifiHostName());
+#ifdef STATIC_IP
+    WiFi.config(IPAddress(STATIC_IP), IPAddress(STATIC_GATEWAY), IPAddress(STATIC_SUBNET), IPAddress(STATIC_DNS));
+#else
+    WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+#endif
     (Password != "") ? WiFi.begin(SSID, Password) : WiFi.begin(SSID);
-    
-    // Set the starting boolean 
-    wifiStarting = true;
 
-    // Set up captive DNS
-    captivePortalDNS.start(53, "*", accessPointIP);
-    captivePortalDNS.setErrorReplyCode(DNSReplyCode::NoError);
+    // Debug
+    Serial.println("[connect] - Attempting connection to \"" + SSID + "\"");
+  }
 
-    // Debug 
-    Serial.println("[handleWifiConnection] - Attempting connection to \"" + SSID + "\"");
+  virtual void abort() {
+    // Only the station is disconnected, the soft AP and its clients stay up
+    WiFi.disconnect();
+    Serial.println("[abort] - Stopped the connection attempt to \"" + SSID + "\"");
   }
-  else if (!softApStarted && SSID == "") {
-    // Set the Host name to the device name
-    String hostName = Name != "" ? Name : DEFAULT_NAME;
-    hostName.replace(" ", "-");
 
-    // Debug 
-    Serial.println("[handleWifiConnection] - No SSID given starting the software AP");
+  virtual void startAccessPoint() {
+    // Debug
+    Serial.println("[startAccessPoint] - Starting the software AP");
 
-    // Disconnect the WS if connected
-    webSocket.disconnect();
-    
-    // Start the wifi in soft AP mode only 
-    WiFi.mode(WIFI_AP);
+    // Add the soft AP next to the station
+    WiFi.enableAP(true);
     WiFi.softAPConfig(accessPointIP, accessPointIP, IPAddress(255, 255, 255, 0));
-    WiFi.softAP(hostName);
+    WiFi.softAP(wifiHostName());
     softApStarted = true;
 
     // Set up captive DNS
     captivePortalDNS.start(53, "*", accessPointIP);
     captivePortalDNS.setErrorReplyCode(DNSReplyCode::NoError);
   }
+
+  virtual void stopAccessPoint() {
+    // Stop the capative DNS and the softAP
+    captivePortalDNS.stop();
+    WiFi.softAPdisconnect(true);
+    softApStarted = false;
+  }
+
+  virtual uint8_t accessPointClients() {
+    return WiFi.softAPgetStationNum();
+  }
+
+  virtual uint32_t random(uint32_t max) {
+    return ESP.random() % max;
+  }
+
+  virtual void connected() {
+    // Debug
+    Serial.println();
+    Serial.println("[connected] - Connected to \"" + SSID + "\" as \"" + Name + "\" with an ip of " + WiFi.localIP().toString());
+    Serial.println("[connected] - Webserver avaialble at http://" + WiFi.localIP().toString() + "/");
+    Serial.println("[connected] - Connecting took " + String(wifiConnection.lastConnectTime) + "ms" + String(wifiConnection.lastConnectWasFast ? " using the cache" : ""));
+
+    // Remember the access point for next time
+    wifiCacheSave();
+
+#ifndef STATIC_IP
+    // The cached lease was only set as a static address, the router does not know it is still in use. Renew it in
+    // the background, handleWifiConnection() stores the lease once DHCP handed it out.
+    if (wifiConnection.lastConnectWasFast) wifiRenewLease();
+#endif
+
+    // Start mDNS here
+    mdnsInit();
+  }
+
+  virtual void lost() {
+    // Debug
+    Serial.println("[lost] - Disconnected from \"" + SSID + "\"");
+  }
+};
+EspWifiDriver espWifiDriver;
+
+void wifiInit() {
+  // The state machine handles reconnecting, stop the SDK from doing the same in the background
+  WiFi.persistent(false);
+  WiFi.setAutoConnect(false);
+  WiFi.setAutoReconnect(false);
+
+  // Get the last good connection for a fast reconnect, and keep it up to date with every lease DHCP hands out
+  wifiCacheLoad();
+  wifiGotIpHandler = WiFi.onStationModeGotIP([](const WiFiEventStationModeGotIP&) {
+    wifiLeaseUpdated = true;
+  });
+
+  // Start the connection state machine
+  wifiConnection.begin(&espWifiDriver);
+}
+
+void handleWifiConnection() {
+  wifiConnection.setStation(SSID != "", wifiCredentialsGeneration);
+  wifiConnection.update(millis());
+
+  // The event comes from the SDK, the flash is written from here
+  if (wifiLeaseUpdated) {
+    wifiLeaseUpdated = false;
+    if (WiFi.isConnected()) wifiCacheSave();
+  }
 }
 
-void onWifiConnected(const WiFiEventStationModeGotIP &event) {
-  // Debug
-  Serial.println();
-  Serial.println("[onWifiConnected] - Connected to \"" + SSID + "\" as \"" + Name + "\" with an ip of " + WiFi.localIP().toString());
-  Serial.println("[onWifiConnected] - Webserver avaialble at http://" + WiFi.localIP().toString() + "/");
+// Ask DHCP for a lease while the cached address stays in use. Switching the station to DHCP with WiFi.config()
+// drops the address until the router answers, lwIP only replaces it once a lease was acknowledged, which is
+// reported by onStationModeGotIP.
+void wifiRenewLease() {
+  for (struct netif* station = netif_list; station; station = station->next) {
+    if (station->num != STATION_IF) continue;
+    if (dhcp_start(station) != ERR_OK) Serial.println("[wifiRenewLease] - Could not start DHCP, keeping the cached address");
+    return;
+  }
+}
 
-  // unset the boolean 
-  wifiStarting = false;
-  softApStarted = false;
+// Host name of the device, used for the soft AP and DHCP
+String wifiHostName() {
+  String hostName = Name != "" ? Name : DEFAULT_NAME;
+  hostName.replace(" ", "-");
+  return hostName;
+}
 
-  // Stop the capative DNS 
-  captivePortalDNS.stop();
+bool wifiCacheValid(const WifiCache& cache) {
+  return cache.magic == WIFI_CACHE_MAGIC
+    && cache.ssidCrc == snapshotCrc32(0, (const uint8_t*)SSID.c_str(), SSID.length())
+    && cache.crc == snapshotCrc32(0, (const uint8_t*)&cache, offsetof(WifiCache, crc));
+}
 
-  // Start mDNS here
-  mdnsInit();
+// Read the cache from RTC memory, which survives a reset, or from flash after a power cycle
+void wifiCacheLoad() {
+  ESP.rtcUserMemoryRead(WIFI_CACHE_RTC_OFFSET, (uint32_t*)&wifiCache, sizeof(wifiCache));
+  if (wifiCacheValid(wifiCache)) return;
 
-  // Stop the softAP
-  WiFi.softAPdisconnect(true);
+  // An empty file was left by a replacement that did not finish, it fails the checks like a missing one
+  memset(&wifiCache, 0, sizeof(wifiCache));
+  recoverFile(fileSystem, "/Wifi.bin", "/Wifi.tmp");
+  File cacheFile = fileSystem.open("/Wifi.bin", "r");
+  if (cacheFile) {
+    cacheFile.read((uint8_t*)&wifiCache, sizeof(wifiCache));
+    cacheFile.close();
+  }
 }
-void onWifiDisconnected(const WiFiEventStationModeDisconnected &event) {
-  // Debug
-  Serial.println("[onWifiConnected] - Disconnected from \"" + SSID + "\"");
-  
-  // unset the boolean 
-  wifiStarting = false;
+
+// Store the current connection, flash is only written when the access point or lease changed
+void wifiCacheSave() {
+  WifiCache updatedCache;
+  memset(&updatedCache, 0, sizeof(updatedCache));
+  updatedCache.magic    = WIFI_CACHE_MAGIC;
+  updatedCache.ssidCrc  = snapshotCrc32(0, (const uint8_t*)SSID.c_str(), SSID.length());
+  memcpy(updatedCache.bssid, WiFi.BSSID(), sizeof(updatedCache.bssid));
+  updatedCache.channel  = WiFi.channel();
+  updatedCache.ip       = WiFi.localIP();
+  updatedCache.gateway  = WiFi.gatewayIP();
+  updatedCache.subnet   = WiFi.subnetMask();
+  updatedCache.dns      = WiFi.dnsIP();
+  updatedCache.crc      = snapshotCrc32(0, (const uint8_t*)&updatedCache, offsetof(WifiCache, crc));
+
+  ESP.rtcUserMemoryWrite(WIFI_CACHE_RTC_OFFSET, (uint32_t*)&updatedCache, sizeof(updatedCache));
+
+  WifiCache storedCache;
+  memset(&storedCache, 0, sizeof(storedCache));
+  File cacheFile = fileSystem.open("/Wifi.bin", "r");
+  if (cacheFile) {
+    cacheFile.read((uint8_t*)&storedCache, sizeof(storedCache));
+    cacheFile.close();
+  }
+  if (memcmp(&storedCache, &updatedCache, sizeof(updatedCache)) != 0) {
+    // Replace the file, see FileReplace.h. The old cache is kept if this fails.
+    bool written = replaceFile(fileSystem, "/Wifi.bin", "/Wifi.tmp", sizeof(updatedCache), [&](File& file) {
+      return file.write((const uint8_t*)&updatedCache, sizeof(updatedCache));
+    });
+    if (!written) Serial.println("[wifiCacheSave] - Failed to write the wifi cache");
+  }
+
+  wifiCache = updatedCache;
 }
@@ -0,0 +1,197 @@
+/* WifiConnection
+ *
+ * Connection state machine for the station interface. All access to the
+ * radio goes through WifiDriver, so the machine can be driven by a fake
+ * driver and a fake clock on any machine.
+ *
+ * The machine is polled from the main loop and never blocks:
+ *   - a cached access point is tried first, if that fails the cache is
+ *     dropped and a full connection is started straight away
+ *   - failed full connections are retried with exponential backoff and
+ *     jitter, so a flaky access point does not starve the rest of the loop
+ *   - the soft AP and captive portal are started once and kept up across
+ *     retries, they are only stopped after connecting and once no client is
+ *     left on the soft AP
+ *   - new credentials stop the current attempt or connection and start
+ *     over straight away, without the backoff of the old ones
+*/
+
+#ifndef WifiConnection_h
+#define WifiConnection_h
+
+#include <stdint.h>
+
+class WifiDriver {
+public:
+  virtual bool isConnected() = 0;
+  virtual bool connectFailed() = 0;           // the current attempt failed for good, e.g. wrong password
+  virtual bool hasCache() = 0;                // a cached access point can be tried
+  virtual void dropCache() = 0;
+  virtual void connectFast() = 0;             // connect to the cached access point
+  virtual void connect() = 0;                 // scan for the access point and use DHCP
+  virtual void abort() = 0;                   // stop the current attempt, must leave the soft AP alone
+  virtual void startAccessPoint() = 0;        // soft AP and captive portal
+  virtual void stopAccessPoint() = 0;
+  virtual uint8_t accessPointClients() = 0;
+  virtual uint32_t random(uint32_t max) = 0;  // random number from 0 to max - 1
+
+  // Notifications
+  virtual void connected() {}
+  virtual void lost() {}
+};
+
+enum WifiState : uint8_t {
+  WIFI_STATE_OFF = 0,
+  WIFI_STATE_ACCESS_POINT,  // no SSID set, only the soft AP is running
+  WIFI_STATE_FAST_CONNECT,  // connecting to the cached access point
+  WIFI_STATE_CONNECTING,    // full connection attempt
+  WIFI_STATE_BACKOFF,       // waiting before the next attempt
+  WIFI_STATE_CONNECTED
+};
+
+class WifiConnection {
+public:
+  // Timings in milliseconds
+  uint32_t  fastConnectTimeout  = 3000;
+  uint32_t  connectTimeout      = 20000;
+  uint32_t  backoffMin          = 1000;
+  uint32_t  backoffMax          = 120000;
+
+  // Telemetry
+  uint32_t  lastConnectTime     = 0;      // time from losing the connection to being connected again
+  bool      lastConnectWasFast  = false;
+  uint32_t  failures            = 0;      // failed attempts since boot
+
+  void begin(WifiDriver* wifiDriver) {
+    driver = wifiDriver;
+    state = WIFI_STATE_OFF;
+  }
+
+  /// Enable or disable the station, i.e. whether an SSID is set. The generation of the credentials changes
+  /// whenever the SSID or password do, the machine then starts over with them.
+  void setStation(bool enabled, uint32_t credentials = 0) {
+    if (enabled == stationEnabled && credentials == credentialsGeneration) return;
+    stationEnabled = enabled;
+    credentialsGeneration = credentials;
+    if (state != WIFI_STATE_OFF && state != WIFI_STATE_ACCESS_POINT) driver->abort();
+    attempt = 0;
+    attemptStart = 0;
+    backoffDelay = 0;
+    state = WIFI_STATE_OFF;
+  }
+
+  /// Advance the machine, call from every loop
+  void update(uint32_t now) {
+    if (!driver) return;
+
+    switch (state) {
+      case WIFI_STATE_OFF : {
+        if (stationEnabled) startAttempt(now);
+        else {
+          startAccessPoint();
+          enter(WIFI_STATE_ACCESS_POINT, now);
+        }
+      }
+      break;
+      case WIFI_STATE_ACCESS_POINT : {
+        if (stationEnabled) startAttempt(now);
+      }
+      break;
+      case WIFI_STATE_FAST_CONNECT :
+      case WIFI_STATE_CONNECTING : {
+        uint32_t timeout = (state == WIFI_STATE_FAST_CONNECT) ? fastConnectTimeout : connectTimeout;
+        if (driver->isConnected()) onConnected(now);
+        else if (driver->connectFailed() || (uint32_t)(now - stateTime) >= timeout) onFailed(now);
+      }
+      break;
+      case WIFI_STATE_BACKOFF : {
+        if ((uint32_t)(now - stateTime) >= backoffDelay) startAttempt(now);
+      }
+      break;
+      case WIFI_STATE_CONNECTED : {
+        if (!driver->isConnected()) {
+          driver->lost();
+          attempt = 0;
+          attemptStart = 0;
+          startAttempt(now);
+        }
+        else if (accessPoint && driver->accessPointClients() == 0) {
+          // Only drop the soft AP once nobody is using it anymore
+          driver->stopAccessPoint();
+          accessPoint = false;
+        }
+      }
+      break;
+    }
+  }
+
+  WifiState getState() const { return state; }
+  bool accessPointActive() const { return accessPoint; }
+  uint32_t nextRetryDelay() const { return backoffDelay; }
+
+private:
+  WifiDriver* driver          = nullptr;
+  WifiState   state           = WIFI_STATE_OFF;
+  bool        stationEnabled  = false;
+  uint32_t    credentialsGeneration = 0;
+  bool        accessPoint     = false;
+  uint8_t     attempt         = 0;        // failed full attempts since the last connection
+  uint32_t    stateTime       = 0;
+  uint32_t    attemptStart    = 0;
+  uint32_t    backoffDelay    = 0;
+
+  void enter(WifiState newState, uint32_t now) {
+    state = newState;
+    stateTime = now;
+  }
+
+  void startAccessPoint() {
+    if (accessPoint) return;
+    driver->startAccessPoint();
+    accessPoint = true;
+  }
+
+  void startAttempt(uint32_t now) {
+    if (!attemptStart) attemptStart = now ? now : 1;
+    if (driver->hasCache()) {
+      driver->connectFast();
+      enter(WIFI_STATE_FAST_CONNECT, now);
+    }
+    else {
+      startAccessPoint();
+      driver->connect();
+      enter(WIFI_STATE_CONNECTING, now);
+    }
+  }
+
+  void onConnected(uint32_t now) {
+    lastConnectTime = now - attemptStart;
+    lastConnectWasFast = (state == WIFI_STATE_FAST_CONNECT);
+    attempt = 0;
+    attemptStart = 0;
+    enter(WIFI_STATE_CONNECTED, now);
+    driver->connected();
+  }
+
+  void onFailed(uint32_t now) {
+    driver->abort();
+    failures++;
+
+    // A stale cache is not worth waiting for, go straight to a full attempt
+    if (state == WIFI_STATE_FAST_CONNECT) {
+      driver->dropCache();
+      startAttempt(now);
+      return;
+    }
+
+    // Exponential backoff with equal jitter
+    uint32_t delay = backoffMin;
+    for (uint8_t i = 0; i < attempt && delay < backoffMax; i++) delay *= 2;
+    if (delay > backoffMax) delay = backoffMax;
+    backoffDelay = delay / 2 + driver->random(delay / 2 + 1);
+    if (attempt < 255) attempt++;
+    enter(WIFI_STATE_BACKOFF, now);
+  }
+};
+
+#endif
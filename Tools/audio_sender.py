@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Stream audio to the visualiser of a lamp as PCM blocks or spectra, from a WAV file or a synthetic beat"""
+
+import argparse
+import cmath
+import math
+import random
+import socket
+import struct
+import time
+import wave
+
+AUDIO_STREAM_PORT = 6769
+AUDIO_STREAM_VERSION = 1
+AUDIO_PCM = 1
+AUDIO_SPECTRUM = 2
+BLOCK_SIZE = 64
+
+
+def audio_packet(kind, sequence, values, sample_rate):
+    """Packet of the given type, see AudioStream.h"""
+    return (b"LA" + struct.pack("<BBBBH", AUDIO_STREAM_VERSION, kind, sequence, len(values), sample_rate) +
+            struct.pack("<%dh" % len(values), *values))
+
+
+def synthetic_samples(rate, bpm):
+    """A kick drum on every beat over a slowly sweeping tone"""
+    beat = 60.0 / bpm
+    index = 0
+    while True:
+        t = index / rate
+        since_beat = t % beat
+        kick = math.sin(2 * math.pi * 55 * since_beat) * math.exp(-since_beat * 12)
+        tone = 0.3 * math.sin(2 * math.pi * (400 + 300 * math.sin(t / 4)) * t)
+        yield int(max(-1.0, min(1.0, kick + tone)) * 20000)
+        index += 1
+
+
+def wav_samples(path, rate):
+    """Samples of a 16 bit WAV file mixed to mono and picked at the given rate"""
+    with wave.open(path, "rb") as wav:
+        if wav.getsampwidth() != 2:
+            raise SystemExit("Only 16 bit WAV files are supported")
+        channels = wav.getnchannels()
+        step = wav.getframerate() / rate
+        frames = wav.readframes(wav.getnframes())
+    samples = struct.unpack("<%dh" % (len(frames) // 2), frames)
+    position = 0.0
+    while int(position) * channels < len(samples):
+        frame = int(position) * channels
+        yield sum(samples[frame:frame + channels]) // channels
+        position += step
+
+
+def spectrum(block):
+    """Magnitudes of the bins of a Hamming windowed block, on the scale of the FFT of the ADC on the lamp"""
+    size = len(block)
+    windowed = [(value / 64.0) * (0.54 - 0.46 * math.cos(2 * math.pi * i / (size - 1))) for i, value in enumerate(block)]
+    bins = []
+    for k in range(size // 2):
+        total = sum(value * cmath.exp(-2j * math.pi * k * i / size) for i, value in enumerate(windowed))
+        bins.append(min(32767, int(abs(total))))
+    return bins
+
+
+def main():
+    """Stream for the given time and print what was sent"""
+    args = _get_arguments()
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_BROADCAST, 1)
+    samples = wav_samples(args.wav, args.rate) if args.wav else synthetic_samples(args.rate, args.bpm)
+
+    period = BLOCK_SIZE / args.rate
+    start = time.perf_counter()
+    next_block = start
+    blocks = 0
+    sent = 0
+    sequence = 0
+    while time.perf_counter() - start < args.seconds:
+        block = [value for _, value in zip(range(BLOCK_SIZE), samples)]
+        if len(block) < BLOCK_SIZE:
+            break
+        sequence = sequence % 255 + 1
+        if args.spectrum:
+            packet = audio_packet(AUDIO_SPECTRUM, sequence, spectrum(block), 0)
+        else:
+            packet = audio_packet(AUDIO_PCM, sequence, block, args.rate)
+        if random.random() >= args.loss:
+            sock.sendto(packet, (args.address, AUDIO_STREAM_PORT))
+            sent += 1
+        blocks += 1
+        next_block += period
+        delay = next_block - time.perf_counter() + random.uniform(0, args.jitter / 1000)
+        if delay > 0:
+            time.sleep(delay)
+    elapsed = time.perf_counter() - start
+    print("Sent %d of %d blocks over %.2fs, %.1f blocks/s" % (sent, blocks, elapsed, sent / elapsed))
+
+
+def _get_arguments():
+    parser = argparse.ArgumentParser(description="Stream audio to the visualiser of a lamp")
+    parser.add_argument("address", type=str, help="Network address of lamp, or a broadcast address")
+    parser.add_argument("--wav", type=str, help="16 bit WAV file to stream, a synthetic beat if not given")
+    parser.add_argument("--bpm", type=float, default=120, help="Tempo of the synthetic beat")
+    parser.add_argument("--rate", type=int, default=4000, help="Sample rate, 1000000 / the Period of the visualiser")
+    parser.add_argument("--spectrum", action="store_true", help="Send spectra worked out here instead of PCM")
+    parser.add_argument("--seconds", type=float, default=30, help="Time to stream for")
+    parser.add_argument("--jitter", type=float, default=0, help="Random delay added to each block in ms")
+    parser.add_argument("--loss", type=float, default=0, help="Chance that a block is not sent")
+    return parser.parse_args()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""Send tempo messages to a lamp on every beat, optionally with a tempo ramp, jitter and loss to test the beat clock"""
+
+import argparse
+import random
+import socket
+import struct
+import time
+
+BEAT_PORT = 6768
+BEAT_PROTOCOL_VERSION = 1
+
+
+def beat_message(beat, beats_per_bar, bpm):
+    """Tempo message sent on the given beat of the bar, see BeatClock.h"""
+    return b"LB" + struct.pack("<BBBBI", BEAT_PROTOCOL_VERSION, beat, beats_per_bar, 0, int(round(bpm * 1000)))
+
+
+def main():
+    """Send for the given time and print the tempo of every bar"""
+    args = _get_arguments()
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_BROADCAST, 1)
+
+    ramp_to = args.ramp_to if args.ramp_to else args.bpm
+    start = time.perf_counter()
+    next_beat = start
+    beats = 0
+    sent = 0
+    while next_beat - start < args.seconds:
+        bpm = args.bpm + (ramp_to - args.bpm) * (next_beat - start) / args.seconds
+        beat = beats % args.beats_per_bar
+
+        # Hold the message back by a random delay, the lamp should not follow it
+        delay = next_beat - time.perf_counter() + random.uniform(0, args.jitter / 1000)
+        if delay > 0:
+            time.sleep(delay)
+        if random.random() >= args.loss:
+            sock.sendto(beat_message(beat, args.beats_per_bar, bpm), (args.address, BEAT_PORT))
+            sent += 1
+        if beat == 0:
+            print("Bar %d at %.1f BPM" % (beats // args.beats_per_bar + 1, bpm))
+
+        beats += 1
+        next_beat += 60.0 / bpm
+    if args.stop:
+        sock.sendto(beat_message(0, args.beats_per_bar, 0), (args.address, BEAT_PORT))
+    print("Sent %d of %d beats over %.2fs" % (sent, beats, time.perf_counter() - start))
+
+
+def _get_arguments():
+    parser = argparse.ArgumentParser(description="Send tempo messages to a lamp")
+    parser.add_argument("address", type=str, help="Network address of lamp, or a broadcast address")
+    parser.add_argument("--bpm", type=float, default=120, help="Tempo to start with")
+    parser.add_argument("--ramp-to", type=float, default=0, help="Tempo to end with, changing smoothly from --bpm")
+    parser.add_argument("--beats-per-bar", type=int, default=4, help="Beats per bar")
+    parser.add_argument("--seconds", type=float, default=30, help="Time to send for")
+    parser.add_argument("--jitter", type=float, default=0, help="Random delay added to each message in ms")
+    parser.add_argument("--loss", type=float, default=0, help="Chance that a message is not sent")
+    parser.add_argument("--stop", action="store_true", help="Stop the beat clock of the lamp at the end")
+    return parser.parse_args()
+
+
+if __name__ == "__main__":
+    main()
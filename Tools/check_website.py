@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Check how a lamp serves its website: gzip, ETag and Cache-Control headers, 304 answers and whole files
+
+Every file is fetched several times. Its body has to gunzip and hash to its ETag, which catches files that are cut
+short or garbled while they are read from the flash. Asking again with the ETag has to give a 304 without a body.
+The ETags are also compared with the ones of Web_Page.ino in this tree, to tell whether the lamp runs this website.
+"""
+
+import argparse
+import gzip
+import hashlib
+import http.client
+import re
+import sys
+from pathlib import Path
+
+# Cache-Control of the page and of the assets, WEBSITE_PAGE_CACHE and WEBSITE_ASSET_CACHE of the sketch
+PAGE_CACHE = "no-cache"
+ASSET_CACHE = "public, max-age=31536000, immutable"
+
+# Path of the asset in the page, its content type and the name of its array in Web_Page.ino
+ASSETS = [("lamp.css", "text/css", "websiteStyle"), ("lamp.js", "application/javascript", "websiteScript")]
+
+
+def content_hash(data):
+    """Short hash of the data, as made by Website/update_website.py"""
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+def tree_etags():
+    """ETags of the website in Web_Page.ino by the name of their array, empty if it is not found"""
+    source = Path(__file__).resolve().parent.parent / "Super_Simple_RGB_WiFi_Lamp" / "Web_Page.ino"
+    if not source.exists():
+        return {}
+    found = re.findall(r"const char (\w+)Etag\[\] = \"\\\"(\w+)\\\"\";", source.read_text())
+    return {name: '"%s"' % etag for name, etag in found}
+
+
+class Checker:
+    """Fetches the files and counts the checks that failed"""
+
+    def __init__(self, address, port, timeout):
+        self.address = address
+        self.port = port
+        self.timeout = timeout
+        self.failures = 0
+
+    def check(self, condition, path, message):
+        if not condition:
+            self.failures += 1
+            print("FAIL %s: %s" % (path, message))
+        return condition
+
+    def get(self, path, headers=None):
+        """One request on its own connection, returns the status, the headers and the body"""
+        connection = http.client.HTTPConnection(self.address, self.port, timeout=self.timeout)
+        try:
+            connection.request("GET", path, headers=dict(headers or {}, **{"Accept-Encoding": "gzip"}))
+            response = connection.getresponse()
+            return response.status, response.headers, response.read()
+        finally:
+            connection.close()
+
+    def check_file(self, path, content_type, cache_control, expected_etag, repeat):
+        """Fetch the file, check its headers and that it is whole, then check the 304. Returns the gunzipped file."""
+        text = None
+        size = 0
+        etags = set()
+        for _ in range(repeat):
+            status, headers, body = self.get(path)
+            if not self.check(status == 200, path, "status %d instead of 200" % status):
+                return None
+            etag = headers.get("ETag", "")
+            etags.add(etag)
+            size = len(body)
+            self.check(headers.get("Content-Encoding") == "gzip", path,
+                       "Content-Encoding is %r" % headers.get("Content-Encoding"))
+            self.check((headers.get("Content-Type") or "").startswith(content_type), path,
+                       "Content-Type is %r" % headers.get("Content-Type"))
+            self.check(headers.get("Cache-Control") == cache_control, path,
+                       "Cache-Control is %r" % headers.get("Cache-Control"))
+            self.check(headers.get("Content-Length") == str(len(body)), path,
+                       "Content-Length is %r for %d bytes" % (headers.get("Content-Length"), len(body)))
+            if not self.check(etag == '"%s"' % content_hash(body), path,
+                              "ETag %r does not match the %d bytes received" % (etag, len(body))):
+                continue
+            try:
+                text = gzip.decompress(body)
+            except (OSError, EOFError) as error:
+                self.check(False, path, "does not gunzip: %s" % error)
+        self.check(len(etags) == 1, path, "ETag changed between requests: %s" % ", ".join(sorted(etags)))
+        if text is None:
+            return None
+        etag = etags.pop()
+        if expected_etag and etag != expected_etag:
+            print("NOTE %s: ETag %s differs from %s of Web_Page.ino, the lamp runs another website" %
+                  (path, etag, expected_etag))
+
+        # The browser has it already, and a browser that has another version
+        status, headers, body = self.get(path, {"If-None-Match": etag})
+        self.check(status == 304, path, "status %d instead of 304 for If-None-Match" % status)
+        self.check(not body, path, "304 has a body of %d bytes" % len(body))
+        self.check(headers.get("ETag") == etag, path, "304 has the ETag %r" % headers.get("ETag"))
+        self.check(headers.get("Cache-Control") == cache_control, path,
+                   "304 has Cache-Control %r" % headers.get("Cache-Control"))
+        status, _, _ = self.get(path, {"If-None-Match": '"0000000000000000"'})
+        self.check(status == 200, path, "status %d instead of 200 for another ETag" % status)
+
+        print("OK   %s: %d bytes gzipped to %d, ETag %s" % (path, len(text), size, etag))
+        return text
+
+
+def main():
+    """Check the page and the assets it links, exits with 1 if any check failed"""
+    args = _get_arguments()
+    checker = Checker(args.address, args.port, args.timeout)
+    expected = tree_etags()
+
+    page = checker.check_file("/", "text/html", PAGE_CACHE, expected.get("websitePage"), args.repeat)
+    if page is None:
+        sys.exit(1)
+    page = page.decode("utf-8", "replace")
+    for file_name, content_type, array_name in ASSETS:
+        link = re.search(r"(?:href|src)=\"/?(%s\?v=(\w+))\"" % re.escape(file_name), page)
+        if not checker.check(link, file_name, "the page does not link it with the hash of its content"):
+            continue
+        text = checker.check_file("/" + link.group(1), content_type, ASSET_CACHE, expected.get(array_name), args.repeat)
+        if text is not None:
+            checker.check(content_hash(text) == link.group(2), file_name,
+                          "the page links version %s, but the lamp serves %s" % (link.group(2), content_hash(text)))
+
+    print("%d check(s) failed" % checker.failures)
+    sys.exit(1 if checker.failures else 0)
+
+
+def _get_arguments():
+    parser = argparse.ArgumentParser(description="Check the website headers and files served by a lamp")
+    parser.add_argument("address", type=str, help="Network address of lamp")
+    parser.add_argument("--port", type=int, default=80, help="Port of the web server")
+    parser.add_argument("--repeat", type=int, default=5, help="Times every file is fetched")
+    parser.add_argument("--timeout", type=float, default=10, help="Seconds to wait for an answer")
+    return parser.parse_args()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""Binary realtime protocol of the lamp and a minimal websocket implementation, standard library only
+
+The layout of the messages is described in Super_Simple_RGB_WiFi_Lamp/RealtimeProtocol.h.
+"""
+
+import base64
+import hashlib
+import os
+import socket
+import struct
+
+VERSION = 1
+
+PIXELS_RGBW = 0x01
+PIXELS_RGB = 0x02
+SET_PARAMETER = 0x10
+SET_LAMP = 0x11
+PING = 0x20
+PONG = 0x21
+PREVIEW = 0x30
+ERROR = 0x7F
+
+FLAG_SHOW = 0x01
+
+LAMP_STATE = 0x01
+LAMP_BRIGHTNESS = 0x02
+
+ERROR_VERSION = 1
+ERROR_OPCODE = 2
+ERROR_LENGTH = 3
+ERROR_PARAMETER = 4
+
+NUM_LEDS = 109
+
+
+def pixels_message(pixels, start=0, show=True, white=True):
+    """Pixels are (r, g, b, w) tuples, w is dropped without white"""
+    opcode = PIXELS_RGBW if white else PIXELS_RGB
+    data = bytearray(struct.pack("<BBBH", VERSION, opcode, FLAG_SHOW if show else 0, start))
+    for pixel in pixels:
+        data.extend(pixel if white else pixel[:3])
+    return bytes(data)
+
+
+def set_parameter_message(mode, index, value):
+    name = mode.encode()
+    return struct.pack("<BBB", VERSION, SET_PARAMETER, len(name)) + name + struct.pack("<Bi", index, value)
+
+
+def set_lamp_message(state=None, brightness=None):
+    mask = (LAMP_STATE if state is not None else 0) | (LAMP_BRIGHTNESS if brightness is not None else 0)
+    return struct.pack("<BBBBB", VERSION, SET_LAMP, mask, 1 if state else 0, brightness or 0)
+
+
+def ping_message(payload=b""):
+    return struct.pack("<BB", VERSION, PING) + payload
+
+
+def header(message):
+    """Version and opcode of a message, None if it is too short"""
+    if len(message) < 2:
+        return None
+    return message[0], message[1]
+
+
+class WebSocket:
+    """One end of a websocket connection, only binary and text frames without extensions"""
+
+    def __init__(self, sock, is_client):
+        self.sock = sock
+        self.is_client = is_client
+        self.buffer = b""
+
+    @classmethod
+    def connect(cls, host, port, path="/"):
+        sock = socket.create_connection((host, port))
+        sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        key = base64.b64encode(os.urandom(16)).decode()
+        request = ("GET %s HTTP/1.1\r\nHost: %s:%d\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                   "Sec-WebSocket-Key: %s\r\nSec-WebSocket-Version: 13\r\n\r\n" % (path, host, port, key))
+        sock.sendall(request.encode())
+        connection = cls(sock, True)
+        response = connection._read_http_header()
+        if " 101 " not in response.split("\r\n")[0]:
+            raise ConnectionError("Handshake failed: %r" % response.split("\r\n")[0])
+        return connection
+
+    @classmethod
+    def accept(cls, sock):
+        sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        connection = cls(sock, False)
+        request = connection._read_http_header()
+        key = ""
+        for line in request.split("\r\n")[1:]:
+            name, _, value = line.partition(":")
+            if name.strip().lower() == "sec-websocket-key":
+                key = value.strip()
+        accept = base64.b64encode(hashlib.sha1((key + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11").encode()).digest())
+        sock.sendall(b"HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                     b"Sec-WebSocket-Accept: " + accept + b"\r\n\r\n")
+        return connection
+
+    def send_binary(self, payload):
+        self._send_frame(0x2, payload)
+
+    def send_text(self, text):
+        self._send_frame(0x1, text.encode())
+
+    def receive(self):
+        """Next text or binary message as (opcode, payload), None once the connection is closed"""
+        while True:
+            head = self._read(2)
+            if head is None:
+                return None
+            opcode = head[0] & 0x0F
+            length = head[1] & 0x7F
+            if length == 126:
+                length = struct.unpack(">H", self._read(2))[0]
+            elif length == 127:
+                length = struct.unpack(">Q", self._read(8))[0]
+            mask = self._read(4) if head[1] & 0x80 else None
+            payload = self._read(length) if length else b""
+            if payload is None:
+                return None
+            if mask:
+                payload = bytes(b ^ mask[i % 4] for i, b in enumerate(payload))
+            if opcode == 0x8:
+                return None
+            if opcode == 0x9:
+                self._send_frame(0xA, payload)
+            elif opcode in (0x1, 0x2):
+                return opcode, payload
+
+    def close(self):
+        try:
+            self._send_frame(0x8, b"")
+        except OSError:
+            pass
+        self.sock.close()
+
+    def _send_frame(self, opcode, payload):
+        length = len(payload)
+        if length < 126:
+            head = struct.pack(">BB", 0x80 | opcode, length)
+        elif length < 65536:
+            head = struct.pack(">BBH", 0x80 | opcode, 126, length)
+        else:
+            head = struct.pack(">BBQ", 0x80 | opcode, 127, length)
+        if self.is_client:
+            # Clients have to mask their frames, a zero mask leaves the payload as it is
+            head = bytes([head[0], head[1] | 0x80]) + head[2:] + b"\x00\x00\x00\x00"
+        self.sock.sendall(head + payload)
+
+    def _read(self, count):
+        while len(self.buffer) < count:
+            data = self.sock.recv(65536)
+            if not data:
+                return None
+            self.buffer += data
+        data, self.buffer = self.buffer[:count], self.buffer[count:]
+        return data
+
+    def _read_http_header(self):
+        while b"\r\n\r\n" not in self.buffer:
+            data = self.sock.recv(4096)
+            if not data:
+                raise ConnectionError("Connection closed during the handshake")
+            self.buffer += data
+        text, _, self.buffer = self.buffer.partition(b"\r\n\r\n")
+        return text.decode(errors="replace")
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Loopback lamp for the realtime protocol, answers like the firmware does so clients can be tested without a lamp"""
+
+import argparse
+import socket
+import struct
+import threading
+import time
+
+import lamp_protocol as lp
+
+
+class SimulatedLamp:
+    """Handles the binary messages the same way Realtime.ino does"""
+
+    def __init__(self, num_leds):
+        self.num_leds = num_leds
+        self.pending = [(0, 0, 0, 0)] * num_leds
+        self.frame = list(self.pending)
+        self.state = True
+        self.brightness = 255
+        self.parameters = {}
+        self.lock = threading.Lock()
+        self.stats = {"messages": 0, "frames": 0, "errors": 0, "bytes": 0}
+
+    def handle(self, message):
+        """Returns the reply to the message, None if there is none"""
+        with self.lock:
+            self.stats["messages"] += 1
+            self.stats["bytes"] += len(message)
+            head = lp.header(message)
+            if head is None:
+                return self._error(lp.ERROR_LENGTH, 0)
+            version, opcode = head
+            if version != lp.VERSION:
+                return self._error(lp.ERROR_VERSION, opcode)
+            payload = message[2:]
+            if opcode in (lp.PIXELS_RGBW, lp.PIXELS_RGB):
+                return self._pixels(opcode, payload)
+            if opcode == lp.SET_PARAMETER:
+                return self._set_parameter(opcode, payload)
+            if opcode == lp.SET_LAMP:
+                if len(payload) < 3:
+                    return self._error(lp.ERROR_LENGTH, opcode)
+                if payload[0] & lp.LAMP_STATE:
+                    self.state = payload[1] != 0
+                if payload[0] & lp.LAMP_BRIGHTNESS:
+                    self.brightness = payload[2]
+                return None
+            if opcode == lp.PING:
+                return struct.pack("<BB", lp.VERSION, lp.PONG) + payload
+            return self._error(lp.ERROR_OPCODE, opcode)
+
+    def _pixels(self, opcode, payload):
+        if len(payload) < 3:
+            return self._error(lp.ERROR_LENGTH, opcode)
+        flags, start = struct.unpack_from("<BH", payload)
+        size = 4 if opcode == lp.PIXELS_RGBW else 3
+        count = (len(payload) - 3) // size
+        if start + count > self.num_leds:
+            return self._error(lp.ERROR_LENGTH, opcode)
+        for i in range(count):
+            pixel = payload[3 + i * size:3 + (i + 1) * size]
+            self.pending[start + i] = tuple(pixel) if size == 4 else tuple(pixel) + (0,)
+        if flags & lp.FLAG_SHOW:
+            self.frame = list(self.pending)
+            self.stats["frames"] += 1
+        return None
+
+    def _set_parameter(self, opcode, payload):
+        if len(payload) < 1 or len(payload) < 1 + payload[0] + 5:
+            return self._error(lp.ERROR_LENGTH, opcode)
+        name = payload[1:1 + payload[0]].decode(errors="replace")
+        index, value = struct.unpack_from("<Bi", payload, 1 + payload[0])
+        self.parameters[(name, index)] = value
+        return None
+
+    def _error(self, error, opcode):
+        self.stats["errors"] += 1
+        return struct.pack("<BBBB", lp.VERSION, lp.ERROR, error, opcode)
+
+
+def serve_client(connection, lamp, address):
+    print("Client %s:%d connected" % address)
+    try:
+        while True:
+            message = connection.receive()
+            if message is None:
+                break
+            opcode, payload = message
+            if opcode != 0x2:
+                continue
+            reply = lamp.handle(payload)
+            if reply is not None:
+                connection.send_binary(reply)
+    except (ConnectionError, OSError):
+        pass
+    connection.close()
+    print("Client %s:%d disconnected" % address)
+
+
+def report(lamp, period):
+    last = dict(lamp.stats)
+    while True:
+        time.sleep(period)
+        with lamp.lock:
+            current = dict(lamp.stats)
+        if current["messages"] != last["messages"]:
+            print("%6.1f messages/s %6.1f frames/s %8.1f KB/s, %d errors" % (
+                (current["messages"] - last["messages"]) / period, (current["frames"] - last["frames"]) / period,
+                (current["bytes"] - last["bytes"]) / period / 1024, current["errors"]))
+        last = current
+
+
+def main():
+    """Accept clients until interrupted"""
+    args = _get_arguments()
+    lamp = SimulatedLamp(args.leds)
+
+    server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    server.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    server.bind((args.address, args.port))
+    server.listen(5)
+    print("Simulated lamp with %d LEDs on ws://%s:%d/" % (args.leds, args.address, args.port))
+
+    threading.Thread(target=report, args=(lamp, 1.0), daemon=True).start()
+    try:
+        while True:
+            sock, address = server.accept()
+            try:
+                connection = lp.WebSocket.accept(sock)
+            except ConnectionError:
+                sock.close()
+                continue
+            threading.Thread(target=serve_client, args=(connection, lamp, address), daemon=True).start()
+    except KeyboardInterrupt:
+        pass
+    server.close()
+
+
+def _get_arguments():
+    parser = argparse.ArgumentParser(description="Loopback lamp for the realtime protocol")
+    parser.add_argument("--address", type=str, default="127.0.0.1", help="Address to listen on")
+    parser.add_argument("--port", type=int, default=8081, help="Port to listen on")
+    parser.add_argument("--leds", type=int, default=lp.NUM_LEDS, help="Number of LEDs of the simulated lamp")
+    return parser.parse_args()
+
+
+if __name__ == "__main__":
+    main()
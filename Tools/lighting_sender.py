@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""Stream E1.31, Art-Net or DDP frames to a lamp, optionally with jitter, reordering and loss to test the receivers"""
+
+import argparse
+import colorsys
+import random
+import socket
+import struct
+import time
+
+import lamp_protocol as lp
+
+E131_PORT = 5568
+ARTNET_PORT = 6454
+DDP_PORT = 4048
+UNIVERSE_SIZE = 512
+SOURCE_ID = bytes(range(16))
+
+
+def e131_data(universe, sequence, channels, sync_universe=0):
+    """E1.31 data packet, ANSI E1.31-2018 section 4.1"""
+    dmp = struct.pack(">HBBHHHB", 0x7000 | (11 + len(channels)), 0x02, 0xA1, 0, 1, len(channels) + 1, 0) + channels
+    framing = struct.pack(">HI64sBHBBH", 0x7000 | (77 + len(dmp)), 0x00000002, b"Lamp sender", 100,
+                          sync_universe, sequence, 0, universe) + dmp
+    return (struct.pack(">HH12sHI16s", 0x0010, 0, b"ASC-E1.17\x00\x00\x00", 0x7000 | (22 + len(framing)),
+                        0x00000004, SOURCE_ID) + framing)
+
+
+def e131_sync(sequence, sync_universe):
+    """E1.31 universe synchronization packet, section 4.2"""
+    framing = struct.pack(">HIBHH", 0x7000 | 11, 0x00000001, sequence, sync_universe, 0)
+    return struct.pack(">HH12sHI16s", 0x0010, 0, b"ASC-E1.17\x00\x00\x00", 0x7000 | (22 + len(framing)),
+                       0x00000008, SOURCE_ID) + framing
+
+
+def artnet_dmx(universe, sequence, channels):
+    if len(channels) % 2:
+        channels += b"\x00"
+    return (b"Art-Net\x00" + struct.pack("<H", 0x5000) + struct.pack(">BBBBBBH", 0, 14, sequence, 0,
+                                                                       universe & 0xFF, universe >> 8 & 0x7F,
+                                                                       len(channels)) + channels)
+
+
+def artnet_sync():
+    return b"Art-Net\x00" + struct.pack("<H", 0x5200) + struct.pack(">BBBB", 0, 14, 0, 0)
+
+
+def ddp_data(offset, sequence, channels, push, channels_per_pixel):
+    data_type = 0x1B if channels_per_pixel == 4 else 0x0B
+    flags = 0x40 | (0x01 if push else 0)
+    return struct.pack(">BBBBIH", flags, sequence & 0x0F, data_type, 1, offset, len(channels)) + channels
+
+
+def rainbow_channels(num_leds, step, channels_per_pixel):
+    data = bytearray()
+    for led in range(num_leds):
+        r, g, b = colorsys.hsv_to_rgb(((led + step) % num_leds) / num_leds, 1.0, 1.0)
+        data.extend((int(r * 255), int(g * 255), int(b * 255), 0)[:channels_per_pixel])
+    return bytes(data)
+
+
+def universe_channels(args, data):
+    """Split the pixel channels over the universes the way the lamp maps them, a pixel never spans two universes"""
+    universes = []
+    position = 0
+    first_channel = args.start_channel - 1
+    while position < len(data):
+        per_universe = (UNIVERSE_SIZE - first_channel) // args.channels * args.channels
+        universes.append(bytes(first_channel) + data[position:position + per_universe])
+        position += per_universe
+        first_channel = 0
+    return universes
+
+
+class Sender:
+    def __init__(self, args):
+        self.args = args
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_BROADCAST, 1)
+        self.sequences = {}
+        self.held = []
+        self.packets = 0
+
+    def next_sequence(self, key, bits=8):
+        sequence = self.sequences.get(key, 0) % ((1 << bits) - 1) + 1
+        self.sequences[key] = sequence
+        return sequence
+
+    def frame_packets(self, step):
+        args = self.args
+        data = rainbow_channels(args.leds, step, args.channels)
+        packets = []
+        if args.protocol == "ddp":
+            size = 1440 // args.channels * args.channels
+            for offset in range(0, len(data), size):
+                push = offset + size >= len(data)
+                packets.append((ddp_data(offset, self.next_sequence("ddp", 4), data[offset:offset + size], push,
+                                         args.channels), DDP_PORT))
+            return packets
+        for index, channels in enumerate(universe_channels(args, data)):
+            universe = args.universe + index
+            if args.protocol == "e131":
+                sync = args.universe if args.sync else 0
+                packets.append((e131_data(universe, self.next_sequence(universe), channels, sync), E131_PORT))
+            else:
+                packets.append((artnet_dmx(universe, self.next_sequence(universe), channels), ARTNET_PORT))
+        if args.sync and args.protocol == "e131":
+            packets.append((e131_sync(self.next_sequence("sync"), args.universe), E131_PORT))
+        elif args.sync:
+            packets.append((artnet_sync(), ARTNET_PORT))
+        return packets
+
+    def send(self, packets):
+        args = self.args
+        for packet in packets:
+            if random.random() < args.loss:
+                continue
+            # Hold a packet back and send it after the next one
+            if random.random() < args.reorder and not self.held:
+                self.held.append(packet)
+                continue
+            self.sock.sendto(packet[0], (args.address, packet[1]))
+            self.packets += 1
+            while self.held:
+                held = self.held.pop()
+                self.sock.sendto(held[0], (args.address, held[1]))
+                self.packets += 1
+
+
+def main():
+    """Stream for the given time and print what was sent"""
+    args = _get_arguments()
+    sender = Sender(args)
+    period = 1.0 / args.fps
+    start = time.perf_counter()
+    next_frame = start
+    frames = 0
+    while time.perf_counter() - start < args.seconds:
+        sender.send(sender.frame_packets(frames))
+        frames += 1
+        next_frame += period
+        delay = next_frame - time.perf_counter() + random.uniform(0, args.jitter / 1000)
+        if delay > 0:
+            time.sleep(delay)
+    elapsed = time.perf_counter() - start
+    print("Sent %d frames in %d packets over %.2fs, %.1f frames/s %.1f packets/s" % (
+        frames, sender.packets, elapsed, frames / elapsed, sender.packets / elapsed))
+
+
+def _get_arguments():
+    parser = argparse.ArgumentParser(description="Stream E1.31, Art-Net or DDP frames to a lamp")
+    parser.add_argument("address", type=str, help="Network address of lamp, or a broadcast or multicast address")
+    parser.add_argument("--protocol", choices=("e131", "artnet", "ddp"), default="e131", help="Protocol to send")
+    parser.add_argument("--fps", type=float, default=40, help="Frames per second")
+    parser.add_argument("--seconds", type=float, default=10, help="Time to stream for")
+    parser.add_argument("--leds", type=int, default=lp.NUM_LEDS, help="Number of LEDs of the lamp")
+    parser.add_argument("--universe", type=int, default=1, help="Universe of the first pixel")
+    parser.add_argument("--start-channel", type=int, default=1, help="Channel of the first pixel in its universe")
+    parser.add_argument("--channels", type=int, choices=(3, 4), default=3, help="Channels per pixel")
+    parser.add_argument("--sync", action="store_true", help="Show the frames with E1.31 sync or ArtSync packets")
+    parser.add_argument("--jitter", type=float, default=0, help="Random delay added to each frame in ms")
+    parser.add_argument("--reorder", type=float, default=0, help="Chance that a packet is sent after the next one")
+    parser.add_argument("--loss", type=float, default=0, help="Chance that a packet is not sent")
+    return parser.parse_args()
+
+
+if __name__ == "__main__":
+    main()
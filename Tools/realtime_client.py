@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""Push realtime frames to a lamp (or the simulator) and measure throughput and round trip latency"""
+
+import argparse
+import colorsys
+import struct
+import threading
+import time
+
+import lamp_protocol as lp
+
+
+class Receiver(threading.Thread):
+    """Collects the pongs and errors sent back by the lamp, text messages are ignored"""
+
+    def __init__(self, connection):
+        super().__init__(daemon=True)
+        self.connection = connection
+        self.round_trips = []
+        self.errors = []
+
+    def run(self):
+        while True:
+            message = self.connection.receive()
+            if message is None:
+                return
+            opcode, payload = message
+            head = lp.header(payload) if opcode == 0x2 else None
+            if head is None:
+                continue
+            if head[1] == lp.PONG and len(payload) >= 10:
+                sent = struct.unpack_from("<Q", payload, 2)[0]
+                self.round_trips.append((time.perf_counter_ns() - sent) / 1e6)
+            elif head[1] == lp.ERROR and len(payload) >= 4:
+                self.errors.append((payload[2], payload[3]))
+
+
+def rainbow_frame(num_leds, step):
+    frame = []
+    for led in range(num_leds):
+        r, g, b = colorsys.hsv_to_rgb(((led + step) % num_leds) / num_leds, 1.0, 1.0)
+        frame.append((int(r * 255), int(g * 255), int(b * 255), 0))
+    return frame
+
+
+def frame_messages(frame, parts, white):
+    """Split the frame into messages, only the last one shows it"""
+    size = (len(frame) + parts - 1) // parts
+    messages = []
+    for start in range(0, len(frame), size):
+        show = start + size >= len(frame)
+        messages.append(lp.pixels_message(frame[start:start + size], start, show, white))
+    return messages
+
+
+def percentile(values, fraction):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+
+def main():
+    """Stream frames for the given time and print the results"""
+    args = _get_arguments()
+    connection = lp.WebSocket.connect(args.address, args.port, "/ws")
+    receiver = Receiver(connection)
+    receiver.start()
+
+    # Prepare the frames up front, so only sending is measured
+    frames = [frame_messages(rainbow_frame(args.leds, step), args.parts, not args.rgb) for step in range(args.leds)]
+
+    period = 1.0 / args.fps if args.fps > 0 else 0
+    sent_frames = 0
+    sent_bytes = 0
+    start = time.perf_counter()
+    next_frame = start
+    while time.perf_counter() - start < args.seconds:
+        for message in frames[sent_frames % len(frames)]:
+            connection.send_binary(message)
+            sent_bytes += len(message)
+        sent_frames += 1
+        if sent_frames % args.ping_every == 0:
+            connection.send_binary(lp.ping_message(struct.pack("<Q", time.perf_counter_ns())))
+        if period:
+            next_frame += period
+            delay = next_frame - time.perf_counter()
+            if delay > 0:
+                time.sleep(delay)
+    elapsed = time.perf_counter() - start
+
+    # Wait for the last pong, so every frame was handled by the lamp
+    expected = sent_frames // args.ping_every + 1
+    connection.send_binary(lp.ping_message(struct.pack("<Q", time.perf_counter_ns())))
+    deadline = time.perf_counter() + 2
+    while len(receiver.round_trips) < expected and time.perf_counter() < deadline:
+        time.sleep(0.01)
+    drained = time.perf_counter() - start
+    connection.close()
+
+    print("Frames:     %d in %.2fs, %.1f frames/s sent, %.1f frames/s handled" % (
+        sent_frames, elapsed, sent_frames / elapsed, sent_frames / drained))
+    print("Throughput: %.1f KB/s, %d bytes per frame in %d message(s)" % (
+        sent_bytes / elapsed / 1024, sent_bytes // max(sent_frames, 1), args.parts))
+    if receiver.round_trips:
+        print("Round trip: min %.2fms, median %.2fms, p99 %.2fms, max %.2fms over %d pings" % (
+            min(receiver.round_trips), percentile(receiver.round_trips, 0.5),
+            percentile(receiver.round_trips, 0.99), max(receiver.round_trips), len(receiver.round_trips)))
+    else:
+        print("Round trip: no pongs received")
+    if receiver.errors:
+        print("Errors:     %d, first was error %d for opcode 0x%02x" % (len(receiver.errors), *receiver.errors[0]))
+
+
+def _get_arguments():
+    parser = argparse.ArgumentParser(description="Push realtime frames to a lamp and measure them")
+    parser.add_argument("address", type=str, help="Network address of lamp, 127.0.0.1 for the simulator")
+    parser.add_argument("--port", type=int, default=80, help="Websocket port, 8081 for the simulator")
+    parser.add_argument("--fps", type=float, default=60, help="Frames per second, 0 to send as fast as possible")
+    parser.add_argument("--seconds", type=float, default=10, help="Time to stream for")
+    parser.add_argument("--leds", type=int, default=lp.NUM_LEDS, help="Number of LEDs of the lamp")
+    parser.add_argument("--parts", type=int, default=1, help="Messages each frame is split into")
+    parser.add_argument("--rgb", action="store_true", help="Send RGB pixels instead of RGBW")
+    parser.add_argument("--ping-every", type=int, default=10, help="Frames between two latency pings")
+    return parser.parse_args()
+
+
+if __name__ == "__main__":
+    main()
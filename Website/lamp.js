@@ -0,0 +1,278 @@
+// The small part of jQuery, the Bootstrap tabs and collapse, and a colour picker that the website uses. It is
+// bundled with the page so the website also works on the soft AP without internet access.
+(function () {
+    function Query(nodes) {
+        this.nodes = nodes
+        this.length = nodes.length
+    }
+
+    // $(function) runs once the page is loaded, $("<div>") creates elements, $("#id") selects them
+    function $(target) {
+        if (target instanceof Query)
+            return target
+        if (typeof target === "function") {
+            if (document.readyState === "loading") document.addEventListener("DOMContentLoaded", target)
+            else target()
+            return new Query([])
+        }
+        if (typeof target === "string") {
+            if (target.trim().charAt(0) === "<") {
+                let template = document.createElement("template")
+                template.innerHTML = target.trim()
+                return new Query(Array.prototype.slice.call(template.content.childNodes))
+            }
+            return new Query(Array.prototype.slice.call(document.querySelectorAll(target)))
+        }
+        return new Query(target ? [target] : [])
+    }
+
+    // Calls fn(key, value) for the properties of an object or fn(index, value) for an array, false stops it
+    $.each = function (object, fn) {
+        if (Array.isArray(object)) {
+            for (let i = 0; i < object.length; i++)
+                if (fn.call(object[i], i, object[i]) === false) break
+        } else {
+            for (let key in object)
+                if (fn.call(object[key], key, object[key]) === false) break
+        }
+        return object
+    }
+
+    $.fn = Query.prototype
+
+    $.fn.each = function (fn) {
+        this.nodes.forEach(function (node, i) { fn.call(node, i, node) })
+        return this
+    }
+
+    $.fn.on = function (events, fn) {
+        return this.each(function () {
+            let node = this
+            events.split(" ").forEach(function (event) { node.addEventListener(event, fn) })
+        })
+    }
+
+    $.fn.click = function (fn) {
+        if (fn) return this.on("click", fn)
+        return this.each(function () { this.click() })
+    }
+
+    // The getters read the first element, the setters write all of them
+    function accessor(property) {
+        return function (value) {
+            if (value === undefined) return this.length ? this.nodes[0][property] : undefined
+            return this.each(function () { this[property] = value })
+        }
+    }
+    $.fn.val = accessor("value")
+    $.fn.html = accessor("innerHTML")
+    $.fn.text = accessor("textContent")
+
+    // Attributes of elements, properties of anything else e.g. the title of the document
+    $.fn.attr = function (name, value) {
+        if (typeof name === "object") {
+            for (let key in name) this.attr(key, name[key])
+            return this
+        }
+        if (value === undefined) return this.length && this.nodes[0].getAttribute ? this.nodes[0].getAttribute(name) : undefined
+        return this.each(function () {
+            if (this.setAttribute) this.setAttribute(name, value)
+            else this[name] = value
+        })
+    }
+
+    $.fn.css = function (styles) {
+        return this.each(function () { Object.assign(this.style, styles) })
+    }
+
+    $.fn.empty = function () {
+        return this.each(function () { this.textContent = "" })
+    }
+
+    $.fn.append = function (content) {
+        let nodes = $(content).nodes
+        return this.each(function (i) {
+            let parent = this
+            nodes.forEach(function (node) { parent.appendChild(i ? node.cloneNode(true) : node) })
+        })
+    }
+
+    // Bootstrap tabs, the link points to its pane with its href
+    $.fn.tab = function () {
+        return this.each(function () {
+            let link = this
+            let pane = document.querySelector(link.getAttribute("href"))
+            let nav = link.closest(".nav")
+            if (!pane || !nav) return
+
+            nav.querySelectorAll(".nav-link.active").forEach(function (other) { other.classList.remove("active") })
+            link.classList.add("active")
+            Array.prototype.forEach.call(pane.parentNode.children, function (other) {
+                if (other.classList.contains("tab-pane")) other.classList.remove("active", "show")
+            })
+            pane.classList.add("active")
+
+            // Let the pane be laid out before it fades in
+            if (pane.classList.contains("fade")) {
+                pane.offsetHeight
+                pane.classList.add("show")
+            }
+        })
+    }
+
+    // Bootstrap collapse, without the animation
+    $.fn.collapse = function (action) {
+        return this.each(function () {
+            if (action === "hide") this.classList.remove("show")
+            else if (action === "show") this.classList.add("show")
+            else this.classList.toggle("show")
+        })
+    }
+
+    // The data attributes of Bootstrap
+    document.addEventListener("click", function (event) {
+        let toggle = event.target.closest ? event.target.closest("[data-toggle]") : null
+        if (!toggle) return
+        if (toggle.getAttribute("data-toggle") === "tab") {
+            event.preventDefault()
+            $(toggle).tab("show")
+        } else if (toggle.getAttribute("data-toggle") === "collapse") {
+            $(toggle.getAttribute("data-target")).collapse("toggle")
+        }
+    })
+
+    // The colour the pickers share, like the colour of tinyColorPicker. Values are from 0 to 1.
+    function Colors() {
+        this.colors = { rgb: { r: 0, g: 0, b: 0 }, RGBLuminance: 0 }
+    }
+
+    Colors.prototype.setColor = function (value) {
+        let rgb = parseColor(value)
+        if (!rgb) return
+        let linear = function (c) { return c <= 0.03928 ? c / 12.92 : Math.pow((c + 0.055) / 1.055, 2.4) }
+        this.colors.rgb = rgb
+        this.colors.RGBLuminance = 0.2126 * linear(rgb.r) + 0.7152 * linear(rgb.g) + 0.0722 * linear(rgb.b)
+    }
+
+    // "rgb(255, 128, 0)" or "#ff8000"
+    function parseColor(value) {
+        let match = /^\s*rgb\(\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*\)\s*$/.exec(value || "")
+        if (match) return { r: Math.min(match[1], 255) / 255, g: Math.min(match[2], 255) / 255, b: Math.min(match[3], 255) / 255 }
+        match = /^\s*#([0-9a-f]{2})([0-9a-f]{2})([0-9a-f]{2})\s*$/i.exec(value || "")
+        if (match) return { r: parseInt(match[1], 16) / 255, g: parseInt(match[2], 16) / 255, b: parseInt(match[3], 16) / 255 }
+        return null
+    }
+
+    function rgbToHsv(rgb) {
+        let max = Math.max(rgb.r, rgb.g, rgb.b)
+        let range = max - Math.min(rgb.r, rgb.g, rgb.b)
+        let h = 0
+        if (range > 0) {
+            if (max === rgb.r) h = ((rgb.g - rgb.b) / range + 6) % 6
+            else if (max === rgb.g) h = (rgb.b - rgb.r) / range + 2
+            else h = (rgb.r - rgb.g) / range + 4
+        }
+        return { h: h / 6, s: max > 0 ? range / max : 0, v: max }
+    }
+
+    function hsvToRgb(hsv) {
+        let f = function (n) {
+            let k = (n + hsv.h * 6) % 6
+            return hsv.v - hsv.v * hsv.s * Math.max(0, Math.min(k, 4 - k, 1))
+        }
+        return { r: f(5), g: f(3), b: f(1) }
+    }
+
+    function rgbString(rgb) {
+        return "rgb(" + Math.round(rgb.r * 255) + ", " + Math.round(rgb.g * 255) + ", " + Math.round(rgb.b * 255) + ")"
+    }
+
+    // A popup with a saturation and brightness square and a hue bar opens below the element when it is clicked.
+    // options.renderCallback is called with this.color while a colour is picked.
+    let openPicker = null
+
+    $.fn.colorPicker = function (options) {
+        let color = $.fn.colorPicker.color
+        return this.each(function () {
+            let element = this
+            let hsv = { h: 0, s: 0, v: 0 }
+            let popup = document.createElement("div")
+            popup.className = "cp-popup"
+            popup.innerHTML = '<div class="cp-sv"><div class="cp-sv-cursor"></div></div><div class="cp-hue"><div class="cp-hue-cursor"></div></div>'
+            let square = popup.firstChild
+            let bar = popup.lastChild
+
+            function render() {
+                square.style.backgroundColor = rgbString(hsvToRgb({ h: hsv.h, s: 1, v: 1 }))
+                square.firstChild.style.left = hsv.s * 100 + "%"
+                square.firstChild.style.top = (1 - hsv.v) * 100 + "%"
+                bar.firstChild.style.top = hsv.h * 100 + "%"
+            }
+
+            function pick() {
+                color.setColor(rgbString(hsvToRgb(hsv)))
+                render()
+                if (options && options.renderCallback) options.renderCallback.call({ color: color }, $(element), false)
+            }
+
+            function drag(target, move) {
+                target.addEventListener("pointerdown", function (event) {
+                    target.setPointerCapture(event.pointerId)
+                    move(event)
+                    event.preventDefault()
+                })
+                target.addEventListener("pointermove", function (event) {
+                    if (target.hasPointerCapture(event.pointerId)) move(event)
+                })
+            }
+
+            function fraction(value) {
+                return Math.max(0, Math.min(1, value))
+            }
+
+            drag(square, function (event) {
+                let rect = square.getBoundingClientRect()
+                hsv.s = fraction((event.clientX - rect.left) / rect.width)
+                hsv.v = 1 - fraction((event.clientY - rect.top) / rect.height)
+                pick()
+            })
+            drag(bar, function (event) {
+                let rect = bar.getBoundingClientRect()
+                hsv.h = fraction((event.clientY - rect.top) / rect.height)
+                pick()
+            })
+
+            element.addEventListener("click", function (event) {
+                event.preventDefault()
+                if (openPicker === popup) {
+                    closePicker()
+                    return
+                }
+                closePicker()
+
+                // Start from the colour the element shows
+                let rgb = parseColor(element.value)
+                if (rgb) hsv = rgbToHsv(rgb)
+                render()
+
+                let rect = element.getBoundingClientRect()
+                popup.style.left = rect.left + window.pageXOffset + "px"
+                popup.style.top = rect.bottom + window.pageYOffset + 4 + "px"
+                document.body.appendChild(popup)
+                openPicker = popup
+            })
+        })
+    }
+    $.fn.colorPicker.color = new Colors()
+
+    function closePicker() {
+        if (openPicker) openPicker.remove()
+        openPicker = null
+    }
+
+    document.addEventListener("pointerdown", function (event) {
+        if (openPicker && !openPicker.contains(event.target) && !event.target.classList.contains("color")) closePicker()
+    })
+
+    window.$ = window.jQuery = $
+})()
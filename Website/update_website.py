@@ -1,24 +1,91 @@
 #!/usr/bin/env python3
-"""Small helper to create the Website.ino from Website/Website.html"""
+"""Small helper to create the Web_Page.ino from Website/Website.html and the lamp.css and lamp.js it uses
 
+The files are minified and gzipped, and stored as byte arrays together with an ETag made from their content. The
+lamp sends them as they are with "Content-Encoding: gzip". The page asks for lamp.css and lamp.js with the hash of
+their content in the URL, so browsers can keep them for a long time and still get the new ones after an update.
+"""
+
+import gzip
+import hashlib
+import re
 from pathlib import Path
 
+# Name of the asset in the page, and the name of its array in Web_Page.ino
+ASSETS = [("lamp.css", "websiteStyle"), ("lamp.js", "websiteScript")]
+
+
+def minify_lines(text, comment):
+    """Strip the indentation and blank lines, and lines that are only a comment starting with the given prefix"""
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line and not (comment and line.startswith(comment)))
+
+
+def minify_html(text):
+    """Strip the comments and indentation of the page, and the comment lines of its scripts"""
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    parts = re.split(r"(<script[^>]*>.*?</script>)", text, flags=re.S | re.I)
+    return "\n".join(minify_lines(part, "//" if index % 2 else None) for index, part in enumerate(parts)
+                     if part.strip())
+
+
+def minify_css(text):
+    """Strip the comments and the white space around the punctuation, quoted strings are left alone"""
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    parts = re.split(r"(\"[^\"]*\"|'[^']*')", text)
+    for index in range(0, len(parts), 2):
+        parts[index] = re.sub(r"\s*([{}:;,>])\s*", r"\1", re.sub(r"\s+", " ", parts[index]))
+    return "".join(parts).replace(";}", "}").strip()
+
+
+def minify_js(text):
+    """Strip the indentation, blank lines and comment lines. The line breaks stay, the scripts rely on them."""
+    return minify_lines(text, "//")
+
+
+def content_hash(data):
+    """Short hash of the data, used in the ETag and in the URL of the assets"""
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+def write_array(target, name, text):
+    """Write the gzipped text as a byte array and its ETag"""
+    data = gzip.compress(text.encode("utf-8"), compresslevel=9, mtime=0)
+    target.write("const char %sEtag[] = \"\\\"%s\\\"\";\n" % (name, content_hash(data)))
+    target.write("const uint8_t %s[] PROGMEM = {\n" % name)
+    for start in range(0, len(data), 16):
+        target.write("  %s,\n" % ", ".join("0x%02x" % byte for byte in data[start:start + 16]))
+    target.write("};\n\n")
+    return len(text), len(data)
+
+
 def main():
     """Main entry point to do the conversion"""
 
     git_base = Path(__file__).resolve().parent.parent
-    source_file = git_base / "Website" / "Website.html"
+    website_dir = git_base / "Website"
+    source_file = website_dir / "Website.html"
     target_file = git_base / "Super_Simple_RGB_WiFi_Lamp" / "Web_Page.ino"
 
-    with source_file.open(encoding="utf-8") as source:
-        with target_file.open("w", encoding="utf-8") as target:
-            target.write("// Created by Website/update_website.py\n"
-                         "const char websiteSource[] PROGMEM =\n")
+    page = minify_html(source_file.read_text(encoding="utf-8"))
+    assets = []
+    for file_name, array_name in ASSETS:
+        text = (website_dir / file_name).read_text(encoding="utf-8")
+        text = minify_css(text) if file_name.endswith(".css") else minify_js(text)
 
-            for line in source:
-                target.write("  \"%s\\n\"\n" % line.replace('"', '\\"').rstrip())
+        # Point the page at this version of the asset
+        version = content_hash(text.encode("utf-8"))
+        page, found = re.subn(r"(href|src)=\"%s\"" % re.escape(file_name), r'\1="%s?v=%s"' % (file_name, version), page)
+        if found != 1:
+            raise SystemExit("%s is not used by the page exactly once" % file_name)
+        assets.append((array_name, text))
 
-            target.write(";\n")
+    with target_file.open("w", encoding="utf-8") as target:
+        target.write("// Created by Website/update_website.py, do not edit\n"
+                     "// The website minified and gzipped, with the ETags of the files\n\n")
+        for array_name, text in [("websitePage", page)] + assets:
+            size, compressed = write_array(target, array_name, text)
+            print("%s: %d bytes, %d gzipped" % (array_name, size, compressed))
 
     print("File updated:", target_file)
     print("You may now recompile your application.")
@@ -6,6 +6,9 @@ import subprocess
 from pathlib import Path
 import requests
 
+# Libraries installed from the Library Manager of the Arduino IDE, the others are in External Libraries
+LIBRARY_MANAGER_LIBRARIES = ["ESP Async WebServer:1.2.3"]
+
 def main():
     """The magic goes here"""
     args = _get_arguments()
@@ -19,6 +22,12 @@ def main():
     if subprocess.Popen([git_base/"Website"/"update_website.py"]).wait() != 0:
         raise SystemExit("Website update failed")
 
+    print("+++ INSTALLING LIBRARIES ++++++++++++++++++++++++++")
+    # The web server is not in External Libraries, the Library Manager has the version that goes with ESPAsyncTCP
+    for library in LIBRARY_MANAGER_LIBRARIES:
+        if subprocess.Popen(["arduino", "--install-library", library]).wait():
+            raise SystemExit("Installing %s failed" % library)
+
     print("+++ COMPILING SKETCH ++++++++++++++++++++++++++++++")
     compile_cmd = [
         "arduino", "--pref", "build.path=%s" % build_base, "--verify", sketch_file
@@ -0,0 +1,47 @@
+/* Check
+ *
+ * Minimal checks for the host tests, every test is a program of its own
+ * that prints the failed checks and returns the number of them.
+*/
+
+#ifndef Check_h
+#define Check_h
+
+#include <stdio.h>
+
+static int checkFailures = 0;
+static int checkCount = 0;
+
+#define CHECK(condition) do { \
+    checkCount++; \
+    if (!(condition)) { \
+      checkFailures++; \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+    } \
+  } while (0)
+
+#define CHECK_EQUAL(actual, expected) do { \
+    checkCount++; \
+    long long checkActual = (long long)(actual), checkExpected = (long long)(expected); \
+    if (checkActual != checkExpected) { \
+      checkFailures++; \
+      printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, checkActual, checkExpected); \
+    } \
+  } while (0)
+
+#define CHECK_NEAR(actual, expected, tolerance) do { \
+    checkCount++; \
+    double checkActual = (actual), checkExpected = (expected); \
+    if (checkActual < checkExpected - (tolerance) || checkActual > checkExpected + (tolerance)) { \
+      checkFailures++; \
+      printf("%s:%d: %s is %g, expected %g +- %g\n", __FILE__, __LINE__, #actual, checkActual, checkExpected, (double)(tolerance)); \
+    } \
+  } while (0)
+
+// Print the result of the test, the return value is the exit code
+inline int checkSummary(const char* name) {
+  printf("%s: %d checks, %d failed\n", name, checkCount, checkFailures);
+  return checkFailures ? 1 : 0;
+}
+
+#endif
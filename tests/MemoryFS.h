@@ -0,0 +1,103 @@
+/* MemoryFS
+ *
+ * File system in RAM with the open(), exists(), remove() and rename() of
+ * the file systems of the Arduino core, for the host tests of the code that
+ * writes the flash.
+ *
+ * The power can be cut after a number of steps, every byte written and
+ * every open, remove and rename is one step. Nothing changes after the cut
+ * until power() is restored, which is what a reset leaves on the flash.
+ * Like SPIFFS, rename() does not replace an existing file.
+*/
+
+#ifndef MemoryFS_h
+#define MemoryFS_h
+
+#include <stdint.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class MemoryFS;
+
+class MemoryFile {
+public:
+  MemoryFile(MemoryFS* fileSystem = nullptr, const std::string& path = "") : fileSystem(fileSystem), path(path) {}
+
+  explicit operator bool() const { return fileSystem != nullptr; }
+
+  size_t write(const uint8_t* data, size_t length);
+  size_t read(uint8_t* data, size_t length);
+  void close() { fileSystem = nullptr; }
+
+private:
+  MemoryFS*   fileSystem;
+  std::string path;
+  size_t      position = 0;
+};
+
+class MemoryFS {
+public:
+  std::map<std::string, std::vector<uint8_t>> files;
+  long stepsLeft = -1;                // Steps until the power is cut, -1 never
+  long steps = 0;                     // Steps taken so far
+
+  // Take a step, false once the power is cut
+  bool step() {
+    if (stepsLeft == 0) return false;
+    if (stepsLeft > 0) stepsLeft--;
+    steps++;
+    return true;
+  }
+
+  // Restore the power, as after a reset
+  void power() { stepsLeft = -1; }
+
+  MemoryFile open(const char* path, const char* mode) {
+    if (!step()) return MemoryFile();
+    if (mode[0] == 'w') files[path].clear();
+    else if (!exists(path)) return MemoryFile();
+    return MemoryFile(this, path);
+  }
+
+  bool exists(const char* path) const { return files.count(path) != 0; }
+
+  bool remove(const char* path) {
+    if (!exists(path) || !step()) return false;
+    files.erase(path);
+    return true;
+  }
+
+  bool rename(const char* from, const char* to) {
+    if (!exists(from) || exists(to) || !step()) return false;
+    files[to].swap(files[from]);
+    files.erase(from);
+    return true;
+  }
+
+  std::string contents(const char* path) const {
+    auto file = files.find(path);
+    return file == files.end() ? "" : std::string(file->second.begin(), file->second.end());
+  }
+};
+
+inline size_t MemoryFile::write(const uint8_t* data, size_t length) {
+  if (!fileSystem) return 0;
+  std::vector<uint8_t>& file = fileSystem->files[path];
+  size_t written = 0;
+  while (written < length && fileSystem->step()) file.push_back(data[written++]);
+  return written;
+}
+
+inline size_t MemoryFile::read(uint8_t* data, size_t length) {
+  if (!fileSystem) return 0;
+  const std::vector<uint8_t>& file = fileSystem->files[path];
+  size_t count = position < file.size() ? file.size() - position : 0;
+  if (count > length) count = length;
+  if (count) memcpy(data, file.data() + position, count);
+  position += count;
+  return count;
+}
+
+#endif
@@ -0,0 +1,146 @@
+// Peak heap of serializing a state message of about 1.2 KB, the way Websockets.ino did before the frame buffer and
+// the way it does now. Before, the message went into a String, and the String of the ESP8266 core 2.6 reallocates
+// to the exact length on every append. Now it goes straight into the static frame buffer. The websocket library
+// copies the message into its queue once in both cases, that copy is not counted here.
+
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include <ArduinoJson.h>
+#include "Check.h"
+
+// Every allocation made through new is counted, with its size kept in front of the block
+static size_t heapInUse = 0, heapPeak = 0, heapAllocations = 0;
+
+void* operator new(size_t size) {
+  size_t* block = (size_t*)malloc(size + sizeof(size_t));
+  if (!block) throw std::bad_alloc();
+  *block = size;
+  heapInUse += size;
+  heapAllocations++;
+  if (heapInUse > heapPeak) heapPeak = heapInUse;
+  return block + 1;
+}
+
+void operator delete(void* pointer) noexcept {
+  if (!pointer) return;
+  size_t* block = (size_t*)pointer - 1;
+  heapInUse -= *block;
+  free(block);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+  operator delete(pointer);
+}
+
+// The sanitizers replace the array forms as well, so they have to be counted explicitly
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete[](void* pointer) noexcept {
+  operator delete(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+  operator delete(pointer);
+}
+
+// Start counting, returns the heap in use so far
+static size_t heapReset() {
+  heapPeak = heapInUse;
+  heapAllocations = 0;
+  return heapInUse;
+}
+
+// A String that grows like the one of the ESP8266 core 2.6, a new buffer of the exact length for every append
+class ExactString {
+public:
+  ~ExactString() { delete[] buffer; }
+
+  void append(const char* data, size_t count) {
+    char* grown = new char[length + count + 1];
+    if (buffer) memcpy(grown, buffer, length);
+    memcpy(grown + length, data, count);
+    grown[length + count] = 0;
+    delete[] buffer;
+    buffer = grown;
+    length += count;
+  }
+
+  size_t length = 0;
+  char* buffer = nullptr;
+};
+
+namespace ARDUINOJSON_NAMESPACE {
+template <> struct IsWriteableString<ExactString> : true_type {};
+template <> class DynamicStringWriter<ExactString> {
+public:
+  DynamicStringWriter(ExactString& string) : string(&string) {}
+  size_t write(uint8_t c) { string->append((const char*)&c, 1); return 1; }
+  size_t write(const uint8_t* data, size_t count) {
+    // Like the String writer of ArduinoJson, which appends a character at a time
+    for (size_t i = 0; i < count; i++) string->append((const char*)data + i, 1);
+    return count;
+  }
+private:
+  ExactString* string;
+};
+}
+
+#define WEBSOCKET_FRAME_SIZE 3072
+static char websocketFrame[WEBSOCKET_FRAME_SIZE];
+
+int main() {
+  // The state of the lamp as sent to a new client, with the settings of a dozen modes
+  DynamicJsonDocument state(4096);
+  state["Name"] = "Super Simple RGB Wifi Lamp";
+  state["Mode"] = "Rainbow";
+  state["State"] = true;
+  state["Fade Time"] = 600;
+  state["Brightness"] = 200;
+  const char* modeNames[] = { "Colour", "Rainbow", "Clock", "Bell Curve", "Night Rider", "Circle", "Sparkle",
+                              "Color Wipe", "Confetti", "Visualiser", "Realtime", "Beat" };
+  for (const char* modeName : modeNames) {
+    JsonObject mode = state.createNestedObject(modeName);
+    mode["Red"] = 255;
+    mode["Green"] = 120;
+    mode["Blue"] = 40;
+    mode["Speed"] = 30;
+    mode["Brightness"] = 180;
+  }
+  JsonArray presets = state.createNestedArray("Presets");
+  presets.add("Evening");
+  presets.add("Reading");
+  presets.add("Party");
+  state["Seq"] = 1234;
+  state["Full"] = true;
+  size_t messageLength = measureJson(state);
+  CHECK(messageLength > 1000);
+
+  // Into a String
+  size_t base = heapReset();
+  size_t stringLength;
+  {
+    ExactString message;
+    serializeJson(state, message);
+    stringLength = message.length;
+  }
+  size_t stringPeak = heapPeak - base, stringAllocations = heapAllocations;
+  CHECK_EQUAL(stringLength, messageLength);
+  CHECK(stringPeak >= 2 * messageLength);
+
+  // Into the frame buffer
+  base = heapReset();
+  size_t frameLength = serializeJson(state, websocketFrame, WEBSOCKET_FRAME_SIZE);
+  size_t framePeak = heapPeak - base, frameAllocations = heapAllocations;
+  CHECK_EQUAL(frameLength, messageLength);
+  CHECK_EQUAL(frameAllocations, 0);
+  CHECK_EQUAL(framePeak, 0);
+
+  printf("message of %zu bytes\n", messageLength);
+  printf("  String:       %zu bytes peak heap, %zu allocations\n", stringPeak, stringAllocations);
+  printf("  frame buffer: %zu bytes peak heap, %zu allocations\n", framePeak, frameAllocations);
+
+  return checkSummary("bench_frame_buffer");
+}
@@ -0,0 +1,124 @@
+// Audio packets through the parser, and blocks that arrive unevenly through the jitter buffer as Audio.ino and the
+// Visualiser mode use it: every block is shown in order or counted as dropped.
+
+#include <stdlib.h>
+#include <vector>
+#include "Check.h"
+#include "AudioStream.h"
+
+static std::vector<uint8_t> audioPacket(uint8_t type, uint8_t sequence, uint8_t count, uint16_t sampleRate, int16_t first) {
+  std::vector<uint8_t> packet = { 'L', 'A', AUDIO_STREAM_VERSION, type, sequence, count, (uint8_t)(sampleRate & 0xFF), (uint8_t)(sampleRate >> 8) };
+  for (uint8_t i = 0; i < count; i++) {
+    int16_t value = first + i;
+    packet.push_back(value & 0xFF);
+    packet.push_back((uint16_t)value >> 8);
+  }
+  return packet;
+}
+
+int main() {
+  AudioFrame frame;
+  uint8_t sequence = 0;
+
+  // A PCM block with negative samples, and a spectrum
+  std::vector<uint8_t> pcm = audioPacket(AUDIO_STREAM_PCM, 17, AUDIO_BLOCK_SIZE, 8000, -32);
+  CHECK(audioParsePacket(pcm.data(), pcm.size(), frame, sequence));
+  CHECK_EQUAL(frame.type, AUDIO_STREAM_PCM);
+  CHECK_EQUAL(sequence, 17);
+  CHECK_EQUAL(frame.sampleRate, 8000);
+  CHECK_EQUAL(frame.values[0], -32);
+  CHECK_EQUAL(frame.values[AUDIO_BLOCK_SIZE - 1], 31);
+
+  std::vector<uint8_t> spectrum = audioPacket(AUDIO_STREAM_SPECTRUM, 0, 16, 0, 3000);
+  CHECK(audioParsePacket(spectrum.data(), spectrum.size(), frame, sequence));
+  CHECK_EQUAL(frame.count, 16);
+  CHECK_EQUAL(frame.values[15], 3015);
+
+  // Wrong counts, types, versions and short packets
+  std::vector<uint8_t> shortPcm = audioPacket(AUDIO_STREAM_PCM, 0, AUDIO_BLOCK_SIZE - 1, 8000, 0);
+  CHECK(!audioParsePacket(shortPcm.data(), shortPcm.size(), frame, sequence));
+  std::vector<uint8_t> wideSpectrum = audioPacket(AUDIO_STREAM_SPECTRUM, 0, AUDIO_BLOCK_SIZE / 2 + 1, 0, 0);
+  CHECK(!audioParsePacket(wideSpectrum.data(), wideSpectrum.size(), frame, sequence));
+  std::vector<uint8_t> emptySpectrum = audioPacket(AUDIO_STREAM_SPECTRUM, 0, 0, 0, 0);
+  CHECK(!audioParsePacket(emptySpectrum.data(), emptySpectrum.size(), frame, sequence));
+  std::vector<uint8_t> unknown = audioPacket(3, 0, 4, 0, 0);
+  CHECK(!audioParsePacket(unknown.data(), unknown.size(), frame, sequence));
+  std::vector<uint8_t> version = pcm;
+  version[2]++;
+  CHECK(!audioParsePacket(version.data(), version.size(), frame, sequence));
+  bool truncated = true;
+  for (size_t length = 0; length < pcm.size(); length++) truncated &= !audioParsePacket(pcm.data(), length, frame, sequence);
+  CHECK(truncated);
+
+  // Random packets are never read past their end
+  srand(11);
+  for (int i = 0; i < 20000; i++) {
+    std::vector<uint8_t> noise(rand() % 200);
+    for (uint8_t& byte : noise) byte = rand();
+    if (noise.size() >= 4) {
+      noise[0] = 'L';
+      noise[1] = 'A';
+      noise[2] = AUDIO_STREAM_VERSION;
+      noise[3] = 1 + rand() % 2;
+    }
+    audioParsePacket(noise.data(), noise.size(), frame, sequence);
+  }
+
+  // A full queue drops its oldest block, a late pop takes the newest due block and skips the older ones
+  {
+    AudioFrameQueue queue;
+    for (int i = 0; i < AUDIO_QUEUE_FRAMES + 2; i++) {
+      frame.values[0] = i;
+      queue.push(frame, 100 + i);
+    }
+    CHECK_EQUAL(queue.dropped, 2);
+    CHECK(!queue.pop(110, 20, frame));
+    CHECK(queue.pop(123, 20, frame));
+    CHECK_EQUAL(frame.values[0], 3);
+    CHECK_EQUAL(queue.dropped, 3);
+    CHECK(queue.pop(200, 20, frame));
+    CHECK_EQUAL(frame.values[0], 5);
+    CHECK(!queue.pop(300, 20, frame));
+  }
+
+  // A block every 16 ms with up to 30 ms of jitter and a loop every 5 ms, across the wrap of millis(). A block
+  // overtaken by a later one is dropped by the sequence check of Audio.ino. With a 40 ms delay the rest are shown
+  // in order, each once or counted as dropped, and never more than 60 ms apart.
+  {
+    AudioFrameQueue queue;
+    uint32_t start = 0xFFFFFF00;
+    std::vector<uint32_t> arrival;
+    for (int block = 0; block < 500; block++) arrival.push_back(block * 16 + rand() % 30);
+
+    std::vector<int16_t> shown;
+    std::vector<uint32_t> showTimes;
+    int lastPushed = -1;
+    uint32_t pushed = 0;
+    for (uint32_t elapsed = 0; elapsed < 500 * 16 + 200; elapsed++) {
+      for (int block = 0; block < 500; block++) {
+        if (arrival[block] != elapsed || block <= lastPushed) continue;
+        frame.values[0] = block;
+        queue.push(frame, start + elapsed);
+        lastPushed = block;
+        pushed++;
+      }
+      if (elapsed % 5 == 0 && queue.pop(start + elapsed, 40, frame)) {
+        shown.push_back(frame.values[0]);
+        showTimes.push_back(start + elapsed);
+      }
+    }
+
+    bool ordered = true;
+    uint32_t longest = 0;
+    for (size_t i = 1; i < shown.size(); i++) {
+      ordered &= shown[i] > shown[i - 1];
+      if (showTimes[i] - showTimes[i - 1] > longest) longest = showTimes[i] - showTimes[i - 1];
+    }
+    CHECK(ordered);
+    CHECK(pushed > 400);
+    CHECK_EQUAL(shown.size() + queue.dropped, pushed);
+    CHECK(longest <= 60);
+  }
+
+  return checkSummary("test_audio_stream");
+}
@@ -0,0 +1,153 @@
+// Taps, tempo messages and audio onsets driving BeatClock the way Beat.ino does, including taps in the same
+// millisecond, messages held up on the way and the wrap of millis().
+
+#include <stdlib.h>
+#include "Check.h"
+#include "BeatClock.h"
+
+int main() {
+  // Tempo messages
+  const uint8_t packet[BEAT_MESSAGE_SIZE] = { 'L', 'B', BEAT_PROTOCOL_VERSION, 2, 3, 0, 0xC0, 0xD4, 0x01, 0x00 };
+  BeatMessage message;
+  CHECK(beatParseMessage(packet, sizeof(packet), message));
+  CHECK_EQUAL(message.beat, 2);
+  CHECK_EQUAL(message.beatsPerBar, 3);
+  CHECK_EQUAL(message.tempo, 120000);
+  CHECK(!beatParseMessage(packet, sizeof(packet) - 1, message));
+
+  CHECK_EQUAL(beatFloorDiv(-1, BEAT_ONE), -1);
+  CHECK_EQUAL(beatFloorDiv(-BEAT_ONE, BEAT_ONE), -1);
+  CHECK_EQUAL(beatFloorDiv(BEAT_ONE - 1, BEAT_ONE), 0);
+
+  // Taps at 120 BPM, the first is beat 0. A second tap in the same millisecond, or a bounce of the button, is
+  // ignored instead of dividing by zero.
+  {
+    BeatClock clock;
+    clock.tap(1000);
+    clock.tap(1000);
+    CHECK(!clock.running());
+    clock.tap(1050);
+    CHECK(!clock.running());
+    clock.tap(1500);
+    clock.tap(1500);
+    CHECK_EQUAL(clock.tempo(), 120000);
+    for (uint32_t time = 2000; time <= 5000; time += 500) clock.tap(time);
+    CHECK_EQUAL(clock.tempo(), 120000);
+    CHECK_EQUAL(clock.source(), BEAT_SOURCE_TAP);
+    CHECK_EQUAL(clock.position(5000), 8 * BEAT_ONE);
+    CHECK_EQUAL(clock.steps(5250, 4), 34);
+    CHECK_EQUAL(clock.phase(5000, 4), 0);
+    CHECK_EQUAL(clock.phase(5500, 4), 16384);
+
+    // After a pause a new series starts with a new downbeat
+    clock.tap(9000);
+    clock.tap(9400);
+    CHECK_EQUAL(clock.tempo(), 150000);
+    CHECK_EQUAL(clock.position(9400), BEAT_ONE);
+  }
+
+  // Taps all at the same time as the full window of taps, and at the clamp of the tempo
+  {
+    BeatClock clock;
+    for (int i = 0; i < 3 * BEAT_TAPS_MAX; i++) clock.tap(7777);
+    CHECK(!clock.running());
+    for (uint32_t i = 0; i < 2 * BEAT_TAPS_MAX; i++) clock.tap(1000 + i * BEAT_TAP_MIN);
+    CHECK_EQUAL(clock.tempo(), BEAT_TEMPO_MAX);
+  }
+
+  // Tempo messages on every beat at 120 BPM in 3/4, some held back by up to 40 ms. The clock follows the beat of
+  // the messages and is never pulled back by more than a fraction of the delay.
+  {
+    BeatClock clock;
+    bool onBeat = true;
+    srand(5);
+    for (int beat = 0; beat < 200; beat++) {
+      uint32_t sent = 0xFFFF0000 + beat * 500;
+      uint32_t delay = rand() % 4 ? 0 : rand() % 40;
+      BeatMessage tick = { (uint8_t)(beat % 3), 3, 120000 };
+      clock.message(tick, sent + delay);
+
+      // Half a beat later the clock should be halfway between beats
+      int64_t position = clock.position(sent + 250);
+      int64_t fraction = position - beatFloorDiv(position, BEAT_ONE) * BEAT_ONE;
+      if (beat > 4 && (fraction < BEAT_ONE / 2 - BEAT_ONE / 10 || fraction > BEAT_ONE / 2 + BEAT_ONE / 10)) onBeat = false;
+    }
+    CHECK(onBeat);
+    CHECK_EQUAL(clock.beatsPerBar, 3);
+    CHECK_EQUAL(clock.source(), BEAT_SOURCE_NETWORK);
+
+    // The downbeat is where the messages say, the last message was beat 199 % 3 = 1
+    uint32_t last = 0xFFFF0000 + 199 * 500;
+    CHECK_EQUAL(clock.phase(last + 1000, 3), 0);
+
+    // Taps do not take over from the network until it has been quiet
+    clock.tap(last + 100);
+    clock.tap(last + 400);
+    CHECK_EQUAL(clock.tempo(), 120000);
+    uint32_t quiet = last + BEAT_SOURCE_TIMEOUT + 1000;
+    clock.tap(quiet);
+    clock.tap(quiet + 400);
+    CHECK_EQUAL(clock.tempo(), 150000);
+    CHECK_EQUAL(clock.source(), BEAT_SOURCE_TAP);
+
+    // A message with tempo 0 stops the clock
+    BeatMessage stop = { 0, 4, 0 };
+    clock.message(stop, quiet + BEAT_SOURCE_TIMEOUT + 1000);
+    CHECK(!clock.running());
+    CHECK_EQUAL(clock.position(quiet + BEAT_SOURCE_TIMEOUT + 2000), 0);
+  }
+
+  // The downbeat button moves the bar by at most half of it
+  {
+    BeatClock clock;
+    clock.setTempo(120000, 0);
+    clock.downbeat(1700);
+    CHECK_EQUAL(clock.position(1700), 4 * BEAT_ONE);
+    clock.downbeat(2600);
+    CHECK_EQUAL(clock.position(2600), 4 * BEAT_ONE);
+  }
+
+  // Kicks at 128 BPM with a few missing and some extra hits, and at 64 BPM which is folded into 128 BPM
+  {
+    BeatClock clock;
+    uint32_t period = 60000 / 128;
+    for (int beat = 0; beat < 64; beat++) {
+      if (beat % 7 == 3) continue;
+      uint32_t time = 10000 + beat * 60000 / 128;
+      clock.onset(time);
+      if (beat % 5 == 0) clock.onset(time + period / 2 + 37);
+    }
+    CHECK_EQUAL(clock.source(), BEAT_SOURCE_AUDIO);
+    CHECK_NEAR(clock.tempo(), 128000, 1500);
+
+    BeatClock slow;
+    for (int beat = 0; beat < 32; beat++) slow.onset(10000 + beat * 60000 / 64);
+    CHECK_NEAR(slow.tempo(), 128000, 1500);
+  }
+
+  // The onset detector takes energy well above the average, still rising and not right after the last onset. The
+  // first pulse at time 0 counts as right after the last onset.
+  {
+    BeatOnsetDetector detector;
+    int onsets = 0;
+    for (uint32_t frame = 0; frame < 1000; frame++) {
+      uint32_t now = frame * 10;
+      float energy = frame % 47 == 0 ? 100.0f : frame % 47 == 1 ? 120.0f : 10.0f;
+      if (detector.update(energy, 20.0f, now)) onsets++;
+    }
+    CHECK_EQUAL(onsets, 1000 / 47);
+  }
+
+  // The position keeps counting across the wrap of millis() and a long run with update()
+  {
+    BeatClock clock;
+    clock.setTempo(60000, 0xFFFFF000);
+    CHECK_EQUAL(clock.position(0x1000), 8 * BEAT_ONE + 192 * BEAT_ONE / 1000);
+    for (uint32_t time = 0x1000; time < 0x1000 + 30 * 86400000UL; time += 60000) clock.update(time);
+    uint32_t end = 0x1000 + 30 * 86400000UL;
+    clock.update(end);
+    CHECK_EQUAL(clock.steps(end, 1), (int64_t)(end - 0xFFFFF000) / 1000);
+  }
+
+  return checkSummary("test_beat_clock");
+}
@@ -0,0 +1,191 @@
+// Round trips of the snapshot format through ConfigSnapshotWriter and ConfigSnapshotReader, the way Config.ino writes
+// and reads /Config.bin and Presets.ino the presets.
+
+#include <string>
+#include <vector>
+#include "Check.h"
+#include "ConfigSnapshot.h"
+
+static size_t writeBuffer(void* context, const uint8_t* data, size_t length) {
+  std::vector<uint8_t>* buffer = (std::vector<uint8_t>*)context;
+  buffer->insert(buffer->end(), data, data + length);
+  return length;
+}
+
+// Fails every write, like a full file system
+static size_t writeNothing(void*, const uint8_t*, size_t) {
+  return 0;
+}
+
+// A block of an older version, before a field was appended
+struct OldLamp {
+  uint8_t   state;
+  uint8_t   brightness;
+} __attribute__((packed));
+
+// The file the same way saveConfigSnapshot() writes it, header, payload and CRC
+static std::vector<uint8_t> writeFile(void (*writePayload)(ConfigSnapshotWriter&)) {
+  ConfigSnapshotWriter dryRun;
+  writePayload(dryRun);
+
+  std::vector<uint8_t> file;
+  ConfigSnapshotHeader header = { CONFIG_SNAPSHOT_MAGIC, CONFIG_SNAPSHOT_VERSION, dryRun.length };
+  writeBuffer(&file, (const uint8_t*)&header, sizeof(header));
+  ConfigSnapshotWriter writer(writeBuffer, &file);
+  writePayload(writer);
+  writeBuffer(&file, (const uint8_t*)&writer.crc, sizeof(writer.crc));
+  CHECK_EQUAL(writer.crc, dryRun.crc);
+  CHECK_EQUAL(writer.length, dryRun.length);
+  return file;
+}
+
+// The checks of readSnapshotFile(), returns false for a file that has to be ignored
+static bool checkFile(const std::vector<uint8_t>& file) {
+  ConfigSnapshotHeader header;
+  if (file.size() < sizeof(header)) return false;
+  memcpy(&header, file.data(), sizeof(header));
+  if (!snapshotHeaderValid(header, CONFIG_SNAPSHOT_MAGIC, file.size())) return false;
+  uint32_t crc;
+  memcpy(&crc, file.data() + sizeof(header) + header.length, sizeof(crc));
+  return crc == snapshotCrc32(0, file.data() + sizeof(header), header.length);
+}
+
+static void writeLamp(ConfigSnapshotWriter& writer) {
+  LampSnapshot lamp = { 1, 200, 1500 };
+  writer.writeBlock(&lamp, sizeof(lamp));
+  writer.writeString("Lillys Lamp");
+  writer.writeString("Rainbow");
+  writer.writeString("");
+  uint8_t modeCount = 2;
+  writer.writeBlock(&modeCount, sizeof(modeCount));
+  const uint8_t colour[] = { 255, 128, 0, 0, 255 };
+  writer.writeString("Colour");
+  writer.writeBlock(colour, sizeof(colour));
+  writer.writeString("Rainbow");
+  writer.writeBlock(nullptr, 0);
+  SyncSnapshot sync = { 2, 7, -120 };
+  writer.writeBlock(&sync, sizeof(sync));
+}
+
+int main() {
+  // The CRC32 check value of the standard
+  CHECK_EQUAL(snapshotCrc32(0, (const uint8_t*)"123456789", 9), 0xCBF43926);
+  CHECK_EQUAL(snapshotCrc32(snapshotCrc32(0, (const uint8_t*)"1234", 4), (const uint8_t*)"56789", 5), 0xCBF43926);
+
+  // Everything written is read back in order
+  std::vector<uint8_t> file = writeFile(writeLamp);
+  CHECK(checkFile(file));
+  ConfigSnapshotReader reader(file.data() + sizeof(ConfigSnapshotHeader), file.size() - sizeof(ConfigSnapshotHeader) - sizeof(uint32_t));
+  LampSnapshot lamp = { 0, 0, 0 };
+  reader.readBlockInto(&lamp, sizeof(lamp));
+  CHECK_EQUAL(lamp.state, 1);
+  CHECK_EQUAL(lamp.brightness, 200);
+  CHECK_EQUAL(lamp.fadeTime, 1500);
+  char text[CONFIG_SNAPSHOT_MAX_BLOCK + 1];
+  reader.readString(text, sizeof(text));
+  CHECK(strcmp(text, "Lillys Lamp") == 0);
+  reader.readString(text, sizeof(text));
+  CHECK(strcmp(text, "Rainbow") == 0);
+  reader.readString(text, sizeof(text));
+  CHECK(strcmp(text, "") == 0);
+  uint8_t modeCount = 0;
+  reader.readBlockInto(&modeCount, sizeof(modeCount));
+  CHECK_EQUAL(modeCount, 2);
+  reader.readString(text, sizeof(text));
+  CHECK(strcmp(text, "Colour") == 0);
+  uint8_t size;
+  const uint8_t* block = reader.readBlock(size);
+  CHECK(block != nullptr);
+  CHECK_EQUAL(size, 5);
+  CHECK_EQUAL(block[1], 128);
+  reader.readString(text, sizeof(text));
+  CHECK(strcmp(text, "Rainbow") == 0);
+  reader.readBlock(size);
+  CHECK_EQUAL(size, 0);
+  CHECK(!reader.atEnd());
+  SyncSnapshot sync = { 0, 0, 0 };
+  reader.readBlockInto(&sync, sizeof(sync));
+  CHECK_EQUAL(sync.offset, -120);
+  CHECK(reader.atEnd());
+  CHECK(!reader.failed);
+
+  // Any flipped bit fails the CRC, a newer version or another magic is ignored
+  for (size_t bit = 0; bit < (file.size() - sizeof(ConfigSnapshotHeader) - sizeof(uint32_t)) * 8; bit += 7) {
+    std::vector<uint8_t> damaged = file;
+    damaged[sizeof(ConfigSnapshotHeader) + bit / 8] ^= 1 << (bit % 8);
+    CHECK(!checkFile(damaged));
+  }
+  std::vector<uint8_t> newer = file;
+  ((ConfigSnapshotHeader*)newer.data())->version = CONFIG_SNAPSHOT_VERSION + 1;
+  CHECK(!checkFile(newer));
+  std::vector<uint8_t> preset = file;
+  ((ConfigSnapshotHeader*)preset.data())->magic = PRESET_SNAPSHOT_MAGIC;
+  CHECK(!checkFile(preset));
+  CHECK(!checkFile(std::vector<uint8_t>(file.begin(), file.end() - 1)));
+
+  // A length that does not fit the file or is too large is rejected before anything is allocated
+  ConfigSnapshotHeader header = { CONFIG_SNAPSHOT_MAGIC, CONFIG_SNAPSHOT_VERSION, 0xFFFF };
+  CHECK(!snapshotHeaderValid(header, CONFIG_SNAPSHOT_MAGIC, file.size()));
+  CHECK(!snapshotHeaderValid(header, CONFIG_SNAPSHOT_MAGIC, sizeof(header) + 0xFFFF + sizeof(uint32_t)));
+  header.length = CONFIG_SNAPSHOT_MAX;
+  CHECK(snapshotHeaderValid(header, CONFIG_SNAPSHOT_MAGIC, sizeof(header) + CONFIG_SNAPSHOT_MAX + sizeof(uint32_t)));
+  header.length = file.size();
+  CHECK(!snapshotHeaderValid(header, CONFIG_SNAPSHOT_MAGIC, file.size()));
+
+  // A shorter block of an older version keeps the defaults of the fields appended since
+  std::vector<uint8_t> payload;
+  ConfigSnapshotWriter oldWriter(writeBuffer, &payload);
+  OldLamp oldLamp = { 1, 90 };
+  oldWriter.writeBlock(&oldLamp, sizeof(oldLamp));
+  ConfigSnapshotReader oldReader(payload.data(), payload.size());
+  lamp = { 0, 0, 800 };
+  oldReader.readBlockInto(&lamp, sizeof(lamp));
+  CHECK_EQUAL(lamp.brightness, 90);
+  CHECK_EQUAL(lamp.fadeTime, 800);
+  CHECK(oldReader.atEnd());
+  CHECK(!oldReader.failed);
+
+  // A longer block of a newer version is cut to what the reader knows, the next block still lines up
+  payload.clear();
+  ConfigSnapshotWriter newWriter(writeBuffer, &payload);
+  newWriter.writeBlock(&lamp, sizeof(lamp));
+  newWriter.writeString("next");
+  ConfigSnapshotReader newReader(payload.data(), payload.size());
+  oldLamp = { 0, 0 };
+  newReader.readBlockInto(&oldLamp, sizeof(oldLamp));
+  CHECK_EQUAL(oldLamp.brightness, 90);
+  newReader.readString(text, sizeof(text));
+  CHECK(strcmp(text, "next") == 0);
+
+  // Strings are cut to the buffer and to the largest block
+  payload.clear();
+  ConfigSnapshotWriter longWriter(writeBuffer, &payload);
+  std::string longText(300, 'x');
+  longWriter.writeString(longText.c_str());
+  longWriter.writeString("after");
+  CHECK_EQUAL(payload.size(), 1 + CONFIG_SNAPSHOT_MAX_BLOCK + 1 + 5);
+  ConfigSnapshotReader longReader(payload.data(), payload.size());
+  char shortText[8];
+  longReader.readString(shortText, sizeof(shortText));
+  CHECK_EQUAL(strlen(shortText), sizeof(shortText) - 1);
+  longReader.readString(text, sizeof(text));
+  CHECK(strcmp(text, "after") == 0);
+
+  // Reading past the end fails and returns empty values instead of reading outside the payload
+  ConfigSnapshotReader truncated(payload.data(), 10);
+  truncated.readString(text, sizeof(text));
+  CHECK(truncated.failed);
+  CHECK_EQUAL(strlen(text), 0);
+  CHECK(truncated.atEnd());
+
+  // A sink that fails marks the writer, the CRC and length still cover everything
+  ConfigSnapshotWriter failing(writeNothing, nullptr);
+  writeLamp(failing);
+  ConfigSnapshotWriter dryRun;
+  writeLamp(dryRun);
+  CHECK(failing.failed);
+  CHECK(!dryRun.failed);
+  CHECK_EQUAL(failing.crc, dryRun.crc);
+
+  return checkSummary("test_config_snapshot");
+}
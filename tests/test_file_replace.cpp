@@ -0,0 +1,85 @@
+// Cuts the power at every step of replaceFile() on MemoryFS and checks that after the reset and recoverFile() the
+// file holds either all of the old or all of the new contents, as Config.ino and Presets.ino rely on.
+
+#include "Check.h"
+#include "MemoryFS.h"
+#include "FileReplace.h"
+
+static const char* path = "/Config.bin";
+static const char* tempPath = "/Config.tmp";
+
+static bool replace(MemoryFS& fileSystem, const std::string& text) {
+  return replaceFile(fileSystem, path, tempPath, text.size(), [&](MemoryFile& file) {
+    return file.write((const uint8_t*)text.data(), text.size());
+  });
+}
+
+// Replace the file with the power cut after every possible step, returns the number of steps a full replace takes
+static long cutEverywhere(const char* oldText, const std::string& newText) {
+  long cut = 0;
+  for (;; cut++) {
+    MemoryFS fileSystem;
+    if (oldText) fileSystem.files[path].assign(oldText, oldText + strlen(oldText));
+    fileSystem.stepsLeft = cut;
+    bool replaced = replace(fileSystem, newText);
+
+    // Reset
+    fileSystem.power();
+    recoverFile(fileSystem, path, tempPath);
+    std::string contents = fileSystem.contents(path);
+    CHECK(contents == newText || contents == (oldText ? oldText : ""));
+    if (replaced) {
+      CHECK(contents == newText);
+      CHECK(!fileSystem.exists(tempPath));
+      break;
+    }
+
+    // A replace after the reset always works
+    CHECK(replace(fileSystem, newText));
+    CHECK(fileSystem.contents(path) == newText);
+    CHECK(!fileSystem.exists(tempPath));
+  }
+  return cut;
+}
+
+int main() {
+  const std::string newText = "{\"Name\":\"Lillys Lamp\",\"Mode\":\"Rainbow\"}";
+
+  // Open the placeholder and the temporary file, the bytes, remove and rename
+  CHECK_EQUAL(cutEverywhere(nullptr, newText), 2 + newText.size() + 2);
+
+  // Open the temporary file, the bytes, remove and rename
+  CHECK_EQUAL(cutEverywhere("{\"Name\":\"Old\"}", newText), 1 + newText.size() + 2);
+
+  // A short write keeps the old file and removes the temporary one
+  MemoryFS fileSystem;
+  fileSystem.files[path].assign(3, 'x');
+  bool replaced = replaceFile(fileSystem, path, tempPath, newText.size(), [&](MemoryFile& file) {
+    return file.write((const uint8_t*)newText.data(), newText.size() / 2);
+  });
+  CHECK(!replaced);
+  CHECK(fileSystem.contents(path) == "xxx");
+  CHECK(!fileSystem.exists(tempPath));
+
+  // Nothing written at all is a failure even if nothing was expected
+  replaced = replaceFile(fileSystem, path, tempPath, 0, [](MemoryFile&) { return (size_t)0; });
+  CHECK(!replaced);
+  CHECK(fileSystem.contents(path) == "xxx");
+
+  // A temporary file left by a reset while writing is not used while the file is still there
+  fileSystem.files[tempPath].assign(5, 'y');
+  recoverFile(fileSystem, path, tempPath);
+  CHECK(fileSystem.contents(path) == "xxx");
+  CHECK(replace(fileSystem, newText));
+  CHECK(fileSystem.contents(path) == newText);
+
+  // Reading back through a file of the file system
+  MemoryFile file = fileSystem.open(path, "r");
+  CHECK(bool(file));
+  char buffer[64] = {};
+  CHECK_EQUAL(file.read((uint8_t*)buffer, sizeof(buffer)), newText.size());
+  CHECK(newText == buffer);
+  CHECK(!fileSystem.open("/Missing.bin", "r"));
+
+  return checkSummary("test_file_replace");
+}
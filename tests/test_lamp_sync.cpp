@@ -0,0 +1,102 @@
+// Sync packets through the header and reader, the four timestamp offset across the wrap of millis(), and a
+// follower that takes samples over a network that holds packets back, as Sync.ino does.
+
+#include <stdlib.h>
+#include "Check.h"
+#include "LampSync.h"
+
+int main() {
+  // Roles
+  CHECK_EQUAL(lampSyncRoleFromName(lampSyncRoleName(LAMP_SYNC_LEADER)), LAMP_SYNC_LEADER);
+  CHECK_EQUAL(lampSyncRoleFromName(lampSyncRoleName(LAMP_SYNC_FOLLOWER)), LAMP_SYNC_FOLLOWER);
+  CHECK_EQUAL(lampSyncRoleFromName("Boss"), LAMP_SYNC_OFF);
+
+  // A reply of group 3 is read back, other groups, versions and short packets are not for the lamp
+  uint8_t packet[LAMP_SYNC_PACKET_MAX];
+  size_t length = lampSyncWriteHeader(packet, LAMP_SYNC_REPLY, 3);
+  length += lampSyncWrite32(packet + length, 0xFFFFFF00);
+  length += lampSyncWrite32(packet + length, 1000);
+  length += lampSyncWrite32(packet + length, 1002);
+  CHECK_EQUAL(length, LAMP_SYNC_HEADER_SIZE + 12);
+  RealtimeReader reader(packet, length);
+  CHECK_EQUAL(lampSyncReadHeader(reader, 3), LAMP_SYNC_REPLY);
+  CHECK_EQUAL((uint32_t)reader.readI32(), 0xFFFFFF00);
+  CHECK_EQUAL(reader.readI32(), 1000);
+  CHECK_EQUAL(reader.readI32(), 1002);
+  CHECK(!reader.failed);
+  RealtimeReader otherGroup(packet, length);
+  CHECK_EQUAL(lampSyncReadHeader(otherGroup, 4), 0);
+  packet[2] = LAMP_SYNC_VERSION + 1;
+  RealtimeReader otherVersion(packet, length);
+  CHECK_EQUAL(lampSyncReadHeader(otherVersion, 3), 0);
+  RealtimeReader shortPacket(packet, 4);
+  CHECK_EQUAL(lampSyncReadHeader(shortPacket, 3), 0);
+
+  // The leader is 5 s ahead, 10 ms each way and 2 ms to answer, the follower clock wraps in between
+  NtpSample sample = lampSyncCalculate(0xFFFFFFF0, 0xFFFFFFF0 + 5010, 0xFFFFFFF0 + 5012, 0xFFFFFFF0 + 22);
+  CHECK_EQUAL(sample.offset, 5000);
+  CHECK_EQUAL(sample.delay, 20);
+
+  // A leader behind the follower
+  sample = lampSyncCalculate(20000, 5010, 5012, 20022);
+  CHECK_EQUAL(sample.offset, -15000);
+  CHECK_EQUAL(sample.delay, 20);
+
+  // The filter lets through samples close to the best delay of the last few
+  LampSyncFilter filter;
+  CHECK(filter.accept(50));
+  CHECK(filter.accept(20));
+  CHECK(!filter.accept(40));
+  CHECK(filter.accept(23));
+  for (int i = 0; i < LAMP_SYNC_FILTER_SIZE; i++) filter.accept(60);
+  CHECK(filter.accept(62));
+  CHECK_EQUAL(filter.samples(), LAMP_SYNC_FILTER_SIZE);
+  filter.reset();
+  CHECK_EQUAL(filter.samples(), 0);
+  CHECK(filter.accept(100));
+
+  // A thousand requests over WiFi that holds every other packet back for up to 100 ms. The samples the filter
+  // keeps are off by a fraction of what all samples are off by on average, the worst of them is only off when the
+  // whole window of the filter was held back.
+  const int32_t trueOffset = 12345;
+  srand(3);
+  filter.reset();
+  int64_t errorFiltered = 0, errorPlain = 0;
+  int32_t worstFiltered = 0;
+  int accepted = 0;
+  uint32_t followerClock = 0xFFF00000;
+  for (int i = 0; i < 1000; i++) {
+    followerClock += 250;
+    uint32_t there = 3 + rand() % 3 + (rand() % 2 ? rand() % 100 : 0);
+    uint32_t back = 3 + rand() % 3 + (rand() % 2 ? rand() % 100 : 0);
+    uint32_t t1 = followerClock;
+    uint32_t t2 = t1 + trueOffset + there;
+    uint32_t t3 = t2 + 1;
+    uint32_t t4 = t3 - trueOffset + back;
+    sample = lampSyncCalculate(t1, t2, t3, t4);
+    int32_t error = abs((int32_t)(sample.offset - trueOffset));
+    errorPlain += error;
+    if (!filter.accept(sample.delay)) continue;
+    accepted++;
+    errorFiltered += error;
+    if (error > worstFiltered) worstFiltered = error;
+  }
+  CHECK(accepted > 100 && accepted < 500);
+  CHECK(errorFiltered / accepted * 4 < errorPlain / 1000);
+  CHECK(worstFiltered < 50);
+
+  // Without packets held back every kept sample is within a millisecond
+  filter.reset();
+  worstFiltered = 0;
+  for (int i = 0; i < 1000; i++) {
+    followerClock += 250;
+    uint32_t there = 3 + rand() % 3, back = 3 + rand() % 3;
+    sample = lampSyncCalculate(followerClock, followerClock + trueOffset + there, followerClock + trueOffset + there + 1, followerClock + there + 1 + back);
+    if (!filter.accept(sample.delay)) continue;
+    int32_t error = abs((int32_t)(sample.offset - trueOffset));
+    if (error > worstFiltered) worstFiltered = error;
+  }
+  CHECK(worstFiltered <= 1);
+
+  return checkSummary("test_lamp_sync");
+}
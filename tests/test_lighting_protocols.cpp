@@ -0,0 +1,197 @@
+// Parses E1.31, Art-Net and DDP packets built byte by byte after the specifications, truncated and random packets,
+// and places a strip of pixels that spans several universes.
+
+#include <stdlib.h>
+#include <vector>
+#include "Check.h"
+#include "LightingProtocols.h"
+
+static void write16(std::vector<uint8_t>& packet, size_t position, uint16_t value) {
+  packet[position] = value >> 8;
+  packet[position + 1] = value & 0xFF;
+}
+
+static void write32(std::vector<uint8_t>& packet, size_t position, uint32_t value) {
+  write16(packet, position, value >> 16);
+  write16(packet, position + 2, value & 0xFFFF);
+}
+
+// E1.31 data packet of the universe with the DMX start code and count channels of 1, 2, 3, ...
+static std::vector<uint8_t> e131Data(uint16_t universe, uint16_t count, uint8_t sequence, uint16_t syncUniverse) {
+  static const char identifier[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+  std::vector<uint8_t> packet(126 + count, 0);
+  write16(packet, 0, 0x0010);
+  memcpy(&packet[4], identifier, sizeof(identifier));
+  write32(packet, 18, 0x00000004);
+  write32(packet, 40, 0x00000002);
+  write16(packet, 109, syncUniverse);
+  packet[111] = sequence;
+  write16(packet, 113, universe);
+  packet[117] = 0x02;
+  write16(packet, 123, count + 1);
+  for (uint16_t i = 0; i < count; i++) packet[126 + i] = i + 1;
+  return packet;
+}
+
+static std::vector<uint8_t> artNetData(uint16_t universe, uint16_t count, uint8_t sequence) {
+  std::vector<uint8_t> packet(18 + count, 0);
+  memcpy(&packet[0], "Art-Net", 8);
+  packet[8] = 0x00;
+  packet[9] = 0x50;
+  packet[11] = 14;
+  packet[12] = sequence;
+  packet[14] = universe & 0xFF;
+  packet[15] = universe >> 8;
+  write16(packet, 16, count);
+  for (uint16_t i = 0; i < count; i++) packet[18 + i] = i + 1;
+  return packet;
+}
+
+static std::vector<uint8_t> ddpData(uint32_t offset, uint16_t count, uint8_t sequence, bool push, uint8_t dataType) {
+  std::vector<uint8_t> packet(10 + count, 0);
+  packet[0] = 0x40 | (push ? 0x01 : 0);
+  packet[1] = sequence;
+  packet[2] = dataType;
+  packet[3] = 1;
+  write32(packet, 4, offset);
+  write16(packet, 8, count);
+  for (uint16_t i = 0; i < count; i++) packet[10 + i] = i + 1;
+  return packet;
+}
+
+int main() {
+  // E1.31 data
+  std::vector<uint8_t> e131 = e131Data(7, 510, 42, 9);
+  LightingPacket packet = lightingParseE131(e131.data(), e131.size());
+  CHECK_EQUAL(packet.type, LIGHTING_DATA);
+  CHECK_EQUAL(packet.universe, 7);
+  CHECK_EQUAL(packet.sequence, 42);
+  CHECK_EQUAL(packet.syncUniverse, 9);
+  CHECK_EQUAL(packet.length, 510);
+  CHECK(packet.data == e131.data() + 126);
+  CHECK_EQUAL(packet.data[0], 1);
+
+  // Preview data, terminated streams, other start codes and a count beyond the packet are ignored
+  std::vector<uint8_t> preview = e131;
+  preview[112] = 0x80;
+  CHECK_EQUAL(lightingParseE131(preview.data(), preview.size()).type, LIGHTING_IGNORE);
+  std::vector<uint8_t> terminated = e131;
+  terminated[112] = 0x40;
+  CHECK_EQUAL(lightingParseE131(terminated.data(), terminated.size()).type, LIGHTING_IGNORE);
+  std::vector<uint8_t> startCode = e131;
+  startCode[125] = 0xDD;
+  CHECK_EQUAL(lightingParseE131(startCode.data(), startCode.size()).type, LIGHTING_IGNORE);
+  CHECK_EQUAL(lightingParseE131(e131.data(), e131.size() - 1).type, LIGHTING_IGNORE);
+
+  // E1.31 universe sync
+  std::vector<uint8_t> sync(49, 0);
+  memcpy(&sync[0], &e131[0], 16);
+  write32(sync, 18, 0x00000008);
+  write32(sync, 40, 0x00000001);
+  sync[44] = 3;
+  write16(sync, 45, 9);
+  packet = lightingParseE131(sync.data(), sync.size());
+  CHECK_EQUAL(packet.type, LIGHTING_SYNC);
+  CHECK_EQUAL(packet.universe, 9);
+  CHECK_EQUAL(packet.sequence, 3);
+
+  // Art-Net data with the 15 bit port address, and ArtSync
+  std::vector<uint8_t> artNet = artNetData(0x1234, 512, 200);
+  packet = lightingParseArtNet(artNet.data(), artNet.size());
+  CHECK_EQUAL(packet.type, LIGHTING_DATA);
+  CHECK_EQUAL(packet.universe, 0x1234);
+  CHECK_EQUAL(packet.sequence, 200);
+  CHECK_EQUAL(packet.length, 512);
+  CHECK(packet.data == artNet.data() + 18);
+  CHECK_EQUAL(lightingParseArtNet(artNet.data(), artNet.size() - 1).type, LIGHTING_IGNORE);
+  std::vector<uint8_t> tooLong = artNetData(0, 514, 0);
+  CHECK_EQUAL(lightingParseArtNet(tooLong.data(), tooLong.size()).type, LIGHTING_IGNORE);
+  std::vector<uint8_t> artSync(14, 0);
+  memcpy(&artSync[0], "Art-Net", 8);
+  artSync[9] = 0x52;
+  CHECK_EQUAL(lightingParseArtNet(artSync.data(), artSync.size()).type, LIGHTING_SYNC);
+
+  // DDP with RGB and RGBW data types, the push flag, the 4 bit sequence and the optional timecode
+  std::vector<uint8_t> ddp = ddpData(300, 480, 5, true, 0x0B);
+  packet = lightingParseDdp(ddp.data(), ddp.size());
+  CHECK_EQUAL(packet.type, LIGHTING_DATA);
+  CHECK_EQUAL(packet.offset, 300);
+  CHECK_EQUAL(packet.length, 480);
+  CHECK_EQUAL(packet.sequence, 5);
+  CHECK_EQUAL(packet.sequenceBits, 4);
+  CHECK_EQUAL(packet.channelsPerPixel, 3);
+  CHECK(packet.push);
+  ddp = ddpData(0, 400, 0, false, 0x1B);
+  packet = lightingParseDdp(ddp.data(), ddp.size());
+  CHECK_EQUAL(packet.channelsPerPixel, 4);
+  CHECK(!packet.push);
+  ddp = ddpData(0, 12, 0, false, 0);
+  CHECK_EQUAL(lightingParseDdp(ddp.data(), ddp.size()).channelsPerPixel, 0);
+  ddp[0] |= 0x10;
+  ddp.insert(ddp.begin() + 10, 4, 0);
+  packet = lightingParseDdp(ddp.data(), ddp.size());
+  CHECK_EQUAL(packet.type, LIGHTING_DATA);
+  CHECK(packet.data == ddp.data() + 14);
+  ddp[3] = 2;
+  CHECK_EQUAL(lightingParseDdp(ddp.data(), ddp.size()).type, LIGHTING_IGNORE);
+
+  // Random bytes and every truncation of the valid packets are never read past their end
+  srand(7);
+  bool ignored = true;
+  for (int i = 0; i < 20000; i++) {
+    std::vector<uint8_t> noise(rand() % 700);
+    for (uint8_t& byte : noise) byte = rand();
+    if (i % 3 == 0 && noise.size() >= 12) memcpy(&noise[0], "Art-Net", 8);
+    if (i % 3 == 1 && noise.size() >= 16) memcpy(&noise[0], &e131[0], 16);
+    lightingParseE131(noise.data(), noise.size());
+    lightingParseArtNet(noise.data(), noise.size());
+    lightingParseDdp(noise.data(), noise.size());
+  }
+  for (size_t length = 0; length < e131.size(); length++) {
+    if (lightingParseE131(e131.data(), length).type == LIGHTING_DATA) ignored = false;
+  }
+  for (size_t length = 0; length < artNet.size(); length++) {
+    if (lightingParseArtNet(artNet.data(), length).type == LIGHTING_DATA) ignored = false;
+  }
+  CHECK(ignored);
+
+  // Sequence numbers: repeats and the 20 before are late for E1.31, half the range for DDP, across the wrap
+  CHECK(lightingSequenceLate(42, 42, 8));
+  CHECK(lightingSequenceLate(23, 42, 8));
+  CHECK(!lightingSequenceLate(22, 42, 8));
+  CHECK(!lightingSequenceLate(43, 42, 8));
+  CHECK(lightingSequenceLate(250, 5, 8));
+  CHECK(!lightingSequenceLate(5, 250, 8));
+  CHECK(lightingSequenceLate(14, 2, 4));
+  CHECK(!lightingSequenceLate(3, 2, 4));
+  CHECK(!lightingSequenceLate(10, 2, 4));
+
+  // 300 RGBW pixels from channel 5 of universe 3: 127 pixels in the first universe, 128 in the next and 45 in the
+  // last. Every pixel is placed exactly once.
+  LightingMapping mapping = { 3, 5, 4, 300 };
+  CHECK_EQUAL(lightingUniverseCount(mapping), 3);
+  std::vector<int> placed(mapping.pixelCount, 0);
+  uint16_t firstPixel = 0, dataOffset = 0;
+  CHECK_EQUAL(lightingMapUniverse(mapping, 3, 512, firstPixel, dataOffset), 127);
+  CHECK_EQUAL(dataOffset, 4);
+  for (uint16_t universe = 3; universe < 6; universe++) {
+    uint16_t count = lightingMapUniverse(mapping, universe, 512, firstPixel, dataOffset);
+    for (uint16_t i = 0; i < count; i++) placed[firstPixel + i]++;
+  }
+  bool once = true;
+  for (int count : placed) once &= count == 1;
+  CHECK(once);
+  CHECK_EQUAL(lightingMapUniverse(mapping, 4, 512, firstPixel, dataOffset), 128);
+  CHECK_EQUAL(firstPixel, 127);
+  CHECK_EQUAL(dataOffset, 0);
+  CHECK_EQUAL(lightingMapUniverse(mapping, 5, 512, firstPixel, dataOffset), 45);
+  CHECK_EQUAL(firstPixel, 255);
+
+  // Short universes only give their whole pixels, other universes none
+  CHECK_EQUAL(lightingMapUniverse(mapping, 4, 30, firstPixel, dataOffset), 7);
+  CHECK_EQUAL(lightingMapUniverse(mapping, 3, 4, firstPixel, dataOffset), 0);
+  CHECK_EQUAL(lightingMapUniverse(mapping, 2, 512, firstPixel, dataOffset), 0);
+  CHECK_EQUAL(lightingMapUniverse(mapping, 6, 512, firstPixel, dataOffset), 0);
+
+  return checkSummary("test_lighting_protocols");
+}
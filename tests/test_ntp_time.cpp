@@ -0,0 +1,82 @@
+// NTP timestamps, the four timestamp offset and delay, and SlewClock over two days of a crystal that runs fast and
+// hourly syncs, as NTP.ino drives it.
+
+#include "Check.h"
+#include "NtpTime.h"
+
+int main() {
+  // 2024-01-01 00:00:00.500 UTC, the NTP seconds are 0xE93C9A00
+  uint8_t packet[8];
+  int64_t newYear = 1704067200500LL;
+  ntpWriteTimestamp(packet, newYear);
+  CHECK_EQUAL(packet[0], 0xE9);
+  CHECK_EQUAL(packet[3], 0x00);
+  CHECK_EQUAL(packet[4], 0x80);
+  CHECK_EQUAL(ntpReadTimestamp(packet), newYear);
+  for (int64_t ms = 0; ms < 1000; ms += 7) {
+    ntpWriteTimestamp(packet, newYear + ms);
+    CHECK_EQUAL(ntpReadTimestamp(packet), newYear + ms);
+  }
+
+  // The server is 500 ms ahead, 40 ms each way and 5 ms to answer
+  NtpSample sample = ntpCalculate(1000, 1540, 1545, 1085);
+  CHECK_EQUAL(sample.offset, 500);
+  CHECK_EQUAL(sample.delay, 80);
+
+  // The first sync steps the clock, its offset is against the time the unset clock shows. A small offset is slewed
+  // at no more than 1 ms per slewDivider ms.
+  SlewClock clock;
+  CHECK(!clock.isSet());
+  clock.adjust(newYear, 0);
+  CHECK(clock.isSet());
+  CHECK_EQUAL(clock.time(0), newYear);
+  clock.adjust(-200, 1000);
+  int64_t last = clock.time(1000);
+  bool monotonic = true;
+  for (uint32_t now = 1000; now <= 1000 + 200 * 16 + 100; now += 10) {
+    clock.update(now);
+    if (clock.time(now) < last) monotonic = false;
+    last = clock.time(now);
+  }
+  CHECK(monotonic);
+  CHECK_EQUAL(clock.pendingSlew(), 0);
+  CHECK_EQUAL(clock.time(10000), newYear + 10000 - 200);
+
+  // Slewing halfway through
+  clock.adjust(100, 20000);
+  clock.update(20000 + 800);
+  CHECK_EQUAL(clock.pendingSlew(), 50);
+
+  // Large offsets step the clock, the offset was measured against the time shown so the rest of the slew is dropped
+  clock.adjust(5000, 30000);
+  CHECK_EQUAL(clock.pendingSlew(), 0);
+  CHECK_EQUAL(clock.time(30000), newYear + 30000 - 200 + 50 + 5000);
+
+  // The clock keeps running across the wrap of millis()
+  SlewClock wrapClock;
+  wrapClock.step(newYear, 0xFFFFFF00);
+  wrapClock.update(0x100);
+  CHECK_EQUAL(wrapClock.time(0x200), newYear + 0x300);
+
+  // A crystal 50 ppm fast synced once an hour for two days, the time is never off by more than the drift of an hour
+  // and never runs backwards
+  SlewClock drifting;
+  const double ppm = 50e-6;
+  int64_t worst = 0;
+  monotonic = true;
+  last = 0;
+  for (uint64_t realMs = 0; realMs <= 2ULL * 24 * 3600 * 1000; realMs += 100) {
+    uint32_t now = (uint32_t)(realMs * (1 + ppm)) + 0xF0000000;
+    if (realMs % 3600000 == 0) drifting.adjust(newYear + (int64_t)realMs - drifting.time(now), now);
+    drifting.update(now);
+    int64_t error = drifting.time(now) - (newYear + (int64_t)realMs);
+    if (error < 0) error = -error;
+    if (error > worst) worst = error;
+    if (drifting.time(now) < last) monotonic = false;
+    last = drifting.time(now);
+  }
+  CHECK(monotonic);
+  CHECK(worst <= (int64_t)(3600000 * ppm) + 2);
+
+  return checkSummary("test_ntp_time");
+}
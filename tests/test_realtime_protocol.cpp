@@ -0,0 +1,117 @@
+// Reads the binary realtime messages as Realtime.ino does: little endian values, short messages and pixel counts.
+// Then encodes thousands of random preview frames and decodes them as the website does.
+
+#include <stdlib.h>
+#include <vector>
+#include "Check.h"
+#include "RealtimeProtocol.h"
+
+// Apply a preview message to the pixels shown, like handlePreviewFrame() of the website. Returns false if the message is malformed.
+static bool decodePreview(const uint8_t* data, size_t length, std::vector<uint16_t>& shown) {
+  RealtimeReader reader(data, length);
+  if (reader.readU8() != REALTIME_PROTOCOL_VERSION || reader.readU8() != REALTIME_PREVIEW) return false;
+  uint8_t flags = reader.readU8();
+  uint16_t count = reader.readU16();
+  if (count != shown.size()) return false;
+  size_t position = 0;
+  bool replaced = false;
+  while (reader.remaining()) {
+    position += reader.readU8();
+    uint8_t run = reader.readU8();
+    for (uint8_t i = 0; i < run; i++) {
+      if (position >= count) return false;
+      shown[position++] = reader.readU16();
+    }
+    replaced |= run > 0;
+  }
+  return !reader.failed && replaced && (!(flags & REALTIME_FLAG_KEY) || position == count);
+}
+
+int main() {
+  // SET_PARAMETER for the "Rainbow" mode, parameter 2 set to -1000
+  const uint8_t setParameter[] = { REALTIME_PROTOCOL_VERSION, REALTIME_SET_PARAMETER, 7, 'R', 'a', 'i', 'n', 'b', 'o', 'w', 2,
+                                   0x18, 0xFC, 0xFF, 0xFF };
+  RealtimeReader reader(setParameter, sizeof(setParameter));
+  CHECK_EQUAL(reader.readU8(), REALTIME_PROTOCOL_VERSION);
+  CHECK_EQUAL(reader.readU8(), REALTIME_SET_PARAMETER);
+  uint8_t nameLength = reader.readU8();
+  const uint8_t* name = reader.readBytes(nameLength);
+  CHECK(name && !memcmp(name, "Rainbow", 7));
+  CHECK_EQUAL(reader.readU8(), 2);
+  CHECK_EQUAL(reader.readI32(), -1000);
+  CHECK_EQUAL(reader.remaining(), 0);
+  CHECK(!reader.failed);
+
+  // Reading past the end fails, returns zeros and stays failed even for values that would fit
+  const uint8_t setLamp[] = { REALTIME_PROTOCOL_VERSION, REALTIME_SET_LAMP, REALTIME_LAMP_BRIGHTNESS, 0x34 };
+  RealtimeReader shortReader(setLamp, sizeof(setLamp));
+  shortReader.readU16();
+  CHECK_EQUAL(shortReader.readU16(), 0x3402);
+  CHECK(!shortReader.failed);
+  CHECK_EQUAL(shortReader.readU16(), 0);
+  CHECK(shortReader.failed);
+  CHECK_EQUAL(shortReader.readU8(), 0);
+  CHECK_EQUAL(shortReader.remaining(), 0);
+  CHECK(shortReader.readBytes(0) == nullptr);
+
+  // A name length beyond the message does not read out of bounds
+  const uint8_t badName[] = { REALTIME_PROTOCOL_VERSION, REALTIME_SET_PARAMETER, 200, 'A' };
+  RealtimeReader badReader(badName, sizeof(badName));
+  badReader.readBytes(REALTIME_HEADER_SIZE);
+  CHECK(badReader.readBytes(badReader.readU8()) == nullptr);
+  CHECK(badReader.failed);
+
+  // An empty message
+  RealtimeReader emptyReader(nullptr, 0);
+  CHECK_EQUAL(emptyReader.readU8(), 0);
+  CHECK(emptyReader.failed);
+
+  // Pixel messages only count whole pixels
+  CHECK_EQUAL(realtimePixelCount(REALTIME_PIXELS_RGBW, 4 * 60 + 3), 60);
+  CHECK_EQUAL(realtimePixelCount(REALTIME_PIXELS_RGB, 3 * 60 + 2), 60);
+  CHECK_EQUAL(realtimePixelCount(REALTIME_PING, 100), 0);
+
+  uint8_t header[REALTIME_HEADER_SIZE];
+  CHECK_EQUAL(realtimeWriteHeader(header, REALTIME_PONG), REALTIME_HEADER_SIZE);
+  CHECK_EQUAL(header[0], REALTIME_PROTOCOL_VERSION);
+  CHECK_EQUAL(header[1], REALTIME_PONG);
+
+  // RGB565
+  CHECK_EQUAL(realtimeRgb565(255, 255, 255), 0xFFFF);
+  CHECK_EQUAL(realtimeRgb565(255, 0, 0), 0xF800);
+  CHECK_EQUAL(realtimeRgb565(0, 255, 0), 0x07E0);
+  CHECK_EQUAL(realtimeRgb565(0, 0, 255), 0x001F);
+
+  // Random frames with few, many, alternating and no changes, with gaps longer than a run can skip. Every message
+  // fits its size and decodes to the frame, and an unchanged frame sends nothing.
+  const uint16_t counts[] = { 1, 2, 60, 255, 256, 600 };
+  bool fits = true, decoded = true, empty = true;
+  srand(1);
+  for (uint16_t count : counts) {
+    std::vector<uint16_t> pixels(count, 0), last(count, 0), shown(count, 0);
+    std::vector<uint8_t> message(realtimePreviewSize(count));
+    for (int frame = 0; frame < 500; frame++) {
+      bool key = frame % 50 == 0;
+      int pattern = frame % 5;
+      bool changed = false;
+      for (uint16_t i = 0; i < count; i++) {
+        bool change = pattern == 0 ? rand() % 10 == 0 : pattern == 1 ? rand() % 2 : pattern == 2 ? i % 2 == 0 : pattern == 3 ? i == count - 1 : false;
+        if (change) pixels[i] = pixels[i] + 1 + rand() % 1000;
+        changed |= change;
+      }
+
+      size_t length = realtimeEncodePreview(pixels.data(), last.data(), count, key, message.data());
+      if (length > message.size()) fits = false;
+      if (!key && !changed) {
+        if (length) empty = false;
+        continue;
+      }
+      if (!length || !decodePreview(message.data(), length, shown) || shown != pixels || last != pixels) decoded = false;
+    }
+  }
+  CHECK(fits);
+  CHECK(decoded);
+  CHECK(empty);
+
+  return checkSummary("test_realtime_protocol");
+}
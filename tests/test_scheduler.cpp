@@ -0,0 +1,115 @@
+// Runs the rules of the automation through the timer wheel over two weeks of virtual time, stepped like the main
+// loop with stalls and clock jumps, and checks every rule fires exactly when a plain minute by minute search says.
+
+#include <vector>
+#include "Check.h"
+#include "Scheduler.h"
+
+static const float latitude = 51.5f, longitude = -0.13f;   // London
+static const int32_t utcOffset = 60;
+
+static uint32_t dayOf(int year, int month, int day) {
+  // Days from civil, see http://howardhinnant.github.io/date_algorithms.html
+  year -= month <= 2;
+  int32_t era = year / 400;
+  uint32_t yoe = year - era * 400;
+  uint32_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+// Every occurrence of the rule in [from, to), found minute by minute
+static std::vector<uint32_t> occurrences(const ScheduleRule& rule, uint32_t from, uint32_t to) {
+  std::vector<uint32_t> times;
+  for (uint32_t day = from / 86400; day <= to / 86400; day++) {
+    if (!(rule.days & (1 << ((day + 4) % 7)))) continue;
+    int32_t minute = rule.minutes;
+    if (rule.trigger != SCHEDULE_AT_TIME) {
+      int16_t sun = scheduleSunMinutes(scheduleDayOfYear(day), latitude, longitude, utcOffset, rule.trigger == SCHEDULE_AT_SUNRISE);
+      if (sun < 0) continue;
+      minute += sun;
+    }
+    uint32_t time = day * 86400 + minute * 60;
+    if (time > from && time < to) times.push_back(time);
+  }
+  return times;
+}
+
+int main() {
+  // Calendar
+  CHECK_EQUAL(scheduleDayOfYear(dayOf(2023, 12, 31)), 365);
+  CHECK_EQUAL(scheduleDayOfYear(dayOf(2024, 3, 1)), 61);
+  CHECK_EQUAL(scheduleDayOfYear(dayOf(2024, 12, 31)), 366);
+  CHECK_EQUAL(scheduleDayOfYear(dayOf(2100, 3, 1)), 60);
+  CHECK_EQUAL((dayOf(2024, 1, 1) + 4) % 7, 1);   // a Monday
+
+  // London at midsummer rises around 04:43 and sets around 21:21 summer time, the pole has no sunrise in winter
+  CHECK_NEAR(scheduleSunMinutes(scheduleDayOfYear(dayOf(2024, 6, 21)), latitude, longitude, utcOffset, true), 4 * 60 + 43, 4);
+  CHECK_NEAR(scheduleSunMinutes(scheduleDayOfYear(dayOf(2024, 6, 21)), latitude, longitude, utcOffset, false), 21 * 60 + 21, 4);
+  CHECK_EQUAL(scheduleSunMinutes(scheduleDayOfYear(dayOf(2024, 12, 21)), 78.2f, 15.6f, utcOffset, true), -1);
+
+  // A rule on a day that never comes does not occur
+  ScheduleRule never;
+  never.days = 0;
+  CHECK_EQUAL(scheduleNextOccurrence(never, dayOf(2024, 1, 1) * 86400, latitude, longitude, utcOffset), 0);
+
+  // Rules of all kinds, including two due at the same time and one due more than a lap of the wheel after another
+  std::vector<ScheduleRule> rules(SCHEDULE_MAX_RULES);
+  for (uint8_t id = 0; id < SCHEDULE_MAX_RULES; id++) {
+    rules[id].trigger = id % 3 == 0 ? SCHEDULE_AT_TIME : id % 3 == 1 ? SCHEDULE_AT_SUNRISE : SCHEDULE_AT_SUNSET;
+    rules[id].minutes = rules[id].trigger == SCHEDULE_AT_TIME ? (id * 97 + 7 * 60) % 1440 : (int16_t)(id * 5 - 40);
+    rules[id].days = id % 4 == 0 ? SCHEDULE_EVERY_DAY : (uint8_t)(0x3E >> (id % 3)) | 1;
+  }
+  rules[1].trigger = SCHEDULE_AT_TIME;
+  rules[1].minutes = rules[0].minutes;
+  rules[1].days = SCHEDULE_EVERY_DAY;
+  rules[2].trigger = SCHEDULE_AT_TIME;
+  rules[2].minutes = rules[0].minutes + 2;
+  rules[2].days = SCHEDULE_EVERY_DAY;
+
+  // Two weeks of spring, stepped a second at a time with a few long stalls and clock steps
+  uint32_t start = dayOf(2024, 3, 25) * 86400 + 12345;
+  uint32_t end = start + 14 * 86400;
+  ScheduleWheel wheel;
+  wheel.begin(start);
+  for (uint8_t id = 0; id < SCHEDULE_MAX_RULES; id++) wheel.schedule(id, scheduleNextOccurrence(rules[id], start, latitude, longitude, utcOffset));
+
+  std::vector<std::vector<uint32_t>> fired(SCHEDULE_MAX_RULES);
+  uint32_t late = 0, now = start, ticks = 0;
+  while (now < end) {
+    ticks++;
+    if (ticks % 50000 == 0) now += 300;         // a stall of five minutes
+    else if (ticks % 77777 == 0) now += 3600;   // the clock stepped by an hour
+    else now += 1;
+    wheel.advance(now, [&](uint8_t id) {
+      uint32_t due = wheel.dueTime(id);
+      fired[id].push_back(due);
+      if (now - due > late) late = now - due;
+      wheel.schedule(id, scheduleNextOccurrence(rules[id], due, latitude, longitude, utcOffset));
+    });
+  }
+
+  for (uint8_t id = 0; id < SCHEDULE_MAX_RULES; id++) {
+    std::vector<uint32_t> expected = occurrences(rules[id], start, now + 1);
+    if (fired[id] != expected) printf("rule %d fired %zu times, expected %zu\n", id, fired[id].size(), expected.size());
+    CHECK(fired[id] == expected);
+    CHECK(wheel.isScheduled(id));
+  }
+  CHECK_EQUAL(fired[0].size(), 14);
+  CHECK(late <= 3600);
+
+  // Moving and cancelling rules, a due time in the past fires on the next tick
+  wheel.begin(1000);
+  wheel.schedule(3, 1000 + SCHEDULE_WHEEL_SLOTS * 3 + 5);
+  wheel.schedule(4, 1005);
+  wheel.schedule(5, 500);
+  wheel.cancel(4);
+  std::vector<uint8_t> order;
+  for (uint32_t time = 1001; time <= 1000 + SCHEDULE_WHEEL_SLOTS * 4; time++) wheel.advance(time, [&](uint8_t id) { order.push_back(id); });
+  CHECK_EQUAL(order.size(), 2);
+  CHECK_EQUAL(order[0], 5);
+  CHECK_EQUAL(order[1], 3);
+  CHECK(!wheel.isScheduled(4));
+
+  return checkSummary("test_scheduler");
+}
@@ -0,0 +1,118 @@
+// Replays edge timings of the switch through SwitchEdgeQueue and SwitchGestureDecoder. The timings have the shape of
+// recordings of the real button: every press and release bounces for a few ms before the level settles.
+
+#include <vector>
+#include "Check.h"
+#include "SwitchGestures.h"
+
+struct Recording {
+  const char*         name;
+  std::vector<SwitchEdge> edges;
+  uint32_t            length;       // ms to keep polling after the first edge
+};
+
+// Press at pressTime for holdTime ms, with contact bounce on both edges
+static void addPress(std::vector<SwitchEdge>& edges, uint32_t pressTime, uint32_t holdTime) {
+  const SwitchEdge bounce[] = { { 0, 0 }, { 1, 1 }, { 3, 0 }, { 4, 1 }, { 6, 0 } };
+  for (const SwitchEdge& edge : bounce) edges.push_back({ pressTime + edge.time, edge.level });
+  uint32_t releaseTime = pressTime + holdTime;
+  for (const SwitchEdge& edge : bounce) edges.push_back({ releaseTime + edge.time, (uint8_t)!edge.level });
+}
+
+// Feed the edges through the queue as the interrupt and loop would and poll every ms. Returns the events decoded,
+// the repeats of LONG_PRESS_HOLD are counted into holds.
+static std::vector<SwitchEvent> replay(const Recording& recording, int& holds) {
+  SwitchEdgeQueue queue;
+  SwitchGestureDecoder decoder;
+  decoder.begin(1);
+
+  std::vector<SwitchEvent> events;
+  holds = 0;
+  size_t next = 0;
+  const uint32_t start = 100000;
+  for (uint32_t now = start; now <= start + recording.length; now++) {
+    while (next < recording.edges.size() && start + recording.edges[next].time <= now) {
+      queue.push(start + recording.edges[next].time, recording.edges[next].level);
+      next++;
+    }
+    SwitchEdge edge;
+    while (queue.pop(edge)) decoder.edge(edge.time, edge.level);
+    SwitchEvent event;
+    while ((event = decoder.poll(now)) != SWITCH_EVENT_NONE) {
+      if (event == SWITCH_EVENT_LONG_PRESS_HOLD) holds++;
+      else events.push_back(event);
+    }
+  }
+  return events;
+}
+
+static void checkEvents(const char* name, const std::vector<SwitchEvent>& events, const std::vector<SwitchEvent>& expected) {
+  CHECK_EQUAL(events.size(), expected.size());
+  for (size_t i = 0; i < events.size() && i < expected.size(); i++) {
+    if (events[i] != expected[i]) printf("%s: event %zu\n", name, i);
+    CHECK_EQUAL(events[i], expected[i]);
+  }
+}
+
+int main() {
+  int holds;
+
+  // A short press is only reported once no second press can follow
+  Recording shortPress = { "short press", {}, 1000 };
+  addPress(shortPress.edges, 0, 120);
+  checkEvents(shortPress.name, replay(shortPress, holds), { SWITCH_EVENT_SHORT_PRESS });
+  CHECK_EQUAL(holds, 0);
+
+  Recording doublePress = { "double press", {}, 1000 };
+  addPress(doublePress.edges, 0, 100);
+  addPress(doublePress.edges, 250, 100);
+  checkEvents(doublePress.name, replay(doublePress, holds), { SWITCH_EVENT_DOUBLE_PRESS });
+
+  // Two presses too far apart are two short presses
+  Recording twoPresses = { "two presses", {}, 1500 };
+  addPress(twoPresses.edges, 0, 100);
+  addPress(twoPresses.edges, 600, 100);
+  checkEvents(twoPresses.name, replay(twoPresses, holds), { SWITCH_EVENT_SHORT_PRESS, SWITCH_EVENT_SHORT_PRESS });
+
+  // The ramp repeats every holdRepeatTime from longPressTime until the release
+  Recording longPress = { "long press", {}, 2500 };
+  addPress(longPress.edges, 0, 2000);
+  checkEvents(longPress.name, replay(longPress, holds), { SWITCH_EVENT_LONG_PRESS_START, SWITCH_EVENT_LONG_PRESS_END });
+  CHECK_NEAR(holds, (2000 - 600) / 40, 1);
+
+  // Holding on stops the ramp and starts the fade
+  Recording hold = { "hold to fade", {}, 7000 };
+  addPress(hold.edges, 0, 6000);
+  checkEvents(hold.name, replay(hold, holds), { SWITCH_EVENT_LONG_PRESS_START, SWITCH_EVENT_HOLD_TO_FADE, SWITCH_EVENT_LONG_PRESS_END });
+  CHECK_NEAR(holds, (5000 - 600) / 40, 1);
+
+  // Spikes shorter than the debounce time are no press at all
+  Recording glitch = { "glitch", { { 0, 0 }, { 2, 1 }, { 300, 0 }, { 320, 1 }, { 500, 0 }, { 549, 1 } }, 1500 };
+  checkEvents(glitch.name, replay(glitch, holds), {});
+
+  // A press right after a long press starts counting presses again
+  Recording longThenShort = { "long then short", {}, 2500 };
+  addPress(longThenShort.edges, 0, 800);
+  addPress(longThenShort.edges, 900, 100);
+  checkEvents(longThenShort.name, replay(longThenShort, holds), { SWITCH_EVENT_LONG_PRESS_START, SWITCH_EVENT_LONG_PRESS_END, SWITCH_EVENT_SHORT_PRESS });
+
+  // A full queue drops the newest edges and counts them
+  SwitchEdgeQueue queue;
+  for (uint32_t i = 0; i < SWITCH_EDGE_QUEUE_SIZE + 5; i++) queue.push(i, i & 1);
+  CHECK_EQUAL(queue.dropped, 6);
+  SwitchEdge edge;
+  uint32_t popped = 0;
+  while (queue.pop(edge)) CHECK_EQUAL(edge.time, popped++);
+  CHECK_EQUAL(popped, SWITCH_EDGE_QUEUE_SIZE - 1);
+
+  // The decoder still works across the wrap of millis()
+  SwitchGestureDecoder decoder;
+  decoder.begin(1);
+  decoder.edge(0xFFFFFFF0, 0);
+  decoder.edge(0xFFFFFFF0 + 100, 1);
+  SwitchEvent event = SWITCH_EVENT_NONE;
+  for (uint32_t now = 0xFFFFFFF0; now != 1000 && event == SWITCH_EVENT_NONE; now++) event = decoder.poll(now);
+  CHECK_EQUAL(event, SWITCH_EVENT_SHORT_PRESS);
+
+  return checkSummary("test_switch_gestures");
+}
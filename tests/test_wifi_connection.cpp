@@ -0,0 +1,260 @@
+// Drives WifiConnection with a fake radio and a virtual clock: fast reconnects, stale caches, a router that is down
+// for an hour, a wrong password and the soft AP staying up while it has clients.
+
+#include "Check.h"
+#include "WifiConnection.h"
+
+class FakeWifiDriver : public WifiDriver {
+public:
+  uint32_t  now               = 0;
+  bool      routerUp          = true;
+  bool      cacheGood         = true;   // the cached access point and lease still work
+  bool      cache             = true;
+  bool      wrongPassword     = false;
+  uint32_t  fastDelay         = 300;    // time a connection takes
+  uint32_t  scanDelay         = 4000;
+  uint8_t   clients           = 0;
+
+  bool      linkUp            = false;
+  bool      attempting        = false;
+  uint32_t  linkAt            = 0;
+
+  // Calls made by the machine
+  uint32_t fastConnects = 0, connects = 0, aborts = 0, drops = 0, apStarts = 0, apStops = 0, connectedCalls = 0, lostCalls = 0;
+  bool apRunning = false;
+
+  void tick(uint32_t time) {
+    now = time;
+    if (attempting && routerUp && (int32_t)(now - linkAt) >= 0) {
+      linkUp = true;
+      attempting = false;
+    }
+    if (!routerUp) linkUp = false;
+  }
+
+  virtual bool isConnected() { return linkUp; }
+  virtual bool connectFailed() { return attempting && wrongPassword; }
+  virtual bool hasCache() { return cache; }
+  virtual void dropCache() { cache = false; drops++; }
+
+  virtual void connectFast() {
+    fastConnects++;
+    attempting = cacheGood;
+    linkAt = now + fastDelay;
+  }
+
+  virtual void connect() {
+    connects++;
+    attempting = true;
+    linkAt = now + scanDelay;
+  }
+
+  virtual void abort() { aborts++; attempting = false; linkUp = false; }
+  virtual void startAccessPoint() { apStarts++; apRunning = true; }
+  virtual void stopAccessPoint() { apStops++; apRunning = false; }
+  virtual uint8_t accessPointClients() { return clients; }
+  virtual uint32_t random(uint32_t max) { seed = seed * 1103515245 + 12345; return (seed >> 8) % max; }
+  virtual void connected() { connectedCalls++; cache = true; }
+  virtual void lost() { lostCalls++; }
+
+private:
+  uint32_t seed = 1;
+};
+
+// Poll the machine every 10 ms, as often as the main loop at least runs
+static uint32_t run(WifiConnection& connection, FakeWifiDriver& driver, uint32_t from, uint32_t duration) {
+  for (uint32_t time = from; time != from + duration; time += 10) {
+    driver.tick(time);
+    connection.update(time);
+  }
+  return from + duration;
+}
+
+int main() {
+  // Without an SSID only the soft AP runs
+  {
+    FakeWifiDriver driver;
+    WifiConnection connection;
+    connection.begin(&driver);
+    run(connection, driver, 0, 60000);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_ACCESS_POINT);
+    CHECK_EQUAL(driver.apStarts, 1);
+    CHECK_EQUAL(driver.connects + driver.fastConnects, 0);
+  }
+
+  // A good cache connects in a fraction of a second without starting the soft AP
+  {
+    FakeWifiDriver driver;
+    WifiConnection connection;
+    connection.begin(&driver);
+    connection.setStation(true);
+    run(connection, driver, 0, 2000);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_CONNECTED);
+    CHECK(connection.lastConnectWasFast);
+    CHECK_NEAR(connection.lastConnectTime, driver.fastDelay, 10);
+    CHECK_EQUAL(driver.apStarts, 0);
+    CHECK_EQUAL(driver.connectedCalls, 1);
+  }
+
+  // A stale cache is dropped after the fast timeout and a full connection follows straight away, the soft AP is
+  // stopped once its last client left
+  {
+    FakeWifiDriver driver;
+    driver.cacheGood = false;
+    driver.clients = 1;
+    WifiConnection connection;
+    connection.begin(&driver);
+    connection.setStation(true);
+    uint32_t time = run(connection, driver, 0, connection.fastConnectTimeout + 20);
+    CHECK_EQUAL(driver.drops, 1);
+    CHECK_EQUAL(driver.connects, 1);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_CONNECTING);
+    time = run(connection, driver, time, driver.scanDelay + 20);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_CONNECTED);
+    CHECK(!connection.lastConnectWasFast);
+    CHECK_NEAR(connection.lastConnectTime, connection.fastConnectTimeout + driver.scanDelay, 30);
+    CHECK(driver.apRunning);
+    time = run(connection, driver, time, 10000);
+    CHECK(driver.apRunning);
+    driver.clients = 0;
+    run(connection, driver, time, 20);
+    CHECK(!driver.apRunning);
+    CHECK_EQUAL(driver.apStarts, 1);
+    CHECK_EQUAL(driver.apStops, 1);
+  }
+
+  // A router that is down for an hour is retried with growing delays up to the maximum, with jitter
+  {
+    FakeWifiDriver driver;
+    driver.routerUp = false;
+    driver.cache = false;
+    WifiConnection connection;
+    connection.begin(&driver);
+    connection.setStation(true);
+    uint32_t delays = 0, maxDelay = 0;
+    bool withinBounds = true;
+    for (uint32_t time = 0; time < 3600000; time += 10) {
+      driver.tick(time);
+      connection.update(time);
+      if (connection.getState() == WIFI_STATE_BACKOFF && connection.nextRetryDelay() != maxDelay) {
+        uint32_t delay = connection.nextRetryDelay();
+        if (delay < connection.backoffMin / 2 || delay > connection.backoffMax) withinBounds = false;
+        maxDelay = delay;
+        delays++;
+      }
+    }
+    CHECK(withinBounds);
+    CHECK(delays > 10);
+    CHECK(maxDelay >= connection.backoffMax / 2);
+    // Most of the hour is spent waiting at the maximum, each attempt with its 20 s timeout
+    CHECK(driver.connects > 3600000 / (connection.backoffMax + connection.connectTimeout));
+    CHECK(driver.connects < 3600000 / (connection.backoffMax / 2 + connection.connectTimeout) + 10);
+    CHECK_EQUAL(connection.failures, driver.connects - (connection.getState() == WIFI_STATE_CONNECTING));
+    CHECK_EQUAL(driver.apStarts, 1);
+
+    // Once the router is back the next attempt connects and the backoff starts from the minimum again
+    driver.routerUp = true;
+    uint32_t time = run(connection, driver, 3600000, connection.backoffMax + connection.connectTimeout);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_CONNECTED);
+    driver.routerUp = false;
+    driver.cache = false;
+    time = run(connection, driver, time, connection.connectTimeout + 20);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_BACKOFF);
+    CHECK(connection.nextRetryDelay() <= connection.backoffMin);
+  }
+
+  // A wrong password fails at once instead of waiting for the timeout
+  {
+    FakeWifiDriver driver;
+    driver.cache = false;
+    driver.wrongPassword = true;
+    WifiConnection connection;
+    connection.begin(&driver);
+    connection.setStation(true);
+    run(connection, driver, 0, 50);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_BACKOFF);
+    CHECK_EQUAL(connection.failures, 1);
+    CHECK_EQUAL(driver.aborts, 1);
+  }
+
+  // A lost connection is noticed and the cache tried first
+  {
+    FakeWifiDriver driver;
+    WifiConnection connection;
+    connection.begin(&driver);
+    connection.setStation(true);
+    uint32_t time = run(connection, driver, 0, 1000);
+    driver.linkUp = false;
+    time = run(connection, driver, time, 20);
+    CHECK_EQUAL(driver.lostCalls, 1);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_FAST_CONNECT);
+    run(connection, driver, time, 1000);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_CONNECTED);
+    CHECK_EQUAL(driver.fastConnects, 2);
+  }
+
+  // Clearing the SSID while connecting stops the attempt and falls back to the soft AP
+  {
+    FakeWifiDriver driver;
+    driver.cache = false;
+    WifiConnection connection;
+    connection.begin(&driver);
+    connection.setStation(true);
+    uint32_t time = run(connection, driver, 0, 1000);
+    connection.setStation(false);
+    run(connection, driver, time, 100);
+    CHECK_EQUAL(driver.aborts, 1);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_ACCESS_POINT);
+    CHECK(driver.apRunning);
+  }
+
+  // New credentials while retrying the old ones stop the attempt and start over at once with the shortest backoff,
+  // and while connected they leave the old network
+  {
+    FakeWifiDriver driver;
+    driver.cache = false;
+    driver.wrongPassword = true;
+    WifiConnection connection;
+    connection.begin(&driver);
+    connection.setStation(true, 1);
+    uint32_t time = run(connection, driver, 0, 600000);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_BACKOFF);
+    CHECK(connection.nextRetryDelay() >= connection.backoffMax / 2);
+    uint32_t connects = driver.connects;
+    driver.wrongPassword = false;
+    connection.setStation(true, 1);
+    time = run(connection, driver, time, 1000);
+    CHECK_EQUAL(driver.connects, connects);
+    connection.setStation(true, 2);
+    time = run(connection, driver, time, 20);
+    CHECK_EQUAL(driver.connects, connects + 1);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_CONNECTING);
+    time = run(connection, driver, time, driver.scanDelay + 20);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_CONNECTED);
+
+    uint32_t aborts = driver.aborts;
+    connection.setStation(true, 3);
+    time = run(connection, driver, time, 20);
+    CHECK_EQUAL(driver.aborts, aborts + 1);
+    CHECK_EQUAL(driver.connectedCalls, 1);
+    driver.wrongPassword = true;
+    run(connection, driver, time, 50);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_BACKOFF);
+    CHECK(connection.nextRetryDelay() <= connection.backoffMin);
+  }
+
+  // The timeouts still work across the wrap of millis()
+  {
+    FakeWifiDriver driver;
+    driver.cacheGood = false;
+    driver.routerUp = false;
+    WifiConnection connection;
+    connection.begin(&driver);
+    connection.setStation(true);
+    run(connection, driver, 0xFFFFFFFF - 1000 + 1, connection.fastConnectTimeout + 20);
+    CHECK_EQUAL(driver.drops, 1);
+    CHECK_EQUAL(connection.getState(), WIFI_STATE_CONNECTING);
+  }
+
+  return checkSummary("test_wifi_connection");
+}